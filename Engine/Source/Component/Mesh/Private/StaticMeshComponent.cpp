@@ -5,6 +5,7 @@
 #include "Manager/Asset/Public/ObjManager.h"
 #include "Manager/Asset/Public/AssetManager.h"
 #include "Physics/Public/AABB.h"
+#include "Level/Public/Level.h"
 #include "Render/UI/Widget/Public/StaticMeshComponentWidget.h"
 #include "Utility/Public/JsonSerializer.h"
 #include "Texture/Public/Texture.h"
@@ -116,6 +117,10 @@ void UStaticMeshComponent::SetStaticMesh(const FName& InObjPath)
 		RenderState.FillMode = EFillMode::Solid;
 		BoundingBox = &AssetManager.GetStaticMeshAABB(InObjPath);
 		MarkAsDirty();
+		if (GWorld && GWorld->GetLevel())
+		{
+			GWorld->GetLevel()->MarkSceneDirty();
+		}
 	}
 }
 
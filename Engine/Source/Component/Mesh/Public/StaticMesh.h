@@ -3,6 +3,8 @@
 #include "Core/Public/Object.h"       // UObject 기반 클래스 및 매크로
 #include "Global/CoreTypes.h"        // TArray 등
 #include "Global/BVH.h"
+#include "Optimization/Public/OccluderProxy.h"
+#include "Core/Public/Archive.h"
 
 // 전방 선언: FStaticMesh의 전체 정의를 포함할 필요 없이 포인터만 사용
 struct FMeshSection
@@ -33,8 +35,55 @@ struct FStaticMesh
 	// --- 3. 연결 정보 (Sections) ---
 	// 각 재질을 어떤 기하 구간에 칠할지에 대한 지시서
 	TArray<FMeshSection> Sections;
+
+	// --- 4. 오클루더 프록시 (Occluder Proxy) ---
+	// 임포트 시 생성되는 소프트웨어 오클루전 컬링용 저폴리 메시. Type이 None이면 이 메시는 오클루더로 쓰이지 않는다
+	FOccluderProxy OccluderProxy;
 };
 
+inline FArchive& operator<<(FArchive& Ar, FMaterial& Material)
+{
+	Ar << Material.Name;
+	Ar << Material.Ka;
+	Ar << Material.Kd;
+	Ar << Material.Ks;
+	Ar << Material.Ke;
+	Ar << Material.Ns;
+	Ar << Material.Ni;
+	Ar << Material.D;
+	Ar << Material.Illumination;
+	Ar << Material.KaMap;
+	Ar << Material.KdMap;
+	Ar << Material.KsMap;
+	Ar << Material.NsMap;
+	Ar << Material.DMap;
+	Ar << Material.BumpMap;
+	return Ar;
+}
+
+inline FArchive& operator<<(FArchive& Ar, FOccluderProxy& OccluderProxy)
+{
+	Ar << OccluderProxy.Type;
+	Ar << OccluderProxy.Vertices;
+	Ar << OccluderProxy.Indices;
+	return Ar;
+}
+
+/**
+ * @brief 쿠킹된 메시 캐시(.meshbin)의 본문. 정점 병합/탄젠트 계산이 끝난 정점과 인덱스, 재질, 섹션, 오클루더 프록시, BVH를 담는다.
+ * PathFileName은 런타임 이름 테이블 인덱스이므로 저장하지 않는다.
+ */
+inline FArchive& operator<<(FArchive& Ar, FStaticMesh& StaticMesh)
+{
+	Ar << StaticMesh.Vertices;
+	Ar << StaticMesh.Indices;
+	Ar << StaticMesh.MaterialInfo;
+	Ar << StaticMesh.Sections;
+	Ar << StaticMesh.OccluderProxy;
+	StaticMesh.BVH.Serialize(Ar, &StaticMesh);
+	return Ar;
+}
+
 
 /**
  * @brief FStaticMesh(Cooked Data)를 엔진 오브젝트 시스템에 통합하는 래퍼 클래스.
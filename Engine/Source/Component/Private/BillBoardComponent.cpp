@@ -81,7 +81,16 @@ void UBillBoardComponent::FaceCamera(const FVector& CameraForward)
     FMatrix RotationMatrix = FMatrix(Forward, Right, Up);
     
     // Convert the rotation matrix to a quaternion and set the relative rotation
-    SetWorldRotation(FQuaternion::FromRotationMatrix(RotationMatrix));
+    // 카메라마다 매 프레임 바뀌는 회전이므로 옥트리/씬 리비전은 갱신하지 않는다
+    const FQuaternion WorldRotation = FQuaternion::FromRotationMatrix(RotationMatrix);
+    if (USceneComponent* Parent = GetAttachParent())
+    {
+        SetRelativeRotationForView(WorldRotation * Parent->GetWorldRotationAsQuaternion().Inverse());
+    }
+    else
+    {
+        SetRelativeRotationForView(WorldRotation);
+    }
 }
 
 UTexture* UBillBoardComponent::GetSprite() const
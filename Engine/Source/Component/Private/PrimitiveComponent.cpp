@@ -4,6 +4,7 @@
 #include "Manager/Asset/Public/AssetManager.h"
 #include "Physics/Public/AABB.h"
 #include "Physics/Public/OBB.h"
+#include "Level/Public/Level.h"
 #include "Utility/Public/JsonSerializer.h"
 
 IMPLEMENT_ABSTRACT_CLASS(UPrimitiveComponent, USceneComponent)
@@ -146,6 +147,35 @@ void UPrimitiveComponent::MarkAsDirty()
 	Super::MarkAsDirty();
 }
 
+void UPrimitiveComponent::SetVisibility(bool bVisibility)
+{
+	if (bVisible == bVisibility) { return; }
+
+	bVisible = bVisibility;
+	if (GWorld && GWorld->GetLevel())
+	{
+		GWorld->GetLevel()->MarkSceneDirty();
+	}
+}
+
+void UPrimitiveComponent::SetMinScreenSize(float InMinScreenSize)
+{
+	MinScreenSize = InMinScreenSize;
+	if (GWorld && GWorld->GetLevel())
+	{
+		GWorld->GetLevel()->MarkSceneDirty();
+	}
+}
+
+void UPrimitiveComponent::SetMaxDrawDistance(float InMaxDrawDistance)
+{
+	MaxDrawDistance = InMaxDrawDistance;
+	if (GWorld && GWorld->GetLevel())
+	{
+		GWorld->GetLevel()->MarkSceneDirty();
+	}
+}
+
 
 UObject* UPrimitiveComponent::Duplicate()
 {
@@ -156,6 +186,9 @@ UObject* UPrimitiveComponent::Duplicate()
 	PrimitiveComponent->RenderState = RenderState;
 	PrimitiveComponent->bVisible = bVisible;
 	PrimitiveComponent->bReceivesDecals = bReceivesDecals;
+	PrimitiveComponent->Mobility = Mobility;
+	PrimitiveComponent->MinScreenSize = MinScreenSize;
+	PrimitiveComponent->MaxDrawDistance = MaxDrawDistance;
 
 	PrimitiveComponent->Vertices = Vertices;
 	PrimitiveComponent->Indices = Indices;
@@ -186,10 +219,21 @@ void UPrimitiveComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 		FString VisibleString;
 		FJsonSerializer::ReadString(InOutHandle, "bVisible", VisibleString, "true");
 		SetVisibility(VisibleString == "true");
+
+		// 이전 씬 파일에는 없는 값이므로 기본값으로 조용히 채운다
+		FJsonSerializer::ReadFloat(InOutHandle, "MinScreenSize", MinScreenSize, -1.0f, false);
+		FJsonSerializer::ReadFloat(InOutHandle, "MaxDrawDistance", MaxDrawDistance, 0.0f, false);
+
+		FString MobilityString;
+		FJsonSerializer::ReadString(InOutHandle, "Mobility", MobilityString, "Static", false);
+		Mobility = StringToEnum<EComponentMobility>(MobilityString).value_or(EComponentMobility::Static);
 	}
 	else
 	{
 		InOutHandle["bVisible"] = bVisible ? "true" : "false";
+		InOutHandle["MinScreenSize"] = MinScreenSize;
+		InOutHandle["MaxDrawDistance"] = MaxDrawDistance;
+		InOutHandle["Mobility"] = EnumToString(Mobility);
 	}
 
 }
\ No newline at end of file
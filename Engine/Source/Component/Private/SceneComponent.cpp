@@ -58,6 +58,10 @@ void USceneComponent::AttachToComponent(USceneComponent* Parent, bool bRemainTra
 	Parent->AttachChildren.push_back(this);
 
 	MarkAsDirty();
+	if (GWorld && GWorld->GetLevel())
+	{
+		GWorld->GetLevel()->MarkSceneDirty();
+	}
 }
 
 void USceneComponent::DetachFromComponent()
@@ -66,6 +70,12 @@ void USceneComponent::DetachFromComponent()
 	{
 		AttachParent->DetachChild(this);
 		AttachParent = nullptr;
+
+		MarkAsDirty();
+		if (GWorld && GWorld->GetLevel())
+		{
+			GWorld->GetLevel()->MarkSceneDirty();
+		}
 	}
 }
 
@@ -104,32 +114,40 @@ void USceneComponent::SetRelativeLocation(const FVector& Location)
 {
 	RelativeLocation = Location;
 	MarkAsDirty();
-
-	if (auto PrimitiveComponent = Cast<UPrimitiveComponent>(this))
-	{
-		GWorld->GetLevel()->UpdatePrimitiveInOctree(PrimitiveComponent);
-	}
+	OnTransformChanged();
 }
 
 void USceneComponent::SetRelativeRotation(const FQuaternion& Rotation)
 {
 	RelativeRotation = Rotation;
 	MarkAsDirty();
-
-	if (auto PrimitiveComponent = Cast<UPrimitiveComponent>(this))
-	{
-		GWorld->GetLevel()->UpdatePrimitiveInOctree(PrimitiveComponent);
-	}
+	OnTransformChanged();
 }
 
 void USceneComponent::SetRelativeScale3D(const FVector& Scale)
 {
 	RelativeScale3D = Scale;
 	MarkAsDirty();
+	OnTransformChanged();
+}
+
+void USceneComponent::SetRelativeRotationForView(const FQuaternion& Rotation)
+{
+	RelativeRotation = Rotation;
+	MarkAsDirty();
+}
+
+void USceneComponent::OnTransformChanged()
+{
+	ULevel* Level = GWorld ? GWorld->GetLevel() : nullptr;
+	if (!Level) { return; }
+
+	// 붙어 있는 자식도 함께 움직이므로 프리미티브가 아니어도 씬 리비전을 올린다
+	Level->MarkSceneDirty();
 
 	if (auto PrimitiveComponent = Cast<UPrimitiveComponent>(this))
 	{
-		GWorld->GetLevel()->UpdatePrimitiveInOctree(PrimitiveComponent);
+		Level->UpdatePrimitiveInOctree(PrimitiveComponent);
 	}
 }
 
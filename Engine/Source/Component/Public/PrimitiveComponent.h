@@ -2,6 +2,9 @@
 #include "Component/Public/SceneComponent.h"
 #include "Physics/Public/BoundingVolume.h"
 
+class FOctree;
+class FDynamicAABBTree;
+
 UCLASS()
 class UPrimitiveComponent : public USceneComponent
 {
@@ -29,10 +32,21 @@ public:
 	//void Render(const URenderer& Renderer) const override;
 
 	bool IsVisible() const { return bVisible; }
-	void SetVisibility(bool bVisibility) { bVisible = bVisibility; }
+	void SetVisibility(bool bVisibility);
 	
 	bool CanPick() const { return bCanPick; }
 	void SetCanPick(bool bInCanPick) { bCanPick = bInCanPick; }
+
+	/** @brief 씬 쿼리 채널(EQueryObjectType). 옮겨져 DynamicTree로 넘어가거나 BuildStaticOctree로 되돌아가도 바뀌지 않는다 */
+	EComponentMobility GetMobility() const { return Mobility; }
+	void SetMobility(EComponentMobility InMobility) { Mobility = InMobility; }
+
+	/** @brief 이보다 작게 투영되면(지름, 픽셀) 그리지 않는다. 음수면 FContributionCuller의 기본값, 0이면 크기로 컬링하지 않는다 */
+	float GetMinScreenSize() const { return MinScreenSize; }
+	void SetMinScreenSize(float InMinScreenSize);
+	/** @brief 카메라로부터 이보다 멀면 그리지 않는다. 0 이하면 제한 없음 */
+	float GetMaxDrawDistance() const { return MaxDrawDistance; }
+	void SetMaxDrawDistance(float InMaxDrawDistance);
 	
 
 	FVector4 GetColor() const { return Color; }
@@ -46,9 +60,10 @@ public:
 	// 데칼에 덮일 수 있는가
 	bool bReceivesDecals = true;
 
-	// 다른 곳에서 사용할 인덱스
-	mutable int32 CachedAABBIndex = -1;
-	mutable uint32 CachedFrame = 0;
+	/** @brief 이 프리미티브를 보관 중인 옥트리 노드를 반환한다. 옥트리에 없다면 nullptr */
+	FOctree* GetOctreeNode() const { return OctreeNode; }
+	/** @brief 이 프리미티브가 동적 AABB 트리에 들어있다면 리프 노드 인덱스, 아니라면 -1 */
+	int32 GetDynamicTreeProxy() const { return DynamicTreeProxy; }
 
 protected:
 	const TArray<FNormalVertex>* Vertices = nullptr;
@@ -67,6 +82,10 @@ protected:
 
 	bool bVisible = true;
 	bool bCanPick = true;
+	EComponentMobility Mobility = EComponentMobility::Static;
+
+	float MinScreenSize = -1.0f;
+	float MaxDrawDistance = 0.0f;
 
 	IBoundingVolume* BoundingBox = nullptr;
 	bool bOwnsBoundingBox = false;
@@ -80,4 +99,15 @@ public:
 
 protected:
 	virtual void DuplicateSubObjects(UObject* DuplicatedObject) override;
+
+private:
+	friend class FOctree;
+	friend class FDynamicAABBTree;
+
+	// FOctree가 관리하는 역참조: 소속 노드와 그 노드의 Primitives 배열 인덱스 (Duplicate 시 복사하지 않음)
+	FOctree* OctreeNode = nullptr;
+	int32 OctreeSlot = -1;
+
+	// FDynamicAABBTree가 관리하는 역참조: 리프 노드 인덱스
+	int32 DynamicTreeProxy = -1;
 };
@@ -43,7 +43,17 @@ public:
     void SetWorldRotation(const FQuaternion& NewRotation);
     void SetWorldScale3D(const FVector& NewScale);
 
+protected:
+	/**
+	 * @brief 옥트리와 씬 리비전을 갱신하지 않고 상대 회전만 바꾼다.
+	 * 빌보드처럼 그리는 카메라를 따라 매 프레임 바뀌는 회전에 쓴다. 카메라가 바뀌면 렌더러의 가시 목록 캐시는 어차피 다시 만들어진다.
+	 */
+	void SetRelativeRotationForView(const FQuaternion& Rotation);
+
 private:
+	/** @brief 트랜스폼 변경을 레벨에 알린다. 씬 리비전을 올리고, 프리미티브라면 옥트리 위치를 갱신한다 */
+	void OnTransformChanged();
+
 	mutable bool bIsTransformDirty = true;
 	mutable bool bIsTransformDirtyInverse = true;
 	mutable FMatrix WorldTransformMatrix;
@@ -17,6 +17,9 @@
 #include "Render/UI/Overlay/Public/StatOverlay.h"
 #include "Utility/Public/ScopeCycleCounter.h"
 #include "Manager/UI/Public/ViewportManager.h"
+#include "Optimization/Public/PotentiallyVisibleSet.h"
+
+#include <iomanip>
 
 #ifdef IS_OBJ_VIEWER
 #include "Utility/Public/FileDialog.h"
@@ -31,11 +34,12 @@ FClientApp::~FClientApp() = default;
  *
  * @param InInstanceHandle Process Instance Handle
  * @param InCmdShow Window Display Method
+ * @param InCommandLine Command Line Arguments (-BakePVS 지원)
  *
  *
  * @return Program Termination Code
  */
-int FClientApp::Run(HINSTANCE InInstanceHandle, int InCmdShow)
+int FClientApp::Run(HINSTANCE InInstanceHandle, int InCmdShow, const char* InCommandLine)
 {
 	// Memory Leak Detection & Report
 #ifdef _DEBUG
@@ -43,9 +47,14 @@ int FClientApp::Run(HINSTANCE InInstanceHandle, int InCmdShow)
 	_CrtSetBreakAlloc(0);
 #endif
 
+	// 명령줄 PVS 베이크는 창을 띄우지 않는다
+	FString PVSBakeLevelPath;
+	FPVSBakeSettings PVSBakeSettings;
+	const bool bIsPVSBake = ParsePVSBakeCommandLine(InCommandLine, PVSBakeLevelPath, PVSBakeSettings);
+
 	// Window Object Initialize
 	Window = new FAppWindow(this);
-	if (!Window->Init(InInstanceHandle, InCmdShow))
+	if (!Window->Init(InInstanceHandle, bIsPVSBake ? SW_HIDE : InCmdShow))
 	{
 		assert(!"Window Creation Failed");
 		return 0;
@@ -67,6 +76,14 @@ int FClientApp::Run(HINSTANCE InInstanceHandle, int InCmdShow)
 		return 0;
 	}
 
+	// PVS 베이크만 하고 종료 (메시 에셋 로드에 렌더러가 필요하므로 시스템 초기화는 그대로 한다)
+	if (bIsPVSBake)
+	{
+		const bool bSuccess = GEditor->BakeLevelPVS(PVSBakeLevelPath, PVSBakeSettings);
+		ShutdownSystem();
+		return bSuccess ? 0 : 1;
+	}
+
 	// Execute Main Loop
 	MainLoop();
 
@@ -76,6 +93,35 @@ int FClientApp::Run(HINSTANCE InInstanceHandle, int InCmdShow)
 	return static_cast<int>(MainMessage.wParam);
 }
 
+bool FClientApp::ParsePVSBakeCommandLine(const char* InCommandLine, FString& OutLevelPath, FPVSBakeSettings& OutSettings)
+{
+	if (!InCommandLine)
+	{
+		return false;
+	}
+
+	// 공백이 들어간 경로는 따옴표로 감싸서 넘긴다
+	std::istringstream Stream(InCommandLine);
+	bool bIsPVSBake = false;
+	FString Token;
+	while (Stream >> std::quoted(Token))
+	{
+		if (_stricmp(Token.c_str(), "-BakePVS") == 0)
+		{
+			bIsPVSBake = static_cast<bool>(Stream >> std::quoted(OutLevelPath));
+		}
+		else if (_strnicmp(Token.c_str(), "-PVSCellSize=", 13) == 0)
+		{
+			const float CellSize = static_cast<float>(atof(Token.c_str() + 13));
+			if (CellSize > 0.0f)
+			{
+				OutSettings.CellSize = CellSize;
+			}
+		}
+	}
+	return bIsPVSBake;
+}
+
 /**
  * @brief Initialize System For Game Execution
  */
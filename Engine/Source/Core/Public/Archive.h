@@ -1,10 +1,30 @@
 #pragma once
 
+#include <cstring>
 #include <type_traits>
 
 #include "Global/CoreTypes.h"
 #include "Global/Vector.h"
 
+/**
+ * @brief TArray<T>를 원소별 호출 없이 메모리 그대로 한 번에 읽고 쓸 수 있는지 여부.
+ * 원소별 직렬화 결과가 메모리 표현과 같은 단순 값 타입만 켠다. 벡터와 정점은 패딩이 끼면 파일 형식이 달라지므로 크기까지 확인한다.
+ */
+template<typename T>
+struct TCanBulkSerialize
+{
+	static constexpr bool Value = std::is_trivially_copyable_v<T> && !std::is_same_v<T, bool>;
+};
+
+template<> struct TCanBulkSerialize<FVector> { static constexpr bool Value = std::is_trivially_copyable_v<FVector> && sizeof(FVector) == sizeof(float) * 3; };
+template<> struct TCanBulkSerialize<FVector2> { static constexpr bool Value = std::is_trivially_copyable_v<FVector2> && sizeof(FVector2) == sizeof(float) * 2; };
+template<> struct TCanBulkSerialize<FVector4> { static constexpr bool Value = std::is_trivially_copyable_v<FVector4> && sizeof(FVector4) == sizeof(float) * 4; };
+template<> struct TCanBulkSerialize<FNormalVertex>
+{
+	static constexpr bool Value = std::is_trivially_copyable_v<FNormalVertex>
+		&& sizeof(FNormalVertex) == sizeof(FVector) * 2 + sizeof(FVector4) * 2 + sizeof(FVector2);
+};
+
 struct FArchive
 {
 	virtual ~FArchive() = default;
@@ -31,9 +51,20 @@ struct FArchive
 			Value.resize(Length);
 		}
 
-		for (T& Element : Value)
+		// 단순 값 배열은 최종 배열 메모리로 바로 한 번에 읽고 쓴다
+		if constexpr (TCanBulkSerialize<T>::Value)
 		{
-			*this << Element;
+			if (Length > 0)
+			{
+				Serialize(Value.data(), Length * sizeof(T));
+			}
+		}
+		else
+		{
+			for (T& Element : Value)
+			{
+				*this << Element;
+			}
 		}
 
 		return *this;
@@ -57,3 +88,34 @@ struct FArchive
 		return *this;
 	}
 };
+
+/**
+ * @brief 정점을 패딩 없이 멤버 순서대로 직렬화한다.
+ * FVector4가 16바이트 정렬이라 FNormalVertex 메모리에는 패딩이 끼므로(TCanBulkSerialize가 false), 멤버를 한 버퍼에 모아 정점마다 한 번만 Serialize한다.
+ */
+inline FArchive& operator<<(FArchive& Ar, FNormalVertex& Vertex)
+{
+	struct FMember { void* Data; size_t Size; };
+	const FMember Members[] =
+	{
+		{ &Vertex.Position, sizeof(FVector) }, { &Vertex.Normal, sizeof(FVector) }, { &Vertex.Color, sizeof(FVector4) },
+		{ &Vertex.TexCoord, sizeof(FVector2) }, { &Vertex.Tangent, sizeof(FVector4) },
+	};
+	static_assert(TCanBulkSerialize<FVector>::Value && TCanBulkSerialize<FVector2>::Value && TCanBulkSerialize<FVector4>::Value,
+		"정점 멤버는 float만 담은 벡터여야 합니다");
+
+	uint8 Packed[sizeof(FVector) * 2 + sizeof(FVector4) * 2 + sizeof(FVector2)];
+	size_t Offset = 0;
+	if (!Ar.IsLoading())
+	{
+		for (const FMember& Member : Members) { memcpy(Packed + Offset, Member.Data, Member.Size); Offset += Member.Size; }
+	}
+
+	Ar.Serialize(Packed, sizeof(Packed));
+
+	if (Ar.IsLoading())
+	{
+		for (const FMember& Member : Members) { memcpy(Member.Data, Packed + Offset, Member.Size); Offset += Member.Size; }
+	}
+	return Ar;
+}
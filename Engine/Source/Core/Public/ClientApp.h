@@ -2,6 +2,7 @@
 
 //class UEditor;
 class FAppWindow;
+struct FPVSBakeSettings;
 
 /**
  * @brief Main Client Class
@@ -14,7 +15,10 @@ class FAppWindow;
 class FClientApp
 {
 public:
-    int Run(HINSTANCE InInstanceHandle, int InCmdShow);
+    /**
+     * @param InCommandLine "-BakePVS <레벨 경로> [-PVSCellSize=<크기>]"가 주어지면 창을 숨긴 채 PVS만 굽고 종료한다
+     */
+    int Run(HINSTANCE InInstanceHandle, int InCmdShow, const char* InCommandLine = nullptr);
 
     // Special Member Function
     FClientApp();
@@ -26,6 +30,9 @@ private:
     void MainLoop();
 	void ShutdownSystem() const;
 
+	/** @return 명령줄에 -BakePVS가 있으면 true */
+	static bool ParsePVSBakeCommandLine(const char* InCommandLine, FString& OutLevelPath, FPVSBakeSettings& OutSettings);
+
     HACCEL AcceleratorTable;
     MSG MainMessage;
     FAppWindow* Window;
@@ -27,6 +27,8 @@ struct FWindowsBinReader : public FArchive
 	}
 
 	bool IsLoading() const override { return true; }
+	/** @brief 파일을 열었고 지금까지의 읽기가 모두 성공했는지 (잘린 캐시 파일 판별용) */
+	bool IsValid() const { return static_cast<bool>(Stream); }
 
 	void Serialize(void* V, size_t Length) override
 	{
@@ -119,17 +119,7 @@ void UCamera::Update(const D3D11_VIEWPORT& InViewport)
 		break;
 	}
 
-	// 카메라가 업데이트할 때마다 Cull한다.
-	// 카메라가 업데이트하지 않으면 Culling을 갱신할 이유가 없다.
-    ULevel* CurrentLevel = GWorld->GetLevel();
-    if (CurrentLevel)
-    {
-        ViewVolumeCuller.Cull(
-            CurrentLevel->GetStaticOctree(),
-            CurrentLevel->GetDynamicPrimitives(),
-            CameraConstants
-        );
-    }
+	// 절두체 컬링은 URenderer가 모든 뷰포트의 카메라를 갱신한 뒤 FMultiViewCuller로 한 번에 처리한다
 }
 
 void UCamera::UpdateMatrixByPers()
@@ -364,6 +354,30 @@ FRay UCamera::ConvertToWorldRay(float NdcX, float NdcY) const
 	return Ray;
 }
 
+bool UCamera::GetSubFrustum(float InNdcMinX, float InNdcMinY, float InNdcMaxX, float InNdcMaxY, FFrustum& OutFrustum) const
+{
+	const float Width = InNdcMaxX - InNdcMinX;
+	const float Height = InNdcMaxY - InNdcMinY;
+	if (!(Width > MATH_EPSILON) || !(Height > MATH_EPSILON))
+	{
+		return false;
+	}
+
+	/* *
+	 * @brief 클립 공간에서 x' = (2x - (MinX + MaxX) * w) / Width (y도 같다)
+	 * row-major 기준 clip * Remap 이므로 w 성분(3행)에 이동량을 둔다.
+	 */
+	FMatrix Remap = FMatrix::Identity();
+	Remap.Data[0][0] = 2.0f / Width;
+	Remap.Data[1][1] = 2.0f / Height;
+	Remap.Data[3][0] = -(InNdcMinX + InNdcMaxX) / Width;
+	Remap.Data[3][1] = -(InNdcMinY + InNdcMaxY) / Height;
+
+	FCameraConstants SubConstants = CameraConstants;
+	SubConstants.Projection = CameraConstants.Projection * Remap;
+	return OutFrustum.SetFromViewProjection(SubConstants);
+}
+
 FVector UCamera::CalculatePlaneNormal(const FVector4& Axis)
 {
 	return FVector(Axis.X, Axis.Y, Axis.Z).Cross(Forward);
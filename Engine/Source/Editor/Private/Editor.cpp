@@ -259,43 +259,63 @@ void UEditor::ProcessMouseInput()
 	}
 	else
 	{
+		// 클릭한 프레임은 기즈모와 프리미티브 피킹을 하나의 경로로 보고 합친 시간을 Picking 통계에 기록한다
+		const bool bPickRequested = !ImGui::GetIO().WantCaptureMouse && InputManager.IsKeyPressed(EKeyInput::MouseLeft);
+		FScopeCycleCounter PickCounter(bPickRequested ? TStatId("Picking") : TStatId());
+
+		// 입력은 프레임마다 한 번 읽으므로 마우스를 빠르게 움직여도 피킹은 프레임당 한 번이고,
+		// 카메라/마우스 픽셀/씬이 지난 피킹과 같으면 그마저 건너뛴다
+		ULevel* CurrentLevel = GWorld->GetLevel();
+		FPickCacheKey PickKey;
+		PickKey.View = CurrentCamera->GetFViewProjConstants().View;
+		PickKey.Projection = CurrentCamera->GetFViewProjConstants().Projection;
+		PickKey.ViewportX = ViewportInfo.TopLeftX;
+		PickKey.ViewportY = ViewportInfo.TopLeftY;
+		PickKey.ViewportWidth = ViewportInfo.Width;
+		PickKey.ViewportHeight = ViewportInfo.Height;
+		PickKey.MouseX = static_cast<int32>(floorf(MousePos.X));
+		PickKey.MouseY = static_cast<int32>(floorf(MousePos.Y));
+		PickKey.SceneRevision = CurrentLevel ? CurrentLevel->GetSceneRevision() : 0;
+		PickKey.ShowFlags = CurrentLevel ? CurrentLevel->GetShowFlags() : 0;
+
 		if (GetSelectedActor() && Gizmo.HasComponent())
 		{
-			ObjectPicker.PickGizmo(CurrentCamera, WorldRay, Gizmo, CollisionPoint);
+			ObjectPicker.PickGizmoCached(CurrentCamera, PickKey, WorldRay, Gizmo, CollisionPoint, bPickRequested);
 		}
 		else
 		{
 			Gizmo.SetGizmoDirection(EGizmoDirection::None);
 		}
 
-		if (!ImGui::GetIO().WantCaptureMouse && InputManager.IsKeyPressed(EKeyInput::MouseLeft))
+		if (bPickRequested)
 		{
-			if (GWorld->GetLevel()->GetShowFlags())
+			// 기즈모는 메시 위에 그려지므로 축을 맞혔다면 가장 가까운 충돌이 이미 정해진 것이라 프리미티브는 검사하지 않는다.
+			// 씬이 바뀐 뒤 첫 피킹이면 TLAS 재구축 시간도 함께 측정된다
+			if (Gizmo.GetGizmoDirection() == EGizmoDirection::None && CurrentLevel && CurrentLevel->GetShowFlags())
 			{
-				TArray<UPrimitiveComponent*> Candidate;
-
-				ULevel* CurrentLevel = GWorld->GetLevel();
-				ObjectPicker.FindCandidateFromOctree(CurrentLevel->GetStaticOctree(), WorldRay, Candidate);
-
-				TArray<UPrimitiveComponent*>& DynamicCandidates = CurrentLevel->GetDynamicPrimitives();
-				if (!DynamicCandidates.empty())
-				{
-					Candidate.insert(Candidate.end(), DynamicCandidates.begin(), DynamicCandidates.end());
-				}
-				
-
-				TStatId StatId("Picking");
-				FScopeCycleCounter PickCounter(StatId);
-				UPrimitiveComponent* PrimitiveCollided = ObjectPicker.PickPrimitive(CurrentCamera, WorldRay, Candidate, &ActorDistance);
+				UPrimitiveComponent* PrimitiveCollided = ObjectPicker.PickPrimitiveCached(CurrentCamera, PickKey, WorldRay, CurrentLevel, &ActorDistance);
 				ActorPicked = PrimitiveCollided ? PrimitiveCollided->GetOwner() : nullptr;
-				float ElapsedMs = PickCounter.Finish(); // 피킹 시간 측정 종료
-				UStatOverlay::GetInstance().RecordPickingStats(ElapsedMs);
+			}
+			float ElapsedMs = static_cast<float>(PickCounter.Finish()); // 피킹 시간 측정 종료
+			UStatOverlay::GetInstance().RecordPickingStats(ElapsedMs);
+
+			// 빈 곳이나 액터를 누르면 마퀴 드래그 추적을 시작한다. 끌지 않고 놓으면 위의 클릭 피킹 결과가 그대로 남는다
+			if (Gizmo.GetGizmoDirection() == EGizmoDirection::None)
+			{
+				bMarqueePressed = true;
+				bMarqueeActive = false;
+				MarqueeStart = FVector2(MousePos.X, MousePos.Y);
+				MarqueeEnd = MarqueeStart;
 			}
 		}
 
 		if (Gizmo.GetGizmoDirection() == EGizmoDirection::None)
 		{
-			SelectActor(ActorPicked);
+			// 클릭한 프레임에만 선택을 바꾼다 (마퀴로 여러 액터를 선택한 상태를 다음 프레임에 덮어쓰지 않도록)
+			if (bPickRequested)
+			{
+				SelectActor(ActorPicked);
+			}
 			if (PreviousGizmoDirection != EGizmoDirection::None)
 			{
 				Gizmo.OnMouseRelease(PreviousGizmoDirection);
@@ -314,6 +334,90 @@ void UEditor::ProcessMouseInput()
 			}
 		}
 	}
+
+	UpdateMarqueeSelection(CurrentCamera, ViewportInfo, MousePos);
+}
+
+void UEditor::UpdateMarqueeSelection(UCamera* InActiveCamera, const D3D11_VIEWPORT& InViewportInfo, const FVector& InMousePosition)
+{
+	if (!bMarqueePressed) { return; }
+
+	// 사각형은 드래그를 시작한 뷰포트 안으로 자른다
+	MarqueeEnd.X = std::clamp(InMousePosition.X, InViewportInfo.TopLeftX, InViewportInfo.TopLeftX + InViewportInfo.Width);
+	MarqueeEnd.Y = std::clamp(InMousePosition.Y, InViewportInfo.TopLeftY, InViewportInfo.TopLeftY + InViewportInfo.Height);
+	if (!bMarqueeActive)
+	{
+		bMarqueeActive = fabsf(MarqueeEnd.X - MarqueeStart.X) >= MARQUEE_DRAG_THRESHOLD || fabsf(MarqueeEnd.Y - MarqueeStart.Y) >= MARQUEE_DRAG_THRESHOLD;
+	}
+
+	if (!UInputManager::GetInstance().IsKeyDown(EKeyInput::MouseLeft))
+	{
+		if (bMarqueeActive)
+		{
+			SelectActorsInMarquee(InActiveCamera, InViewportInfo);
+		}
+		bMarqueePressed = false;
+		bMarqueeActive = false;
+	}
+}
+
+void UEditor::SelectActorsInMarquee(UCamera* InActiveCamera, const D3D11_VIEWPORT& InViewportInfo)
+{
+	ULevel* CurrentLevel = GWorld->GetLevel();
+	if (!CurrentLevel || !CurrentLevel->GetShowFlags() || InViewportInfo.Width <= 0.0f || InViewportInfo.Height <= 0.0f) { return; }
+
+	FScopeCycleCounter MarqueeCounter(TStatId("MarqueeSelection"));
+
+	// 화면 y는 아래로 커지므로 NDC로 옮기면 위아래가 바뀐다
+	const auto ToNdcX = [&InViewportInfo](float InX) { return ((InX - InViewportInfo.TopLeftX) / InViewportInfo.Width) * 2.0f - 1.0f; };
+	const auto ToNdcY = [&InViewportInfo](float InY) { return -(((InY - InViewportInfo.TopLeftY) / InViewportInfo.Height) * 2.0f - 1.0f); };
+	const float NdcMinX = ToNdcX(std::min(MarqueeStart.X, MarqueeEnd.X));
+	const float NdcMaxX = ToNdcX(std::max(MarqueeStart.X, MarqueeEnd.X));
+	const float NdcMinY = ToNdcY(std::max(MarqueeStart.Y, MarqueeEnd.Y));
+	const float NdcMaxY = ToNdcY(std::min(MarqueeStart.Y, MarqueeEnd.Y));
+
+	FFrustum MarqueeFrustum;
+	if (!InActiveCamera->GetSubFrustum(NdcMinX, NdcMinY, NdcMaxX, NdcMaxY, MarqueeFrustum)) { return; }
+
+	// Alt를 누르고 있으면 삼각형이 모두 사각형 안에 들어온 액터만, 아니면 삼각형이 걸친 액터까지 선택한다
+	const EFrustumOverlapMode OverlapMode = UInputManager::GetInstance().IsKeyDown(EKeyInput::Alt)
+		? EFrustumOverlapMode::TriangleContain : EFrustumOverlapMode::TriangleIntersect;
+	GWorld->OverlapFrustum(MarqueeFrustum, OverlapMode, MarqueePrimitives);
+	SelectPrimitiveOwners(MarqueePrimitives, InActiveCamera->GetLocation());
+}
+
+void UEditor::SelectPrimitiveOwners(const TArray<UPrimitiveComponent*>& InPrimitives, const FVector& InCameraLocation)
+{
+	// 프리미티브를 카메라 거리 순으로 정렬한 뒤 액터 단위로 묶어, 가장 가까운 액터를 주 선택으로 둔다
+	MarqueeActors.clear();
+	for (UPrimitiveComponent* Primitive : InPrimitives)
+	{
+		AActor* Owner = Primitive->GetOwner();
+		if (!Owner || !Primitive->CanPick()) { continue; }
+
+		FVector WorldMin, WorldMax;
+		Primitive->GetWorldAABB(WorldMin, WorldMax);
+		MarqueeActors.emplace_back(((WorldMin + WorldMax) * 0.5f - InCameraLocation).LengthSquared(), Owner);
+	}
+	std::sort(MarqueeActors.begin(), MarqueeActors.end(), [](const auto& InA, const auto& InB) { return InA.first < InB.first; });
+
+	// 가까운 프리미티브부터 보므로 액터가 처음 나올 때만 담으면 거리 순서가 유지된다
+	MarqueeActorSet.clear();
+	MarqueeSelection.clear();
+	for (const auto& [DistanceSquared, Actor] : MarqueeActors)
+	{
+		if (MarqueeActorSet.insert(Actor).second) { MarqueeSelection.push_back(Actor); }
+	}
+	SelectActors(MarqueeSelection);
+}
+
+bool UEditor::GetMarqueeRect(FVector2& OutStart, FVector2& OutEnd) const
+{
+	if (!bMarqueeActive) { return false; }
+
+	OutStart = MarqueeStart;
+	OutEnd = MarqueeEnd;
+	return true;
 }
 
 FVector UEditor::GetGizmoDragLocation(UCamera* InActiveCamera, FRay& WorldRay)
@@ -422,13 +526,60 @@ FVector UEditor::GetGizmoDragScale(UCamera* InActiveCamera, FRay& WorldRay)
 
 void UEditor::SelectActor(AActor* InActor)
 {
+	if (InActor == SelectedActor && SelectedActors.size() <= 1) return;
+
+	// 함께 선택돼 있던 액터의 강조를 끈다. 주 선택은 SelectComponent가 처리한다
+	for (AActor* Actor : SelectedActors)
+	{
+		if (Actor != SelectedActor && Actor->GetRootComponent())
+		{
+			Actor->GetRootComponent()->OnDeselected();
+		}
+	}
+	SelectedActors.clear();
+	if (InActor) { SelectedActors.push_back(InActor); }
 	if (InActor == SelectedActor) return;
-	
+
 	SelectedActor = InActor;
 	if (SelectedActor) { SelectComponent(InActor->GetRootComponent()); }
 	else { SelectComponent(nullptr); }
 }
 
+void UEditor::SelectActors(const TArray<AActor*>& InActors)
+{
+	SelectActor(InActors.empty() ? nullptr : InActors[0]);
+
+	// 나머지 액터는 루트 컴포넌트만 강조하고 기즈모/디테일 패널은 주 선택을 따른다
+	for (size_t Index = 1; Index < InActors.size(); ++Index)
+	{
+		AActor* Actor = InActors[Index];
+		SelectedActors.push_back(Actor);
+		if (Actor->GetRootComponent())
+		{
+			Actor->GetRootComponent()->OnSelected();
+		}
+	}
+}
+
+void UEditor::DeselectActor(AActor* InActor)
+{
+	if (InActor == SelectedActor)
+	{
+		SelectActor(nullptr);
+		SelectComponent(nullptr);
+		return;
+	}
+
+	if (auto It = std::find(SelectedActors.begin(), SelectedActors.end(), InActor); It != SelectedActors.end())
+	{
+		if (InActor->GetRootComponent())
+		{
+			InActor->GetRootComponent()->OnDeselected();
+		}
+		SelectedActors.erase(It);
+	}
+}
+
 void UEditor::SelectComponent(UActorComponent* InComponent)
 {
 	if (InComponent == SelectedComponent) return;
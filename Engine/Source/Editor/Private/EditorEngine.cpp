@@ -5,6 +5,7 @@
 #include "Level/Public/Level.h"
 #include "Manager/Config/Public/ConfigManager.h"
 #include "Manager/Path/Public/PathManager.h"
+#include "Optimization/Public/PotentiallyVisibleSet.h"
 
 
 IMPLEMENT_CLASS(UEditorEngine, UObject)
@@ -206,6 +207,33 @@ path UEditorEngine::GenerateLevelFilePath(const FString& InLevelName)
     return LevelDirectory / FileName;
 }
 
+bool UEditorEngine::BakeLevelPVS(const FString& InLevelFilePath, const FPVSBakeSettings& InSettings)
+{
+    // PIE 실행 시 PIE 종료 후 로직 실행
+    if (IsPIESessionActive()) { EndPIE(); }
+
+    path ScenePath = InLevelFilePath;
+    if (ScenePath.empty())
+    {
+        FName CurrentLevelName = GetEditorWorldContext().World()->GetLevel()->GetName();
+        ScenePath = GenerateLevelFilePath(CurrentLevelName == FName::GetNone() ? "Untitled" : CurrentLevelName.ToString());
+    }
+    else if (!LoadLevel(InLevelFilePath))
+    {
+        UE_LOG_ERROR("GEditor: PVS를 구울 레벨을 불러오지 못했습니다: %s", InLevelFilePath.c_str());
+        return false;
+    }
+
+    ULevel* Level = GetEditorWorldContext().World()->GetLevel();
+    if (!Level || !Level->BakePVS(InSettings))
+    {
+        UE_LOG_ERROR("GEditor: PVS 베이크에 실패했습니다");
+        return false;
+    }
+
+    return Level->SavePVS(FPotentiallyVisibleSet::GetFilePath(ScenePath));
+}
+
 path UEditorEngine::GetLevelDirectory()
 {
     UPathManager& PathManager = UPathManager::GetInstance();
@@ -3,9 +3,10 @@
 #include "Editor/Public/Camera.h"
 #include "Editor/Public/Gizmo.h"
 #include "Component/Public/PrimitiveComponent.h"
-#include "Global/Octree.h"
 #include "Physics/Public/AABB.h"
 #include "Component/Mesh/Public/StaticMeshComponent.h"
+#include "Level/Public/Level.h"
+#include "Physics/Public/SceneTLAS.h"
 
 FRay UObjectPicker::GetModelRay(const FRay& Ray, UPrimitiveComponent* Primitive)
 {
@@ -18,129 +19,223 @@ FRay UObjectPicker::GetModelRay(const FRay& Ray, UPrimitiveComponent* Primitive)
 	return ModelRay;
 }
 
-UPrimitiveComponent* UObjectPicker::PickPrimitive(UCamera* InActiveCamera, const FRay& WorldRay, TArray<UPrimitiveComponent*> Candidate, float* Distance)
+UPrimitiveComponent* UObjectPicker::PickPrimitiveCached(UCamera* InActiveCamera, const FPickCacheKey& InKey, const FRay& WorldRay, ULevel* InLevel,
+	float* Distance)
 {
-	UPrimitiveComponent* ShortestPrimitive = nullptr;
-	float ShortestDistance = D3D11_FLOAT32_MAX;
-	float PrimitiveDistance = D3D11_FLOAT32_MAX;
+	if (!bPrimitivePickCached || !(PrimitivePickKey == InKey))
+	{
+		PrimitivePickResult = PickPrimitive(InActiveCamera, WorldRay, InLevel, &PrimitivePickDistance);
+		PrimitivePickKey = InKey;
+		bPrimitivePickCached = true;
+	}
+
+	*Distance = PrimitivePickDistance;
+	return PrimitivePickResult;
+}
 
-	for (UPrimitiveComponent* Primitive : Candidate)
+UPrimitiveComponent* UObjectPicker::PickPrimitive(UCamera* InActiveCamera, const FRay& WorldRay, ULevel* InLevel, float* Distance)
+{
+	*Distance = D3D11_FLOAT32_MAX;
+	if (!InLevel)
 	{
-		if (!Primitive->CanPick()) { continue; }
-		FMatrix ModelMat = Primitive->GetWorldTransformMatrix();
-		if (IsRayPrimitiveCollided(InActiveCamera, WorldRay, Primitive, ModelMat, &PrimitiveDistance))
-			//Ray와 Primitive가 충돌했다면 거리 테스트 후 가까운 Actor Picking
-		{
-			if (PrimitiveDistance < ShortestDistance)
-			{
-				ShortestPrimitive = Primitive;
-				ShortestDistance = PrimitiveDistance;
-			}
-		}
+		return nullptr;
+	}
+
+	FVector Origin(WorldRay.Origin.X, WorldRay.Origin.Y, WorldRay.Origin.Z);
+	FVector Direction(WorldRay.Direction.X, WorldRay.Direction.Y, WorldRay.Direction.Z);
+	Direction.Normalize();
+
+	// 월드 레이를 T만큼 진행한 카메라 깊이는 T * ForwardStep이므로, near/far 조건을 거리 범위로 바꿔 순회에 넘긴다
+	const float ForwardStep = Direction.Dot(InActiveCamera->GetForward());
+	if (ForwardStep <= 0.0f)
+	{
+		return nullptr;
 	}
-	*Distance = ShortestDistance;
 
-	return ShortestPrimitive;
+	FSceneRayParams Params;
+	Params.MinDistance = InActiveCamera->GetNearZ() / ForwardStep;
+	Params.MaxDistance = InActiveCamera->GetFarZ() / ForwardStep;
+	// 빌보드/텍스트처럼 삼각형이 없는 프리미티브는 기존 피킹과 같이 맞지 않는다
+	Params.bHitBoundsWithoutTriangles = false;
+	Params.Filter = [](UPrimitiveComponent* InPrimitive) { return InPrimitive->CanPick(); };
+
+	FSceneRayHit Hit;
+	if (!InLevel->GetSceneTLAS()->Trace(Origin, Direction, Params, Hit))
+	{
+		return nullptr;
+	}
+
+	*Distance = Hit.Distance;
+	return Hit.Primitive;
 }
 
 void UObjectPicker::PickGizmo(UCamera* InActiveCamera, const FRay& WorldRay, UGizmo& Gizmo, FVector& CollisionPoint)
 {
-	//Forward, Right, Up순으로 테스트할거임.
-	//원기둥 위의 한 점 P, 축 위의 임의의 점 A에(기즈모 포지션) 대해, AP벡터와 축 벡터 V와 피타고라스 정리를 적용해서 점 P의 축부터의 거리 r을 구할 수 있음.
-	//r이 원기둥의 반지름과 같다고 방정식을 세운 후 근의공식을 적용해서 충돌여부 파악하고 distance를 구할 수 있음.
+	const int32 Axis = IntersectGizmoShape(MakeGizmoPickShape(Gizmo), WorldRay, CollisionPoint);
+	Gizmo.SetGizmoDirection(GizmoAxisToDirection(Axis));
+}
 
-	//FVector4 PointOnCylinder = WorldRay.Origin + WorldRay.Direction * X;
-	//dot(PointOnCylinder - GizmoLocation)*Dot(PointOnCylinder - GizmoLocation) - Dot(PointOnCylinder - GizmoLocation, GizmoAxis)^2 = r^2 = radiusOfGizmo
-	//이 t에 대한 방정식을 풀어서 근의공식 적용하면 됨.
+void UObjectPicker::PickGizmoCached(UCamera* InActiveCamera, const FPickCacheKey& InKey, const FRay& WorldRay, UGizmo& Gizmo, FVector& CollisionPoint,
+	bool bNeedCollisionPoint)
+{
+	const FGizmoPickShape Shape = MakeGizmoPickShape(Gizmo);
+	const bool bSameView = bGizmoPickCached && GizmoPickKey.IsSameView(InKey) && GizmoPickShape == Shape;
+
+	// 1. 마우스 픽셀까지 같으면 지난 결과를 그대로 쓴다 (클릭은 지난 결과가 레이 피킹이었을 때만)
+	if (bSameView && GizmoPickKey == InKey && (bGizmoPickHasCollisionPoint || !bNeedCollisionPoint))
+	{
+		Gizmo.SetGizmoDirection(GizmoPickDirection);
+		if (bGizmoPickHasCollisionPoint) { CollisionPoint = GizmoPickCollisionPoint; }
+		return;
+	}
+
+	GizmoPickKey = InKey;
+	GizmoPickShape = Shape;
+	bGizmoPickCached = true;
+
+	// 2. 호버는 카메라와 기즈모가 지난 프레임과 같으면 ID 버퍼를 조회한다. 버퍼는 이렇게 멈춘 첫 프레임에 만든다
+	if (!bNeedCollisionPoint && bSameView)
+	{
+		if (!bGizmoIdBufferValid || !GizmoIdBufferKey.IsSameView(InKey) || !(GizmoIdBufferShape == Shape))
+		{
+			bGizmoIdBufferValid = BuildGizmoIdBuffer(InActiveCamera, InKey, Shape);
+		}
+
+		const int32 CellX = static_cast<int32>(floorf((static_cast<float>(InKey.MouseX) + 0.5f - GizmoIdOriginX) / GizmoIdCellSize));
+		const int32 CellY = static_cast<int32>(floorf((static_cast<float>(InKey.MouseY) + 0.5f - GizmoIdOriginY) / GizmoIdCellSize));
+		const bool bInside = CellX >= 0 && CellX < GizmoIdWidth && CellY >= 0 && CellY < GizmoIdHeight;
+		const uint8 Cell = bInside ? GizmoIdCells[CellY * GizmoIdWidth + CellX] : static_cast<uint8>(EGizmoDirection::None);
+
+		// 축 경계에 걸친 셀은 셀 중심 값이 마우스 픽셀과 다를 수 있으므로 아래의 레이 피킹으로 넘긴다
+		if (bGizmoIdBufferValid && (Cell & GIZMO_ID_EDGE_BIT) == 0)
+		{
+			GizmoPickDirection = static_cast<EGizmoDirection>(Cell);
+			bGizmoPickHasCollisionPoint = false;
+			Gizmo.SetGizmoDirection(GizmoPickDirection);
+			return;
+		}
+	}
 
-	FVector GizmoLocation = Gizmo.GetGizmoLocation();
-	FVector GizmoAxises[3] = { FVector{1, 0, 0}, FVector{0, 1, 0}, FVector{0, 0, 1} };
+	// 3. 카메라/기즈모가 이번 프레임에 바뀌었거나, 클릭이거나, 축 경계 셀이면 레이로 검사한다
+	const int32 Axis = IntersectGizmoShape(Shape, WorldRay, CollisionPoint);
+	GizmoPickDirection = GizmoAxisToDirection(Axis);
+	GizmoPickCollisionPoint = CollisionPoint;
+	bGizmoPickHasCollisionPoint = true;
+	Gizmo.SetGizmoDirection(GizmoPickDirection);
+}
 
-	if (Gizmo.GetGizmoMode() == EGizmoMode::Scale || !Gizmo.IsWorldMode())
+FGizmoPickShape UObjectPicker::MakeGizmoPickShape(UGizmo& Gizmo)
+{
+	FGizmoPickShape Shape;
+	Shape.Mode = Gizmo.GetGizmoMode();
+	Shape.Location = Gizmo.GetGizmoLocation();
+	Shape.Axes[0] = FVector{ 1, 0, 0 };
+	Shape.Axes[1] = FVector{ 0, 1, 0 };
+	Shape.Axes[2] = FVector{ 0, 0, 1 };
+
+	if (Shape.Mode == EGizmoMode::Scale || !Gizmo.IsWorldMode())
 	{
 		FQuaternion q = Gizmo.GetTargetComponent()->GetWorldRotationAsQuaternion();
 		for (int i = 0; i < 3; i++)
 		{
 			// 쿼터니언을 사용해 기본 축을 회전시킵니다.
-			GizmoAxises[i] = q.RotateVector(GizmoAxises[i]);
+			Shape.Axes[i] = q.RotateVector(Shape.Axes[i]);
 		}
 	}
 
+	Shape.TranslateRadius = Gizmo.GetTranslateRadius();
+	Shape.TranslateHeight = Gizmo.GetTranslateHeight();
+	Shape.RotateInnerRadius = Gizmo.GetRotateInnerRadius();
+	Shape.RotateOuterRadius = Gizmo.GetRotateOuterRadius();
+	return Shape;
+}
+
+EGizmoDirection UObjectPicker::GizmoAxisToDirection(int32 InAxis)
+{
+	switch (InAxis)
+	{
+	case 0:	return EGizmoDirection::Forward;
+	case 1:	return EGizmoDirection::Right;
+	case 2:	return EGizmoDirection::Up;
+	default: return EGizmoDirection::None;
+	}
+}
+
+int32 UObjectPicker::IntersectGizmoShape(const FGizmoPickShape& InShape, const FRay& WorldRay, FVector& OutCollisionPoint)
+{
+	//Forward, Right, Up순으로 테스트할거임.
+	//원기둥 위의 한 점 P, 축 위의 임의의 점 A에(기즈모 포지션) 대해, AP벡터와 축 벡터 V와 피타고라스 정리를 적용해서 점 P의 축부터의 거리 r을 구할 수 있음.
+	//r이 원기둥의 반지름과 같다고 방정식을 세운 후 근의공식을 적용해서 충돌여부 파악하고 distance를 구할 수 있음.
+
+	//FVector4 PointOnCylinder = WorldRay.Origin + WorldRay.Direction * X;
+	//dot(PointOnCylinder - GizmoLocation)*Dot(PointOnCylinder - GizmoLocation) - Dot(PointOnCylinder - GizmoLocation, GizmoAxis)^2 = r^2 = radiusOfGizmo
+	//이 t에 대한 방정식을 풀어서 근의공식 적용하면 됨.
+
 	FVector WorldRayOrigin{ WorldRay.Origin.X,WorldRay.Origin.Y ,WorldRay.Origin.Z };
 	FVector WorldRayDirection(WorldRay.Direction.X, WorldRay.Direction.Y, WorldRay.Direction.Z);
 	WorldRayDirection.Normalize();
 
-	switch (Gizmo.GetGizmoMode())
+	// 축이 겹쳐 보일 때 배열 순서가 아니라 레이에서 가장 가까운 축을 고르도록 세 축을 모두 검사한다
+	int32 ClosestAxis = -1;
+	float ClosestDistance = D3D11_FLOAT32_MAX;
+
+	switch (InShape.Mode)
 	{
 	case EGizmoMode::Translate:
 	case EGizmoMode::Scale:
 	{
-		FVector GizmoDistanceVector = WorldRayOrigin - GizmoLocation;
-		bool bIsCollide = false;
+		FVector GizmoDistanceVector = WorldRayOrigin - InShape.Location;
 
-		float GizmoRadius = Gizmo.GetTranslateRadius();
-		float GizmoHeight = Gizmo.GetTranslateHeight();
+		float GizmoRadius = InShape.TranslateRadius;
+		float GizmoHeight = InShape.TranslateHeight;
 		float A, B, C; //Ax^2 + Bx + C의 ABC
-		float X; //해
 		float Det; //판별식
 		//0 = forward 1 = Right 2 = UP
 
 		for (int a = 0; a < 3; a++)
 		{
-			FVector GizmoAxis = GizmoAxises[a];
-			A = 1 - static_cast<float>(pow(WorldRay.Direction.Dot3(GizmoAxis), 2));
-			B = WorldRay.Direction.Dot3(GizmoDistanceVector) - WorldRay.Direction.Dot3(GizmoAxis) * GizmoDistanceVector.
+			FVector GizmoAxis = InShape.Axes[a];
+			A = 1 - static_cast<float>(pow(WorldRayDirection.Dot(GizmoAxis), 2));
+			B = WorldRayDirection.Dot(GizmoDistanceVector) - WorldRayDirection.Dot(GizmoAxis) * GizmoDistanceVector.
 				Dot(GizmoAxis); //B가 2의 배수이므로 미리 약분
 			C = static_cast<float>(GizmoDistanceVector.Dot(GizmoDistanceVector) -
 				pow(GizmoDistanceVector.Dot(GizmoAxis), 2)) - GizmoRadius * GizmoRadius;
 
 			Det = B * B - A * C;
-			if (Det >= 0) //판별식 0이상 => 근 존재. 높이테스트만 통과하면 충돌
+			if (Det < 0) { continue; } //판별식 0이상 => 근 존재. 높이테스트만 통과하면 충돌
+
+			// 두 근(가까운 면, 먼 면) 중 높이 테스트를 통과하는 가장 가까운 해
+			const float Roots[2] = { (-B - sqrtf(Det)) / A, (-B + sqrtf(Det)) / A };
+			for (float X : Roots)
 			{
-				X = (-B + sqrtf(Det)) / A;
+				if (!(X >= 0.0f && X < ClosestDistance)) { continue; }
+
 				FVector PointOnCylinder = WorldRayOrigin + WorldRayDirection * X;
-				float Height = (PointOnCylinder - GizmoLocation).Dot(GizmoAxis);
+				float Height = (PointOnCylinder - InShape.Location).Dot(GizmoAxis);
 				if (Height <= GizmoHeight && Height >= 0) //충돌
 				{
-					CollisionPoint = PointOnCylinder;
-					bIsCollide = true;
-
-				}
-				X = (-B - sqrtf(Det)) / A;
-				PointOnCylinder = WorldRay.Origin + WorldRay.Direction * X;
-				Height = (PointOnCylinder - GizmoLocation).Dot(GizmoAxis);
-				if (Height <= GizmoHeight && Height >= 0)
-				{
-					CollisionPoint = PointOnCylinder;
-					bIsCollide = true;
-				}
-				if (bIsCollide)
-				{
-					switch (a)
-					{
-					case 0:	Gizmo.SetGizmoDirection(EGizmoDirection::Forward);	return;
-					case 1:	Gizmo.SetGizmoDirection(EGizmoDirection::Right);	return;
-					case 2:	Gizmo.SetGizmoDirection(EGizmoDirection::Up);		return;
-					}
+					OutCollisionPoint = PointOnCylinder;
+					ClosestDistance = X;
+					ClosestAxis = a;
 				}
 			}
 		}
 	} break;
 	case EGizmoMode::Rotate:
 	{
+		FVector PointOnPlane;
 		for (int a = 0; a < 3; a++)
 		{
-			if (IsRayCollideWithPlane(WorldRay, GizmoLocation, GizmoAxises[a], CollisionPoint))
+			if (IsRayCollideWithPlane(WorldRay, InShape.Location, InShape.Axes[a], PointOnPlane))
 			{
-				FVector RadiusVector = CollisionPoint - GizmoLocation;
-				if (Gizmo.IsInRadius(RadiusVector.Length()))
+				// 링 범위는 UGizmo::IsInRadius와 같다
+				const float Radius = (PointOnPlane - InShape.Location).Length();
+				const float Distance = (PointOnPlane - WorldRayOrigin).Length();
+				if (Distance < ClosestDistance && Radius >= InShape.RotateInnerRadius && Radius <= InShape.RotateOuterRadius)
 				{
-					switch (a)
-					{
-					case 0:	Gizmo.SetGizmoDirection(EGizmoDirection::Forward);	return;
-					case 1:	Gizmo.SetGizmoDirection(EGizmoDirection::Right);	return;
-					case 2:	Gizmo.SetGizmoDirection(EGizmoDirection::Up);		return;
-					}
+					OutCollisionPoint = PointOnPlane;
+					ClosestDistance = Distance;
+					ClosestAxis = a;
 				}
 			}
 		}
@@ -148,7 +243,92 @@ void UObjectPicker::PickGizmo(UCamera* InActiveCamera, const FRay& WorldRay, UGi
 	default: break;
 	}
 
-	Gizmo.SetGizmoDirection(EGizmoDirection::None);
+	return ClosestAxis;
+}
+
+bool UObjectPicker::BuildGizmoIdBuffer(UCamera* InActiveCamera, const FPickCacheKey& InKey, const FGizmoPickShape& InShape)
+{
+	if (InKey.ViewportWidth <= 0.0f || InKey.ViewportHeight <= 0.0f) { return false; }
+
+	// 1. 기즈모를 감싸는 정육면체의 꼭짓점을 화면에 투영해 기즈모가 덮는 사각형을 구한다
+	const float Extent = std::max(InShape.TranslateHeight + InShape.TranslateRadius, InShape.RotateOuterRadius);
+	const FMatrix ViewProjection = InKey.View * InKey.Projection;
+	float MinX = FLT_MAX, MinY = FLT_MAX, MaxX = -FLT_MAX, MaxY = -FLT_MAX;
+	for (int32 Corner = 0; Corner < 8; ++Corner)
+	{
+		const FVector Point = InShape.Location + FVector((Corner & 1) ? Extent : -Extent, (Corner & 2) ? Extent : -Extent, (Corner & 4) ? Extent : -Extent);
+		const FVector4 Clip = FVector4(Point.X, Point.Y, Point.Z, 1.0f) * ViewProjection;
+		// 카메라 뒤에 걸친 꼭짓점은 화면에서 뒤집혀 사각형을 구할 수 없다
+		if (Clip.W <= MATH_EPSILON) { return false; }
+
+		const float ScreenX = InKey.ViewportX + (Clip.X / Clip.W * 0.5f + 0.5f) * InKey.ViewportWidth;
+		const float ScreenY = InKey.ViewportY + (0.5f - Clip.Y / Clip.W * 0.5f) * InKey.ViewportHeight;
+		MinX = std::min(MinX, ScreenX);
+		MinY = std::min(MinY, ScreenY);
+		MaxX = std::max(MaxX, ScreenX);
+		MaxY = std::max(MaxY, ScreenY);
+	}
+	MinX = std::max(MinX, InKey.ViewportX);
+	MinY = std::max(MinY, InKey.ViewportY);
+	MaxX = std::min(MaxX, InKey.ViewportX + InKey.ViewportWidth);
+	MaxY = std::min(MaxY, InKey.ViewportY + InKey.ViewportHeight);
+
+	GizmoIdBufferKey = InKey;
+	GizmoIdBufferShape = InShape;
+	GizmoIdOriginX = MinX;
+	GizmoIdOriginY = MinY;
+	GizmoIdCells.clear();
+	GizmoIdWidth = 0;
+	GizmoIdHeight = 0;
+
+	// 기즈모가 화면 밖이면 빈 버퍼 (모든 픽셀이 None)
+	if (MinX >= MaxX || MinY >= MaxY) { return true; }
+
+	// 2. 기즈모가 화면을 크게 덮으면 셀 수가 상한을 넘지 않도록 셀을 키운다
+	GizmoIdCellSize = std::max(GIZMO_ID_CELL_SIZE, std::max(MaxX - MinX, MaxY - MinY) / static_cast<float>(GIZMO_ID_MAX_CELLS_PER_AXIS));
+	GizmoIdWidth = std::max(1, static_cast<int32>(ceilf((MaxX - MinX) / GizmoIdCellSize)));
+	GizmoIdHeight = std::max(1, static_cast<int32>(ceilf((MaxY - MinY) / GizmoIdCellSize)));
+	GizmoIdCells.resize(static_cast<size_t>(GizmoIdWidth) * GizmoIdHeight);
+
+	// 3. 셀 중심을 지나는 레이로 축을 검사해 셀에 기록한다
+	for (int32 CellY = 0; CellY < GizmoIdHeight; ++CellY)
+	{
+		for (int32 CellX = 0; CellX < GizmoIdWidth; ++CellX)
+		{
+			const float ScreenX = MinX + (static_cast<float>(CellX) + 0.5f) * GizmoIdCellSize;
+			const float ScreenY = MinY + (static_cast<float>(CellY) + 0.5f) * GizmoIdCellSize;
+			const float NdcX = ((ScreenX - InKey.ViewportX) / InKey.ViewportWidth) * 2.0f - 1.0f;
+			const float NdcY = -(((ScreenY - InKey.ViewportY) / InKey.ViewportHeight) * 2.0f - 1.0f);
+
+			FVector CellCollisionPoint;
+			const int32 Axis = IntersectGizmoShape(InShape, InActiveCamera->ConvertToWorldRay(NdcX, NdcY), CellCollisionPoint);
+			GizmoIdCells[CellY * GizmoIdWidth + CellX] = static_cast<uint8>(GizmoAxisToDirection(Axis));
+		}
+	}
+
+	// 4. 이웃 셀(사각형 밖은 None)과 값이 다른 셀에 경계 표시를 한다
+	const auto GetCellDirection = [this](int32 InX, int32 InY)
+	{
+		if (InX < 0 || InX >= GizmoIdWidth || InY < 0 || InY >= GizmoIdHeight) { return static_cast<uint8>(EGizmoDirection::None); }
+		return static_cast<uint8>(GizmoIdCells[InY * GizmoIdWidth + InX] & ~GIZMO_ID_EDGE_BIT);
+	};
+	for (int32 CellY = 0; CellY < GizmoIdHeight; ++CellY)
+	{
+		for (int32 CellX = 0; CellX < GizmoIdWidth; ++CellX)
+		{
+			const uint8 Center = GetCellDirection(CellX, CellY);
+			bool bEdge = false;
+			for (int32 OffsetY = -1; OffsetY <= 1 && !bEdge; ++OffsetY)
+			{
+				for (int32 OffsetX = -1; OffsetX <= 1 && !bEdge; ++OffsetX)
+				{
+					bEdge = GetCellDirection(CellX + OffsetX, CellY + OffsetY) != Center;
+				}
+			}
+			if (bEdge) { GizmoIdCells[CellY * GizmoIdWidth + CellX] |= GIZMO_ID_EDGE_BIT; }
+		}
+	}
+	return true;
 }
 
 //개별 primitive와 ray 충돌 검사
@@ -171,6 +351,17 @@ bool UObjectPicker::IsRayPrimitiveCollided(UCamera* InActiveCamera, const FRay&
 	const TArray<uint32>* Indices = Primitive->GetIndicesData();
 
 	FRay ModelRay = GetModelRay(WorldRay, Primitive);
+
+	// 스태틱 메시는 BVH 순회 중에 삼각형까지 검사해 가장 가까운 충돌만 찾는다
+	if (UStaticMeshComponent* StaticMeshComp = Cast<UStaticMeshComponent>(Primitive))
+	{
+		UStaticMesh* StaticMesh = StaticMeshComp->GetStaticMesh();
+		FStaticMesh* StaticMeshAsset = StaticMesh ? StaticMesh->GetStaticMeshAsset() : nullptr;
+		if (StaticMeshAsset && StaticMeshAsset->BVH.GetRootIndex() >= 0)
+		{
+			return IsRayBVHCollided(InActiveCamera, ModelRay, StaticMeshAsset->BVH, ModelMatrix, ShortestDistance);
+		}
+	}
 	
 	// 충돌 가능성 있는 삼각형 인덱스 수집
 	// Triangle Ordinal(인덱스 버퍼를 3개 단위로 묶었을 때의 삼각형 번호)로 반환
@@ -203,6 +394,26 @@ bool UObjectPicker::IsRayPrimitiveCollided(UCamera* InActiveCamera, const FRay&
 	return bIsHit;
 }
 
+bool UObjectPicker::IsRayBVHCollided(UCamera* InActiveCamera, const FRay& ModelRay, const FBVH& BVH, const FMatrix& ModelMatrix, float* ShortestDistance)
+{
+	// 모델 레이를 T만큼 진행한 월드 변위는 T * WorldStep이므로, near/far 조건을 T 범위로 바꿔 순회에 넘긴다
+	FVector4 WorldStep = ModelRay.Direction * ModelMatrix;
+	float ForwardStep = WorldStep.Dot3(InActiveCamera->GetForward());
+	if (ForwardStep <= 0.0f)
+	{
+		return false;
+	}
+
+	FBVHRayHit Hit;
+	if (!BVH.ClosestHit(ModelRay, Hit, InActiveCamera->GetNearZ() / ForwardStep, InActiveCamera->GetFarZ() / ForwardStep))
+	{
+		return false;
+	}
+
+	*ShortestDistance = std::min(*ShortestDistance, Hit.Distance * WorldStep.Length());
+	return true;
+}
+
 bool UObjectPicker::IsRayTriangleCollided(UCamera* InActiveCamera, const FRay& Ray, const FVector& Vertex1, const FVector& Vertex2, const FVector& Vertex3,
                            const FMatrix& ModelMatrix, float* Distance)
 {
@@ -283,51 +494,9 @@ bool UObjectPicker::IsRayCollideWithPlane(const FRay& WorldRay, FVector PlanePoi
 	return true;
 }
 
-/**
- * 레이와 충돌하는 후보 노드들을 찾아 그 안의 프리미티브들을 OutCandidate에 담습니다.
- * @return 후보를 찾았으면 true, 못 찾았으면 false를 반환합니다.
- */
-bool UObjectPicker::FindCandidateFromOctree(FOctree* Node, const FRay& WorldRay, TArray<UPrimitiveComponent*>& OutCandidate)
-{
-	// 0. nullptr인지 검사.
-	if (!Node) { return false; }
-
-	// 1. 레이가 현재 노드와 겹치지 않으면 검사 생략.
-	if (CheckIntersectionRayBox(WorldRay, Node->GetBoundingBox()) == false) { return false; }
-
-	// 2. 현재 노드와 레이가 교차하므로, 이 노드에 직접 포함된 프리미티브들을 후보에 추가합니다.
-	const auto& CurrentNodePrimitives = Node->GetPrimitives();
-	if (!CurrentNodePrimitives.empty())
-	{
-		OutCandidate.insert(OutCandidate.end(), CurrentNodePrimitives.begin(), CurrentNodePrimitives.end());
-	}
-
-	// 3. 리프 노드가 아니라면, 자식 노드를 재귀적으로 탐색합니다.
-	if (!Node->IsLeafNode())
-	{
-		for (FOctree* Child : Node->GetChildren())
-		{
-			FindCandidateFromOctree(Child, WorldRay, OutCandidate);
-		}
-	}
-
-	return true;
-}
-
 void UObjectPicker::GatherCandidateTriangles(UPrimitiveComponent* Primitive, const FRay& ModelRay, TArray<int32>& OutCandidateIndices)
 {
-	if (UStaticMeshComponent* StaticMeshComp = Cast<UStaticMeshComponent>(Primitive))
-	{
-		if (FStaticMesh* StaticMesh = StaticMeshComp->GetStaticMesh()->GetStaticMeshAsset())
-		{
-			if (StaticMesh->BVH.TraverseRay(ModelRay, OutCandidateIndices))
-            {
-				return;
-            }
-		}
-	}
-
-	// fallback: 전체 삼각형 인덱스 채우기
+	// BVH가 있는 스태틱 메시는 IsRayBVHCollided에서 처리하므로, 여기서는 전체 삼각형 인덱스 채우기
 	const TArray<FNormalVertex>* Vertices = Primitive->GetVerticesData();
 	const TArray<uint32>* Indices = Primitive->GetIndicesData();
 
@@ -55,6 +55,12 @@ public:
 	FMatrix GetCameraProjectionMatrix() const {return PerspectiveCameraProj; }
 	
 	FRay ConvertToWorldRay(float NdcX, float NdcY) const;
+	/**
+	 * @brief 화면의 NDC 사각형만 덮는 부분 절두체 (마퀴 선택용). 투영 행렬 뒤에 사각형을 [-1, 1]로 늘리는 변환을 붙여 평면을 뽑으므로
+	 * 원근/직교 카메라 모두 같은 near/far를 쓴다.
+	 * @return 사각형의 폭이나 높이가 0이거나 평면을 정규화할 수 없으면 false
+	 */
+	bool GetSubFrustum(float InNdcMinX, float InNdcMinY, float InNdcMaxX, float InNdcMaxY, FFrustum& OutFrustum) const;
 
 	FVector CalculatePlaneNormal(const FVector4& Axis);
 	FVector CalculatePlaneNormal(const FVector& Axis);
@@ -69,7 +75,6 @@ public:
 	float GetFarZ() const { return FarZ; }
 	float GetOrthoWidth() const { return OrthoWidth; }
 	ECameraType GetCameraType() const { return CameraType; }
-	ViewVolumeCuller& GetViewVolumeCuller() { return ViewVolumeCuller; }
 
 	// Input enable for main editor camera (disable when hovering other viewports)
 	void SetInputEnabled(bool b) { bInputEnabled = b; }
@@ -114,9 +119,6 @@ private:
 	float OrthoWidth = {};
 	ECameraType CameraType = {};
 
-	// 절두체 컬링을 이용한 최적화
-	ViewVolumeCuller ViewVolumeCuller;
-
 	// Whether this camera consumes input (movement/rotation). Only used by editor main camera.
 	bool bInputEnabled = true;
 	bool bIsMainDrraging = false;
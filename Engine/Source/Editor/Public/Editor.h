@@ -44,6 +44,16 @@ public:
 
 	void SelectActor(AActor* InActor);
 	AActor* GetSelectedActor() const { return SelectedActor; }
+	/** @brief 여러 액터를 함께 선택한다 (마퀴 선택). 첫 액터가 기즈모와 디테일 패널이 쓰는 주 선택이 된다 */
+	void SelectActors(const TArray<AActor*>& InActors);
+	/** @brief 선택에서 액터를 뺀다. 주 선택이면 선택 전체를 해제한다 (액터 삭제 시 호출) */
+	void DeselectActor(AActor* InActor);
+	/** @brief 주 선택을 포함해 선택된 모든 액터 */
+	const TArray<AActor*>& GetSelectedActors() const { return SelectedActors; }
+	/** @brief 마퀴 드래그 중이면 드래그 사각형의 두 꼭짓점(화면 좌표)을 반환한다 */
+	bool GetMarqueeRect(FVector2& OutStart, FVector2& OutEnd) const;
+	/** @brief 프리미티브들의 소유 액터를 카메라에서 가까운 순서로 중복 없이 선택한다 (마퀴 선택의 마지막 단계, bench marquee도 이 경로를 잰다) */
+	void SelectPrimitiveOwners(const TArray<UPrimitiveComponent*>& InPrimitives, const FVector& InCameraLocation);
 	void SelectComponent(UActorComponent* InComponent);
 	UActorComponent* GetSelectedComponent() const { return SelectedComponent; }
 
@@ -57,6 +67,10 @@ public:
 private:
 	void UpdateBatchLines();
 	void ProcessMouseInput();
+	/** @brief 빈 곳을 누른 채 끌면 마퀴 사각형을 갱신하고, 버튼을 놓을 때 사각형 안의 액터를 선택한다 */
+	void UpdateMarqueeSelection(UCamera* InActiveCamera, const D3D11_VIEWPORT& InViewportInfo, const FVector& InMousePosition);
+	/** @brief 마퀴 사각형으로 카메라의 부분 절두체를 만들어 옥트리/동적 트리와 메시 BVH로 선택할 액터를 찾는다 */
+	void SelectActorsInMarquee(UCamera* InActiveCamera, const D3D11_VIEWPORT& InViewportInfo);
 	
 	// 모든 기즈모 드래그 함수가 ActiveCamera를 받도록 통일
 	FVector GetGizmoDragLocation(UCamera* InActiveCamera, FRay& WorldRay);
@@ -71,6 +85,19 @@ private:
 	UObjectPicker ObjectPicker;
 	AActor* SelectedActor = nullptr; // 선택된 액터
 	UActorComponent* SelectedComponent = nullptr; // 선택된 컴포넌트
+	TArray<AActor*> SelectedActors; // 주 선택(SelectedActor)이 맨 앞에 오는 선택된 액터 전체
+
+	// 마퀴 선택 (화면 좌표)
+	static constexpr float MARQUEE_DRAG_THRESHOLD = 4.0f; // 이만큼(픽셀) 끌어야 클릭이 아닌 마퀴로 본다
+	bool bMarqueePressed = false; // 빈 곳을 눌러 드래그를 추적하는 중
+	bool bMarqueeActive = false; // 임계값 이상 끌어 사각형을 그리는 중
+	FVector2 MarqueeStart;
+	FVector2 MarqueeEnd;
+	// 마퀴 선택 사이에 재사용하는 버퍼
+	TArray<UPrimitiveComponent*> MarqueePrimitives;
+	TArray<TPair<float, AActor*>> MarqueeActors;
+	TSet<AActor*> MarqueeActorSet;
+	TArray<AActor*> MarqueeSelection;
 
 	UCamera* Camera;
 	UGizmo Gizmo;
@@ -3,6 +3,7 @@
 #include "Level/Public/World.h"
 
 class UEditor;
+struct FPVSBakeSettings;
 /**
  * @brief UWorld 인스턴스와 그에 대한 정보를 담는 구조체
  */
@@ -88,6 +89,12 @@ public:
     static std::filesystem::path GetLevelDirectory();
     static std::filesystem::path GenerateLevelFilePath(const FString& InLevelName);
 
+    /**
+     * @brief 레벨의 PVS를 구워 .Scene 옆에 .pvs로 저장
+     * @param InLevelFilePath 비어 있으면 현재 에디터 레벨을 굽고, 아니면 그 레벨을 먼저 불러온다
+     */
+    bool BakeLevelPVS(const FString& InLevelFilePath, const FPVSBakeSettings& InSettings);
+
     /**
      * @brief 에디터 UI/상호작용 담당하는 UEditor 반환
      */
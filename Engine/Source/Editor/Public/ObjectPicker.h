@@ -7,23 +7,135 @@ class AActor;
 class ULevel;
 class UCamera;
 class UGizmo;
-class FOctree;
+class FBVH;
 struct FRay;
 
+/**
+ * @brief 피킹 결과를 다시 쓸 수 있는지 판단하는 키
+ * 카메라 뷰/투영 행렬, 뷰포트, 마우스 픽셀, 레벨의 씬 리비전과 쇼 플래그가 모두 같으면 같은 레이로 같은 씬을 검사하므로 결과도 같다.
+ */
+struct FPickCacheKey
+{
+	FMatrix View;
+	FMatrix Projection;
+	float ViewportX = 0.0f;
+	float ViewportY = 0.0f;
+	float ViewportWidth = 0.0f;
+	float ViewportHeight = 0.0f;
+	int32 MouseX = INT32_MIN;
+	int32 MouseY = INT32_MIN;
+	uint64 SceneRevision = 0;
+	uint64 ShowFlags = 0;
+
+	/** @brief 마우스 픽셀을 뺀 나머지(카메라, 뷰포트, 씬)가 같은지 */
+	bool IsSameView(const FPickCacheKey& InOther) const
+	{
+		return SceneRevision == InOther.SceneRevision && ShowFlags == InOther.ShowFlags
+			&& ViewportX == InOther.ViewportX && ViewportY == InOther.ViewportY
+			&& ViewportWidth == InOther.ViewportWidth && ViewportHeight == InOther.ViewportHeight
+			&& memcmp(View.Data, InOther.View.Data, sizeof(View.Data)) == 0
+			&& memcmp(Projection.Data, InOther.Projection.Data, sizeof(Projection.Data)) == 0;
+	}
+	bool operator==(const FPickCacheKey& InOther) const
+	{
+		return MouseX == InOther.MouseX && MouseY == InOther.MouseY && IsSameView(InOther);
+	}
+};
+
+/** @brief 기즈모 피킹에 쓰는 충돌 형상. 모드 전환, 월드/로컬 전환, 화면 크기 보정도 결과를 바꾸므로 키에 함께 넣는다 */
+struct FGizmoPickShape
+{
+	EGizmoMode Mode = EGizmoMode::Translate;
+	FVector Location;
+	/** @brief 0: Forward, 1: Right, 2: Up */
+	FVector Axes[3];
+	float TranslateRadius = 0.0f;
+	float TranslateHeight = 0.0f;
+	float RotateInnerRadius = 0.0f;
+	float RotateOuterRadius = 0.0f;
+
+	bool operator==(const FGizmoPickShape& InOther) const
+	{
+		return Mode == InOther.Mode && Location == InOther.Location
+			&& Axes[0] == InOther.Axes[0] && Axes[1] == InOther.Axes[1] && Axes[2] == InOther.Axes[2]
+			&& TranslateRadius == InOther.TranslateRadius && TranslateHeight == InOther.TranslateHeight
+			&& RotateInnerRadius == InOther.RotateInnerRadius && RotateOuterRadius == InOther.RotateOuterRadius;
+	}
+};
+
 class UObjectPicker : public UObject
 {
 public:
 	UObjectPicker() = default;
-	UPrimitiveComponent* PickPrimitive(UCamera* InActiveCamera, const FRay& WorldRay, TArray<UPrimitiveComponent*> Candidate, float* Distance);
+	/**
+	 * @brief 레벨의 FSceneTLAS를 가까운 인스턴스부터 순회해 카메라 near/far 사이에서 가장 가까운 프리미티브를 찾는다.
+	 * 후보를 따로 모으지 않으며, 이미 찾은 충돌보다 먼 인스턴스는 메시 BVH에 들어가지 않는다.
+	 */
+	UPrimitiveComponent* PickPrimitive(UCamera* InActiveCamera, const FRay& WorldRay, ULevel* InLevel, float* Distance);
+	/**
+	 * @brief PickPrimitive(레벨)와 같지만 InKey가 지난 피킹과 같으면 TLAS를 다시 순회하지 않고 지난 결과를 돌려준다.
+	 * 프리미티브 삭제와 트랜스폼 변경은 씬 리비전을 바꾸므로 캐시된 포인터가 지워진 컴포넌트를 가리키는 일은 없다.
+	 */
+	UPrimitiveComponent* PickPrimitiveCached(UCamera* InActiveCamera, const FPickCacheKey& InKey, const FRay& WorldRay, ULevel* InLevel, float* Distance);
+	/** @brief 세 축을 모두 검사해 레이에서 가장 가까운 축을 기즈모 방향으로 정한다. 맞은 축이 없으면 None */
 	void PickGizmo(UCamera* InActiveCamera, const FRay& WorldRay, UGizmo& Gizmo, FVector& CollisionPoint);
+	/**
+	 * @brief 마우스 아래의 기즈모 축을 찾는다. InKey와 기즈모 형상이 지난 피킹과 같으면 검사하지 않고 지난 결과를 쓴다.
+	 * 호버(bNeedCollisionPoint = false)는 카메라와 기즈모가 멈춰 있는 동안 저해상도 ID 버퍼를 조회하고,
+	 * 버퍼를 만들 수 없거나, 이번 프레임에 카메라/기즈모가 바뀌었거나, 축 경계 셀이면 레이 피킹으로 대신한다.
+	 * 클릭은 드래그 시작점(CollisionPoint)이 필요하므로 항상 레이 피킹 결과를 쓴다.
+	 */
+	void PickGizmoCached(UCamera* InActiveCamera, const FPickCacheKey& InKey, const FRay& WorldRay, UGizmo& Gizmo, FVector& CollisionPoint,
+		bool bNeedCollisionPoint);
 	bool IsRayCollideWithPlane(const FRay& WorldRay, FVector PlanePoint, FVector Normal, FVector& PointOnPlane);
 
-	bool FindCandidateFromOctree(FOctree* Node, const FRay& WorldRay, TArray<UPrimitiveComponent*>& OutCandidate);
-
 private:
+	static FGizmoPickShape MakeGizmoPickShape(UGizmo& Gizmo);
+	/** @brief 레이에서 가장 가까운 기즈모 축 번호(0: Forward, 1: Right, 2: Up). 맞은 축이 없으면 -1 */
+	int32 IntersectGizmoShape(const FGizmoPickShape& InShape, const FRay& WorldRay, FVector& OutCollisionPoint);
+	static EGizmoDirection GizmoAxisToDirection(int32 InAxis);
+	/**
+	 * @brief 화면에서 기즈모를 덮는 사각형을 GIZMO_ID_CELL_SIZE 픽셀 셀로 나누고, 셀 중심 레이가 맞힌 축을 셀에 기록한다.
+	 * 이웃과 값이 다른 셀은 경계로 표시해 조회할 때 레이 피킹으로 넘긴다.
+	 * @return 기즈모가 카메라 뒤에 걸쳐 화면 사각형을 구할 수 없으면 false
+	 */
+	bool BuildGizmoIdBuffer(UCamera* InActiveCamera, const FPickCacheKey& InKey, const FGizmoPickShape& InShape);
 	void GatherCandidateTriangles(UPrimitiveComponent* Primitive, const FRay& ModelRay, TArray<int32>& OutCandidateTriangleIndices);
 	bool IsRayPrimitiveCollided(UCamera* InActiveCamera, const FRay& WorldRay, UPrimitiveComponent* Primitive, const FMatrix& ModelMatrix, float* ShortestDistance);
+	/** @brief 메시 BVH의 closest-hit 순회로 카메라 near/far 사이에서 가장 가까운 충돌의 월드 거리를 구한다. */
+	bool IsRayBVHCollided(UCamera* InActiveCamera, const FRay& ModelRay, const FBVH& BVH, const FMatrix& ModelMatrix, float* ShortestDistance);
 	FRay GetModelRay(const FRay& Ray, UPrimitiveComponent* Primitive);
 	bool IsRayTriangleCollided(UCamera* InActiveCamera, const FRay& Ray, const FVector& Vertex1, const FVector& Vertex2, const FVector& Vertex3,
 		const FMatrix& ModelMatrix, float* Distance);
+
+	// 마지막 프리미티브 피킹
+	bool bPrimitivePickCached = false;
+	FPickCacheKey PrimitivePickKey;
+	UPrimitiveComponent* PrimitivePickResult = nullptr;
+	float PrimitivePickDistance = D3D11_FLOAT32_MAX;
+
+	// 마지막 기즈모 피킹. CollisionPoint는 레이 피킹으로 구했을 때만 유효하다
+	bool bGizmoPickCached = false;
+	bool bGizmoPickHasCollisionPoint = false;
+	FPickCacheKey GizmoPickKey;
+	FGizmoPickShape GizmoPickShape;
+	EGizmoDirection GizmoPickDirection = EGizmoDirection::None;
+	FVector GizmoPickCollisionPoint;
+
+	/**
+	 * @brief 기즈모 호버용 저해상도 ID 버퍼 (셀마다 EGizmoDirection, 이웃 셀과 값이 다르면 GIZMO_ID_EDGE_BIT)
+	 * 카메라/기즈모가 바뀐 뒤 두 번째 프레임부터 만들어, 카메라를 움직이는 동안에는 매 프레임 다시 만들지 않는다.
+	 */
+	static constexpr float GIZMO_ID_CELL_SIZE = 4.0f;
+	static constexpr int32 GIZMO_ID_MAX_CELLS_PER_AXIS = 64;
+	static constexpr uint8 GIZMO_ID_EDGE_BIT = 0x80;
+	bool bGizmoIdBufferValid = false;
+	FPickCacheKey GizmoIdBufferKey;
+	FGizmoPickShape GizmoIdBufferShape;
+	float GizmoIdOriginX = 0.0f;
+	float GizmoIdOriginY = 0.0f;
+	float GizmoIdCellSize = GIZMO_ID_CELL_SIZE;
+	int32 GizmoIdWidth = 0;
+	int32 GizmoIdHeight = 0;
+	TArray<uint8> GizmoIdCells;
 };
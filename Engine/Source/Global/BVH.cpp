@@ -3,6 +3,269 @@
 #include "Global/BVH.h"
 #include "Component/Public/PrimitiveComponent.h"
 #include "Component/Mesh/Public/StaticMesh.h"
+#include "Utility/Public/ParallelFor.h"
+#include "Core/Public/Archive.h"
+#include "Optimization/Public/ViewVolumeCuller.h"
+
+namespace
+{
+	/** @brief 삼각형 수가 이보다 적으면 서브트리를 나누지 않고 호출 스레드에서 한 번에 구축한다 */
+	constexpr uint32 PARALLEL_BUILD_MIN_TRIANGLES = 8192;
+	/** @brief 병렬로 구축하는 서브트리 하나의 최소 삼각형 수 */
+	constexpr uint32 PARALLEL_SUBTREE_MIN_TRIANGLES = 2048;
+	/** @brief 삼각형 AABB/중심 계산을 나누는 단위 */
+	constexpr uint32 TRIANGLE_BOUNDS_CHUNK_SIZE = 4096;
+
+	/** @brief 메시 캐시에 쓰는 노드 표현. FAABB는 가상 함수 테이블을 가지므로 값만 옮겨 배열 전체를 한 번에 읽고 쓴다 */
+	struct FCookedBVHNode
+	{
+		int32 ObjectIndex;
+		int32 ParentIndex;
+		int32 Child1;
+		int32 Child2;
+		int32 TriangleBaseIndex;
+		uint32 bIsLeaf;
+		float Min[3];
+		float Max[3];
+	};
+
+	/** @brief ClosestHit/AnyHit 순회 스택. 스레드마다 하나씩 두고 재사용해 쿼리마다 할당하지 않는다 (PVS 베이크는 워커 스레드에서 호출) */
+	thread_local TArray<std::pair<int32, float>> RayTraversalStack;
+	/** @brief OverlapFrustum 순회 스택 (노드 인덱스, 아직 검사해야 하는 평면 마스크) */
+	thread_local TArray<std::pair<int32, uint8>> FrustumTraversalStack;
+
+	/** @brief 레이와 AABB의 [InMinDistance, InMaxDistance] 구간 교차. 교차하면 진입 거리를 OutEntry에 담는다 */
+	bool IntersectRayBox(const FAABB& InBox, const FVector& InOrigin, const FVector& InInvDirection,
+		float InMinDistance, float InMaxDistance, float& OutEntry)
+	{
+		const float TX1 = (InBox.Min.X - InOrigin.X) * InInvDirection.X;
+		const float TX2 = (InBox.Max.X - InOrigin.X) * InInvDirection.X;
+		const float TY1 = (InBox.Min.Y - InOrigin.Y) * InInvDirection.Y;
+		const float TY2 = (InBox.Max.Y - InOrigin.Y) * InInvDirection.Y;
+		const float TZ1 = (InBox.Min.Z - InOrigin.Z) * InInvDirection.Z;
+		const float TZ2 = (InBox.Max.Z - InOrigin.Z) * InInvDirection.Z;
+
+		OutEntry = std::max({ std::min(TX1, TX2), std::min(TY1, TY2), std::min(TZ1, TZ2), InMinDistance });
+		const float Exit = std::min({ std::max(TX1, TX2), std::max(TY1, TY2), std::max(TZ1, TZ2), InMaxDistance });
+		return OutEntry <= Exit;
+	}
+
+	float GetAxisValue(const FVector& InVector, uint32 InAxis)
+	{
+		return InAxis == 0 ? InVector.X : (InAxis == 1 ? InVector.Y : InVector.Z);
+	}
+
+	FAABB MakeEmptyBounds()
+	{
+		return FAABB(FVector(FLT_MAX, FLT_MAX, FLT_MAX), FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX));
+	}
+
+	void GrowBounds(FAABB& InOutBounds, const FVector& InMin, const FVector& InMax)
+	{
+		InOutBounds.Min = FVector(std::min(InOutBounds.Min.X, InMin.X), std::min(InOutBounds.Min.Y, InMin.Y), std::min(InOutBounds.Min.Z, InMin.Z));
+		InOutBounds.Max = FVector(std::max(InOutBounds.Max.X, InMax.X), std::max(InOutBounds.Max.Y, InMax.Y), std::max(InOutBounds.Max.Z, InMax.Z));
+	}
+
+	/** @brief 일괄 구축 중 아직 노드를 만들지 않은 삼각형 구간. 노드를 만들면 부모의 Child1 또는 Child2에 연결한다 */
+	struct FBuildRange
+	{
+		uint32 Begin;
+		uint32 End;
+		int32 ParentIndex;
+		bool bIsChild1;
+	};
+
+	/**
+	 * @brief binned SAH 일괄 구축기.
+	 * 삼각형 순서 배열(TriangleOrder)의 구간을 제자리에서 나누므로, 서로 겹치지 않는 구간은 여러 스레드에서 동시에 구축할 수 있다.
+	 */
+	class FBinnedSAHBuilder
+	{
+	public:
+		static constexpr uint32 BIN_COUNT = 16;
+
+		explicit FBinnedSAHBuilder(const FStaticMesh& InMesh)
+		{
+			const uint32 TriangleCount = static_cast<uint32>(InMesh.Indices.size() / 3);
+			TriangleBounds.resize(TriangleCount);
+			Centroids.resize(TriangleCount);
+			TriangleOrder.resize(TriangleCount);
+
+			const uint32 ChunkCount = (TriangleCount + TRIANGLE_BOUNDS_CHUNK_SIZE - 1) / TRIANGLE_BOUNDS_CHUNK_SIZE;
+			ParallelFor(ChunkCount, [&](uint32 Chunk)
+			{
+				const uint32 Begin = Chunk * TRIANGLE_BOUNDS_CHUNK_SIZE;
+				const uint32 End = std::min(Begin + TRIANGLE_BOUNDS_CHUNK_SIZE, TriangleCount);
+				for (uint32 Triangle = Begin; Triangle < End; ++Triangle)
+				{
+					const uint32* TriangleIndices = &InMesh.Indices[Triangle * 3];
+					TriangleBounds[Triangle] = GetTriangleAABB(InMesh.Vertices[TriangleIndices[0]],
+						InMesh.Vertices[TriangleIndices[1]], InMesh.Vertices[TriangleIndices[2]]);
+					Centroids[Triangle] = TriangleBounds[Triangle].GetCenter();
+					TriangleOrder[Triangle] = Triangle;
+				}
+			});
+		}
+
+		uint32 GetTriangleCount() const { return static_cast<uint32>(TriangleOrder.size()); }
+
+		/**
+		 * @brief InRange를 루트로 하는 서브트리를 OutNodes 뒤에 깊이 우선 순서로 추가한다.
+		 * InDeferSize가 0보다 크면 삼각형 수가 그 이하인 구간은 노드를 만들지 않고 OutDeferred에 넘긴다.
+		 */
+		void BuildSubtree(const FBuildRange& InRange, TArray<FNode>& OutNodes, uint32 InDeferSize = 0, TArray<FBuildRange>* OutDeferred = nullptr)
+		{
+			TArray<FBuildRange> RangeStack;
+			RangeStack.push_back(InRange);
+
+			while (!RangeStack.empty())
+			{
+				const FBuildRange Range = RangeStack.back();
+				RangeStack.pop_back();
+
+				const uint32 Count = Range.End - Range.Begin;
+				if (OutDeferred && Count <= InDeferSize)
+				{
+					OutDeferred->push_back(Range);
+					continue;
+				}
+
+				FNode Node;
+				Node.ObjectIndex = static_cast<int32>(OutNodes.size());
+				Node.ParentIndex = Range.ParentIndex;
+				Node.Child1 = -1;
+				Node.Child2 = -1;
+
+				uint32 Split = Range.Begin;
+				if (Count == 1)
+				{
+					const uint32 Triangle = TriangleOrder[Range.Begin];
+					Node.bIsLeaf = true;
+					Node.Box = TriangleBounds[Triangle];
+					Node.TriangleBaseIndex = static_cast<int32>(Triangle * 3);
+				}
+				else
+				{
+					Split = Partition(Range.Begin, Range.End, Node.Box);
+					Node.bIsLeaf = false;
+					Node.TriangleBaseIndex = -1;
+				}
+
+				if (Range.ParentIndex >= 0)
+				{
+					FNode& Parent = OutNodes[Range.ParentIndex];
+					(Range.bIsChild1 ? Parent.Child1 : Parent.Child2) = Node.ObjectIndex;
+				}
+				OutNodes.push_back(Node);
+
+				if (!Node.bIsLeaf)
+				{
+					// 왼쪽 자식을 먼저 꺼내도록 오른쪽을 먼저 넣는다 (부모 바로 뒤에 왼쪽 서브트리가 놓인다)
+					RangeStack.push_back({ Split, Range.End, Node.ObjectIndex, false });
+					RangeStack.push_back({ Range.Begin, Split, Node.ObjectIndex, true });
+				}
+			}
+		}
+
+	private:
+		/**
+		 * @brief [InBegin, InEnd) 구간을 축마다 BIN_COUNT개의 중심 빈으로 나누어 SAH 비용이 가장 작은 평면으로 분할한다.
+		 * @param OutBounds 구간 전체 삼각형의 AABB
+		 * @return 오른쪽 구간의 시작 위치. 모든 중심이 한 점에 모여 나눌 수 없으면 구간의 가운데
+		 */
+		uint32 Partition(uint32 InBegin, uint32 InEnd, FAABB& OutBounds)
+		{
+			FAABB CentroidBounds = MakeEmptyBounds();
+			OutBounds = MakeEmptyBounds();
+			for (uint32 Index = InBegin; Index < InEnd; ++Index)
+			{
+				const uint32 Triangle = TriangleOrder[Index];
+				GrowBounds(OutBounds, TriangleBounds[Triangle].Min, TriangleBounds[Triangle].Max);
+				GrowBounds(CentroidBounds, Centroids[Triangle], Centroids[Triangle]);
+			}
+
+			const uint32 Middle = InBegin + (InEnd - InBegin) / 2;
+			if (InEnd - InBegin == 2) { return Middle; }
+
+			float BestCost = FLT_MAX;
+			uint32 BestAxis = 3;
+			uint32 BestSplitBin = 0;
+			for (uint32 Axis = 0; Axis < 3; ++Axis)
+			{
+				const float AxisMin = GetAxisValue(CentroidBounds.Min, Axis);
+				const float AxisExtent = GetAxisValue(CentroidBounds.Max, Axis) - AxisMin;
+				if (AxisExtent <= MATH_EPSILON) { continue; }
+
+				FAABB BinBounds[BIN_COUNT];
+				uint32 BinCounts[BIN_COUNT] = {};
+				for (uint32 Bin = 0; Bin < BIN_COUNT; ++Bin) { BinBounds[Bin] = MakeEmptyBounds(); }
+
+				const float BinScale = BIN_COUNT / AxisExtent;
+				for (uint32 Index = InBegin; Index < InEnd; ++Index)
+				{
+					const uint32 Triangle = TriangleOrder[Index];
+					const uint32 Bin = GetBin(GetAxisValue(Centroids[Triangle], Axis), AxisMin, BinScale);
+					GrowBounds(BinBounds[Bin], TriangleBounds[Triangle].Min, TriangleBounds[Triangle].Max);
+					++BinCounts[Bin];
+				}
+
+				// 오른쪽에서 왼쪽으로 누적한 면적/개수를 먼저 구해 두고, 왼쪽 누적과 맞춰 분할 평면마다 비용을 계산한다
+				float RightAreas[BIN_COUNT];
+				uint32 RightCounts[BIN_COUNT];
+				FAABB Accumulated = MakeEmptyBounds();
+				uint32 AccumulatedCount = 0;
+				for (uint32 Bin = BIN_COUNT - 1; Bin > 0; --Bin)
+				{
+					if (BinCounts[Bin] > 0) { GrowBounds(Accumulated, BinBounds[Bin].Min, BinBounds[Bin].Max); }
+					AccumulatedCount += BinCounts[Bin];
+					RightCounts[Bin] = AccumulatedCount;
+					RightAreas[Bin] = AccumulatedCount > 0 ? Accumulated.GetSurfaceArea() : 0.0f;
+				}
+
+				Accumulated = MakeEmptyBounds();
+				AccumulatedCount = 0;
+				for (uint32 SplitBin = 1; SplitBin < BIN_COUNT; ++SplitBin)
+				{
+					const uint32 LeftBin = SplitBin - 1;
+					if (BinCounts[LeftBin] > 0) { GrowBounds(Accumulated, BinBounds[LeftBin].Min, BinBounds[LeftBin].Max); }
+					AccumulatedCount += BinCounts[LeftBin];
+					if (AccumulatedCount == 0 || RightCounts[SplitBin] == 0) { continue; }
+
+					const float Cost = AccumulatedCount * Accumulated.GetSurfaceArea() + RightCounts[SplitBin] * RightAreas[SplitBin];
+					if (Cost < BestCost)
+					{
+						BestCost = Cost;
+						BestAxis = Axis;
+						BestSplitBin = SplitBin;
+					}
+				}
+			}
+
+			if (BestAxis == 3) { return Middle; }
+
+			const float AxisMin = GetAxisValue(CentroidBounds.Min, BestAxis);
+			const float BinScale = BIN_COUNT / (GetAxisValue(CentroidBounds.Max, BestAxis) - AxisMin);
+			const auto SplitIt = std::partition(TriangleOrder.begin() + InBegin, TriangleOrder.begin() + InEnd, [&](uint32 Triangle)
+			{
+				return GetBin(GetAxisValue(Centroids[Triangle], BestAxis), AxisMin, BinScale) < BestSplitBin;
+			});
+
+			const uint32 Split = static_cast<uint32>(SplitIt - TriangleOrder.begin());
+			return (Split == InBegin || Split == InEnd) ? Middle : Split;
+		}
+
+		static uint32 GetBin(float InValue, float InAxisMin, float InBinScale)
+		{
+			const int32 Bin = static_cast<int32>((InValue - InAxisMin) * InBinScale);
+			return static_cast<uint32>(std::clamp(Bin, 0, static_cast<int32>(BIN_COUNT) - 1));
+		}
+
+		TArray<FAABB> TriangleBounds;
+		TArray<FVector> Centroids;
+		TArray<uint32> TriangleOrder;
+	};
+}
+
 
 FBVH::FBVH(FStaticMesh* InMesh)
 {
@@ -27,6 +290,7 @@ void FBVH::Clear()
 	Nodes.clear();
 	RootIndex = -1;
 	Cost = 0.0f;
+	WideBVH.Clear();
 }
 
 int32 FBVH::InsertLeaf(int32 InTriangleBaseIndex)
@@ -463,6 +727,80 @@ void FBVH::Build(FStaticMesh* InMesh)
 	}
 	Clear();
 	Mesh = InMesh;
+
+	FBinnedSAHBuilder Builder(*Mesh);
+	const uint32 TriangleCount = Builder.GetTriangleCount();
+	if (TriangleCount == 0)
+	{
+		return;
+	}
+
+	// 1. 상위 분할은 호출 스레드에서 하고, DeferSize 이하로 나뉜 구간은 서브트리 작업으로 미룬다
+	//    삼각형이 적거나 워커가 없으면 루트 구간 하나가 그대로 작업이 된다
+	const uint32 WorkerCount = GetParallelWorkerCount();
+	const uint32 DeferSize = (WorkerCount == 0 || TriangleCount < PARALLEL_BUILD_MIN_TRIANGLES)
+		? TriangleCount
+		: std::max(PARALLEL_SUBTREE_MIN_TRIANGLES, TriangleCount / ((WorkerCount + 1) * 4));
+
+	Nodes.reserve(static_cast<size_t>(TriangleCount) * 2 - 1);
+	TArray<FBuildRange> SubtreeRanges;
+	Builder.BuildSubtree({ 0, TriangleCount, -1, true }, Nodes, DeferSize, &SubtreeRanges);
+
+	// 2. 서브트리는 서로 겹치지 않는 삼각형 구간을 다루므로 각자의 노드 배열에 병렬로 구축한다
+	TArray<TArray<FNode>> SubtreeNodes(SubtreeRanges.size());
+	ParallelFor(static_cast<uint32>(SubtreeRanges.size()), [&](uint32 Index)
+	{
+		const FBuildRange& Range = SubtreeRanges[Index];
+		SubtreeNodes[Index].reserve(static_cast<size_t>(Range.End - Range.Begin) * 2 - 1);
+		Builder.BuildSubtree({ Range.Begin, Range.End, -1, true }, SubtreeNodes[Index]);
+	});
+
+	// 3. 서브트리 노드를 인덱스를 옮겨 이어 붙이고, 서브트리 루트를 미뤄 둔 부모에 연결한다
+	for (uint32 Index = 0; Index < static_cast<uint32>(SubtreeRanges.size()); ++Index)
+	{
+		const FBuildRange& Range = SubtreeRanges[Index];
+		const int32 Offset = static_cast<int32>(Nodes.size());
+		for (FNode& Node : SubtreeNodes[Index])
+		{
+			Node.ObjectIndex += Offset;
+			Node.ParentIndex = Node.ParentIndex == -1 ? Range.ParentIndex : Node.ParentIndex + Offset;
+			if (!Node.bIsLeaf)
+			{
+				Node.Child1 += Offset;
+				Node.Child2 += Offset;
+			}
+			Nodes.push_back(Node);
+		}
+
+		if (Range.ParentIndex >= 0)
+		{
+			FNode& Parent = Nodes[Range.ParentIndex];
+			(Range.bIsChild1 ? Parent.Child1 : Parent.Child2) = Offset;
+		}
+	}
+	RootIndex = 0;
+
+	// 전체 비용 계산
+	Cost = GetCost(RootIndex);
+	// 유효성 검사
+	if (!CheckValidity())
+	{
+		std::cerr << "FBVH::Build: BVH structure is invalid after build." << std::endl;
+	}
+
+	// Ray 쿼리는 이진 트리를 접은 넓은 트리로 한다
+	WideBVH.Build(*this);
+}
+
+void FBVH::BuildIncremental(FStaticMesh* InMesh)
+{
+	if (!InMesh)
+	{
+		std::cerr << "FBVH::BuildIncremental: Input mesh is null." << std::endl;
+		return;
+	}
+	Clear();
+	Mesh = InMesh;
 	// 모든 삼각형에 대해 Leaf 노드 삽입
 	int32 TriangleCount = static_cast<int32>(Mesh->Indices.size()) / 3;
 	for (int32 i = 0; i < TriangleCount; ++i)
@@ -475,7 +813,355 @@ void FBVH::Build(FStaticMesh* InMesh)
 	// 유효성 검사
 	if (!CheckValidity())
 	{
-		std::cerr << "FBVH::Build: BVH structure is invalid after build." << std::endl;
+		std::cerr << "FBVH::BuildIncremental: BVH structure is invalid after build." << std::endl;
+	}
+
+	WideBVH.Build(*this);
+}
+
+void FBVH::Serialize(FArchive& Ar, FStaticMesh* InMesh)
+{
+	TArray<FCookedBVHNode> CookedNodes;
+	if (Ar.IsLoading())
+	{
+		Clear();
+		Mesh = InMesh;
+	}
+	else
+	{
+		CookedNodes.reserve(Nodes.size());
+		for (const FNode& Node : Nodes)
+		{
+			CookedNodes.push_back({ Node.ObjectIndex, Node.ParentIndex, Node.Child1, Node.Child2, Node.TriangleBaseIndex, Node.bIsLeaf ? 1u : 0u,
+				{ Node.Box.Min.X, Node.Box.Min.Y, Node.Box.Min.Z }, { Node.Box.Max.X, Node.Box.Max.Y, Node.Box.Max.Z } });
+		}
+	}
+
+	Ar << RootIndex;
+	Ar << Cost;
+	Ar << CookedNodes;
+
+	if (Ar.IsLoading())
+	{
+		Nodes.resize(CookedNodes.size());
+		for (size_t Index = 0; Index < CookedNodes.size(); ++Index)
+		{
+			const FCookedBVHNode& Cooked = CookedNodes[Index];
+			FNode& Node = Nodes[Index];
+			Node.ObjectIndex = Cooked.ObjectIndex;
+			Node.ParentIndex = Cooked.ParentIndex;
+			Node.Child1 = Cooked.Child1;
+			Node.Child2 = Cooked.Child2;
+			Node.TriangleBaseIndex = Cooked.TriangleBaseIndex;
+			Node.bIsLeaf = Cooked.bIsLeaf != 0;
+			Node.Box = FAABB(FVector(Cooked.Min[0], Cooked.Min[1], Cooked.Min[2]), FVector(Cooked.Max[0], Cooked.Max[1], Cooked.Max[2]));
+		}
+	}
+
+	// 폭이 다른 빌드가 쓴 캐시면 이진 트리를 다시 접는다 (삼각형을 다시 나누는 것보다 훨씬 싸다)
+	if (!WideBVH.Serialize(Ar, InMesh) && Ar.IsLoading())
+	{
+		WideBVH.Build(*this);
 	}
 }
 
+float FBVH::GetSAHCost() const
+{
+	if (RootIndex < 0 || RootIndex >= static_cast<int32>(Nodes.size()))
+	{
+		return 0.0f;
+	}
+
+	const float RootArea = Nodes[RootIndex].Box.GetSurfaceArea();
+	if (RootArea <= 0.0f)
+	{
+		return 0.0f;
+	}
+
+	// 모든 노드가 루트에서 닿으므로 배열을 한 번 훑어 표면적을 더한다
+	float AreaSum = 0.0f;
+	for (const FNode& Node : Nodes)
+	{
+		AreaSum += Node.Box.GetSurfaceArea();
+	}
+	return AreaSum / RootArea;
+}
+
+bool FBVH::ClosestHit(const FRay& Ray, FBVHRayHit& OutHit, float MinDistance, float MaxDistance) const
+{
+	if (WideBVH.IsBuilt())
+	{
+		return WideBVH.ClosestHit(Ray, OutHit, MinDistance, MaxDistance);
+	}
+	return IntersectRay(Ray, OutHit, MinDistance, MaxDistance, false);
+}
+
+bool FBVH::AnyHit(const FRay& Ray, FBVHRayHit& OutHit, float MinDistance, float MaxDistance) const
+{
+	if (WideBVH.IsBuilt())
+	{
+		return WideBVH.AnyHit(Ray, OutHit, MinDistance, MaxDistance);
+	}
+	return IntersectRay(Ray, OutHit, MinDistance, MaxDistance, true);
+}
+
+bool FBVH::ClosestHitBinary(const FRay& Ray, FBVHRayHit& OutHit, float MinDistance, float MaxDistance) const
+{
+	return IntersectRay(Ray, OutHit, MinDistance, MaxDistance, false);
+}
+
+bool FBVH::OverlapFrustum(const FFrustum& InFrustum, bool bRequireContainment) const
+{
+	if (!Mesh || RootIndex < 0 || RootIndex >= static_cast<int32>(Nodes.size()))
+	{
+		return false;
+	}
+
+	FVector Corners[8];
+	const FVector* CornerPointer = InFrustum.GetCorners(Corners) ? Corners : nullptr;
+
+	TArray<std::pair<int32, uint8>>& NodeStack = FrustumTraversalStack;
+	NodeStack.clear();
+	NodeStack.emplace_back(RootIndex, FFrustum::ALL_PLANES_MASK);
+
+	while (!NodeStack.empty())
+	{
+		const auto [NodeIndex, ParentPlaneMask] = NodeStack.back();
+		NodeStack.pop_back();
+
+		const FNode& Node = Nodes[NodeIndex];
+		uint8 PlaneMask = ParentPlaneMask;
+		uint8 RejectingPlane = 0;
+		const EBoundCheckResult Result = InFrustum.CheckIntersection(Node.Box, PlaneMask, RejectingPlane);
+
+		// 노드 박스가 완전히 바깥이면 서브트리의 삼각형도 모두 바깥이고, 완전히 안쪽이면 모두 안쪽이다
+		if (Result == EBoundCheckResult::Outside)
+		{
+			if (bRequireContainment) { return false; }
+			continue;
+		}
+		if (Result == EBoundCheckResult::Inside)
+		{
+			if (!bRequireContainment) { return true; }
+			continue;
+		}
+
+		if (Node.bIsLeaf)
+		{
+			const uint32* TriangleIndices = &Mesh->Indices[Node.TriangleBaseIndex];
+			const FVector& V0 = Mesh->Vertices[TriangleIndices[0]].Position;
+			const FVector& V1 = Mesh->Vertices[TriangleIndices[1]].Position;
+			const FVector& V2 = Mesh->Vertices[TriangleIndices[2]].Position;
+
+			if (bRequireContainment)
+			{
+				// 박스가 안쪽에 있는 평면은 마스크에서 빠졌으므로 남은 평면만 검사한다
+				for (int32 Plane = 0; Plane < 6; ++Plane)
+				{
+					if ((PlaneMask & (1u << Plane)) == 0) { continue; }
+
+					const FVector4& P = InFrustum.Planes[Plane];
+					if (P.Dot3(V0) + P.W > 0 || P.Dot3(V1) + P.W > 0 || P.Dot3(V2) + P.W > 0)
+					{
+						return false;
+					}
+				}
+			}
+			else if (IntersectTriangleFrustum(InFrustum, CornerPointer, V0, V1, V2))
+			{
+				return true;
+			}
+			continue;
+		}
+
+		NodeStack.emplace_back(Node.Child1, PlaneMask);
+		NodeStack.emplace_back(Node.Child2, PlaneMask);
+	}
+
+	return bRequireContainment;
+}
+
+bool FBVH::IntersectTriangleFrustum(const FFrustum& InFrustum, const FVector* InCorners, const FVector& V0, const FVector& V1, const FVector& V2)
+{
+	// 1. 절두체 평면: 세 점이 모두 한 평면의 바깥이면 분리되고, 한 점이라도 절두체 안에 있으면 겹친다
+	for (int32 Plane = 0; Plane < 6; ++Plane)
+	{
+		const FVector4& P = InFrustum.Planes[Plane];
+		if (P.Dot3(V0) + P.W > 0 && P.Dot3(V1) + P.W > 0 && P.Dot3(V2) + P.W > 0)
+		{
+			return false;
+		}
+	}
+	if (InFrustum.ContainsPoint(V0) || InFrustum.ContainsPoint(V1) || InFrustum.ContainsPoint(V2) || !InCorners)
+	{
+		return true;
+	}
+
+	// 2. 나머지 분리축: 삼각형 법선과 (삼각형 변 x 절두체 모서리). 축에 투영한 두 구간이 떨어져 있으면 분리된다
+	const auto IsSeparated = [&](const FVector& InAxis)
+	{
+		const float T0 = InAxis.Dot(V0);
+		const float T1 = InAxis.Dot(V1);
+		const float T2 = InAxis.Dot(V2);
+		const float TriangleMin = std::min({ T0, T1, T2 });
+		const float TriangleMax = std::max({ T0, T1, T2 });
+
+		float FrustumMin = FLT_MAX;
+		float FrustumMax = -FLT_MAX;
+		for (int32 Corner = 0; Corner < 8; ++Corner)
+		{
+			const float T = InAxis.Dot(InCorners[Corner]);
+			FrustumMin = std::min(FrustumMin, T);
+			FrustumMax = std::max(FrustumMax, T);
+		}
+		return FrustumMax < TriangleMin || FrustumMin > TriangleMax;
+	};
+
+	const FVector TriangleEdges[3] = { V1 - V0, V2 - V1, V0 - V2 };
+	if (IsSeparated(TriangleEdges[0].Cross(TriangleEdges[1])))
+	{
+		return false;
+	}
+
+	// Near/Far 평면이 평행하므로 Far 면의 모서리는 Near 면 모서리와 방향이 같다. 길이가 0인 축은 분리하지 못하므로 그대로 둔다
+	const FVector FrustumEdges[8] =
+	{
+		InCorners[1] - InCorners[0], InCorners[3] - InCorners[2], InCorners[2] - InCorners[0], InCorners[3] - InCorners[1],
+		InCorners[4] - InCorners[0], InCorners[5] - InCorners[1], InCorners[6] - InCorners[2], InCorners[7] - InCorners[3],
+	};
+	for (const FVector& TriangleEdge : TriangleEdges)
+	{
+		for (const FVector& FrustumEdge : FrustumEdges)
+		{
+			if (IsSeparated(TriangleEdge.Cross(FrustumEdge)))
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+FVector FBVH::GetSafeInverseDirection(const FVector& InDirection)
+{
+	// 0에 가까운 성분은 부호를 유지한 큰 값으로 바꿔 slab 검사에서 NaN이 나오지 않게 한다
+	const auto SafeInverse = [](float InValue)
+	{
+		return 1.0f / (fabsf(InValue) > 1e-12f ? InValue : (InValue < 0.0f ? -1e-12f : 1e-12f));
+	};
+	return FVector(SafeInverse(InDirection.X), SafeInverse(InDirection.Y), SafeInverse(InDirection.Z));
+}
+
+bool FBVH::IntersectTriangle(const FVector& InOrigin, const FVector& InDirection, const FVector& V0, const FVector& V1, const FVector& V2,
+	float InMinDistance, float InMaxDistance, float& OutT, float& OutU, float& OutV)
+{
+	const FVector E1 = V1 - V0;
+	const FVector E2 = V2 - V0;
+	const FVector P = InDirection.Cross(E2);
+	const float Determinant = E1.Dot(P);
+	if (Determinant == 0.0f) { return false; }
+
+	const float InvDeterminant = 1.0f / Determinant;
+	const FVector S = InOrigin - V0;
+	const float U = S.Dot(P) * InvDeterminant;
+	if (U < 0.0f || U > 1.0f) { return false; }
+
+	const FVector Q = S.Cross(E1);
+	const float V = InDirection.Dot(Q) * InvDeterminant;
+	if (V < 0.0f || U + V > 1.0f) { return false; }
+
+	const float T = E2.Dot(Q) * InvDeterminant;
+	if (T < InMinDistance || T > InMaxDistance) { return false; }
+
+	OutT = T;
+	OutU = U;
+	OutV = V;
+	return true;
+}
+
+bool FBVH::IntersectRay(const FRay& Ray, FBVHRayHit& OutHit, float MinDistance, float MaxDistance, bool bStopAtFirstHit) const
+{
+	OutHit = FBVHRayHit();
+	if (!Mesh || RootIndex < 0 || RootIndex >= static_cast<int32>(Nodes.size()) || MinDistance > MaxDistance)
+	{
+		return false;
+	}
+
+	const FVector Origin(Ray.Origin.X, Ray.Origin.Y, Ray.Origin.Z);
+	const FVector Direction(Ray.Direction.X, Ray.Direction.Y, Ray.Direction.Z);
+	const FVector InvDirection = GetSafeInverseDirection(Direction);
+
+	float RootEntry;
+	if (!IntersectRayBox(Nodes[RootIndex].Box, Origin, InvDirection, MinDistance, MaxDistance, RootEntry))
+	{
+		return false;
+	}
+
+	// 스택 항목은 (노드 인덱스, 노드 진입 거리). 꺼낼 때 그 사이 줄어든 최대 거리보다 멀면 건너뛴다
+	TArray<std::pair<int32, float>>& NodeStack = RayTraversalStack;
+	NodeStack.clear();
+	NodeStack.emplace_back(RootIndex, RootEntry);
+
+	float Closest = MaxDistance;
+	bool bHit = false;
+	while (!NodeStack.empty())
+	{
+		const auto [NodeIndex, Entry] = NodeStack.back();
+		NodeStack.pop_back();
+		if (Entry > Closest)
+		{
+			continue;
+		}
+
+		const FNode& Node = Nodes[NodeIndex];
+		if (Node.bIsLeaf)
+		{
+			const uint32* TriangleIndices = &Mesh->Indices[Node.TriangleBaseIndex];
+			float T, U, V;
+			if (IntersectTriangle(Origin, Direction, Mesh->Vertices[TriangleIndices[0]].Position, Mesh->Vertices[TriangleIndices[1]].Position,
+				Mesh->Vertices[TriangleIndices[2]].Position, MinDistance, Closest, T, U, V))
+			{
+				Closest = T;
+				OutHit.Distance = T;
+				OutHit.TriangleIndex = Node.TriangleBaseIndex / 3;
+				OutHit.U = U;
+				OutHit.V = V;
+				bHit = true;
+
+				if (bStopAtFirstHit)
+				{
+					return true;
+				}
+			}
+			continue;
+		}
+
+		// 가까운 자식을 나중에 넣어 먼저 꺼낸다
+		float Entry1, Entry2;
+		const bool bHitChild1 = IntersectRayBox(Nodes[Node.Child1].Box, Origin, InvDirection, MinDistance, Closest, Entry1);
+		const bool bHitChild2 = IntersectRayBox(Nodes[Node.Child2].Box, Origin, InvDirection, MinDistance, Closest, Entry2);
+		if (bHitChild1 && bHitChild2)
+		{
+			if (Entry1 <= Entry2)
+			{
+				NodeStack.emplace_back(Node.Child2, Entry2);
+				NodeStack.emplace_back(Node.Child1, Entry1);
+			}
+			else
+			{
+				NodeStack.emplace_back(Node.Child1, Entry1);
+				NodeStack.emplace_back(Node.Child2, Entry2);
+			}
+		}
+		else if (bHitChild1)
+		{
+			NodeStack.emplace_back(Node.Child1, Entry1);
+		}
+		else if (bHitChild2)
+		{
+			NodeStack.emplace_back(Node.Child2, Entry2);
+		}
+	}
+
+	return bHit;
+}
@@ -1,9 +1,12 @@
 #pragma once
 #include "pch.h"
 #include "Physics/Public/AABB.h"
+#include "Global/WideBVH.h"
 
 class UPrimitiveComponent;
 struct FStaticMesh;
+struct FArchive;
+struct FFrustum;
 
 struct FNode
 {
@@ -16,6 +19,17 @@ struct FNode
 	int32 TriangleBaseIndex; // �ε��� ���ۿ��� �ﰢ���� ���� �ε���
 };
 
+/**
+* @brief FBVH::ClosestHit/AnyHit 결과. 충돌 지점은 (1 - U - V) * V0 + U * V1 + V * V2.
+*/
+struct FBVHRayHit
+{
+	float Distance = FLT_MAX;   // 레이 매개변수 T (Ray.Direction 길이 단위)
+	int32 TriangleIndex = -1;   // 삼각형 번호 (TraverseRay와 같은 Triangle ordinal)
+	float U = 0.0f;
+	float V = 0.0f;
+};
+
 //  Phase Picking에 사용되는 BVH (Bounding Volume Hierarchy)
 class FBVH
 {
@@ -23,13 +37,31 @@ public:
 	FBVH() = default;
 	explicit FBVH(FStaticMesh* InMesh);
 
+	/**
+	* @brief 메시의 모든 삼각형으로 top-down binned SAH 트리를 일괄 구축한다. (리프 하나에 삼각형 하나)
+	* @note 상위 분할은 호출 스레드에서 하고, 일정 크기 이하로 나뉜 서브트리는 ParallelFor로 병렬 구축한 뒤 노드 배열에 이어 붙인다.
+	*/
 	void Build(FStaticMesh* InMesh);
+	/**
+	* @brief 삼각형을 하나씩 InsertLeaf로 삽입해 구축한다. 일괄 구축과 트리 품질/구축 시간을 비교할 때 사용.
+	*/
+	void BuildIncremental(FStaticMesh* InMesh);
 	int32 GetRootIndex() const { return RootIndex; }
+	const FStaticMesh* GetMesh() const { return Mesh; }
+	/** @brief Build/BuildIncremental 끝에 이 트리를 접어 만든 Ray 쿼리용 넓은 트리 */
+	const FMeshWideBVH& GetWideBVH() const { return WideBVH; }
 	int32 GetNodeCount() const { return Nodes.size(); }
 	const FNode& GetNode(uint32 Index) const;
 	FNode& GetNode(uint32 Index);
 	void Clear();
 
+	/**
+	* @brief 노드 배열과 넓은 트리를 쿠킹된 메시 캐시에 읽고 쓴다.
+	* @param InMesh: 로드할 때 트리를 연결할 메시. 노드의 삼각형 인덱스는 이 메시의 Indices를 가리킨다
+	* @note 캐시의 넓은 트리 폭이 현재 빌드와 다르면 로드한 이진 트리를 다시 접는다.
+	*/
+	void Serialize(FArchive& Ar, FStaticMesh* InMesh);
+
 	/**
 	* @brief 서브트리의 cost(노드가 가진 AABB의 표면적 합)을 계산.
 	* @param SubTreeRootIndex: cost 계산 시작 노드 인덱스
@@ -38,6 +70,12 @@ public:
 	*/
 	float GetCost(int32 SubTreeRootIndex, bool bInternalOnly = false) const;
 
+	/**
+	* @brief 루트 표면적으로 정규화한 SAH 비용 (노드 순회 비용과 삼각형 검사 비용을 1로 둔다).
+	* @return 레이 하나가 평균적으로 검사하는 노드 수의 기댓값. 빈 트리면 0
+	*/
+	float GetSAHCost() const;
+
 	/**
 	* @brief: 트리의 유효성 검사.
 	*/
@@ -51,6 +89,50 @@ public:
 	*/
 	bool TraverseRay(const FRay& Ray, TArray<int32>& OutTriangleIndices) const;
 
+	/**
+	* @brief: Ray와 가장 가까운 삼각형 충돌을 찾는다. 리프에서 삼각형을 직접 검사하고, 가까운 자식 노드부터 방문하며,
+	* 충돌을 찾을 때마다 최대 거리를 줄여 그보다 먼 노드는 건너뛴다. (양면 판정)
+	* 넓은 트리(GetWideBVH)가 만들어져 있으면 그쪽으로 순회한다.
+	* @param Ray: 모델 좌표계 Ray. 방향은 정규화하지 않아도 되며 거리는 방향 길이 단위의 T
+	* @param MinDistance, MaxDistance: T가 이 범위 밖인 충돌은 무시
+	* @return: 충돌이 있으면 true, OutHit에 거리/삼각형 번호/무게중심 좌표를 담는다
+	*/
+	bool ClosestHit(const FRay& Ray, FBVHRayHit& OutHit, float MinDistance = 0.0f, float MaxDistance = FLT_MAX) const;
+
+	/**
+	* @brief: 범위 안의 충돌이 하나라도 있는지 검사한다 (그림자/가시성 Ray용). 처음 찾은 충돌에서 순회를 멈추며,
+	* OutHit은 가장 가까운 충돌이 아닐 수 있다.
+	*/
+	bool AnyHit(const FRay& Ray, FBVHRayHit& OutHit, float MinDistance = 0.0f, float MaxDistance = FLT_MAX) const;
+
+	/**
+	* @brief: 넓은 트리를 거치지 않고 이진 트리로 ClosestHit를 수행한다. 두 순회의 결과/속도 비교용
+	*/
+	bool ClosestHitBinary(const FRay& Ray, FBVHRayHit& OutHit, float MinDistance = 0.0f, float MaxDistance = FLT_MAX) const;
+
+	/**
+	* @brief: 모델 좌표계 절두체와 메시 삼각형의 겹침을 검사한다 (마퀴 선택용). 노드 박스가 절두체 완전히 안쪽/바깥이면
+	* 서브트리를 삼각형 없이 판정하고, 박스가 안쪽에 있는 평면은 자식 노드에서 다시 검사하지 않는다.
+	* @param InFrustum: 모델 좌표계 절두체. FFrustum::TransformToLocal처럼 평면이 정규화되지 않아도 된다
+	* @param bRequireContainment: false면 삼각형 하나라도 겹칠 때, true면 모든 삼각형이 절두체 안에 있을 때 true
+	*/
+	bool OverlapFrustum(const FFrustum& InFrustum, bool bRequireContainment) const;
+
+	/**
+	* @brief: 삼각형과 절두체의 분리축(SAT) 교차 검사. 절두체 평면, 삼각형 평면, 삼각형 변과 절두체 모서리의 외적을 분리축으로 쓴다.
+	* @param InCorners: InFrustum.GetCorners의 꼭짓점 8개. nullptr이면 절두체 평면만 검사하므로 모서리 부근에서 겹친다고 판정할 수 있다
+	*/
+	static bool IntersectTriangleFrustum(const FFrustum& InFrustum, const FVector* InCorners, const FVector& V0, const FVector& V1, const FVector& V2);
+
+	/** @brief 방향의 역수. 0에 가까운 성분은 부호를 유지한 큰 값이 된다 (slab 검사용) */
+	static FVector GetSafeInverseDirection(const FVector& InDirection);
+
+	/**
+	* @brief: 양면 Moller-Trumbore 교차. T가 [InMinDistance, InMaxDistance] 안이면 T와 무게중심 좌표를 담는다
+	*/
+	static bool IntersectTriangle(const FVector& InOrigin, const FVector& InDirection, const FVector& V0, const FVector& V1, const FVector& V2,
+		float InMinDistance, float InMaxDistance, float& OutT, float& OutU, float& OutV);
+
 	/**
 	* @brief: 새 리프 노드를 특정 노드의 형제로 추가했을 때 전체 뉱업 트리의 비용 증가량 계산
 	* @param CandidateIndex: 후보 형제 노드 인덱스
@@ -76,10 +158,14 @@ private:
 	//@brief 주어진 노드의 '부모'부터 루트까지 올라가며 AABB Refit 수행.
 	void RefitAncestors(int32 RefitStartIndex);
 
+	//@brief ClosestHit/AnyHit 공용 순회. bStopAtFirstHit이면 처음 찾은 충돌에서 멈춘다.
+	bool IntersectRay(const FRay& Ray, FBVHRayHit& OutHit, float MinDistance, float MaxDistance, bool bStopAtFirstHit) const;
+
 	FStaticMesh* Mesh = nullptr; // BVH 원본 메시
 	TArray<FNode> Nodes;
 	int32 RootIndex = -1;
 	float Cost = 0.0f;
+	FMeshWideBVH WideBVH;
 };
 
 FAABB GetTriangleAABB(const FNormalVertex& V0, const FNormalVertex& V1, const FNormalVertex& V2);
\ No newline at end of file
@@ -0,0 +1,603 @@
+#include "pch.h"
+#include "Global/DynamicAABBTree.h"
+#include "Component/Public/PrimitiveComponent.h"
+#include "Optimization/Public/ViewVolumeCuller.h"
+#include "Optimization/Public/FrustumCullingKernel.h"
+
+namespace
+{
+	FAABB GetPrimitiveBoundingBox(UPrimitiveComponent* InPrimitive)
+	{
+		FVector Min, Max;
+		InPrimitive->GetWorldAABB(Min, Max);
+		return FAABB(Min, Max);
+	}
+
+	bool IsValidBoundingBox(const FAABB& InBox)
+	{
+		return std::isfinite(InBox.Min.X) && std::isfinite(InBox.Min.Y) && std::isfinite(InBox.Min.Z) &&
+			std::isfinite(InBox.Max.X) && std::isfinite(InBox.Max.Y) && std::isfinite(InBox.Max.Z) &&
+			InBox.Min.X <= InBox.Max.X && InBox.Min.Y <= InBox.Max.Y && InBox.Min.Z <= InBox.Max.Z;
+	}
+
+	float GetFatMargin(const FAABB& InBox)
+	{
+		const FVector HalfSize = (InBox.Max - InBox.Min) * 0.5f;
+		return FAT_AABB_MIN_MARGIN + FAT_AABB_MARGIN_RATIO * std::max({ HalfSize.X, HalfSize.Y, HalfSize.Z });
+	}
+
+	FAABB ExpandBox(const FAABB& InBox, float InMargin)
+	{
+		const FVector Margin(InMargin, InMargin, InMargin);
+		return FAABB(InBox.Min - Margin, InBox.Max + Margin);
+	}
+}
+
+FDynamicAABBTree::~FDynamicAABBTree()
+{
+	Clear();
+}
+
+bool FDynamicAABBTree::Insert(UPrimitiveComponent* InPrimitive)
+{
+	if (!InPrimitive) { return false; }
+
+	if (Contains(InPrimitive))
+	{
+		return Update(InPrimitive);
+	}
+
+	const FAABB PrimitiveBox = GetPrimitiveBoundingBox(InPrimitive);
+	if (!IsValidBoundingBox(PrimitiveBox)) { return false; }
+
+	const int32 LeafIndex = AllocateNode();
+	FDynamicAABBTreeNode& Leaf = Nodes[LeafIndex];
+	Leaf.Box = MakeFatBox(PrimitiveBox);
+	Leaf.Primitive = InPrimitive;
+	Leaf.Height = 0;
+
+	InsertLeaf(LeafIndex);
+
+	InPrimitive->DynamicTreeProxy = LeafIndex;
+	++NumPrimitives;
+	return true;
+}
+
+bool FDynamicAABBTree::Remove(UPrimitiveComponent* InPrimitive)
+{
+	if (!Contains(InPrimitive)) { return false; }
+
+	const int32 LeafIndex = InPrimitive->DynamicTreeProxy;
+	RemoveLeaf(LeafIndex);
+	FreeNode(LeafIndex);
+
+	InPrimitive->DynamicTreeProxy = -1;
+	--NumPrimitives;
+	return true;
+}
+
+bool FDynamicAABBTree::Update(UPrimitiveComponent* InPrimitive)
+{
+	if (!Contains(InPrimitive)) { return false; }
+
+	const FAABB PrimitiveBox = GetPrimitiveBoundingBox(InPrimitive);
+	if (!IsValidBoundingBox(PrimitiveBox))
+	{
+		Remove(InPrimitive);
+		return false;
+	}
+
+	const int32 LeafIndex = InPrimitive->DynamicTreeProxy;
+	const FAABB OldFatBox = Nodes[LeafIndex].Box;
+
+	// Fat AABB 안에서 움직였다면 그대로 둔다.
+	// 단, 이동 예측으로 늘어난 Fat AABB가 지나치게 크게 남아있다면 쿼리 효율을 위해 줄여서 다시 넣는다.
+	if (OldFatBox.IsContains(PrimitiveBox))
+	{
+		const FAABB HugeBox = ExpandBox(PrimitiveBox, GetFatMargin(PrimitiveBox) * 4.0f);
+		if (HugeBox.IsContains(OldFatBox))
+		{
+			return true;
+		}
+	}
+
+	RemoveLeaf(LeafIndex);
+
+	// 이동 방향으로 Fat AABB를 늘려, 같은 방향으로 계속 움직이는 동안 재삽입 빈도를 줄인다
+	FAABB FatBox = MakeFatBox(PrimitiveBox);
+	const FVector Displacement = (PrimitiveBox.GetCenter() - OldFatBox.GetCenter()) * FAT_AABB_DISPLACEMENT_MULTIPLIER;
+	(Displacement.X < 0.0f ? FatBox.Min.X : FatBox.Max.X) += Displacement.X;
+	(Displacement.Y < 0.0f ? FatBox.Min.Y : FatBox.Max.Y) += Displacement.Y;
+	(Displacement.Z < 0.0f ? FatBox.Min.Z : FatBox.Max.Z) += Displacement.Z;
+
+	Nodes[LeafIndex].Box = FatBox;
+	InsertLeaf(LeafIndex);
+	return true;
+}
+
+bool FDynamicAABBTree::Contains(const UPrimitiveComponent* InPrimitive) const
+{
+	if (!InPrimitive) { return false; }
+
+	const int32 LeafIndex = InPrimitive->DynamicTreeProxy;
+	return LeafIndex >= 0 && LeafIndex < static_cast<int32>(Nodes.size()) && Nodes[LeafIndex].Primitive == InPrimitive;
+}
+
+void FDynamicAABBTree::Clear()
+{
+	for (int32 NodeIndex = 0; NodeIndex < static_cast<int32>(Nodes.size()); ++NodeIndex)
+	{
+		UPrimitiveComponent* Primitive = Nodes[NodeIndex].Primitive;
+		if (Primitive && Primitive->DynamicTreeProxy == NodeIndex)
+		{
+			Primitive->DynamicTreeProxy = -1;
+		}
+	}
+
+	Nodes.clear();
+	RootIndex = -1;
+	FreeList = -1;
+	NumPrimitives = 0;
+}
+
+void FDynamicAABBTree::QueryFrustum(const FFrustum& InFrustum, TArray<UPrimitiveComponent*>& OutPrimitives) const
+{
+	if (RootIndex == -1) { return; }
+
+	// 내부 노드만 하나씩 검사하고, 겹치는 노드의 자식 리프는 모아 두었다가 SIMD 커널로 한 번에 검사한다
+	FPrimitiveBoundsSoA LeafBatch;
+	const auto AddLeafOrPush = [this, &LeafBatch](int32 InNodeIndex, TArray<int32>& OutStack)
+	{
+		const FDynamicAABBTreeNode& Node = Nodes[InNodeIndex];
+		if (!Node.IsLeaf())
+		{
+			OutStack.push_back(InNodeIndex);
+		}
+		else if (Node.Primitive->IsVisible())
+		{
+			LeafBatch.Add(Node.Primitive, Node.Box.Min, Node.Box.Max);
+		}
+	};
+
+	TArray<int32> NodeStack;
+	AddLeafOrPush(RootIndex, NodeStack);
+
+	while (!NodeStack.empty())
+	{
+		const int32 NodeIndex = NodeStack.back();
+		NodeStack.pop_back();
+
+		const FDynamicAABBTreeNode& Node = Nodes[NodeIndex];
+		const EBoundCheckResult Result = InFrustum.CheckIntersection(Node.Box);
+
+		if (Result == EBoundCheckResult::Outside)
+		{
+			continue;
+		}
+
+		// 완전히 안쪽이면 서브트리 전체를 검사 없이 추가
+		if (Result == EBoundCheckResult::Inside)
+		{
+			AppendSubtree(NodeIndex, OutPrimitives, true);
+			continue;
+		}
+
+		AddLeafOrPush(Node.Child1, NodeStack);
+		AddLeafOrPush(Node.Child2, NodeStack);
+	}
+
+	LeafBatch.Cull(FFrustumCullingKernel(InFrustum));
+	LeafBatch.AppendVisible(OutPrimitives);
+}
+
+void FDynamicAABBTree::QueryRay(const FRay& InRay, TArray<UPrimitiveComponent*>& OutPrimitives) const
+{
+	if (RootIndex == -1) { return; }
+
+	TArray<int32> NodeStack;
+	NodeStack.push_back(RootIndex);
+
+	while (!NodeStack.empty())
+	{
+		const int32 NodeIndex = NodeStack.back();
+		NodeStack.pop_back();
+
+		const FDynamicAABBTreeNode& Node = Nodes[NodeIndex];
+		if (!CheckIntersectionRayBox(InRay, Node.Box)) { continue; }
+
+		if (Node.IsLeaf())
+		{
+			OutPrimitives.push_back(Node.Primitive);
+			continue;
+		}
+
+		NodeStack.push_back(Node.Child1);
+		NodeStack.push_back(Node.Child2);
+	}
+}
+
+void FDynamicAABBTree::QueryAABB(const FAABB& InBox, TArray<UPrimitiveComponent*>& OutPrimitives) const
+{
+	if (RootIndex == -1) { return; }
+
+	TArray<int32> NodeStack;
+	NodeStack.push_back(RootIndex);
+
+	while (!NodeStack.empty())
+	{
+		const int32 NodeIndex = NodeStack.back();
+		NodeStack.pop_back();
+
+		const FDynamicAABBTreeNode& Node = Nodes[NodeIndex];
+		if (!Node.Box.IsIntersected(InBox)) { continue; }
+
+		if (Node.IsLeaf())
+		{
+			OutPrimitives.push_back(Node.Primitive);
+			continue;
+		}
+
+		NodeStack.push_back(Node.Child1);
+		NodeStack.push_back(Node.Child2);
+	}
+}
+
+void FDynamicAABBTree::GetAllPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives) const
+{
+	if (RootIndex == -1) { return; }
+
+	AppendSubtree(RootIndex, OutPrimitives, false);
+}
+
+bool FDynamicAABBTree::CheckValidity() const
+{
+	if (RootIndex == -1) { return NumPrimitives == 0; }
+	if (Nodes[RootIndex].Parent != -1) { return false; }
+
+	uint32 LeafCount = 0;
+	TArray<int32> NodeStack;
+	NodeStack.push_back(RootIndex);
+
+	while (!NodeStack.empty())
+	{
+		const int32 NodeIndex = NodeStack.back();
+		NodeStack.pop_back();
+
+		const FDynamicAABBTreeNode& Node = Nodes[NodeIndex];
+		if (Node.IsLeaf())
+		{
+			if (Node.Height != 0 || Node.Child2 != -1 || !Node.Primitive || Node.Primitive->DynamicTreeProxy != NodeIndex)
+			{
+				return false;
+			}
+			++LeafCount;
+			continue;
+		}
+
+		const FDynamicAABBTreeNode& Child1 = Nodes[Node.Child1];
+		const FDynamicAABBTreeNode& Child2 = Nodes[Node.Child2];
+		if (Child1.Parent != NodeIndex || Child2.Parent != NodeIndex || Node.Primitive)
+		{
+			return false;
+		}
+		if (Node.Height != 1 + std::max(Child1.Height, Child2.Height))
+		{
+			return false;
+		}
+		if (!Node.Box.IsContains(Child1.Box) || !Node.Box.IsContains(Child2.Box))
+		{
+			return false;
+		}
+
+		NodeStack.push_back(Node.Child1);
+		NodeStack.push_back(Node.Child2);
+	}
+
+	return LeafCount == NumPrimitives;
+}
+
+int32 FDynamicAABBTree::AllocateNode()
+{
+	int32 NodeIndex;
+	if (FreeList == -1)
+	{
+		NodeIndex = static_cast<int32>(Nodes.size());
+		Nodes.emplace_back();
+	}
+	else
+	{
+		NodeIndex = FreeList;
+		FreeList = Nodes[NodeIndex].Parent;
+		Nodes[NodeIndex] = FDynamicAABBTreeNode();
+	}
+
+	Nodes[NodeIndex].Height = 0;
+	return NodeIndex;
+}
+
+void FDynamicAABBTree::FreeNode(int32 InNodeIndex)
+{
+	Nodes[InNodeIndex] = FDynamicAABBTreeNode();
+	Nodes[InNodeIndex].Parent = FreeList;
+	FreeList = InNodeIndex;
+}
+
+void FDynamicAABBTree::InsertLeaf(int32 InLeafIndex)
+{
+	if (RootIndex == -1)
+	{
+		RootIndex = InLeafIndex;
+		Nodes[InLeafIndex].Parent = -1;
+		return;
+	}
+
+	// 1. 비용 증가가 가장 작은 형제 탐색
+	const FAABB LeafBox = Nodes[InLeafIndex].Box;
+	const int32 SiblingIndex = FindBestSibling(LeafBox);
+
+	// 2. 리프와 형제를 묶는 새 부모 생성 (AllocateNode가 배열을 재할당할 수 있으므로 이후에 참조를 얻는다)
+	const int32 OldParentIndex = Nodes[SiblingIndex].Parent;
+	const int32 NewParentIndex = AllocateNode();
+
+	FDynamicAABBTreeNode& NewParent = Nodes[NewParentIndex];
+	NewParent.Parent = OldParentIndex;
+	NewParent.Box = Union(LeafBox, Nodes[SiblingIndex].Box);
+	NewParent.Height = Nodes[SiblingIndex].Height + 1;
+	NewParent.Child1 = SiblingIndex;
+	NewParent.Child2 = InLeafIndex;
+
+	Nodes[SiblingIndex].Parent = NewParentIndex;
+	Nodes[InLeafIndex].Parent = NewParentIndex;
+
+	if (OldParentIndex == -1)
+	{
+		RootIndex = NewParentIndex;
+	}
+	else if (Nodes[OldParentIndex].Child1 == SiblingIndex)
+	{
+		Nodes[OldParentIndex].Child1 = NewParentIndex;
+	}
+	else
+	{
+		Nodes[OldParentIndex].Child2 = NewParentIndex;
+	}
+
+	// 3. 조상 리핏 및 균형 조정
+	RefitAncestors(NewParentIndex);
+}
+
+void FDynamicAABBTree::RemoveLeaf(int32 InLeafIndex)
+{
+	if (InLeafIndex == RootIndex)
+	{
+		RootIndex = -1;
+		return;
+	}
+
+	// 부모를 제거하고 형제를 조부모에 직접 연결한다
+	const int32 ParentIndex = Nodes[InLeafIndex].Parent;
+	const int32 GrandParentIndex = Nodes[ParentIndex].Parent;
+	const int32 SiblingIndex = Nodes[ParentIndex].Child1 == InLeafIndex ? Nodes[ParentIndex].Child2 : Nodes[ParentIndex].Child1;
+
+	Nodes[SiblingIndex].Parent = GrandParentIndex;
+	if (GrandParentIndex == -1)
+	{
+		RootIndex = SiblingIndex;
+	}
+	else
+	{
+		if (Nodes[GrandParentIndex].Child1 == ParentIndex)
+		{
+			Nodes[GrandParentIndex].Child1 = SiblingIndex;
+		}
+		else
+		{
+			Nodes[GrandParentIndex].Child2 = SiblingIndex;
+		}
+	}
+
+	FreeNode(ParentIndex);
+	Nodes[InLeafIndex].Parent = -1;
+
+	RefitAncestors(GrandParentIndex);
+}
+
+int32 FDynamicAABBTree::FindBestSibling(const FAABB& InLeafBox) const
+{
+	const float LeafArea = InLeafBox.GetSurfaceArea();
+
+	int32 BestSiblingIndex = RootIndex;
+	float BestCost = Union(InLeafBox, Nodes[RootIndex].Box).GetSurfaceArea();
+
+	// Branch and Bound: (노드, 조상들이 물려받는 표면적 증가량)을 스택으로 순회
+	TArray<std::pair<int32, float>> CandidateStack;
+	CandidateStack.push_back({ RootIndex, 0.0f });
+
+	while (!CandidateStack.empty())
+	{
+		const auto [CurrentIndex, InheritedCost] = CandidateStack.back();
+		CandidateStack.pop_back();
+
+		const FDynamicAABBTreeNode& CurrentNode = Nodes[CurrentIndex];
+		const float DirectCost = Union(InLeafBox, CurrentNode.Box).GetSurfaceArea();
+		const float Cost = DirectCost + InheritedCost;
+
+		if (Cost < BestCost)
+		{
+			BestCost = Cost;
+			BestSiblingIndex = CurrentIndex;
+		}
+
+		if (CurrentNode.IsLeaf()) { continue; }
+
+		// 자식 쪽에 붙이면 이 노드도 커지므로 그 증가량을 물려준다.
+		// 자식 서브트리에서 얻을 수 있는 최소 비용(하한)이 현재 최적보다 크면 탐색 중단
+		const float ChildInheritedCost = InheritedCost + DirectCost - CurrentNode.Box.GetSurfaceArea();
+		if (LeafArea + ChildInheritedCost < BestCost)
+		{
+			CandidateStack.push_back({ CurrentNode.Child1, ChildInheritedCost });
+			CandidateStack.push_back({ CurrentNode.Child2, ChildInheritedCost });
+		}
+	}
+
+	return BestSiblingIndex;
+}
+
+void FDynamicAABBTree::RefitAncestors(int32 InNodeIndex)
+{
+	int32 NodeIndex = InNodeIndex;
+	while (NodeIndex != -1)
+	{
+		NodeIndex = Balance(NodeIndex);
+
+		FDynamicAABBTreeNode& Node = Nodes[NodeIndex];
+		const FDynamicAABBTreeNode& Child1 = Nodes[Node.Child1];
+		const FDynamicAABBTreeNode& Child2 = Nodes[Node.Child2];
+
+		Node.Height = 1 + std::max(Child1.Height, Child2.Height);
+		Node.Box = Union(Child1.Box, Child2.Box);
+
+		NodeIndex = Node.Parent;
+	}
+}
+
+int32 FDynamicAABBTree::Balance(int32 InNodeIndex)
+{
+	//       A
+	//     /   \
+	//    B     C
+	//   / \   / \
+	//  D   E F   G
+	FDynamicAABBTreeNode& A = Nodes[InNodeIndex];
+	if (A.IsLeaf() || A.Height < 2)
+	{
+		return InNodeIndex;
+	}
+
+	const int32 IndexA = InNodeIndex;
+	const int32 IndexB = A.Child1;
+	const int32 IndexC = A.Child2;
+	FDynamicAABBTreeNode& B = Nodes[IndexB];
+	FDynamicAABBTreeNode& C = Nodes[IndexC];
+
+	const auto ReplaceChildOfParent = [this](int32 InParentIndex, int32 InOldChild, int32 InNewChild)
+	{
+		if (InParentIndex == -1)
+		{
+			RootIndex = InNewChild;
+		}
+		else if (Nodes[InParentIndex].Child1 == InOldChild)
+		{
+			Nodes[InParentIndex].Child1 = InNewChild;
+		}
+		else
+		{
+			Nodes[InParentIndex].Child2 = InNewChild;
+		}
+	};
+
+	const int32 BalanceFactor = C.Height - B.Height;
+
+	// C를 A 자리로 올린다
+	if (BalanceFactor > 1)
+	{
+		const int32 IndexF = C.Child1;
+		const int32 IndexG = C.Child2;
+		FDynamicAABBTreeNode& F = Nodes[IndexF];
+		FDynamicAABBTreeNode& G = Nodes[IndexG];
+
+		C.Child1 = IndexA;
+		C.Parent = A.Parent;
+		A.Parent = IndexC;
+		ReplaceChildOfParent(C.Parent, IndexA, IndexC);
+
+		// F, G 중 높은 쪽을 C에 남기고 낮은 쪽을 A로 보낸다
+		if (F.Height > G.Height)
+		{
+			C.Child2 = IndexF;
+			A.Child2 = IndexG;
+			G.Parent = IndexA;
+			A.Box = Union(B.Box, G.Box);
+			C.Box = Union(A.Box, F.Box);
+			A.Height = 1 + std::max(B.Height, G.Height);
+			C.Height = 1 + std::max(A.Height, F.Height);
+		}
+		else
+		{
+			C.Child2 = IndexG;
+			A.Child2 = IndexF;
+			F.Parent = IndexA;
+			A.Box = Union(B.Box, F.Box);
+			C.Box = Union(A.Box, G.Box);
+			A.Height = 1 + std::max(B.Height, F.Height);
+			C.Height = 1 + std::max(A.Height, G.Height);
+		}
+
+		return IndexC;
+	}
+
+	// B를 A 자리로 올린다
+	if (BalanceFactor < -1)
+	{
+		const int32 IndexD = B.Child1;
+		const int32 IndexE = B.Child2;
+		FDynamicAABBTreeNode& D = Nodes[IndexD];
+		FDynamicAABBTreeNode& E = Nodes[IndexE];
+
+		B.Child1 = IndexA;
+		B.Parent = A.Parent;
+		A.Parent = IndexB;
+		ReplaceChildOfParent(B.Parent, IndexA, IndexB);
+
+		if (D.Height > E.Height)
+		{
+			B.Child2 = IndexD;
+			A.Child1 = IndexE;
+			E.Parent = IndexA;
+			A.Box = Union(C.Box, E.Box);
+			B.Box = Union(A.Box, D.Box);
+			A.Height = 1 + std::max(C.Height, E.Height);
+			B.Height = 1 + std::max(A.Height, D.Height);
+		}
+		else
+		{
+			B.Child2 = IndexE;
+			A.Child1 = IndexD;
+			D.Parent = IndexA;
+			A.Box = Union(C.Box, D.Box);
+			B.Box = Union(A.Box, E.Box);
+			A.Height = 1 + std::max(C.Height, D.Height);
+			B.Height = 1 + std::max(A.Height, E.Height);
+		}
+
+		return IndexB;
+	}
+
+	return IndexA;
+}
+
+void FDynamicAABBTree::AppendSubtree(int32 InNodeIndex, TArray<UPrimitiveComponent*>& OutPrimitives, bool bInVisibleOnly) const
+{
+	TArray<int32> NodeStack;
+	NodeStack.push_back(InNodeIndex);
+
+	while (!NodeStack.empty())
+	{
+		const FDynamicAABBTreeNode& Node = Nodes[NodeStack.back()];
+		NodeStack.pop_back();
+
+		if (Node.IsLeaf())
+		{
+			if (!bInVisibleOnly || Node.Primitive->IsVisible()) { OutPrimitives.push_back(Node.Primitive); }
+			continue;
+		}
+
+		NodeStack.push_back(Node.Child1);
+		NodeStack.push_back(Node.Child2);
+	}
+}
+
+FAABB FDynamicAABBTree::MakeFatBox(const FAABB& InBox)
+{
+	return ExpandBox(InBox, GetFatMargin(InBox));
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "Physics/Public/AABB.h"
+
+class UPrimitiveComponent;
+struct FFrustum;
+
+/** @brief Fat AABB의 최소 여유 폭 (월드 단위) */
+constexpr float FAT_AABB_MIN_MARGIN = 0.1f;
+/** @brief Fat AABB의 여유 폭을 AABB 반크기에 비례해 추가하는 비율 */
+constexpr float FAT_AABB_MARGIN_RATIO = 0.1f;
+/** @brief 재삽입 시 이동 방향으로 Fat AABB를 늘리는 배율 (다음 몇 프레임의 이동을 미리 덮는다) */
+constexpr float FAT_AABB_DISPLACEMENT_MULTIPLIER = 2.0f;
+
+/**
+ * @brief FDynamicAABBTree의 노드. 리프는 프리미티브 하나를 가지며, 내부 노드는 항상 자식 두 개를 가진다.
+ * 해제된 노드는 Parent를 Free List의 다음 인덱스로 사용한다.
+ */
+struct FDynamicAABBTreeNode
+{
+	FAABB Box;
+	UPrimitiveComponent* Primitive = nullptr;
+	int32 Parent = -1;
+	int32 Child1 = -1;
+	int32 Child2 = -1;
+	/** @brief 리프는 0, 해제된 노드는 -1 */
+	int32 Height = -1;
+	/** @brief 뷰마다 마지막으로 이 노드를 절두체 밖으로 판정한 평면 (FOctree::GetLastRejectingPlanes와 같은 3비트 배치). 컬링 중에 갱신하는 힌트다 */
+	mutable uint32 LastRejectingPlanes = 0;
+
+	bool IsLeaf() const { return Child1 == -1; }
+};
+
+/**
+ * @brief 움직이는 프리미티브를 위한 동적 AABB 트리
+ * 리프에는 실제 AABB보다 약간 큰 Fat AABB를 저장하므로, 프리미티브가 Fat AABB 안에서 움직이는 동안은 Update가 아무 작업도 하지 않는다.
+ * 벗어난 경우에만 리프를 떼어 FBVH와 같은 SAH 비용 기준(표면적 증가량 최소)으로 형제를 골라 다시 붙이고,
+ * 조상 노드를 따라 올라가며 AABB를 리핏하고 높이 차이가 나면 회전으로 균형을 맞춘다.
+ * 노드는 하나의 배열에 인덱스로 연결되며 해제된 노드는 Free List로 재사용한다.
+ * 삽입된 프리미티브는 자신의 리프 인덱스를 역참조로 들고 있으므로 Remove/Update에 탐색이 필요 없다.
+ */
+class FDynamicAABBTree
+{
+public:
+	FDynamicAABBTree() = default;
+	~FDynamicAABBTree();
+
+	FDynamicAABBTree(const FDynamicAABBTree&) = delete;
+	FDynamicAABBTree& operator=(const FDynamicAABBTree&) = delete;
+
+	/**
+	 * @brief 프리미티브를 삽입한다. 이미 들어있는 프리미티브라면 Update와 동일하게 동작한다.
+	 * @return 프리미티브가 nullptr이거나 AABB가 유효하지 않으면 false
+	 */
+	bool Insert(UPrimitiveComponent* InPrimitive);
+	bool Remove(UPrimitiveComponent* InPrimitive);
+	/**
+	 * @brief 프리미티브의 이동을 반영한다. 현재 AABB가 Fat AABB 안에 있다면 아무 작업도 하지 않는다.
+	 * @return 갱신 후에도 프리미티브가 트리에 남아있다면 true (AABB가 유효하지 않게 되면 제거되고 false)
+	 */
+	bool Update(UPrimitiveComponent* InPrimitive);
+	bool Contains(const UPrimitiveComponent* InPrimitive) const;
+	void Clear();
+
+	uint32 GetNumPrimitives() const { return NumPrimitives; }
+	bool IsEmpty() const { return RootIndex == -1; }
+
+	/** @brief Fat AABB가 절두체와 겹치는 보이는 프리미티브를 OutPrimitives에 추가한다. */
+	void QueryFrustum(const FFrustum& InFrustum, TArray<UPrimitiveComponent*>& OutPrimitives) const;
+	/** @brief Fat AABB가 레이와 교차하는 프리미티브를 OutPrimitives에 추가한다. (피킹 후보 수집용) */
+	void QueryRay(const FRay& InRay, TArray<UPrimitiveComponent*>& OutPrimitives) const;
+	/** @brief Fat AABB가 InBox와 겹치는 프리미티브를 OutPrimitives에 추가한다. */
+	void QueryAABB(const FAABB& InBox, TArray<UPrimitiveComponent*>& OutPrimitives) const;
+	void GetAllPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives) const;
+
+	int32 GetRootIndex() const { return RootIndex; }
+	const FDynamicAABBTreeNode& GetNode(int32 InIndex) const { return Nodes[InIndex]; }
+	int32 GetHeight() const { return RootIndex == -1 ? 0 : Nodes[RootIndex].Height; }
+
+	/** @brief 부모/자식 연결, 높이, AABB 포함 관계, 역참조를 검사한다. (디버그용) */
+	bool CheckValidity() const;
+
+private:
+	int32 AllocateNode();
+	void FreeNode(int32 InNodeIndex);
+
+	void InsertLeaf(int32 InLeafIndex);
+	void RemoveLeaf(int32 InLeafIndex);
+	//@brief 새 리프를 형제로 붙였을 때 전체 표면적 증가가 가장 작은 노드를 Branch and Bound로 탐색.
+	int32 FindBestSibling(const FAABB& InLeafBox) const;
+	//@brief 주어진 노드부터 루트까지 올라가며 균형을 맞추고 AABB와 높이를 리핏.
+	void RefitAncestors(int32 InNodeIndex);
+	//@brief 노드의 두 자식 높이 차이가 2 이상이면 회전시키고, 회전 후 서브트리의 루트 인덱스를 반환.
+	int32 Balance(int32 InNodeIndex);
+
+	void AppendSubtree(int32 InNodeIndex, TArray<UPrimitiveComponent*>& OutPrimitives, bool bInVisibleOnly) const;
+
+	static FAABB MakeFatBox(const FAABB& InBox);
+
+	TArray<FDynamicAABBTreeNode> Nodes;
+	int32 RootIndex = -1;
+	int32 FreeList = -1;
+	uint32 NumPrimitives = 0;
+};
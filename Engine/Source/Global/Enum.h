@@ -119,6 +119,20 @@ enum class EPrimitiveType : uint8
 };
 DECLARE_UINT8_ENUM_REFLECTION(EPrimitiveType)
 
+/**
+ * @brief Primitive Component Mobility Enum
+ * 씬 쿼리의 Static/Dynamic 채널을 정한다. 레벨의 어느 트리(StaticOctree/DynamicTree)에 들어 있는지와는 무관하다
+ */
+UENUM()
+enum class EComponentMobility : uint8
+{
+	Static,
+	Movable,
+
+	End = 0xFF
+};
+DECLARE_UINT8_ENUM_REFLECTION(EComponentMobility)
+
 /**
  * @brief RasterizerState Enum
  */
@@ -167,6 +181,9 @@ enum class EEngineShowFlags : uint64
 	SF_PCF = 1 << 9,
 	SF_CSM = 1 << 10,
 	SF_Shadow = 1 << 11,
+	SF_OcclusionCulling = 1 << 12,
+	SF_OcclusionTemporalReprojection = 1 << 13,
+	SF_ContributionCulling = 1 << 14,
 };
 
 enum class EShadowProjectionType : uint8_t
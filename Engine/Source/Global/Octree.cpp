@@ -3,8 +3,6 @@
 #include "Component/Public/UUIDTextComponent.h"
 #include "Component/Public/PrimitiveComponent.h"
 
-#include "Level/Public/Level.h"
-
 namespace
 {
 	FAABB GetPrimitiveBoundingBox(UPrimitiveComponent* InPrimitive)
@@ -14,26 +12,69 @@ namespace
 
 		return FAABB(Min, Max);
 	}
+
+	bool IsValidBoundingBox(const FAABB& InBox)
+	{
+		return std::isfinite(InBox.Min.X) && std::isfinite(InBox.Min.Y) && std::isfinite(InBox.Min.Z) &&
+			std::isfinite(InBox.Max.X) && std::isfinite(InBox.Max.Y) && std::isfinite(InBox.Max.Z) &&
+			InBox.Min.X <= InBox.Max.X && InBox.Min.Y <= InBox.Max.Y && InBox.Min.Z <= InBox.Max.Z;
+	}
+
+	/** @brief 64비트 Morton 코드에서 축마다 사용할 수 있는 비트 수 (= Build가 만들 수 있는 최대 깊이) */
+	constexpr int MORTON_BITS_PER_AXIS = 21;
+
+	/** @brief 21비트 정수의 각 비트 사이에 0을 두 개씩 끼워 넣는다. */
+	uint64 ExpandMortonBits(uint64 InValue)
+	{
+		InValue &= 0x1fffff;
+		InValue = (InValue | InValue << 32) & 0x1f00000000ffff;
+		InValue = (InValue | InValue << 16) & 0x1f0000ff0000ff;
+		InValue = (InValue | InValue << 8) & 0x100f00f00f00f00f;
+		InValue = (InValue | InValue << 4) & 0x10c30c30c30c30c3;
+		InValue = (InValue | InValue << 2) & 0x1249249249249249;
+		return InValue;
+	}
+
+	/** @brief 해당 깊이의 노드에서 자식을 고르는 Morton 3비트(x | y << 1 | z << 2)를 GetChildIndex의 배치로 바꾼다. */
+	int MortonDigitToChildIndex(uint64 InDigit)
+	{
+		int Index = 0;
+		if (InDigit & 1) { Index |= 1; }       // Right
+		if (InDigit & 4) { Index |= 2; }       // Front
+		if (!(InDigit & 2)) { Index |= 4; }    // Bottom
+		return Index;
+	}
 }
 
+/** @brief FOctree::Build에서 정렬에 사용하는 항목 */
+struct FOctreeBuildEntry
+{
+	uint64 MortonCode;
+	UPrimitiveComponent* Primitive;
+	FAABB Box;
+};
+
 FOctree::FOctree()
 	: BoundingBox(), Depth(0)
 {
+	UpdateLooseBoundingBox();
 	Children.resize(8);
 }
 
-FOctree::FOctree(const FAABB& InBoundingBox, int InDepth)
-	: BoundingBox(InBoundingBox), Depth(InDepth)
+FOctree::FOctree(const FAABB& InBoundingBox, int InDepth, float InLooseness)
+	: BoundingBox(InBoundingBox), Depth(InDepth), Looseness(std::max(InLooseness, 1.0f))
 {
+	UpdateLooseBoundingBox();
 	Children.resize(8);
 }
 
-FOctree::FOctree(const FVector& InPosition, float InSize, int InDepth)
-	: Depth(InDepth)
+FOctree::FOctree(const FVector& InPosition, float InSize, int InDepth, float InLooseness)
+	: Depth(InDepth), Looseness(std::max(InLooseness, 1.0f))
 {
 	const float HalfSize = InSize * 0.5f;
 	BoundingBox.Min = InPosition - FVector(HalfSize, HalfSize, HalfSize);
 	BoundingBox.Max = InPosition + FVector(HalfSize, HalfSize, HalfSize);
+	UpdateLooseBoundingBox();
 	Children.resize(8);
 }
 
@@ -48,43 +89,232 @@ bool FOctree::Insert(UPrimitiveComponent* InPrimitive)
 	// nullptr 체크
 	if (!InPrimitive) { return false; }
 
-	// 0. 영역 내에 객체가 없으면 종료
-	if (BoundingBox.IsIntersected(GetPrimitiveBoundingBox(InPrimitive)) == false) { return false; }
+	// 이미 들어있다면 이동으로 취급한다
+	if (Contains(InPrimitive)) { return Update(InPrimitive); }
+
+	const FAABB PrimitiveBox = GetPrimitiveBoundingBox(InPrimitive);
+	if (!IsValidBoundingBox(PrimitiveBox)) { return false; }
+
+	// 0. 비어있는 트리라면 확장하지 않고 루트를 프리미티브 위치로 옮긴다
+	if (IsLeaf() && Primitives.empty() && !LooseBoundingBox.IsContains(PrimitiveBox))
+	{
+		const FVector HalfSize = (BoundingBox.Max - BoundingBox.Min) * 0.5f;
+		const FVector Center = PrimitiveBox.GetCenter();
+		SetBoundingBox(FAABB(Center - HalfSize, Center + HalfSize));
+	}
+
+	// 1. 루트의 Loose 경계를 벗어나면 프리미티브 방향으로 루트를 확장한다
+	int GrowCount = 0;
+	while (!LooseBoundingBox.IsContains(PrimitiveBox))
+	{
+		if (GrowCount++ >= MAX_ROOT_GROW_COUNT) { return false; }
+		GrowRoot(PrimitiveBox.GetCenter());
+	}
+
+	return InsertInternal(InPrimitive, PrimitiveBox);
+}
 
+bool FOctree::InsertInternal(UPrimitiveComponent* InPrimitive, const FAABB& InPrimitiveBox)
+{
 	if (IsLeaf())
 	{
 		// 리프 노드이며, 여유 공간이 있거나 최대 깊이에 도달했다면
-		if (Primitives.size() < MAX_PRIMITIVES || Depth == MAX_DEPTH)
+		if (Primitives.size() < MAX_PRIMITIVES || Depth >= MaxDepth)
 		{
-			Primitives.push_back(InPrimitive); // 해당 객체를 추가한다
+			AddPrimitive(InPrimitive); // 해당 객체를 추가한다
 			return true;
 		}
-		else // 여유 공간이 없고, 최대 깊이에 도달하지 않았다면
+
+		// 여유 공간이 없고, 최대 깊이에 도달하지 않았다면 분할 및 재귀적 추가를 한다
+		Subdivide(InPrimitive, InPrimitiveBox);
+		return true;
+	}
+
+	// 중심점이 속한 자식의 Loose 경계에 완전히 들어간다면 자식 노드에게 넘겨준다
+	FOctree* Child = Children[GetChildIndex(InPrimitiveBox.GetCenter())];
+	if (Child && Child->LooseBoundingBox.IsContains(InPrimitiveBox))
+	{
+		return Child->InsertInternal(InPrimitive, InPrimitiveBox);
+	}
+
+	AddPrimitive(InPrimitive);
+	return true;
+}
+
+bool FOctree::Remove(UPrimitiveComponent* InPrimitive)
+{
+	if (InPrimitive == nullptr) { return false; }
+
+	// DeepCopy로 만든 트리는 역참조를 관리하지 않으므로 전체 탐색으로 제거한다
+	if (!bTrackPrimitiveHandles) { return RemoveBySearch(InPrimitive); }
+
+	// 역참조가 없다면 어느 트리에도 들어있지 않다
+	FOctree* Node = InPrimitive->OctreeNode;
+	if (Node == nullptr) { return false; }
+
+	// 역참조가 다른 트리를 가리킨다면 이 트리에는 없다
+	const int32 Slot = InPrimitive->OctreeSlot;
+	if (!IsAncestorOf(Node)) { return false; }
+	assert(Slot >= 0 && Slot < static_cast<int32>(Node->Primitives.size()) && Node->Primitives[Slot] == InPrimitive);
+
+	Node->RemoveAt(Slot);
+	MergeUpwards(Node);
+	return true;
+}
+
+bool FOctree::Update(UPrimitiveComponent* InPrimitive, bool bInReinsert)
+{
+	if (!Contains(InPrimitive)) { return false; }
+
+	// 소속 노드의 Loose 경계 안에서 움직였다면 트리 구조를 바꿀 필요가 없다
+	const FAABB PrimitiveBox = GetPrimitiveBoundingBox(InPrimitive);
+	if (IsValidBoundingBox(PrimitiveBox) && InPrimitive->OctreeNode->LooseBoundingBox.IsContains(PrimitiveBox))
+	{
+		return true;
+	}
+
+	Remove(InPrimitive);
+	return bInReinsert && Insert(InPrimitive);
+}
+
+bool FOctree::Contains(const UPrimitiveComponent* InPrimitive) const
+{
+	return bTrackPrimitiveHandles && InPrimitive && InPrimitive->OctreeNode && IsAncestorOf(InPrimitive->OctreeNode);
+}
+
+void FOctree::Clear()
+{
+	if (bTrackPrimitiveHandles)
+	{
+		for (UPrimitiveComponent* Primitive : Primitives)
 		{
-			// 분할 및 재귀적 추가를 한다
-			Subdivide(InPrimitive);
-			return true;
+			Primitive->OctreeNode = nullptr;
+			Primitive->OctreeSlot = -1;
 		}
 	}
-	else
+	Primitives.clear();
+
+	for (int Index = 0; Index < 8; ++Index)
 	{
-		for (int Index = 0; Index < 8; ++Index)
+		if (Children[Index]) { Children[Index]->Clear(); }
+		SafeDelete(Children[Index]);
+	}
+}
+
+void FOctree::Build(const TArray<UPrimitiveComponent*>& InPrimitives, TArray<UPrimitiveComponent*>& OutRejected)
+{
+	Clear();
+
+	// 1. 모든 AABB를 한 번씩만 계산하고, 유효한 것들의 합집합을 구한다
+	TArray<FOctreeBuildEntry> Entries;
+	Entries.reserve(InPrimitives.size());
+
+	FVector UnionMin(FLT_MAX, FLT_MAX, FLT_MAX);
+	FVector UnionMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	for (UPrimitiveComponent* Primitive : InPrimitives)
+	{
+		if (!Primitive) { continue; }
+
+		const FAABB PrimitiveBox = GetPrimitiveBoundingBox(Primitive);
+		if (!IsValidBoundingBox(PrimitiveBox))
 		{
-			// 자식 노드를 보유하고 있고, 영역 내에 해당 객체가 존재한다면
-			if (Children[Index] && Children[Index]->BoundingBox.IsContains(GetPrimitiveBoundingBox(InPrimitive)))
-			{
-				return Children[Index]->Insert(InPrimitive); // 자식 노드에게 넘겨준다
-			}
+			OutRejected.push_back(Primitive);
+			continue;
 		}
 
-		Primitives.push_back(InPrimitive);
-		return true;
+		Entries.push_back({ 0, Primitive, PrimitiveBox });
+		UnionMin.X = std::min(UnionMin.X, PrimitiveBox.Min.X);
+		UnionMin.Y = std::min(UnionMin.Y, PrimitiveBox.Min.Y);
+		UnionMin.Z = std::min(UnionMin.Z, PrimitiveBox.Min.Z);
+		UnionMax.X = std::max(UnionMax.X, PrimitiveBox.Max.X);
+		UnionMax.Y = std::max(UnionMax.Y, PrimitiveBox.Max.Y);
+		UnionMax.Z = std::max(UnionMax.Z, PrimitiveBox.Max.Z);
 	}
 
-	return false;
+	if (Entries.empty()) { return; }
+
+	// 2. 합집합을 덮는 정육면체로 루트 셀을 다시 잡는다
+	//    기존 리프 셀 크기를 유지하도록 MaxDepth를 늘리며, 루트는 현재 셀보다 작아지지 않는다
+	const FVector CellSize = BoundingBox.Max - BoundingBox.Min;
+	const float CurrentSize = std::max({ CellSize.X, CellSize.Y, CellSize.Z });
+	const FVector UnionSize = UnionMax - UnionMin;
+	const float RootSize = std::max({ UnionSize.X, UnionSize.Y, UnionSize.Z, CurrentSize, MATH_EPSILON });
+	const FVector RootCenter = (UnionMin + UnionMax) * 0.5f;
+	const FVector RootHalfSize(RootSize * 0.5f, RootSize * 0.5f, RootSize * 0.5f);
+	SetBoundingBox(FAABB(RootCenter - RootHalfSize, RootCenter + RootHalfSize));
+
+	if (CurrentSize > 0.0f)
+	{
+		const float LeafSize = CurrentSize / static_cast<float>(1 << std::min(MaxDepth, 30));
+		const int RequiredDepth = static_cast<int>(std::ceil(std::log2(RootSize / LeafSize)));
+		MaxDepth = std::max(MaxDepth, RequiredDepth);
+	}
+	MaxDepth = std::min(MaxDepth, MORTON_BITS_PER_AXIS);
+
+	// 3. 중심점을 루트 셀 기준 격자로 양자화해 Morton 코드를 만들고 정렬한다
+	const float GridResolution = static_cast<float>(1 << MORTON_BITS_PER_AXIS);
+	const float GridScale = GridResolution / RootSize;
+	const FVector& RootMin = BoundingBox.Min;
+	for (FOctreeBuildEntry& Entry : Entries)
+	{
+		const FVector Center = Entry.Box.GetCenter();
+		const auto Quantize = [GridScale, GridResolution](float InValue)
+		{
+			return static_cast<uint64>(std::clamp(InValue * GridScale, 0.0f, GridResolution - 1.0f));
+		};
+
+		Entry.MortonCode =
+			ExpandMortonBits(Quantize(Center.X - RootMin.X)) |
+			ExpandMortonBits(Quantize(Center.Y - RootMin.Y)) << 1 |
+			ExpandMortonBits(Quantize(Center.Z - RootMin.Z)) << 2;
+	}
+
+	std::sort(Entries.begin(), Entries.end(), [](const FOctreeBuildEntry& A, const FOctreeBuildEntry& B)
+	{
+		return A.MortonCode < B.MortonCode;
+	});
+
+	// 4. 정렬된 구간을 한 번에 내려가며 트리를 만든다
+	BuildFromSortedRange(Entries.data(), Entries.data() + Entries.size());
 }
 
-bool FOctree::Remove(UPrimitiveComponent* InPrimitive)
+void FOctree::BuildFromSortedRange(FOctreeBuildEntry* InBegin, FOctreeBuildEntry* InEnd)
+{
+	// Insert와 같은 기준으로 리프에 남긴다
+	const int64 Count = InEnd - InBegin;
+	if (Count <= MAX_PRIMITIVES || Depth >= MaxDepth)
+	{
+		for (FOctreeBuildEntry* Entry = InBegin; Entry != InEnd; ++Entry) { AddPrimitive(Entry->Primitive); }
+		return;
+	}
+
+	CreateChildren();
+
+	// Morton 순서로 정렬되어 있으므로 같은 자식 셀에 속하는 항목은 연속된 구간을 이룬다
+	// 루트의 Depth는 항상 0이고 Build에서 MaxDepth를 MORTON_BITS_PER_AXIS 이하로 제한하므로 Shift는 음수가 되지 않는다
+	const int Shift = 3 * (MORTON_BITS_PER_AXIS - 1 - Depth);
+	FOctreeBuildEntry* RangeBegin = InBegin;
+	while (RangeBegin != InEnd)
+	{
+		const uint64 Digit = (RangeBegin->MortonCode >> Shift) & 7;
+		FOctreeBuildEntry* RangeEnd = RangeBegin;
+		while (RangeEnd != InEnd && ((RangeEnd->MortonCode >> Shift) & 7) == Digit) { ++RangeEnd; }
+
+		// 자식의 Loose 경계에 들어가지 않는 큰 프리미티브는 현재 노드에 남긴다 (Morton 순서는 유지)
+		FOctree* Child = Children[MortonDigitToChildIndex(Digit)];
+		FOctreeBuildEntry* ChildEnd = std::stable_partition(RangeBegin, RangeEnd, [Child](const FOctreeBuildEntry& Entry)
+		{
+			return Child->LooseBoundingBox.IsContains(Entry.Box);
+		});
+
+		for (FOctreeBuildEntry* Entry = ChildEnd; Entry != RangeEnd; ++Entry) { AddPrimitive(Entry->Primitive); }
+		Child->BuildFromSortedRange(RangeBegin, ChildEnd);
+
+		RangeBegin = RangeEnd;
+	}
+}
+
+bool FOctree::RemoveBySearch(UPrimitiveComponent* InPrimitive)
 {
 	if (InPrimitive == nullptr) { return false; }
 
@@ -119,9 +349,9 @@ bool FOctree::Remove(UPrimitiveComponent* InPrimitive)
 
 		for (int Index = 0; Index < 8; ++Index)
 		{
-			// 💡 Children[Index]->Remove(InPrimitive) 호출 시, 
+			// 💡 Children[Index]->RemoveBySearch(InPrimitive) 호출 시, 
 			//    자식 노드 내부에서 다시 경계 검사가 수행되지 않도록 보장해야 합니다.
-			if (Children[Index] && Children[Index]->Remove(InPrimitive))
+			if (Children[Index] && Children[Index]->RemoveBySearch(InPrimitive))
 			{
 				bIsRemoved = true;
 				break;
@@ -136,10 +366,49 @@ bool FOctree::Remove(UPrimitiveComponent* InPrimitive)
 
 }
 
-void FOctree::Clear()
+void FOctree::AddPrimitive(UPrimitiveComponent* InPrimitive)
 {
-	Primitives.clear();
-	for (int Index = 0; Index < 8; ++Index) { SafeDelete(Children[Index]); }
+	if (bTrackPrimitiveHandles)
+	{
+		InPrimitive->OctreeNode = this;
+		InPrimitive->OctreeSlot = static_cast<int32>(Primitives.size());
+	}
+	Primitives.push_back(InPrimitive);
+}
+
+void FOctree::RemoveAt(int32 InSlot)
+{
+	UPrimitiveComponent* Removed = Primitives[InSlot];
+	Removed->OctreeNode = nullptr;
+	Removed->OctreeSlot = -1;
+
+	// 마지막 원소를 빈 자리로 옮기고 역참조 슬롯을 갱신한다
+	if (InSlot != static_cast<int32>(Primitives.size()) - 1)
+	{
+		Primitives[InSlot] = Primitives.back();
+		Primitives[InSlot]->OctreeSlot = InSlot;
+	}
+	Primitives.pop_back();
+}
+
+void FOctree::MergeUpwards(FOctree* InNode)
+{
+	// 리프에서 빠졌다면 부모부터, 내부 노드에서 빠졌다면 해당 노드부터 병합을 시도한다
+	// 한 단계라도 병합되지 않으면 그 위의 노드도 자식 중 리프가 아닌 노드가 있으므로 병합될 수 없다
+	for (FOctree* Current = InNode->IsLeaf() ? InNode->Parent : InNode; Current; Current = Current->Parent)
+	{
+		Current->TryMerge();
+		if (!Current->IsLeaf()) { break; }
+	}
+}
+
+bool FOctree::IsAncestorOf(const FOctree* InNode) const
+{
+	for (const FOctree* Current = InNode; Current; Current = Current->Parent)
+	{
+		if (Current == this) { return true; }
+	}
+	return false;
 }
 
 void FOctree::GetAllPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives) const
@@ -157,67 +426,188 @@ void FOctree::GetAllPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives) cons
 	}
 }
 
-TArray<UPrimitiveComponent*> FOctree::FindNearestPrimitives(const FVector& FindPos, uint32 MaxPrimitiveCount)
+void FOctree::FindNearestPrimitives(const FVector& InLocation, uint32 InMaxCount, TArray<UPrimitiveComponent*>& OutPrimitives,
+	float InMaxDistance) const
 {
-	TArray<UPrimitiveComponent*> Candidates = GWorld->GetLevel()->GetDynamicPrimitives();
-	Candidates.reserve(MaxPrimitiveCount);
-	FNodeQueue NodeQueue;
+	OutPrimitives.clear();
+	if (InMaxCount == 0 || !(InMaxDistance >= 0.0f)) { return; }
+
+	// 지금까지 찾은 후보 중 가장 먼 후보가 top에 오는 최대 힙. 크기는 InMaxCount를 넘지 않는다
+	using FCandidate = std::pair<float, UPrimitiveComponent*>;
+	std::priority_queue<FCandidate> Candidates;
+
+	// 후보가 InMaxCount개 모이면 가장 먼 후보까지의 거리로 줄어든다. 이보다 먼 노드와 프리미티브는 볼 필요가 없다
+	const float MaxDistanceSquared = InMaxDistance < sqrtf(FLT_MAX) ? InMaxDistance * InMaxDistance : FLT_MAX;
+	float BoundDistanceSquared = MaxDistanceSquared;
 
-	float RootDistance = this->GetBoundingBox().GetCenterDistanceSquared(FindPos);
-	NodeQueue.push({ RootDistance, this });
+	FNodeQueue NodeQueue;
+	NodeQueue.push({ GetBoundingBox().GetDistanceSquaredToPoint(InLocation), this });
 
-	while (!NodeQueue.empty() && Candidates.size() < MaxPrimitiveCount)
+	while (!NodeQueue.empty())
 	{
-		FOctree* CurrentNode = NodeQueue.top().second;
+		const auto [NodeDistanceSquared, CurrentNode] = NodeQueue.top();
 		NodeQueue.pop();
 
-		if (CurrentNode->IsLeafNode())
+		// 남은 노드는 모두 이보다 멀다
+		if (NodeDistanceSquared > BoundDistanceSquared) { break; }
+
+		// Loose Octree는 내부 노드에도 프리미티브가 있으므로 리프가 아니어도 검사한다
+		for (UPrimitiveComponent* Primitive : CurrentNode->Primitives)
 		{
-			for (UPrimitiveComponent* Primitive : CurrentNode->GetPrimitives())
+			const float DistanceSquared = GetPrimitiveBoundingBox(Primitive).GetDistanceSquaredToPoint(InLocation);
+			if (DistanceSquared > BoundDistanceSquared) { continue; }
+
+			if (Candidates.size() == InMaxCount)
+			{
+				if (DistanceSquared >= Candidates.top().first) { continue; }
+				Candidates.pop();
+			}
+			Candidates.push({ DistanceSquared, Primitive });
+
+			if (Candidates.size() == InMaxCount)
 			{
-				Candidates.push_back(Primitive);
+				BoundDistanceSquared = min(MaxDistanceSquared, Candidates.top().first);
 			}
 		}
-		else
+
+		if (!CurrentNode->IsLeaf())
 		{
-			for (int i = 0; i < 8; ++i)
+			for (const FOctree* Child : CurrentNode->Children)
 			{
-				FOctree* Child = CurrentNode->Children[i];
-				if (Child)
+				const float ChildDistanceSquared = Child->GetBoundingBox().GetDistanceSquaredToPoint(InLocation);
+				if (ChildDistanceSquared <= BoundDistanceSquared)
 				{
-					float ChildDistance = Child->GetBoundingBox().GetCenterDistanceSquared(FindPos);
-					NodeQueue.push({ ChildDistance, Child });
+					NodeQueue.push({ ChildDistanceSquared, Child });
 				}
 			}
 		}
 	}
 
-	return Candidates;
+	// 최대 힙은 먼 순서로 꺼내지므로 뒤에서부터 채운다
+	OutPrimitives.resize(Candidates.size());
+	for (size_t Index = Candidates.size(); Index > 0; --Index)
+	{
+		OutPrimitives[Index - 1] = Candidates.top().second;
+		Candidates.pop();
+	}
 }
 
-void FOctree::Subdivide(UPrimitiveComponent* InPrimitive)
+void FOctree::Subdivide(UPrimitiveComponent* InPrimitive, const FAABB& InPrimitiveBox)
 {
-	const FVector& Min = BoundingBox.Min;
-	const FVector& Max = BoundingBox.Max;
-	const FVector Center = (Min + Max) * 0.5f;
-
-	Children[0] = new FOctree(FAABB(FVector(Min.X, Center.Y, Min.Z), FVector(Center.X, Max.Y, Center.Z)), Depth + 1); // Top-Back-Left
-	Children[1] = new FOctree(FAABB(FVector(Center.X, Center.Y, Min.Z), FVector(Max.X, Max.Y, Center.Z)), Depth + 1); // Top-Back-Right
-	Children[2] = new FOctree(FAABB(FVector(Min.X, Center.Y, Center.Z), FVector(Center.X, Max.Y, Max.Z)), Depth + 1); // Top-Front-Left
-	Children[3] = new FOctree(FAABB(FVector(Center.X, Center.Y, Center.Z), FVector(Max.X, Max.Y, Max.Z)), Depth + 1); // Top-Front-Right
-	Children[4] = new FOctree(FAABB(FVector(Min.X, Min.Y, Min.Z), FVector(Center.X, Center.Y, Center.Z)), Depth + 1); // Bottom-Back-Left
-	Children[5] = new FOctree(FAABB(FVector(Center.X, Min.Y, Min.Z), FVector(Max.X, Center.Y, Center.Z)), Depth + 1); // Bottom-Back-Right
-	Children[6] = new FOctree(FAABB(FVector(Min.X, Min.Y, Center.Z), FVector(Center.X, Center.Y, Max.Z)), Depth + 1); // Bottom-Front-Left
-	Children[7] = new FOctree(FAABB(FVector(Center.X, Min.Y, Center.Z), FVector(Max.X, Center.Y, Max.Z)), Depth + 1); // Bottom-Front-Right
-
-	TArray<UPrimitiveComponent*> primitivesToMove = Primitives;
-	primitivesToMove.push_back(InPrimitive);
+	CreateChildren();
+
+	TArray<UPrimitiveComponent*> PrimitivesToMove = std::move(Primitives);
 	Primitives.clear();
 
-	for (UPrimitiveComponent* prim : primitivesToMove)
+	for (UPrimitiveComponent* Primitive : PrimitivesToMove)
+	{
+		InsertInternal(Primitive, GetPrimitiveBoundingBox(Primitive));
+	}
+	InsertInternal(InPrimitive, InPrimitiveBox);
+}
+
+void FOctree::CreateChildren()
+{
+	for (int Index = 0; Index < 8; ++Index)
+	{
+		Children[Index] = new FOctree(GetChildCellBox(Index), Depth + 1, Looseness);
+		Children[Index]->MaxDepth = MaxDepth;
+		Children[Index]->Parent = this;
+		Children[Index]->bTrackPrimitiveHandles = bTrackPrimitiveHandles;
+	}
+}
+
+void FOctree::GrowRoot(const FVector& InTarget)
+{
+	const FVector Center = BoundingBox.GetCenter();
+	const FVector Size = BoundingBox.Max - BoundingBox.Min;
+
+	// 1. Target이 있는 방향으로 각 축을 두 배로 늘린 새 루트 경계를 계산한다
+	FVector NewMin = BoundingBox.Min;
+	FVector NewMax = BoundingBox.Max;
+	if (InTarget.X < Center.X) { NewMin.X -= Size.X; } else { NewMax.X += Size.X; }
+	if (InTarget.Y < Center.Y) { NewMin.Y -= Size.Y; } else { NewMax.Y += Size.Y; }
+	if (InTarget.Z < Center.Z) { NewMin.Z -= Size.Z; } else { NewMax.Z += Size.Z; }
+
+	// 2. 기존 루트의 내용을 새 노드로 옮긴다 (루트 포인터는 외부에서 유지되므로 this는 그대로 루트로 남는다)
+	FOctree* OldRoot = new FOctree(BoundingBox, Depth, Looseness);
+	OldRoot->MaxDepth = MaxDepth;
+	OldRoot->Primitives = std::move(Primitives);
+	OldRoot->Children = std::move(Children);
+	OldRoot->Parent = this;
+	OldRoot->bTrackPrimitiveHandles = bTrackPrimitiveHandles;
+	OldRoot->ShiftDepth(1);
+	if (bTrackPrimitiveHandles)
 	{
-		Insert(prim);
+		for (UPrimitiveComponent* Primitive : OldRoot->Primitives) { Primitive->OctreeNode = OldRoot; }
 	}
+	for (FOctree* Child : OldRoot->Children)
+	{
+		if (Child) { Child->Parent = OldRoot; }
+	}
+
+	Primitives.clear();
+	Children.assign(8, nullptr);
+	++MaxDepth;
+	SetBoundingBox(FAABB(NewMin, NewMax));
+
+	// 3. 기존 루트를 새 루트의 자식 셀 중 하나로 배치하고, 나머지는 빈 리프로 채운다
+	const int OldRootIndex = GetChildIndex(OldRoot->BoundingBox.GetCenter());
+	for (int Index = 0; Index < 8; ++Index)
+	{
+		if (Index == OldRootIndex)
+		{
+			Children[Index] = OldRoot;
+			continue;
+		}
+		Children[Index] = new FOctree(GetChildCellBox(Index), Depth + 1, Looseness);
+		Children[Index]->MaxDepth = MaxDepth;
+		Children[Index]->Parent = this;
+		Children[Index]->bTrackPrimitiveHandles = bTrackPrimitiveHandles;
+	}
+}
+
+void FOctree::ShiftDepth(int InDelta)
+{
+	Depth += InDelta;
+	MaxDepth += InDelta;
+	for (FOctree* Child : Children)
+	{
+		if (Child) { Child->ShiftDepth(InDelta); }
+	}
+}
+
+int FOctree::GetChildIndex(const FVector& InPoint) const
+{
+	const FVector Center = BoundingBox.GetCenter();
+
+	int Index = 0;
+	if (InPoint.X >= Center.X) { Index |= 1; } // Right
+	if (InPoint.Z >= Center.Z) { Index |= 2; } // Front
+	if (InPoint.Y < Center.Y) { Index |= 4; }  // Bottom
+	return Index;
+}
+
+FAABB FOctree::GetChildCellBox(int InIndex) const
+{
+	const FVector Center = BoundingBox.GetCenter();
+	FVector Min = BoundingBox.Min;
+	FVector Max = BoundingBox.Max;
+
+	// 0: Top-Back-Left,    1: Top-Back-Right,    2: Top-Front-Left,    3: Top-Front-Right
+	// 4: Bottom-Back-Left, 5: Bottom-Back-Right, 6: Bottom-Front-Left, 7: Bottom-Front-Right
+	if (InIndex & 1) { Min.X = Center.X; } else { Max.X = Center.X; }
+	if (InIndex & 2) { Min.Z = Center.Z; } else { Max.Z = Center.Z; }
+	if (InIndex & 4) { Max.Y = Center.Y; } else { Min.Y = Center.Y; }
+
+	return FAABB(Min, Max);
+}
+
+void FOctree::UpdateLooseBoundingBox()
+{
+	const FVector Center = BoundingBox.GetCenter();
+	const FVector LooseHalfSize = (BoundingBox.Max - BoundingBox.Min) * (0.5f * Looseness);
+	LooseBoundingBox = FAABB(Center - LooseHalfSize, Center + LooseHalfSize);
 }
 
 void FOctree::TryMerge()
@@ -246,7 +636,7 @@ void FOctree::TryMerge()
 	{
 		for (int Index = 0; Index < 8; ++Index)
 		{
-			Primitives.insert(Primitives.end(), Children[Index]->Primitives.begin(), Children[Index]->Primitives.end());
+			for (UPrimitiveComponent* Primitive : Children[Index]->Primitives) { AddPrimitive(Primitive); }
 		}
 
 		// 모든 자식 노드를 메모리에서 해제
@@ -260,11 +650,15 @@ void FOctree::DeepCopy(FOctree* OutOctree) const
 
 	// 1) 필드 복사
 	OutOctree->BoundingBox = BoundingBox;
+	OutOctree->LooseBoundingBox = LooseBoundingBox;
 	OutOctree->Depth = Depth;
+	OutOctree->MaxDepth = MaxDepth;
+	OutOctree->Looseness = Looseness;
+	OutOctree->bTrackPrimitiveHandles = false;
 
 	// 2) 기존 대상의 프리미티브/자식 정리 후 초기화
 	//    - 프리미티브는 대입으로 교체
-	OutOctree->Primitives = Primitives; // shallow copy of pointers
+	OutOctree->Primitives = Primitives; // shallow copy of pointers (프리미티브의 역참조는 원본 트리를 계속 가리킨다)
 
 	//    - 기존 자식 노드 메모리 해제
 	for (FOctree* Child : OutOctree->Children)
@@ -282,7 +676,8 @@ void FOctree::DeepCopy(FOctree* OutOctree) const
 			if (Children[Index] != nullptr)
 			{
 				// 자식 노드 생성 후 재귀 복사
-				OutOctree->Children[Index] = new FOctree(Children[Index]->BoundingBox, Children[Index]->Depth);
+				OutOctree->Children[Index] = new FOctree(Children[Index]->BoundingBox, Children[Index]->Depth, Children[Index]->Looseness);
+				OutOctree->Children[Index]->Parent = OutOctree;
 				Children[Index]->DeepCopy(OutOctree->Children[Index]);
 			}
 		}
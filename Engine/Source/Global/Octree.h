@@ -7,43 +7,133 @@ class UPrimitiveComponent;
 constexpr int MAX_PRIMITIVES = 16; 
 constexpr int MAX_DEPTH = 5;      
 
+/** @brief Loose Octree의 기본 느슨함 계수. 노드의 Loose 경계는 셀 크기 * Looseness가 된다. */
+constexpr float DEFAULT_OCTREE_LOOSENESS = 2.0f;
+/** @brief 한 번의 Insert에서 루트를 확장할 수 있는 최대 횟수 (비정상적인 AABB로 인한 무한 확장 방지) */
+constexpr int MAX_ROOT_GROW_COUNT = 16;
+
+/**
+ * @brief Loose Octree
+ * 각 노드는 셀 경계(BoundingBox)와 이를 Looseness배 만큼 키운 Loose 경계(LooseBoundingBox)를 가진다.
+ * 프리미티브는 중심점이 속한 자식 셀의 Loose 경계에 완전히 들어갈 때만 자식으로 내려가며,
+ * 루트의 Loose 경계를 벗어나는 프리미티브가 들어오면 루트를 해당 방향으로 확장한다.
+ * 따라서 유효한 AABB를 가진 프리미티브는 항상 트리에 삽입된다.
+ * 삽입된 프리미티브는 소속 노드와 슬롯을 역참조로 들고 있으므로, 삭제는 탐색 없이 swap-and-pop으로 처리된다.
+ */
 class FOctree
 {
 public:
 	FOctree();
-	FOctree(const FVector& InPosition, float InSize, int InDepth);
-	FOctree(const FAABB& InBoundingBox, int InDepth);
+	FOctree(const FVector& InPosition, float InSize, int InDepth, float InLooseness = DEFAULT_OCTREE_LOOSENESS);
+	FOctree(const FAABB& InBoundingBox, int InDepth, float InLooseness = DEFAULT_OCTREE_LOOSENESS);
 	~FOctree();
 
+	/**
+	 * @brief 프리미티브를 삽입한다. 루트의 Loose 경계를 벗어나면 루트를 확장한 뒤 삽입한다.
+	 * @return 프리미티브가 nullptr이거나 AABB가 유효하지 않으면 false
+	 */
 	bool Insert(UPrimitiveComponent* InPrimitive);
+	/** @brief 프리미티브의 역참조를 이용해 소속 노드에서 바로 제거한다. 트리에 없다면 false */
 	bool Remove(UPrimitiveComponent* InPrimitive);
+	/**
+	 * @brief 프리미티브의 이동을 반영한다. 소속 노드의 Loose 경계 안에 머문다면 아무 작업도 하지 않는다.
+	 * @param bInReinsert 경계를 벗어났을 때 즉시 재삽입할지 여부. false라면 트리에서 제거만 한다.
+	 * @return 갱신 후에도 프리미티브가 트리에 남아있다면 true
+	 */
+	bool Update(UPrimitiveComponent* InPrimitive, bool bInReinsert = true);
+	/** @brief 프리미티브가 이 트리에 들어있는지 역참조로 확인한다. */
+	bool Contains(const UPrimitiveComponent* InPrimitive) const;
 	void Clear();
 
+	/**
+	 * @brief 트리를 비우고 주어진 프리미티브들로 한 번에 다시 구축한다. (레벨 로드 등 대량 삽입용)
+	 * 모든 AABB를 먼저 계산해 루트 경계를 정하고, 중심점의 Morton 코드로 정렬한 뒤
+	 * 정렬된 구간을 자식 셀 단위로 잘라 내려가며 노드를 한 번씩만 만든다. (Subdivide에 의한 재삽입 없음)
+	 * 루트에서 호출해야 하며, 런타임 스폰은 기존처럼 Insert를 사용한다.
+	 * @param OutRejected AABB가 유효하지 않아 삽입되지 못한 프리미티브
+	 */
+	void Build(const TArray<UPrimitiveComponent*>& InPrimitives, TArray<UPrimitiveComponent*>& OutRejected);
+
+	/** @brief 트리 구조를 복사한다. 복사본은 프리미티브 역참조를 관리하지 않으므로 Remove가 전체 탐색으로 동작한다. */
 	void DeepCopy(FOctree* OutOctree) const;
 
 	void GetAllPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives) const;
-	TArray<UPrimitiveComponent*> FindNearestPrimitives(const FVector& FindPos, uint32 MaxPrimitiveCount);
+	/**
+	 * @brief InLocation에서 가까운 프리미티브를 최대 InMaxCount개 찾는다. 거리는 점과 프리미티브 월드 AABB 사이의 거리이다.
+	 * 노드를 Loose 경계까지의 거리 순으로 방문하는 Best-First 탐색이며, 후보를 InMaxCount개까지만 유지하는 최대 힙의
+	 * 가장 먼 후보보다 먼 노드가 나오면 나머지 노드는 방문하지 않는다.
+	 * 이 트리에 들어있는 프리미티브만 검색하므로, 동적 프리미티브까지 필요하다면 호출하는 쪽에서 결과를 합친다.
+	 * @param OutPrimitives 가까운 순서로 정렬된 결과 (기존 내용은 지운다)
+	 * @param InMaxDistance 이보다 먼 프리미티브는 결과에 넣지 않는다
+	 */
+	void FindNearestPrimitives(const FVector& InLocation, uint32 InMaxCount, TArray<UPrimitiveComponent*>& OutPrimitives,
+		float InMaxDistance = FLT_MAX) const;
 
-	const FAABB& GetBoundingBox() const { return BoundingBox; }
-	void SetBoundingBox(const FAABB& InAABB) { BoundingBox = InAABB; }
+	/** @brief 쿼리(컬링, 피킹 등)에 사용해야 하는 Loose 경계를 반환한다. */
+	const FAABB& GetBoundingBox() const { return LooseBoundingBox; }
+	/** @brief 옥트리 공간 분할 단위인 셀 경계를 반환한다. */
+	const FAABB& GetCellBoundingBox() const { return BoundingBox; }
+	void SetBoundingBox(const FAABB& InAABB) { BoundingBox = InAABB; UpdateLooseBoundingBox(); }
+	float GetLooseness() const { return Looseness; }
 	bool IsLeafNode() const { return IsLeaf(); }
+	FOctree* GetParent() const { return Parent; }
 	const TArray<UPrimitiveComponent*>& GetPrimitives() const { return Primitives; }
 	TArray<FOctree*>& GetChildren() { return Children; }
 	const TArray<FOctree*>& GetChildren() const { return Children; } 
 
+	/**
+	 * @brief 뷰마다 마지막으로 이 노드를 절두체 밖으로 판정한 평면. 다음 프레임 컬링 때 이 평면부터 검사한다.
+	 * 뷰 인덱스 i의 평면 번호는 (i * 3)번째 비트부터 3비트에 담긴다. 트리 구조와 무관한 힌트이므로 const 노드에서도 갱신한다.
+	 */
+	uint32 GetLastRejectingPlanes() const { return LastRejectingPlanes; }
+	void SetLastRejectingPlanes(uint32 InPackedPlanes) const { LastRejectingPlanes = InPackedPlanes; }
+
 private:
 	bool IsLeaf() const { return Children[0] == nullptr; }
-	void Subdivide(UPrimitiveComponent* InPrimitive);
+	bool InsertInternal(UPrimitiveComponent* InPrimitive, const FAABB& InPrimitiveBox);
+	void Subdivide(UPrimitiveComponent* InPrimitive, const FAABB& InPrimitiveBox);
+	void CreateChildren();
+	/** @brief Morton 코드로 정렬된 구간으로 서브트리를 구축한다. (Build 전용) */
+	void BuildFromSortedRange(struct FOctreeBuildEntry* InBegin, struct FOctreeBuildEntry* InEnd);
 	void TryMerge();
+	/** @brief 프리미티브가 빠진 노드에서 부모 방향으로 올라가며 병합을 시도한다. (병합으로 InNode가 해제될 수 있다) */
+	static void MergeUpwards(FOctree* InNode);
+
+	/** @brief 프리미티브를 현재 노드에 추가하고 역참조를 기록한다. */
+	void AddPrimitive(UPrimitiveComponent* InPrimitive);
+	/** @brief 슬롯의 프리미티브를 swap-and-pop으로 제거하고, 자리를 옮긴 프리미티브의 역참조를 갱신한다. */
+	void RemoveAt(int32 InSlot);
+	/** @brief 역참조를 관리하지 않는 트리(DeepCopy로 만든 복사본)를 위한 전체 탐색 제거 */
+	bool RemoveBySearch(UPrimitiveComponent* InPrimitive);
+	/** @brief 해당 노드가 이 트리(this를 루트로 하는 서브트리)에 속하는지 확인한다. */
+	bool IsAncestorOf(const FOctree* InNode) const;
+
+	/** @brief 루트를 Target 방향으로 두 배 확장하고, 기존 루트의 내용을 자식 노드로 내린다. */
+	void GrowRoot(const FVector& InTarget);
+	/** @brief 서브트리 전체의 Depth와 MaxDepth를 InDelta만큼 이동시킨다. (루트 확장 시 사용) */
+	void ShiftDepth(int InDelta);
+
+	/** @brief 해당 점이 속하는 자식 셀의 인덱스를 반환한다. Subdivide의 자식 배치와 일치해야 한다. */
+	int GetChildIndex(const FVector& InPoint) const;
+	FAABB GetChildCellBox(int InIndex) const;
+	void UpdateLooseBoundingBox();
 
 	FAABB BoundingBox;
-	int Depth;                       
+	FAABB LooseBoundingBox;
+	FOctree* Parent = nullptr;
+	/** @brief 프리미티브 역참조를 관리하는지 여부. DeepCopy로 만든 복사본은 원본의 역참조를 건드리지 않도록 false가 된다. */
+	bool bTrackPrimitiveHandles = true;
+	int Depth;
+	int MaxDepth = MAX_DEPTH;
+	float Looseness = DEFAULT_OCTREE_LOOSENESS;
+	mutable uint32 LastRejectingPlanes = 0;
 	TArray<UPrimitiveComponent*> Primitives;
 	TArray<FOctree*> Children;
 };
 
+/** @brief 거리(제곱)가 가장 작은 노드가 top에 오는 최소 힙 (FindNearestPrimitives 탐색용) */
 using FNodeQueue = std::priority_queue<
-	std::pair<float, FOctree*>,
-	std::vector<std::pair<float, FOctree*>>,
-	std::greater<std::pair<float, FOctree*>>
+	std::pair<float, const FOctree*>,
+	std::vector<std::pair<float, const FOctree*>>,
+	std::greater<std::pair<float, const FOctree*>>
 >;
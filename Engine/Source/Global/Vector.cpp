@@ -20,15 +20,6 @@ FVector::FVector(float InX, float InY, float InZ)
 {
 }
 
-
-/**
- * @brief FVector를 Param으로 넘기는 생성자
- */
-FVector::FVector(const FVector& InOther)
-	: X(InOther.X), Y(InOther.Y), Z(InOther.Z)
-{
-}
-
 void FVector::operator=(const FVector4& InOther)
 {
 	*this = FVector(InOther.X, InOther.Y, InOther.Z);
@@ -165,14 +156,6 @@ FVector4::FVector4(const float InX, const float InY, const float InZ, const floa
 FVector4::FVector4(const FVector& InVt3, float InW) : X(InVt3.X), Y(InVt3.Y), Z(InVt3.Z), W(InW)
 {
 
-}
-
-	/**
-	 * @brief FVector를 Param으로 넘기는 생성자
-	 */
-FVector4::FVector4(const FVector4& InOther)
-		: X(InOther.X), Y(InOther.Y), Z(InOther.Z), W(InOther.W)
-{
 }
 
 
@@ -328,14 +311,6 @@ FVector2::FVector2(float InX, float InY)
 {
 }
 
-/**
- * @brief FVector2를 Param으로 넘기는 생성자
- */
-FVector2::FVector2(const FVector2& InOther)
-	: X(InOther.X), Y(InOther.Y)
-{
-}
-
 /**
  * @brief 두 벡터를 더한 새로운 벡터를 반환하는 함수
  */
@@ -22,7 +22,7 @@ struct FVector
 	/**
 	 * @brief FVector를 Param으로 넘기는 생성자
 	 */
-	FVector(const FVector& InOther);
+	FVector(const FVector& InOther) = default;
 
 	void operator=(const FVector4& InOther);
 
@@ -220,7 +220,7 @@ struct FVector2
 	/**
 	 * @brief FVector2를 Param으로 넘기는 생성자
 	 */
-	FVector2(const FVector2& InOther);
+	FVector2(const FVector2& InOther) = default;
 
 	/**
 	 * @brief 두 벡터를 더한 새로운 벡터를 반환하는 함수
@@ -274,7 +274,7 @@ struct alignas(16) FVector4
 	/**
 	 * @brief FVector를 Param으로 넘기는 생성자
 	 */
-	FVector4(const FVector4& InOther);
+	FVector4(const FVector4& InOther) = default;
 
 	/**
 	 * @brief 두 벡터를 더한 새로운 벡터를 반환하는 함수
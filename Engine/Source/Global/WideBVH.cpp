@@ -0,0 +1,441 @@
+#include "pch.h"
+#include "Global/WideBVH.h"
+#include "Global/BVH.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Core/Public/Archive.h"
+
+#include <immintrin.h>
+
+namespace
+{
+	/** @brief 넓은 트리 Ray 순회 스택. FBVH의 순회 스택처럼 스레드마다 하나씩 두고 재사용한다 */
+	thread_local TArray<std::pair<int32, float>> WideRayTraversalStack;
+
+	/** @brief 양자화 격자의 최대 칸. 올림 보정으로 255까지 쓸 수 있게 한 칸을 남겨 둔다 */
+	constexpr float QUANTIZE_STEPS = 254.0f;
+
+	/** @brief 레이 원점/방향 역수를 축마다 8레인으로 복제해 둔다. (SSE는 앞 4레인만 읽는다) */
+	struct alignas(32) FRayLanes
+	{
+		float Origin[3][8];
+		float InvDirection[3][8];
+
+		FRayLanes(const FVector& InOrigin, const FVector& InInvDirection)
+		{
+			for (uint32 Lane = 0; Lane < 8; ++Lane)
+			{
+				Origin[0][Lane] = InOrigin.X;
+				Origin[1][Lane] = InOrigin.Y;
+				Origin[2][Lane] = InOrigin.Z;
+				InvDirection[0][Lane] = InInvDirection.X;
+				InvDirection[1][Lane] = InInvDirection.Y;
+				InvDirection[2][Lane] = InInvDirection.Z;
+			}
+		}
+	};
+
+	float GetAxisValue(const FVector& InVector, uint32 InAxis)
+	{
+		return InAxis == 0 ? InVector.X : (InAxis == 1 ? InVector.Y : InVector.Z);
+	}
+
+	/**
+	 * @brief [InMin, InMax]를 Origin + Q * Scale 격자로 양자화한다.
+	 * 복원은 순회와 같은 float 연산이므로 그 결과가 원래 구간을 덮을 때까지 한 칸씩 넓혀 보수적인 박스를 보장한다.
+	 */
+	void QuantizeRange(float InMin, float InMax, float InOrigin, float InScale, uint8& OutMin, uint8& OutMax)
+	{
+		if (InScale == 0.0f)
+		{
+			OutMin = 0;
+			OutMax = 0;
+			return;
+		}
+
+		int32 QuantizedMin = std::clamp(static_cast<int32>(floorf((InMin - InOrigin) / InScale)), 0, 255);
+		while (QuantizedMin > 0 && InOrigin + static_cast<float>(QuantizedMin) * InScale > InMin)
+		{
+			--QuantizedMin;
+		}
+
+		int32 QuantizedMax = std::clamp(static_cast<int32>(ceilf((InMax - InOrigin) / InScale)), 0, 255);
+		while (QuantizedMax < 255 && InOrigin + static_cast<float>(QuantizedMax) * InScale < InMax)
+		{
+			++QuantizedMax;
+		}
+
+		OutMin = static_cast<uint8>(QuantizedMin);
+		OutMax = static_cast<uint8>(QuantizedMax);
+	}
+
+	/** @brief uint8 4개를 float 4개로 넓힌다. (SSE2만 사용) */
+	__m128 LoadQuantized4(const uint8* InValues)
+	{
+		int32 Packed;
+		memcpy(&Packed, InValues, sizeof(Packed));
+		const __m128i Zero = _mm_setzero_si128();
+		const __m128i Words = _mm_unpacklo_epi8(_mm_cvtsi32_si128(Packed), Zero);
+		return _mm_cvtepi32_ps(_mm_unpacklo_epi16(Words, Zero));
+	}
+
+	/** @brief uint8 8개를 float 8개로 넓힌다. 정수 확장은 SSE2로 하고 변환만 AVX로 한다 (AVX2 불필요) */
+	__m256 LoadQuantized8(const uint8* InValues)
+	{
+		const __m128i Zero = _mm_setzero_si128();
+		const __m128i Words = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(InValues)), Zero);
+		const __m256i Dwords = _mm256_insertf128_si256(_mm256_castsi128_si256(_mm_unpacklo_epi16(Words, Zero)), _mm_unpackhi_epi16(Words, Zero), 1);
+		return _mm256_cvtepi32_ps(Dwords);
+	}
+
+	/**
+	 * @brief 자식 4개의 양자화 박스를 한 번에 slab 검사한다. InQuantizedMin/Max는 축마다 InStride 간격으로 놓인 레인 배열.
+	 * @return 교차하는 레인의 비트 마스크. OutEntry에 레인별 진입 거리를 쓴다
+	 */
+	uint32 IntersectChildrenSSE(const float* InNodeOrigin, const float* InNodeScale, const uint8* InQuantizedMin, const uint8* InQuantizedMax,
+		uint32 InStride, const FRayLanes& InRay, float InMinDistance, float InMaxDistance, float* OutEntry)
+	{
+		__m128 Entry = _mm_set1_ps(InMinDistance);
+		__m128 Exit = _mm_set1_ps(InMaxDistance);
+		for (uint32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const __m128 NodeOrigin = _mm_set1_ps(InNodeOrigin[Axis]);
+			const __m128 NodeScale = _mm_set1_ps(InNodeScale[Axis]);
+			const __m128 Lo = _mm_add_ps(NodeOrigin, _mm_mul_ps(LoadQuantized4(InQuantizedMin + Axis * InStride), NodeScale));
+			const __m128 Hi = _mm_add_ps(NodeOrigin, _mm_mul_ps(LoadQuantized4(InQuantizedMax + Axis * InStride), NodeScale));
+
+			const __m128 RayOrigin = _mm_load_ps(InRay.Origin[Axis]);
+			const __m128 InvDirection = _mm_load_ps(InRay.InvDirection[Axis]);
+			const __m128 T1 = _mm_mul_ps(_mm_sub_ps(Lo, RayOrigin), InvDirection);
+			const __m128 T2 = _mm_mul_ps(_mm_sub_ps(Hi, RayOrigin), InvDirection);
+			Entry = _mm_max_ps(Entry, _mm_min_ps(T1, T2));
+			Exit = _mm_min_ps(Exit, _mm_max_ps(T1, T2));
+		}
+
+		_mm_storeu_ps(OutEntry, Entry);
+		return static_cast<uint32>(_mm_movemask_ps(_mm_cmple_ps(Entry, Exit)));
+	}
+
+	/** @brief IntersectChildrenSSE의 8레인 버전 */
+	uint32 IntersectChildrenAVX(const float* InNodeOrigin, const float* InNodeScale, const uint8* InQuantizedMin, const uint8* InQuantizedMax,
+		uint32 InStride, const FRayLanes& InRay, float InMinDistance, float InMaxDistance, float* OutEntry)
+	{
+		__m256 Entry = _mm256_set1_ps(InMinDistance);
+		__m256 Exit = _mm256_set1_ps(InMaxDistance);
+		for (uint32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const __m256 NodeOrigin = _mm256_set1_ps(InNodeOrigin[Axis]);
+			const __m256 NodeScale = _mm256_set1_ps(InNodeScale[Axis]);
+			const __m256 Lo = _mm256_add_ps(NodeOrigin, _mm256_mul_ps(LoadQuantized8(InQuantizedMin + Axis * InStride), NodeScale));
+			const __m256 Hi = _mm256_add_ps(NodeOrigin, _mm256_mul_ps(LoadQuantized8(InQuantizedMax + Axis * InStride), NodeScale));
+
+			const __m256 RayOrigin = _mm256_load_ps(InRay.Origin[Axis]);
+			const __m256 InvDirection = _mm256_load_ps(InRay.InvDirection[Axis]);
+			const __m256 T1 = _mm256_mul_ps(_mm256_sub_ps(Lo, RayOrigin), InvDirection);
+			const __m256 T2 = _mm256_mul_ps(_mm256_sub_ps(Hi, RayOrigin), InvDirection);
+			Entry = _mm256_max_ps(Entry, _mm256_min_ps(T1, T2));
+			Exit = _mm256_min_ps(Exit, _mm256_max_ps(T1, T2));
+		}
+
+		_mm256_storeu_ps(OutEntry, Entry);
+		return static_cast<uint32>(_mm256_movemask_ps(_mm256_cmp_ps(Entry, Exit, _CMP_LE_OQ)));
+	}
+
+	/** @brief 비어 있지 않은 자식 슬롯의 비트 마스크 */
+	template<uint32 Width>
+	uint32 GetOccupiedMask(const int32* InChildren)
+	{
+		const __m128i Empty = _mm_set1_epi32(TWideBVH<Width>::EMPTY_CHILD);
+		uint32 Mask = 0;
+		for (uint32 Lane = 0; Lane < Width; Lane += 4)
+		{
+			const __m128i Children = _mm_loadu_si128(reinterpret_cast<const __m128i*>(InChildren + Lane));
+			Mask |= static_cast<uint32>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(Children, Empty)))) << Lane;
+		}
+		return ~Mask & ((1u << Width) - 1);
+	}
+
+	/** @brief 노드의 자식 Width개를 검사한다. 8개 폭은 AVX 빌드에서만 AVX로, 아니면 SSE 두 번으로 검사한다 */
+	template<uint32 Width>
+	uint32 IntersectChildren(const typename TWideBVH<Width>::FNode& InNode, const FRayLanes& InRay, float InMinDistance, float InMaxDistance,
+		float* OutEntry)
+	{
+		uint32 HitMask;
+		if constexpr (Width == 4)
+		{
+			HitMask = IntersectChildrenSSE(InNode.Origin, InNode.Scale, InNode.QuantizedMin[0], InNode.QuantizedMax[0], Width,
+				InRay, InMinDistance, InMaxDistance, OutEntry);
+		}
+		else
+		{
+#if defined(__AVX__)
+			HitMask = IntersectChildrenAVX(InNode.Origin, InNode.Scale, InNode.QuantizedMin[0], InNode.QuantizedMax[0], Width,
+				InRay, InMinDistance, InMaxDistance, OutEntry);
+#else
+			HitMask = IntersectChildrenSSE(InNode.Origin, InNode.Scale, InNode.QuantizedMin[0], InNode.QuantizedMax[0], Width,
+				InRay, InMinDistance, InMaxDistance, OutEntry);
+			HitMask |= IntersectChildrenSSE(InNode.Origin, InNode.Scale, InNode.QuantizedMin[0] + 4, InNode.QuantizedMax[0] + 4, Width,
+				InRay, InMinDistance, InMaxDistance, OutEntry + 4) << 4;
+#endif
+		}
+		return HitMask & GetOccupiedMask<Width>(InNode.Children);
+	}
+}
+
+template<uint32 Width>
+void TWideBVH<Width>::Clear()
+{
+	Mesh = nullptr;
+	Nodes.clear();
+}
+
+template<uint32 Width>
+void TWideBVH<Width>::Build(const FBVH& InBinary)
+{
+	Clear();
+
+	const int32 BinaryRoot = InBinary.GetRootIndex();
+	if (!InBinary.GetMesh() || BinaryRoot < 0 || BinaryRoot >= InBinary.GetNodeCount())
+	{
+		return;
+	}
+	Mesh = InBinary.GetMesh();
+
+	// 넓은 노드 하나가 이진 내부 노드 최대 Width - 1개를 흡수한다
+	Nodes.reserve(static_cast<size_t>(InBinary.GetNodeCount()) / (2 * (Width - 1)) + 1);
+	Nodes.emplace_back();
+
+	// (접을 이진 노드, 채울 넓은 노드) 쌍
+	TArray<std::pair<int32, int32>> PendingNodes;
+	PendingNodes.emplace_back(BinaryRoot, 0);
+
+	while (!PendingNodes.empty())
+	{
+		const auto [BinaryIndex, WideIndex] = PendingNodes.back();
+		PendingNodes.pop_back();
+
+		// 1. 자식이 Width개가 될 때까지 표면적이 가장 큰 내부 노드를 두 자식으로 펼친다
+		int32 Candidates[Width];
+		uint32 CandidateCount = 1;
+		Candidates[0] = BinaryIndex;
+		while (CandidateCount < Width)
+		{
+			int32 ExpandSlot = -1;
+			float LargestArea = -1.0f;
+			for (uint32 Slot = 0; Slot < CandidateCount; ++Slot)
+			{
+				const ::FNode& Candidate = InBinary.GetNode(Candidates[Slot]);
+				if (!Candidate.bIsLeaf && Candidate.Box.GetSurfaceArea() > LargestArea)
+				{
+					LargestArea = Candidate.Box.GetSurfaceArea();
+					ExpandSlot = static_cast<int32>(Slot);
+				}
+			}
+			if (ExpandSlot < 0)
+			{
+				break;
+			}
+
+			const ::FNode& Expanded = InBinary.GetNode(Candidates[ExpandSlot]);
+			Candidates[ExpandSlot] = Expanded.Child1;
+			Candidates[CandidateCount++] = Expanded.Child2;
+		}
+
+		// 2. 자식 박스의 합집합을 양자화 격자로 삼는다
+		FVector BoundsMin(FLT_MAX, FLT_MAX, FLT_MAX);
+		FVector BoundsMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		for (uint32 Slot = 0; Slot < CandidateCount; ++Slot)
+		{
+			const FAABB& ChildBox = InBinary.GetNode(Candidates[Slot]).Box;
+			BoundsMin = FVector(std::min(BoundsMin.X, ChildBox.Min.X), std::min(BoundsMin.Y, ChildBox.Min.Y), std::min(BoundsMin.Z, ChildBox.Min.Z));
+			BoundsMax = FVector(std::max(BoundsMax.X, ChildBox.Max.X), std::max(BoundsMax.Y, ChildBox.Max.Y), std::max(BoundsMax.Z, ChildBox.Max.Z));
+		}
+
+		FNode Node;
+		for (uint32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const float Extent = GetAxisValue(BoundsMax, Axis) - GetAxisValue(BoundsMin, Axis);
+			Node.Origin[Axis] = GetAxisValue(BoundsMin, Axis);
+			Node.Scale[Axis] = Extent > 0.0f ? std::max(Extent / QUANTIZE_STEPS, FLT_MIN) : 0.0f;
+		}
+
+		// 3. 리프는 슬롯에 삼각형 번호를 바로 넣고, 내부 노드는 새 넓은 노드를 만들어 나중에 접는다
+		for (uint32 Slot = 0; Slot < Width; ++Slot)
+		{
+			if (Slot >= CandidateCount)
+			{
+				Node.Children[Slot] = EMPTY_CHILD;
+				for (uint32 Axis = 0; Axis < 3; ++Axis)
+				{
+					Node.QuantizedMin[Axis][Slot] = 0;
+					Node.QuantizedMax[Axis][Slot] = 0;
+				}
+				continue;
+			}
+
+			const ::FNode& Child = InBinary.GetNode(Candidates[Slot]);
+			for (uint32 Axis = 0; Axis < 3; ++Axis)
+			{
+				QuantizeRange(GetAxisValue(Child.Box.Min, Axis), GetAxisValue(Child.Box.Max, Axis), Node.Origin[Axis], Node.Scale[Axis],
+					Node.QuantizedMin[Axis][Slot], Node.QuantizedMax[Axis][Slot]);
+			}
+
+			if (Child.bIsLeaf)
+			{
+				Node.Children[Slot] = ~(Child.TriangleBaseIndex / 3);
+			}
+			else
+			{
+				Node.Children[Slot] = static_cast<int32>(Nodes.size());
+				PendingNodes.emplace_back(Candidates[Slot], Node.Children[Slot]);
+				Nodes.emplace_back();
+			}
+		}
+		Nodes[WideIndex] = Node;
+	}
+}
+
+template<uint32 Width>
+bool TWideBVH<Width>::Serialize(FArchive& Ar, const FStaticMesh* InMesh)
+{
+	uint32 SavedWidth = Width;
+	Ar << SavedWidth;
+
+	if (Ar.IsLoading() && SavedWidth != Width)
+	{
+		// 다른 폭의 노드는 읽지 않고 크기만큼 건너뛴다
+		Clear();
+		if (SavedWidth != 4 && SavedWidth != 8)
+		{
+			return false;
+		}
+
+		size_t NodeCount = 0;
+		Ar << NodeCount;
+		TArray<uint8> SkippedNodes(NodeCount * (SavedWidth == 4 ? sizeof(typename TWideBVH<4>::FNode) : sizeof(typename TWideBVH<8>::FNode)));
+		if (!SkippedNodes.empty())
+		{
+			Ar.Serialize(SkippedNodes.data(), SkippedNodes.size());
+		}
+		return false;
+	}
+
+	Ar << Nodes;
+	if (Ar.IsLoading())
+	{
+		Mesh = Nodes.empty() ? nullptr : InMesh;
+	}
+	return true;
+}
+
+template<uint32 Width>
+bool TWideBVH<Width>::ClosestHit(const FRay& Ray, FBVHRayHit& OutHit, float MinDistance, float MaxDistance) const
+{
+	return IntersectRay(Ray, OutHit, MinDistance, MaxDistance, false);
+}
+
+template<uint32 Width>
+bool TWideBVH<Width>::AnyHit(const FRay& Ray, FBVHRayHit& OutHit, float MinDistance, float MaxDistance) const
+{
+	return IntersectRay(Ray, OutHit, MinDistance, MaxDistance, true);
+}
+
+template<uint32 Width>
+bool TWideBVH<Width>::IntersectRay(const FRay& Ray, FBVHRayHit& OutHit, float MinDistance, float MaxDistance, bool bStopAtFirstHit) const
+{
+	OutHit = FBVHRayHit();
+	if (!IsBuilt() || MinDistance > MaxDistance)
+	{
+		return false;
+	}
+
+	const FVector Origin(Ray.Origin.X, Ray.Origin.Y, Ray.Origin.Z);
+	const FVector Direction(Ray.Direction.X, Ray.Direction.Y, Ray.Direction.Z);
+	const FRayLanes RayLanes(Origin, FBVH::GetSafeInverseDirection(Direction));
+
+	// 루트 박스는 자식 박스의 합집합이므로 따로 검사하지 않고 자식 검사에 맡긴다
+	TArray<std::pair<int32, float>>& NodeStack = WideRayTraversalStack;
+	NodeStack.clear();
+	NodeStack.emplace_back(0, MinDistance);
+
+	float Closest = MaxDistance;
+	bool bHit = false;
+	while (!NodeStack.empty())
+	{
+		const auto [NodeIndex, Entry] = NodeStack.back();
+		NodeStack.pop_back();
+		if (Entry > Closest)
+		{
+			continue;
+		}
+
+		const FNode& Node = Nodes[NodeIndex];
+		alignas(32) float ChildEntries[Width];
+		uint32 HitMask = IntersectChildren<Width>(Node, RayLanes, MinDistance, Closest, ChildEntries);
+		if (HitMask == 0)
+		{
+			continue;
+		}
+
+		// 맞은 자식을 진입 거리 순으로 정렬한다
+		uint32 Order[Width];
+		uint32 HitCount = 0;
+		for (; HitMask != 0; HitMask &= HitMask - 1)
+		{
+			unsigned long Lane;
+			_BitScanForward(&Lane, HitMask);
+
+			uint32 Insert = HitCount++;
+			while (Insert > 0 && ChildEntries[Order[Insert - 1]] > ChildEntries[Lane])
+			{
+				Order[Insert] = Order[Insert - 1];
+				--Insert;
+			}
+			Order[Insert] = Lane;
+		}
+
+		// 삼각형 자식은 가까운 것부터 바로 검사해 Closest를 줄인다
+		for (uint32 Index = 0; Index < HitCount; ++Index)
+		{
+			const uint32 Lane = Order[Index];
+			const int32 Child = Node.Children[Lane];
+			if (Child >= 0 || ChildEntries[Lane] > Closest)
+			{
+				continue;
+			}
+
+			const int32 TriangleIndex = ~Child;
+			const uint32* TriangleIndices = &Mesh->Indices[static_cast<size_t>(TriangleIndex) * 3];
+			float T, U, V;
+			if (FBVH::IntersectTriangle(Origin, Direction, Mesh->Vertices[TriangleIndices[0]].Position, Mesh->Vertices[TriangleIndices[1]].Position,
+				Mesh->Vertices[TriangleIndices[2]].Position, MinDistance, Closest, T, U, V))
+			{
+				Closest = T;
+				OutHit.Distance = T;
+				OutHit.TriangleIndex = TriangleIndex;
+				OutHit.U = U;
+				OutHit.V = V;
+				bHit = true;
+
+				if (bStopAtFirstHit)
+				{
+					return true;
+				}
+			}
+		}
+
+		// 내부 자식은 먼 것부터 넣어 가까운 것을 먼저 꺼낸다
+		for (uint32 Index = HitCount; Index-- > 0;)
+		{
+			const uint32 Lane = Order[Index];
+			if (Node.Children[Lane] >= 0 && ChildEntries[Lane] <= Closest)
+			{
+				NodeStack.emplace_back(Node.Children[Lane], ChildEntries[Lane]);
+			}
+		}
+	}
+
+	return bHit;
+}
+
+template class TWideBVH<4>;
+template class TWideBVH<8>;
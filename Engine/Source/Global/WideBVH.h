@@ -0,0 +1,71 @@
+#pragma once
+
+class FBVH;
+struct FStaticMesh;
+struct FBVHRayHit;
+struct FRay;
+struct FArchive;
+
+/**
+ * @brief 이진 FBVH를 Width개의 자식을 갖는 노드로 접은 메시 Ray 쿼리 전용 BVH (Width = 4: SSE, 8: AVX)
+ * 노드는 자식 박스를 축별(SoA)로 노드 박스 안의 8비트 격자에 양자화해 담으므로, 자식 Width개의 slab 검사를 SIMD 한 번에 한다.
+ * 양자화는 최소값을 내림, 최대값을 올림하므로 복원한 박스는 항상 원래 자식 박스를 포함한다.
+ * 삼각형 하나짜리 리프는 따로 노드를 두지 않고 자식 슬롯에 ~삼각형 번호로 바로 넣는다.
+ * 이진 트리에서 접어 만들기 때문에 일괄(SAH)/점진 구축 어느 쪽 결과로도 만들 수 있다.
+ */
+template<uint32 Width>
+class TWideBVH
+{
+public:
+	static_assert(Width == 4 || Width == 8, "TWideBVH supports 4 or 8 wide nodes");
+
+	static constexpr uint32 WIDTH = Width;
+	/** @brief 비어 있는 자식 슬롯. 삼각형 자식(~번호)과 겹치지 않는다 */
+	static constexpr int32 EMPTY_CHILD = INT32_MIN;
+
+	struct alignas(64) FNode
+	{
+		/** @brief 자식 박스 = Origin + Q * Scale (축마다). 두께가 0인 축은 Scale이 0이다 */
+		float Origin[3];
+		float Scale[3];
+		/** @brief 0 이상이면 내부 노드 인덱스, 음수면 ~삼각형 번호, EMPTY_CHILD면 빈 슬롯 */
+		int32 Children[Width];
+		uint8 QuantizedMin[3][Width];
+		uint8 QuantizedMax[3][Width];
+	};
+
+	/** @brief InBinary의 노드를 표면적이 큰 내부 자식부터 펼쳐 Width개씩 묶는다. InBinary가 비어 있으면 빈 트리가 된다 */
+	void Build(const FBVH& InBinary);
+	void Clear();
+
+	/**
+	 * @brief 노드 배열을 그대로 읽고 쓴다. 로드한 트리는 InMesh의 삼각형을 가리킨다.
+	 * @return 로드할 때 캐시의 폭이 Width와 달라 노드를 건너뛰었으면 false (트리는 비어 있다)
+	 */
+	bool Serialize(FArchive& Ar, const FStaticMesh* InMesh);
+
+	bool IsBuilt() const { return Mesh != nullptr && !Nodes.empty(); }
+	uint32 GetNodeCount() const { return static_cast<uint32>(Nodes.size()); }
+	size_t GetMemorySize() const { return Nodes.size() * sizeof(FNode); }
+
+	/** @brief FBVH::ClosestHit와 같은 계약. 한 노드의 자식을 한 번에 검사하고 가까운 자식부터 방문한다 */
+	bool ClosestHit(const FRay& Ray, FBVHRayHit& OutHit, float MinDistance, float MaxDistance) const;
+	/** @brief FBVH::AnyHit와 같은 계약. 처음 찾은 충돌에서 멈춘다 */
+	bool AnyHit(const FRay& Ray, FBVHRayHit& OutHit, float MinDistance, float MaxDistance) const;
+
+private:
+	bool IntersectRay(const FRay& Ray, FBVHRayHit& OutHit, float MinDistance, float MaxDistance, bool bStopAtFirstHit) const;
+
+	const FStaticMesh* Mesh = nullptr;
+	TArray<FNode> Nodes;
+};
+
+using FBVH4 = TWideBVH<4>;
+using FBVH8 = TWideBVH<8>;
+
+/** @brief 메시 BVH가 기본으로 쓰는 폭. 빌드 옵션에 따라 SSE/AVX 중 넓은 쪽을 고른다 */
+#if defined(__AVX__)
+using FMeshWideBVH = FBVH8;
+#else
+using FMeshWideBVH = FBVH4;
+#endif
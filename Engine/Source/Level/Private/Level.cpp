@@ -10,22 +10,33 @@
 #include "Editor/Public/Editor.h"
 #include "Render/UI/Viewport/Public/Viewport.h"
 #include "Global/Octree.h"
+#include "Global/DynamicAABBTree.h"
 #include "Level/Public/Level.h"
 #include "Manager/Config/Public/ConfigManager.h"
 #include "Render/Renderer/Public/Renderer.h"
 #include "Utility/Public/JsonSerializer.h"
 #include "Manager/UI/Public/ViewportManager.h"
+#include "Optimization/Public/PotentiallyVisibleSet.h"
+#include "Physics/Public/SceneTLAS.h"
 #include <json.hpp>
 
 IMPLEMENT_CLASS(ULevel, UObject)
 
 ULevel::ULevel()
 {
-	StaticOctree = new FOctree(FVector(0, 0, -5), 75, 0);
+	// 초기 크기는 시작값일 뿐이며, 경계를 벗어나는 프리미티브가 들어오면 루트가 확장된다.
+	StaticOctree = new FOctree(FVector(0, 0, -5), 75, 0, DEFAULT_OCTREE_LOOSENESS);
+	DynamicTree = new FDynamicAABBTree();
+	PVS = new FPotentiallyVisibleSet();
+	SceneTLAS = new FSceneTLAS();
+	MarkSceneStructureDirty();
 }
 
 ULevel::~ULevel()
 {
+	// 액터 삭제 중에 PVS 무효화 로그가 남지 않도록 먼저 지운다
+	SafeDelete(PVS);
+
 	// LevelActors 배열에 남아있는 모든 액터의 메모리를 해제합니다.
 	for (const auto& Actor : LevelActors)
 	{
@@ -35,6 +46,8 @@ ULevel::~ULevel()
 
 	// 모든 액터 객체가 삭제되었으므로, 포인터를 담고 있던 컨테이너들을 비웁니다.
 	SafeDelete(StaticOctree);
+	SafeDelete(DynamicTree);
+	SafeDelete(SceneTLAS);
 }
 
 void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
@@ -62,6 +75,8 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 		JSON ActorsJson;
 		if (FJsonSerializer::ReadObject(InOutHandle, "Actors", ActorsJson))
 		{
+			// 액터마다 옥트리에 하나씩 넣지 않고, 모두 스폰한 뒤 한 번에 구축한다
+			bDeferOctreeInsertion = true;
 			for (auto& Pair : ActorsJson.ObjectRange())
 			{
 				JSON& ActorDataJson = Pair.second;
@@ -72,6 +87,9 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 				UClass* ActorClass = UClass::FindClass(TypeString);
 				SpawnActorToLevel(ActorClass, &ActorDataJson); 
 			}
+			bDeferOctreeInsertion = false;
+
+			BuildStaticOctree();
 		}
 	}
 	// 저장
@@ -145,18 +163,19 @@ void ULevel::RegisterComponent(UActorComponent* InComponent)
 		return;
 	}
 
+	MarkSceneDirty();
+
 	if (!StaticOctree)
 	{
 		return;
 	}
 
+	// 일괄 로드 중에는 프리미티브를 BuildStaticOctree가 한 번에 삽입하므로 여기서는 옥트리를 건드리지 않는다
 	if (auto PrimitiveComponent = Cast<UPrimitiveComponent>(InComponent))
 	{
-		// StaticOctree에 먼저 삽입 시도
-		if (!(StaticOctree->Insert(PrimitiveComponent)))
+		if (!bDeferOctreeInsertion)
 		{
-			// 실패하면 DynamicPrimitiveQueue 목록에 추가
-			OnPrimitiveUpdated(PrimitiveComponent);
+			RegisterPrimitive(PrimitiveComponent);
 		}
 	}
 	else if (auto LightComponent = Cast<ULightComponent>(InComponent))
@@ -183,7 +202,11 @@ void ULevel::RegisterComponent(UActorComponent* InComponent)
 		
 		
 	}
-	UE_LOG("Level: '%s' 컴포넌트를 씬에 등록했습니다.", InComponent->GetName().ToString().data());
+
+	if (!bDeferOctreeInsertion)
+	{
+		UE_LOG("Level: '%s' 컴포넌트를 씬에 등록했습니다.", InComponent->GetName().ToString().data());
+	}
 }
 
 void ULevel::UnregisterComponent(UActorComponent* InComponent)
@@ -193,6 +216,8 @@ void ULevel::UnregisterComponent(UActorComponent* InComponent)
 		return;
 	}
 
+	MarkSceneDirty();
+
 	if (!StaticOctree)
 	{
 		return;
@@ -200,9 +225,6 @@ void ULevel::UnregisterComponent(UActorComponent* InComponent)
 
 	if (auto PrimitiveComponent = Cast<UPrimitiveComponent>(InComponent))
 	{
-		// StaticOctree에서 제거 시도
-		StaticOctree->Remove(PrimitiveComponent);
-	
 		OnPrimitiveUnregistered(PrimitiveComponent);
 	}
 	else if (auto LightComponent = Cast<ULightComponent>(InComponent))
@@ -223,11 +245,16 @@ void ULevel::AddLevelComponent(AActor* Actor)
 		return;
 	}
 
+	MarkSceneDirty();
+
 	for (auto& Component : Actor->GetOwnedComponents())
 	{
 		if (auto PrimitiveComponent = Cast<UPrimitiveComponent>(Component))
 		{
-			OnPrimitiveUpdated(PrimitiveComponent);			
+			if (!bDeferOctreeInsertion)
+			{
+				RegisterPrimitive(PrimitiveComponent);
+			}
 		}
 		else if (auto LightComponent = Cast<ULightComponent>(Component))
 		{
@@ -278,11 +305,7 @@ bool ULevel::DestroyActor(AActor* InActor)
 
 	// Remove Actor Selection
 	UEditor* Editor = GEditor->GetEditorModule();
-	if (Editor->GetSelectedActor() == InActor)
-	{
-		Editor->SelectActor(nullptr);
-		Editor->SelectComponent(nullptr);
-	}
+	Editor->DeselectActor(InActor);
 
 	// Remove
 	SafeDelete(InActor);
@@ -293,9 +316,47 @@ bool ULevel::DestroyActor(AActor* InActor)
 
 void ULevel::UpdatePrimitiveInOctree(UPrimitiveComponent* InComponent)
 {
-	if (!StaticOctree->Remove(InComponent))
+	MarkSceneDirty();
+
+	// 이미 DynamicTree에 있다면 Fat AABB를 벗어났을 때만 재삽입된다
+	if (DynamicTree->Contains(InComponent))
+	{
+		if (!DynamicTree->Update(InComponent))
+		{
+			PendingPrimitives.push_back(InComponent);
+			MarkSceneStructureDirty();
+		}
+		return;
+	}
+
+	// 옥트리에 없는 프리미티브(대기 중이거나 미등록)는 무시한다
+	if (!StaticOctree->Contains(InComponent))
 		return;
-	OnPrimitiveUpdated(InComponent);
+
+	CheckPVSInvalidation(InComponent, false);
+
+	// 소속 노드의 Loose 경계 안에서 움직였다면 그대로 두고, 벗어났다면 움직이는 프리미티브로 보고 DynamicTree로 옮긴다
+	if (StaticOctree->Update(InComponent, false))
+		return;
+	if (!DynamicTree->Insert(InComponent))
+	{
+		PendingPrimitives.push_back(InComponent);
+		MarkSceneStructureDirty();
+	}
+}
+
+TArray<UPrimitiveComponent*>& ULevel::GetDynamicPrimitives()
+{
+	DynamicPrimitives.clear();
+	DynamicTree->GetAllPrimitives(DynamicPrimitives);
+	DynamicPrimitives.insert(DynamicPrimitives.end(), PendingPrimitives.begin(), PendingPrimitives.end());
+	return DynamicPrimitives;
+}
+
+FSceneTLAS* ULevel::GetSceneTLAS()
+{
+	SceneTLAS->Update(this);
+	return SceneTLAS;
 }
 
 UObject* ULevel::Duplicate()
@@ -310,12 +371,23 @@ void ULevel::DuplicateSubObjects(UObject* DuplicatedObject)
 	Super::DuplicateSubObjects(DuplicatedObject);
 	ULevel* DuplicatedLevel = Cast<ULevel>(DuplicatedObject);
 
+	DuplicatedLevel->bDeferOctreeInsertion = true;
 	for (AActor* Actor : LevelActors)
 	{
 		AActor* DuplicatedActor = Cast<AActor>(Actor->Duplicate());
 		DuplicatedLevel->LevelActors.push_back(DuplicatedActor);
 		DuplicatedLevel->AddLevelComponent(DuplicatedActor);
 	}
+	DuplicatedLevel->bDeferOctreeInsertion = false;
+
+	DuplicatedLevel->BuildStaticOctree();
+
+	// 복제된 레벨은 프리미티브 구성이 같으므로 구운 PVS를 그대로 바인딩한다
+	if (PVS->IsValid())
+	{
+		*DuplicatedLevel->PVS = *PVS;
+		DuplicatedLevel->PVS->Bind(DuplicatedLevel);
+	}
 }
 
 /*-----------------------------------------------------------------------------
@@ -323,69 +395,106 @@ void ULevel::DuplicateSubObjects(UObject* DuplicatedObject)
 -----------------------------------------------------------------------------*/
 
 void ULevel::UpdateOctree()
+{
+	if (!StaticOctree || PendingPrimitives.empty())
+	{
+		return;
+	}
+
+	// AABB가 유효해진 대기 프리미티브를 등록한다
+	TArray<UPrimitiveComponent*> StillPending;
+	for (UPrimitiveComponent* Primitive : PendingPrimitives)
+	{
+		if (!StaticOctree->Insert(Primitive))
+		{
+			StillPending.push_back(Primitive);
+		}
+		else
+		{
+			CheckPVSInvalidation(Primitive, true);
+			MarkSceneStructureDirty();
+		}
+	}
+	PendingPrimitives = std::move(StillPending);
+}
+
+void ULevel::BuildStaticOctree()
 {
 	if (!StaticOctree)
 	{
 		return;
 	}
-	
-	uint32 Count = 0;
-	FDynamicPrimitiveQueue NotInsertedQueue;
-	
-	while (!DynamicPrimitiveQueue.empty() && Count < MAX_OBJECTS_TO_INSERT_PER_FRAME)
+
+	TArray<UPrimitiveComponent*> Primitives;
+	for (AActor* Actor : LevelActors)
 	{
-		auto [Component, TimePoint] = DynamicPrimitiveQueue.front();
-		DynamicPrimitiveQueue.pop();
+		if (!Actor)
+		{
+			continue;
+		}
 
-		if (auto It = DynamicPrimitiveMap.find(Component); It != DynamicPrimitiveMap.end())
+		for (auto& Component : Actor->GetOwnedComponents())
 		{
-			if (It->second <= TimePoint)
-			{
-				// 큐에 기록된 오브젝트의 마지막 변경 시간 이후로 변경이 없었다면 Octree에 재삽입한다.
-				if (StaticOctree->Insert(Component))
-				{
-					DynamicPrimitiveMap.erase(It);
-				}
-				// 삽입이 안됐다면 다시 Queue에 들어가기 위해 저장
-				else
-				{
-					NotInsertedQueue.push({Component, It->second});
-				}
-				// TODO: 오브젝트의 유일성을 보장하기 위해 StaticOctree->Remove(Component)가 필요한가?
-				++Count;
-			}
-			else
+			if (auto PrimitiveComponent = Cast<UPrimitiveComponent>(Component))
 			{
-				// 큐에 기록된 오브젝트의 마지막 변경 이후 새로운 변경이 존재했다면 다시 큐에 삽입한다.
-				DynamicPrimitiveQueue.push({Component, It->second});
+				Primitives.push_back(PrimitiveComponent);
 			}
 		}
 	}
-	
-	DynamicPrimitiveQueue = NotInsertedQueue;
-	if (Count != 0)
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	TArray<UPrimitiveComponent*> Rejected;
+	StaticOctree->Build(Primitives, Rejected);
+
+	// 모든 프리미티브가 옥트리로 다시 들어갔으므로 DynamicTree를 비우고, 삽입되지 못한 것만 대기 목록에 남긴다
+	DynamicTree->Clear();
+	PendingPrimitives = std::move(Rejected);
+	MarkSceneStructureDirty();
+
+	// 베이크 당시 DynamicTree나 대기 목록에 있던 프리미티브가 정적으로 들어왔다면 PVS 집합에 없으므로 PVS 뷰에서 빠지지 않도록 무효화한다
+	if (GetPVS())
 	{
-		// UE_LOG("UpdateOctree: %d개의 컴포넌트가 업데이트 되었습니다.", Count);
+		for (UPrimitiveComponent* Primitive : Primitives)
+		{
+			if (std::find(PendingPrimitives.begin(), PendingPrimitives.end(), Primitive) == PendingPrimitives.end())
+			{
+				CheckPVSInvalidation(Primitive, true);
+			}
+		}
 	}
+
+	const double ElapsedMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+	UE_LOG("Level: StaticOctree 일괄 구축 완료 (%zu개, 제외 %zu개, %.3f ms)", Primitives.size() - PendingPrimitives.size(), PendingPrimitives.size(), ElapsedMs);
 }
 
-void ULevel::OnPrimitiveUpdated(UPrimitiveComponent* InComponent)
+void ULevel::RegisterPrimitive(UPrimitiveComponent* InComponent)
 {
 	if (!InComponent)
 	{
 		return;
 	}
 
-	float GameTime = UTimeManager::GetInstance().GetGameTime();
-	if (auto It = DynamicPrimitiveMap.find(InComponent); It != DynamicPrimitiveMap.end())
+	MarkSceneStructureDirty();
+
+	if (DynamicTree->Contains(InComponent))
 	{
-		It->second = GameTime;
+		// 이미 움직인 적이 있는 프리미티브는 DynamicTree에 그대로 둔다
+		if (DynamicTree->Update(InComponent))
+		{
+			return;
+		}
 	}
-	else
+	else if (StaticOctree->Insert(InComponent))
 	{
-		DynamicPrimitiveMap[InComponent] = UTimeManager::GetInstance().GetGameTime();
+		// 새로 배치된 프리미티브는 움직이기 전까지 StaticOctree에서 관리한다
+		CheckPVSInvalidation(InComponent, true);
+		return;
+	}
 
-		DynamicPrimitiveQueue.push({InComponent, GameTime});
+	if (std::find(PendingPrimitives.begin(), PendingPrimitives.end(), InComponent) == PendingPrimitives.end())
+	{
+		PendingPrimitives.push_back(InComponent);
 	}
 }
 
@@ -396,8 +505,89 @@ void ULevel::OnPrimitiveUnregistered(UPrimitiveComponent* InComponent)
 		return;
 	}
 
-	if (auto It = DynamicPrimitiveMap.find(InComponent); It != DynamicPrimitiveMap.end())
+	CheckPVSInvalidation(InComponent, false);
+	MarkSceneStructureDirty();
+
+	StaticOctree->Remove(InComponent);
+	DynamicTree->Remove(InComponent);
+
+	if (auto It = std::find(PendingPrimitives.begin(), PendingPrimitives.end(), InComponent); It != PendingPrimitives.end())
 	{
-		DynamicPrimitiveMap.erase(It);
+		PendingPrimitives.erase(It);
 	}
 }
+
+/*-----------------------------------------------------------------------------
+	PVS Management
+-----------------------------------------------------------------------------*/
+
+const FPotentiallyVisibleSet* ULevel::GetPVS() const
+{
+	return (PVS && PVS->IsValid()) ? PVS : nullptr;
+}
+
+bool ULevel::BakePVS(const FPVSBakeSettings& InSettings)
+{
+	MarkSceneDirty();
+	return PVS && PVS->Bake(this, InSettings);
+}
+
+bool ULevel::LoadPVS(const std::filesystem::path& InFilePath)
+{
+	MarkSceneDirty();
+	return PVS && PVS->Load(InFilePath, this);
+}
+
+bool ULevel::SavePVS(const std::filesystem::path& InFilePath) const
+{
+	return PVS && PVS->Save(InFilePath);
+}
+
+void ULevel::InvalidatePVS(const char* InReason)
+{
+	if (!PVS || !PVS->IsValid())
+	{
+		return;
+	}
+
+	PVS->Reset();
+	MarkSceneDirty();
+	UE_LOG_WARNING("Level: PVS 무효화 (%s). 다시 베이크하기 전까지 옥트리로 컬링합니다", InReason);
+}
+
+void ULevel::CheckPVSInvalidation(const UPrimitiveComponent* InComponent, bool bInIsNewStatic)
+{
+	if (!PVS || !PVS->IsValid())
+	{
+		return;
+	}
+
+	if (bInIsNewStatic)
+	{
+		if (!PVS->Contains(InComponent))
+		{
+			InvalidatePVS("새 정적 프리미티브 등록");
+		}
+	}
+	else if (PVS->Contains(InComponent))
+	{
+		InvalidatePVS("베이크된 프리미티브 변경");
+	}
+}
+
+/*-----------------------------------------------------------------------------
+	Scene Revision
+-----------------------------------------------------------------------------*/
+
+void ULevel::MarkSceneDirty()
+{
+	static uint64 LastSceneRevision = 0;
+	SceneRevision = ++LastSceneRevision;
+}
+
+void ULevel::MarkSceneStructureDirty()
+{
+	// 씬 리비전은 모든 레벨에서 겹치지 않으므로 구조 리비전도 같은 값을 쓴다
+	MarkSceneDirty();
+	SceneStructureRevision = SceneRevision;
+}
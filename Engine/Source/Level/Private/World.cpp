@@ -4,6 +4,7 @@
 #include "Utility/Public/JsonSerializer.h"
 #include "Manager/Config/Public/ConfigManager.h"
 #include "Manager/Path/Public/PathManager.h"
+#include "Optimization/Public/PotentiallyVisibleSet.h"
 
 IMPLEMENT_CLASS(UWorld, UObject)
 
@@ -140,6 +141,9 @@ bool UWorld::LoadLevel(path InLevelFilePath)
 		SwitchToLevel(NewLevel);
 		NewLevel->Serialize(true, LevelJson);
 
+		// .Scene 옆에 구운 PVS가 있으면 함께 불러온다
+		NewLevel->LoadPVS(FPotentiallyVisibleSet::GetFilePath(InLevelFilePath));
+
 		UConfigManager::GetInstance().SetLastUsedLevelPath(InLevelFilePath.string());
 		BeginPlay();
 	}
@@ -187,6 +191,12 @@ bool UWorld::SaveCurrentLevel(path InLevelFilePath) const
 			return false;
 		}
 
+		// 베이크 이후 정적 배치가 바뀌지 않아 PVS가 유효하면 새 경로에도 함께 저장한다
+		if (Level->GetPVS())
+		{
+			Level->SavePVS(FPotentiallyVisibleSet::GetFilePath(InLevelFilePath));
+		}
+
 	}
 	catch (const exception& Exception)
 	{
@@ -290,6 +300,47 @@ void UWorld::SwitchToLevel(ULevel* InNewLevel)
 	bBegunPlay = false;
 }
 
+bool UWorld::LineTraceSingle(const FVector& InStart, const FVector& InEnd, FHitResult& OutHit,
+	const FCollisionQueryParams& InParams) const
+{
+	return SceneQuery.LineTraceSingle(Level, InStart, InEnd, OutHit, InParams);
+}
+
+bool UWorld::LineTraceMulti(const FVector& InStart, const FVector& InEnd, TArray<FHitResult>& OutHits,
+	const FCollisionQueryParams& InParams) const
+{
+	return SceneQuery.LineTraceMulti(Level, InStart, InEnd, OutHits, InParams);
+}
+
+bool UWorld::LineTraceTest(const FVector& InStart, const FVector& InEnd, const FCollisionQueryParams& InParams) const
+{
+	return SceneQuery.LineTraceTest(Level, InStart, InEnd, InParams);
+}
+
+bool UWorld::OverlapAABB(const FAABB& InBox, TArray<UPrimitiveComponent*>& OutPrimitives,
+	const FCollisionQueryParams& InParams) const
+{
+	return SceneQuery.OverlapAABB(Level, InBox, OutPrimitives, InParams);
+}
+
+bool UWorld::OverlapSphere(const FVector& InCenter, float InRadius, TArray<UPrimitiveComponent*>& OutPrimitives,
+	const FCollisionQueryParams& InParams) const
+{
+	return SceneQuery.OverlapSphere(Level, InCenter, InRadius, OutPrimitives, InParams);
+}
+
+bool UWorld::OverlapOBB(const FOBB& InBox, TArray<UPrimitiveComponent*>& OutPrimitives,
+	const FCollisionQueryParams& InParams) const
+{
+	return SceneQuery.OverlapOBB(Level, InBox, OutPrimitives, InParams);
+}
+
+bool UWorld::OverlapFrustum(const FFrustum& InFrustum, EFrustumOverlapMode InMode, TArray<UPrimitiveComponent*>& OutPrimitives,
+	const FCollisionQueryParams& InParams) const
+{
+	return SceneQuery.OverlapFrustum(Level, InFrustum, InMode, OutPrimitives, InParams);
+}
+
 UObject* UWorld::Duplicate()
 {
 	UWorld* World = Cast<UWorld>(Super::Duplicate());
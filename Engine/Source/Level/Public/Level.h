@@ -12,6 +12,10 @@ class UPrimitiveComponent;
 class UPointLightComponent;
 class ULightComponent;
 class FOctree;
+class FDynamicAABBTree;
+class FPotentiallyVisibleSet;
+class FSceneTLAS;
+struct FPVSBakeSettings;
 
 UCLASS()
 class ULevel : public UObject
@@ -40,18 +44,20 @@ public:
 	void UpdatePrimitiveInOctree(UPrimitiveComponent* InComponent);
 
 	FOctree* GetStaticOctree() { return StaticOctree; }
-
-	/** @todo: 효율 개선을 위해 DirtyFlag와 캐시 도입 가능 */
-	TArray<UPrimitiveComponent*>& GetDynamicPrimitives()
-	{
-		DynamicPrimitives.clear();
-
-		for (auto [Component, TimePoint] : DynamicPrimitiveMap)
-		{
-			DynamicPrimitives.push_back(Component);
-		}
-		return DynamicPrimitives;
-	}
+	FDynamicAABBTree* GetDynamicTree() { return DynamicTree; }
+	/**
+	 * @brief 피킹/라인 트레이스용 최상위 BVH. 씬 리비전이 마지막 갱신 이후 바뀌었으면 갱신한 뒤 반환한다.
+	 * 트랜스폼만 바뀌었으면 박스만 다시 맞추고, 구조 리비전이 바뀌었으면 StaticOctree와 DynamicTree의 프리미티브로 다시 구축한다.
+	 */
+	FSceneTLAS* GetSceneTLAS();
+
+	/**
+	 * @brief DynamicTree의 프리미티브와 AABB가 유효하지 않아 어느 트리에도 없는 프리미티브를 모아서 반환한다.
+	 * 매 호출마다 배열을 새로 채우므로 컬링/피킹에는 DynamicTree 쿼리를 사용해야 한다.
+	 */
+	TArray<UPrimitiveComponent*>& GetDynamicPrimitives();
+	/** @brief AABB가 유효하지 않아 어느 트리에도 없는 프리미티브. 컬링할 경계가 없으므로 모든 뷰에 보이는 것으로 취급한다 */
+	const TArray<UPrimitiveComponent*>& GetPendingPrimitives() const { return PendingPrimitives; }
 
 	friend class UWorld;
 public:
@@ -75,47 +81,95 @@ private:
 		static_cast<uint64>(EEngineShowFlags::SF_Text) |
 		static_cast<uint64>(EEngineShowFlags::SF_Decal) |
 		static_cast<uint64>(EEngineShowFlags::SF_Fog) |
-		static_cast<uint64>(EEngineShowFlags::SF_Shadow);
+		static_cast<uint64>(EEngineShowFlags::SF_Shadow) |
+		static_cast<uint64>(EEngineShowFlags::SF_ContributionCulling);
 	
 	/*-----------------------------------------------------------------------------
 		Octree Management
 	-----------------------------------------------------------------------------*/
 public:
 	void UpdateOctree();
+
+	/**
+	 * @brief 레벨의 모든 프리미티브로 StaticOctree를 한 번에 다시 구축한다.
+	 * 레벨 로드/PIE 복제 직후 호출되며, DynamicTree는 비워진다. AABB가 유효하지 않은 프리미티브는 대기 목록으로 보낸다.
+	 */
+	void BuildStaticOctree();
 	
 private:
 
-	void OnPrimitiveUpdated(UPrimitiveComponent* InComponent);
+	/** @brief 프리미티브를 StaticOctree → DynamicTree → 대기 목록 순으로 등록한다. */
+	void RegisterPrimitive(UPrimitiveComponent* InComponent);
 
 	void OnPrimitiveUnregistered(UPrimitiveComponent* InComponent);
 
-	/** @brief 한 프레임에 Octree에 삽입할 오브젝트의 최대 크기를 결정해서 부하를 여러 프레임에 분산함. */
-	static constexpr uint32 MAX_OBJECTS_TO_INSERT_PER_FRAME = 256;
-	
-	/** @brief 가장 오래전에 움직인 UPrimitiveComponent를 Octree에 삽입하기 위해 필요한 구조체. */
-	struct FDynamicPrimitiveData
-	{
-		UPrimitiveComponent* Primitive;
-		float LastMoveTimePoint;
-
-		bool operator>(const FDynamicPrimitiveData& Other) const
-		{
-			return LastMoveTimePoint > Other.LastMoveTimePoint;
-		}
-	};
-	
-	using FDynamicPrimitiveQueue = TQueue<FDynamicPrimitiveData>;
-	
+	/**
+	 * @brief 배치된 뒤 움직이지 않은 프리미티브를 보관한다. 레벨 로드 시 일괄 구축된다.
+	 * 소속 노드의 Loose 경계를 벗어나도록 움직인 프리미티브는 DynamicTree로 옮겨지고, 다음 일괄 구축 전까지 돌아오지 않는다.
+	 */
 	FOctree* StaticOctree = nullptr;
 
-	/** @deprecated 기존 코드와의 호환성을 위해 유지, 직접 사용하거나 업데이트하는 것을 금지함 */
+	/** @brief 움직인 적이 있는 프리미티브를 보관한다. Fat AABB 안에서의 이동은 비용이 없다. */
+	FDynamicAABBTree* DynamicTree = nullptr;
+
+	/** @brief 두 트리의 프리미티브를 인스턴스로 담는 레이 쿼리용 최상위 BVH. GetSceneTLAS에서 필요할 때 갱신한다. */
+	FSceneTLAS* SceneTLAS = nullptr;
+
+	/** @brief AABB가 유효하지 않아 어느 트리에도 넣지 못한 프리미티브. UpdateOctree에서 재시도한다. */
+	TArray<UPrimitiveComponent*> PendingPrimitives;
+
+	/** @brief true인 동안 AddLevelComponent/RegisterComponent가 프리미티브를 등록하지 않고 등록 로그도 남기지 않는다. (BuildStaticOctree로 일괄 삽입) */
+	bool bDeferOctreeInsertion = false;
+
+	/** @deprecated GetDynamicPrimitives 반환용 버퍼 */
 	TArray<UPrimitiveComponent*> DynamicPrimitives;
 
-	/** @brief 가장 오래전에 움직인 UPrimitiveComponent부터 순서대로 Octree에 삽입할 수 있도록 보관 */
-	FDynamicPrimitiveQueue DynamicPrimitiveQueue;
+	/*-----------------------------------------------------------------------------
+		PVS Management
+	-----------------------------------------------------------------------------*/
+public:
+	/** @brief 바인딩된 PVS. 없거나 무효화되었다면 nullptr */
+	const FPotentiallyVisibleSet* GetPVS() const;
+
+	/** @brief 현재 StaticOctree의 프리미티브로 PVS를 굽는다. */
+	bool BakePVS(const FPVSBakeSettings& InSettings);
+	bool LoadPVS(const std::filesystem::path& InFilePath);
+	bool SavePVS(const std::filesystem::path& InFilePath) const;
+
+	/**
+	 * @brief PVS를 버린다. 베이크한 프리미티브가 움직이거나 삭제되었을 때, 또는 새 프리미티브가 정적으로 등록되었을 때 호출된다.
+	 * 이후 컬링은 다시 StaticOctree 전체를 탐색한다.
+	 */
+	void InvalidatePVS(const char* InReason);
+
+private:
+	/** @brief 베이크한 프리미티브에 영향을 주는 변경인지 확인하고, 그렇다면 PVS를 무효화한다. */
+	void CheckPVSInvalidation(const UPrimitiveComponent* InComponent, bool bInIsNewStatic);
+
+	FPotentiallyVisibleSet* PVS = nullptr;
 
-	/** @brief 각 UPrimitiveComponent가 움직인 가장 마지막 시간을 기록 */
-	TMap<UPrimitiveComponent*, float> DynamicPrimitiveMap;
+	/*-----------------------------------------------------------------------------
+		Scene Revision
+	-----------------------------------------------------------------------------*/
+public:
+	/**
+	 * @brief 그려지는 결과가 달라질 수 있는 변경(컴포넌트 등록/해제, 트랜스폼, 가시성, PVS)마다 바뀌는 값.
+	 * 모든 레벨이 하나의 증가 카운터에서 값을 받으므로 레벨이 바뀌어도 이전 레벨의 값과 겹치지 않는다.
+	 * URenderer는 이 값과 뷰가 그대로면 이전 프레임의 가시 목록을 다시 쓴다.
+	 */
+	uint64 GetSceneRevision() const { return SceneRevision; }
+	void MarkSceneDirty();
+
+	/**
+	 * @brief StaticOctree/DynamicTree에 들어 있는 프리미티브 집합이 바뀔 때(등록/해제, 대기 목록 출입, 일괄 구축)만 바뀌는 값.
+	 * 트랜스폼만 바뀌면 그대로이므로 FSceneTLAS는 이 값이 같으면 다시 구축하지 않고 박스만 갱신한다. 바꿀 때 씬 리비전도 함께 바뀐다.
+	 */
+	uint64 GetSceneStructureRevision() const { return SceneStructureRevision; }
+	void MarkSceneStructureDirty();
+
+private:
+	uint64 SceneRevision = 0;
+	uint64 SceneStructureRevision = 0;
 	
 	/*-----------------------------------------------------------------------------
 		Lighting Management
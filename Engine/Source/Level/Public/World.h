@@ -2,6 +2,7 @@
 #include <filesystem>
 #include "Core/Public/Object.h"
 #include "Global/Types.h"
+#include "Physics/Public/SceneQuery.h"
 
 class UEditor;
 class ULevel;
@@ -57,8 +58,24 @@ public:
 	AActor* SpawnActor(UClass* InActorClass, JSON* ActorJsonData = nullptr);
 	bool DestroyActor(AActor* InActor); // Level의 void MarkActorForDeletion(AActor * InActor) 기능을 DestroyActor가 가짐
 
-	// TODO: World Scope Query Entrypoint
-	// Editor에서 쿼리 요청시 Level에 바로 요청하지 않고 World를 통해 요청하도록 변경 
+	// World Scope Query
+	// 현재 레벨의 StaticOctree와 DynamicTree를 함께 검사한다. 결과 배열은 지우고 채우므로 호출하는 쪽에서 재사용하면 할당이 없다.
+	bool LineTraceSingle(const FVector& InStart, const FVector& InEnd, FHitResult& OutHit,
+		const FCollisionQueryParams& InParams = FCollisionQueryParams()) const;
+	bool LineTraceMulti(const FVector& InStart, const FVector& InEnd, TArray<FHitResult>& OutHits,
+		const FCollisionQueryParams& InParams = FCollisionQueryParams()) const;
+	// 가로막는 프리미티브가 있는지만 검사한다 (그림자/가시성 판정용, 첫 충돌에서 멈춘다)
+	bool LineTraceTest(const FVector& InStart, const FVector& InEnd,
+		const FCollisionQueryParams& InParams = FCollisionQueryParams()) const;
+	bool OverlapAABB(const FAABB& InBox, TArray<UPrimitiveComponent*>& OutPrimitives,
+		const FCollisionQueryParams& InParams = FCollisionQueryParams()) const;
+	bool OverlapSphere(const FVector& InCenter, float InRadius, TArray<UPrimitiveComponent*>& OutPrimitives,
+		const FCollisionQueryParams& InParams = FCollisionQueryParams()) const;
+	bool OverlapOBB(const FOBB& InBox, TArray<UPrimitiveComponent*>& OutPrimitives,
+		const FCollisionQueryParams& InParams = FCollisionQueryParams()) const;
+	// 절두체와 겹치거나(안에 들어오는) 프리미티브. 에디터 마퀴 선택이 카메라의 부분 절두체로 호출한다
+	bool OverlapFrustum(const FFrustum& InFrustum, EFrustumOverlapMode InMode, TArray<UPrimitiveComponent*>& OutPrimitives,
+		const FCollisionQueryParams& InParams = FCollisionQueryParams()) const;
 
 	EWorldType GetWorldType() const;
 	void SetWorldType(EWorldType InWorldType);
@@ -68,6 +85,8 @@ private:
 	ULevel* Level = nullptr; // Persistance Level. Sublevels are not considered in Engine.
 	bool bBegunPlay = false;
 	TArray<AActor*> PendingDestroyActors;
+	/** @brief 쿼리 사이에 버퍼를 재사용하는 공간 쿼리 (게임 스레드 전용) */
+	mutable FSceneQuery SceneQuery;
 
 	void FlushPendingDestroy(); // Destroy marking 된 액터들을 실제 삭제
 
@@ -244,6 +244,11 @@ UStaticMesh* UAssetManager::GetStaticMeshFromCache(const FName& InObjPath)
 	return nullptr;
 }
 
+const TMap<FName, std::unique_ptr<UStaticMesh>>& UAssetManager::GetStaticMeshCache() const
+{
+	return StaticMeshCache;
+}
+
 void UAssetManager::AddStaticMeshToCache(const FName& InObjPath, UStaticMesh* InStaticMesh)
 {
 	if (!InStaticMesh)
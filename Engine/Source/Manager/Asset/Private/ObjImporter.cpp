@@ -3,6 +3,102 @@
 #include "Core/Public/WindowsBinReader.h"
 #include "Core/Public/WindowsBinWriter.h"
 #include "Manager/Asset/Public/ObjImporter.h"
+#include "Utility/Public/ParallelFor.h"
+
+#include <charconv>
+
+namespace
+{
+	/** @brief 청크 하나가 맡는 최소 크기. 이보다 작은 파일은 호출한 스레드에서 한 번에 파싱한다 */
+	constexpr size_t OBJ_PARALLEL_CHUNK_BYTES = 4 * 1024 * 1024;
+
+	enum class EParseCommand : uint8
+	{
+		Object,
+		Group,
+		Material,
+		MaterialLibrary,
+		/** @brief 청크의 첫 면이 오브젝트 없이 나왔다. 합칠 때 오브젝트가 없으면 기본 이름으로 만든다 */
+		EnsureObject,
+	};
+
+	/** @brief o/g/usemtl/mtllib 한 줄과, 그 줄이 나왔을 때 청크의 면 스트림 길이 */
+	struct FParseCommand
+	{
+		EParseCommand Type = EParseCommand::EnsureObject;
+		/** @brief 파일 버퍼를 가리킨다 */
+		std::string_view Name;
+		size_t FaceCount = 0;
+		size_t VertexIndexCount = 0;
+		size_t NormalIndexCount = 0;
+		size_t TexCoordIndexCount = 0;
+	};
+
+	/** @brief istringstream의 >>와 같은 공백 문자 */
+	bool IsSpace(char InChar)
+	{
+		return InChar == ' ' || InChar == '\t' || InChar == '\r' || InChar == '\v' || InChar == '\f';
+	}
+
+	/** @brief InOutLine 앞의 공백을 건너뛰어 다음 토큰을 잘라내고 InOutLine을 그 뒤로 옮긴다. 토큰이 없으면 빈 view */
+	std::string_view NextToken(std::string_view& InOutLine)
+	{
+		size_t Begin = 0;
+		while (Begin < InOutLine.size() && IsSpace(InOutLine[Begin])) { ++Begin; }
+		size_t End = Begin;
+		while (End < InOutLine.size() && !IsSpace(InOutLine[End])) { ++End; }
+
+		const std::string_view Token = InOutLine.substr(Begin, End - Begin);
+		InOutLine.remove_prefix(End);
+		return Token;
+	}
+
+	/** @brief 다음 토큰을 로케일과 무관하게 float로 읽는다. 스트림과 같이 토큰 앞부분만 숫자여도 받는다 */
+	bool ParseFloat(std::string_view& InOutLine, float& OutValue)
+	{
+		std::string_view Token = NextToken(InOutLine);
+		// from_chars는 앞의 '+'를 받지 않는다
+		if (!Token.empty() && Token[0] == '+')
+		{
+			Token.remove_prefix(1);
+		}
+
+		const std::from_chars_result Result = std::from_chars(Token.data(), Token.data() + Token.size(), OutValue);
+		return Result.ec == std::errc() && Result.ptr != Token.data();
+	}
+
+	/** @brief 1부터 시작하는 OBJ 인덱스를 0부터 시작하는 인덱스로 읽는다 */
+	bool ParseIndex(std::string_view InToken, size_t& OutIndex)
+	{
+		uint64 Value = 0;
+		const std::from_chars_result Result = std::from_chars(InToken.data(), InToken.data() + InToken.size(), Value);
+		if (Result.ec != std::errc() || Result.ptr == InToken.data())
+		{
+			return false;
+		}
+
+		OutIndex = static_cast<size_t>(Value - 1);
+		return true;
+	}
+}
+
+struct FObjImporter::FParseChunk
+{
+	TArray<FVector> VertexList;
+	TArray<FVector> NormalList;
+	TArray<FVector2> TexCoordList;
+
+	/** @brief 청크의 모든 면 인덱스. 합칠 때 Commands 위치에서 잘라 오브젝트에 붙인다 */
+	TArray<size_t> VertexIndexList;
+	TArray<size_t> NormalIndexList;
+	TArray<size_t> TexCoordIndexList;
+	size_t FaceCount = 0;
+
+	TArray<FParseCommand> Commands;
+
+	/** @brief 첫 오류 메시지. 워커 스레드에서는 로그를 남기지 않고 합치기 전에 호출한 스레드가 출력한다 */
+	const char* Error = nullptr;
+};
 
 bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo, Configuration Config)
 {
@@ -45,24 +141,216 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 		return false;
 	}
 
-	std::ifstream File(FilePath);
+	std::ifstream File(FilePath, std::ios::binary);
 	if (!File)
 	{
 		UE_LOG_ERROR("파일을 열지 못했습니다: %s", FilePath.string().c_str());
 		return false;
 	}
 
+	// 파일 전체를 한 번에 읽고, 줄과 토큰은 이 버퍼를 가리키는 string_view로 자른다
+	FString FileBuffer;
+	FileBuffer.resize(static_cast<size_t>(std::filesystem::file_size(FilePath)));
+	if (!FileBuffer.empty() && !File.read(FileBuffer.data(), static_cast<std::streamsize>(FileBuffer.size())))
+	{
+		UE_LOG_ERROR("파일을 읽지 못했습니다: %s", FilePath.string().c_str());
+		return false;
+	}
+
+	if (!ParseObj(FileBuffer, FilePath, OutObjInfo, Config))
+	{
+		return false;
+	}
+
+	if (Config.bIsBinaryEnabled)
+	{
+		FWindowsBinWriter WindowsBinWriter(BinFilePath);
+		WindowsBinWriter << *OutObjInfo;
+	}
+
+	return true;
+}
+
+bool FObjImporter::ParseObj(std::string_view InSource, const std::filesystem::path& FilePath, FObjInfo* OutObjInfo, const Configuration& Config,
+	uint32 InChunkCount)
+{
+	if (!OutObjInfo)
+	{
+		return false;
+	}
+
+	const char* FileBegin = InSource.data();
+	const char* FileEnd = FileBegin + InSource.size();
+
+	// 1. 큰 파일은 줄 경계에서 나눠 청크마다 따로 파싱한다. 면 인덱스는 파일 전체 기준이라 청크끼리 고칠 것이 없다
+	const size_t ChunkCount = InChunkCount > 0 ? InChunkCount
+		: std::clamp<size_t>(InSource.size() / OBJ_PARALLEL_CHUNK_BYTES, 1, GetParallelWorkerCount() + 1);
+	TArray<const char*> ChunkBounds;
+	ChunkBounds.reserve(ChunkCount + 1);
+	ChunkBounds.push_back(FileBegin);
+	for (size_t ChunkIndex = 1; ChunkIndex < ChunkCount; ++ChunkIndex)
+	{
+		const char* Split = std::max(FileBegin + InSource.size() * ChunkIndex / ChunkCount, ChunkBounds.back());
+		const char* LineEnd = static_cast<const char*>(memchr(Split, '\n', FileEnd - Split));
+		ChunkBounds.push_back(LineEnd ? LineEnd + 1 : FileEnd);
+	}
+	ChunkBounds.push_back(FileEnd);
+
+	TArray<FParseChunk> Chunks(ChunkCount);
+	ParallelFor(static_cast<uint32>(ChunkCount), [&](uint32 ChunkIndex)
+	{
+		ParseChunk(ChunkBounds[ChunkIndex], ChunkBounds[ChunkIndex + 1], Config, Chunks[ChunkIndex]);
+	});
+
+	for (const FParseChunk& Chunk : Chunks)
+	{
+		if (Chunk.Error)
+		{
+			UE_LOG_ERROR("%s", Chunk.Error);
+			return false;
+		}
+	}
+
+	// 2. 청크를 파일 순서대로 합친다. 명령(o/g/usemtl/mtllib)은 청크의 면 스트림에서 나온 위치에 맞춰 적용한다
+	size_t VertexCount = 0, NormalCount = 0, TexCoordCount = 0;
+	for (const FParseChunk& Chunk : Chunks)
+	{
+		VertexCount += Chunk.VertexList.size();
+		NormalCount += Chunk.NormalList.size();
+		TexCoordCount += Chunk.TexCoordList.size();
+	}
+	OutObjInfo->VertexList.reserve(OutObjInfo->VertexList.size() + VertexCount);
+	OutObjInfo->NormalList.reserve(OutObjInfo->NormalList.size() + NormalCount);
+	OutObjInfo->TexCoordList.reserve(OutObjInfo->TexCoordList.size() + TexCoordCount);
+
 	size_t FaceCount = 0;
 
 	TOptional<FObjectInfo> OptObjectInfo;
+	const auto EnsureObject = [&OptObjectInfo, &Config]()
+	{
+		if (!OptObjectInfo)
+		{
+			OptObjectInfo.emplace();
+			OptObjectInfo->Name = Config.DefaultName;
+		}
+	};
 
-	FString Buffer;
-	while (std::getline(File, Buffer))
+	for (FParseChunk& Chunk : Chunks)
 	{
-		std::istringstream Tokenizer(Buffer);
-		FString Prefix;
+		OutObjInfo->VertexList.insert(OutObjInfo->VertexList.end(), Chunk.VertexList.begin(), Chunk.VertexList.end());
+		OutObjInfo->NormalList.insert(OutObjInfo->NormalList.end(), Chunk.NormalList.begin(), Chunk.NormalList.end());
+		OutObjInfo->TexCoordList.insert(OutObjInfo->TexCoordList.end(), Chunk.TexCoordList.begin(), Chunk.TexCoordList.end());
 
-		Tokenizer >> Prefix;
+		// 이전 명령부터 InCommand 위치까지의 면을 현재 오브젝트에 붙인다. 면이 있으면 오브젝트는 ParseChunk가 남긴 명령으로 이미 만들어져 있다
+		FParseCommand Cursor = {};
+		const auto FlushFaces = [&](const FParseCommand& InCommand)
+		{
+			if (InCommand.FaceCount > Cursor.FaceCount)
+			{
+				FObjectInfo& ObjectInfo = *OptObjectInfo;
+				ObjectInfo.VertexIndexList.insert(ObjectInfo.VertexIndexList.end(),
+					Chunk.VertexIndexList.begin() + Cursor.VertexIndexCount, Chunk.VertexIndexList.begin() + InCommand.VertexIndexCount);
+				ObjectInfo.NormalIndexList.insert(ObjectInfo.NormalIndexList.end(),
+					Chunk.NormalIndexList.begin() + Cursor.NormalIndexCount, Chunk.NormalIndexList.begin() + InCommand.NormalIndexCount);
+				ObjectInfo.TexCoordIndexList.insert(ObjectInfo.TexCoordIndexList.end(),
+					Chunk.TexCoordIndexList.begin() + Cursor.TexCoordIndexCount, Chunk.TexCoordIndexList.begin() + InCommand.TexCoordIndexCount);
+				FaceCount += InCommand.FaceCount - Cursor.FaceCount;
+			}
+			Cursor = InCommand;
+		};
+
+		for (const FParseCommand& Command : Chunk.Commands)
+		{
+			FlushFaces(Command);
+
+			switch (Command.Type)
+			{
+			case EParseCommand::Object:
+				if (OptObjectInfo)
+				{
+					OutObjInfo->ObjectInfoList.emplace_back(std::move(*OptObjectInfo));
+				}
+				OptObjectInfo.emplace();
+				OptObjectInfo->Name = FString(Command.Name);
+				FaceCount = 0;
+				break;
+			case EParseCommand::Group:
+				EnsureObject();
+				OptObjectInfo->GroupNameList.emplace_back(Command.Name);
+				OptObjectInfo->GroupIndexList.emplace_back(FaceCount);
+				break;
+			case EParseCommand::Material:
+				EnsureObject();
+				OptObjectInfo->MaterialNameList.emplace_back(Command.Name);
+				OptObjectInfo->MaterialIndexList.emplace_back(FaceCount);
+				break;
+			case EParseCommand::MaterialLibrary:
+			{
+				/** @todo: Support relative path from .obj file to find .mtl file */
+				std::filesystem::path MaterialFilePath = FilePath.parent_path() / FString(Command.Name);
+
+				MaterialFilePath = std::filesystem::weakly_canonical(MaterialFilePath);
+
+				if (!LoadMaterial(MaterialFilePath, OutObjInfo))
+				{
+					UE_LOG_ERROR("머티리얼을 불러오는데 실패했습니다: %s", MaterialFilePath.string().c_str());
+					return false;
+				}
+			} break;
+			case EParseCommand::EnsureObject:
+				EnsureObject();
+				break;
+			}
+		}
+
+		FParseCommand ChunkEnd = {};
+		ChunkEnd.FaceCount = Chunk.FaceCount;
+		ChunkEnd.VertexIndexCount = Chunk.VertexIndexList.size();
+		ChunkEnd.NormalIndexCount = Chunk.NormalIndexList.size();
+		ChunkEnd.TexCoordIndexCount = Chunk.TexCoordIndexList.size();
+		FlushFaces(ChunkEnd);
+
+		// 합친 청크의 메모리는 바로 돌려준다
+		Chunk = FParseChunk();
+	}
+
+	if (OptObjectInfo)
+	{
+		OutObjInfo->ObjectInfoList.emplace_back(std::move(*OptObjectInfo));
+	}
+
+	return true;
+}
+
+void FObjImporter::ParseChunk(const char* InBegin, const char* InEnd, const Configuration& Config, FParseChunk& OutChunk)
+{
+	// 청크 안에서 오브젝트가 있다고 알려진 뒤의 면은 EnsureObject 명령을 남기지 않는다
+	bool bObjectKnown = false;
+	TArray<std::string_view> FaceBuffers;
+
+	const auto AddCommand = [&OutChunk](EParseCommand InType, std::string_view InName)
+	{
+		FParseCommand& Command = OutChunk.Commands.emplace_back();
+		Command.Type = InType;
+		Command.Name = InName;
+		Command.FaceCount = OutChunk.FaceCount;
+		Command.VertexIndexCount = OutChunk.VertexIndexList.size();
+		Command.NormalIndexCount = OutChunk.NormalIndexList.size();
+		Command.TexCoordIndexCount = OutChunk.TexCoordIndexList.size();
+	};
+
+	const char* LineBegin = InBegin;
+	while (LineBegin < InEnd)
+	{
+		const char* LineEnd = static_cast<const char*>(memchr(LineBegin, '\n', InEnd - LineBegin));
+		if (!LineEnd)
+		{
+			LineEnd = InEnd;
+		}
+		std::string_view Line(LineBegin, LineEnd - LineBegin);
+		LineBegin = LineEnd < InEnd ? LineEnd + 1 : InEnd;
+
+		const std::string_view Prefix = NextToken(Line);
 
 		// ========================== Vertex Information ============================ //
 
@@ -70,60 +358,38 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 		if (Prefix == "v")
 		{
 			FVector Position;
-			if (!(Tokenizer >> Position.X >> Position.Y >> Position.Z))
+			if (!ParseFloat(Line, Position.X) || !ParseFloat(Line, Position.Y) || !ParseFloat(Line, Position.Z))
 			{
-				UE_LOG_ERROR("정점 위치 형식이 잘못되었습니다");
-				return false;
-			}
-
-			if (Config.bPositionToUEBasis)
-			{
-				OutObjInfo->VertexList.emplace_back(PositionToUEBasis(Position));
-			}
-			else
-			{
-				OutObjInfo->VertexList.emplace_back(Position);
+				OutChunk.Error = "정점 위치 형식이 잘못되었습니다";
+				return;
 			}
 
+			OutChunk.VertexList.emplace_back(Config.bPositionToUEBasis ? PositionToUEBasis(Position) : Position);
 		}
 		/** Vertex Normal */
 		else if (Prefix == "vn")
 		{
 			FVector Normal;
-			if (!(Tokenizer >> Normal.X >> Normal.Y >> Normal.Z))
+			if (!ParseFloat(Line, Normal.X) || !ParseFloat(Line, Normal.Y) || !ParseFloat(Line, Normal.Z))
 			{
-				UE_LOG_ERROR("정점 법선 형식이 잘못되었습니다");
-				return false;
+				OutChunk.Error = "정점 법선 형식이 잘못되었습니다";
+				return;
 			}
 
-			if (Config.bNormalToUEBasis)
-			{
-				OutObjInfo->NormalList.emplace_back(NormalToUEBasis(Normal));
-			}
-			else
-			{
-				OutObjInfo->NormalList.emplace_back(Normal);
-			}
+			OutChunk.NormalList.emplace_back(Config.bNormalToUEBasis ? NormalToUEBasis(Normal) : Normal);
 		}
 		/** Texture Coordinate */
 		else if (Prefix == "vt")
 		{
 			/** @note: Ignore 3D Texture */
 			FVector2 TexCoord;
-			if (!(Tokenizer >> TexCoord.X >> TexCoord.Y))
+			if (!ParseFloat(Line, TexCoord.X) || !ParseFloat(Line, TexCoord.Y))
 			{
-				UE_LOG_ERROR("정점 텍스쳐 좌표 형식이 잘못되었습니다");
-				return false;
+				OutChunk.Error = "정점 텍스쳐 좌표 형식이 잘못되었습니다";
+				return;
 			}
 
-			if (Config.bUVToUEBasis)
-			{
-				OutObjInfo->TexCoordList.emplace_back(UVToUEBasis(TexCoord));
-			}
-			else
-			{
-				OutObjInfo->TexCoordList.emplace_back(TexCoord);
-			}
+			OutChunk.TexCoordList.emplace_back(Config.bUVToUEBasis ? UVToUEBasis(TexCoord) : TexCoord);
 		}
 
 		// =========================== Group Information ============================ //
@@ -136,41 +402,27 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 				continue; // Ignore 'o' prefix
 			}
 
-			if (OptObjectInfo)
-			{
-				OutObjInfo->ObjectInfoList.emplace_back(std::move(*OptObjectInfo));
-			}
-
-			FString ObjectName;
-			if (!(Tokenizer >> ObjectName))
+			const std::string_view ObjectName = NextToken(Line);
+			if (ObjectName.empty())
 			{
-				UE_LOG_ERROR("오브젝트 이름 형식이 잘못되었습니다");
-				return false;
+				OutChunk.Error = "오브젝트 이름 형식이 잘못되었습니다";
+				return;
 			}
-			OptObjectInfo.emplace();
-			OptObjectInfo->Name = std::move(ObjectName);
-
-			FaceCount = 0;
+			AddCommand(EParseCommand::Object, ObjectName);
+			bObjectKnown = true;
 		}
 
 		/** Group Information */
 		else if (Prefix == "g")
 		{
-			if (!OptObjectInfo)
+			const std::string_view GroupName = NextToken(Line);
+			if (GroupName.empty())
 			{
-				OptObjectInfo.emplace();
-				OptObjectInfo->Name = Config.DefaultName;
+				OutChunk.Error = "잘못된 그룹 이름 형식입니다";
+				return;
 			}
-
-			FString GroupName;
-			if (!(Tokenizer >> GroupName))
-			{
-				UE_LOG_ERROR("잘못된 그룹 이름 형식입니다");
-				return false;
-			}
-
-			OptObjectInfo->GroupNameList.emplace_back(std::move(GroupName));
-			OptObjectInfo->GroupIndexList.emplace_back(FaceCount);
+			AddCommand(EParseCommand::Group, GroupName);
+			bObjectKnown = true;
 		}
 
 		// ============================ Face Information ============================ //
@@ -178,69 +430,36 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 		/** Face Information */
 		else if (Prefix == "f")
 		{
-			if (!OptObjectInfo)
+			if (!bObjectKnown)
 			{
-				OptObjectInfo.emplace();
-				OptObjectInfo->Name = Config.DefaultName;
+				AddCommand(EParseCommand::EnsureObject, {});
+				bObjectKnown = true;
 			}
 
-			TArray<FString> FaceBuffers;
-			FString FaceBuffer;
-			while (Tokenizer >> FaceBuffer)
+			FaceBuffers.clear();
+			for (std::string_view FaceBuffer = NextToken(Line); !FaceBuffer.empty(); FaceBuffer = NextToken(Line))
 			{
-				FaceBuffers.emplace_back(FaceBuffer);
+				FaceBuffers.push_back(FaceBuffer);
 			}
 
 			if (FaceBuffers.size() < 2)
 			{
-				UE_LOG_ERROR("면 형식이 잘못되었습니다");
-				return false;
+				OutChunk.Error = "면 형식이 잘못되었습니다";
+				return;
 			}
 
 			/** @todo: 오목 다각형에 대한 지원 필요, 현재는 볼록 다각형만 지원 */
 			for (size_t i = 1; i + 1 < FaceBuffers.size(); ++i)
 			{
-				if (Config.bFlipWindingOrder)
+				const size_t Second = Config.bFlipWindingOrder ? i + 1 : i;
+				const size_t Third = Config.bFlipWindingOrder ? i : i + 1;
+				if (!ParseFaceVertex(FaceBuffers[0], OutChunk, OutChunk.Error)
+					|| !ParseFaceVertex(FaceBuffers[Second], OutChunk, OutChunk.Error)
+					|| !ParseFaceVertex(FaceBuffers[Third], OutChunk, OutChunk.Error))
 				{
-					if (!ParseFaceBuffer(FaceBuffers[0], &(*OptObjectInfo)))
-					{
-						UE_LOG_ERROR("면 파싱에 실패했습니다");
-						return false;
-					}
-
-					if (!ParseFaceBuffer(FaceBuffers[i + 1], &(*OptObjectInfo)))
-					{
-						UE_LOG_ERROR("면 파싱에 실패했습니다");
-						return false;
-					}
-
-					if (!ParseFaceBuffer(FaceBuffers[i], &(*OptObjectInfo)))
-					{
-						UE_LOG_ERROR("면 파싱에 실패했습니다");
-						return false;
-					}
+					return;
 				}
-				else
-				{
-					if (!ParseFaceBuffer(FaceBuffers[0], &(*OptObjectInfo)))
-					{
-						UE_LOG_ERROR("면 파싱에 실패했습니다");
-						return false;
-					}
-
-					if (!ParseFaceBuffer(FaceBuffers[i], &(*OptObjectInfo)))
-					{
-						UE_LOG_ERROR("면 파싱에 실패했습니다");
-						return false;
-					}
-
-					if (!ParseFaceBuffer(FaceBuffers[i + 1], &(*OptObjectInfo)))
-					{
-						UE_LOG_ERROR("면 파싱에 실패했습니다");
-						return false;
-					}
-				}
-				++FaceCount;
+				++OutChunk.FaceCount;
 			}
 		}
 
@@ -248,50 +467,15 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 
 		else if (Prefix == "mtllib")
 		{
-			/** @todo: Parse material data */
-			/** @todo: Support relative path from .obj file to find .mtl file */
-			FString MaterialFileName;
-			Tokenizer >> MaterialFileName;
-
-			std::filesystem::path MaterialFilePath = FilePath.parent_path() / MaterialFileName;
-
-			MaterialFilePath = std::filesystem::weakly_canonical(MaterialFilePath);
-
-			if (!LoadMaterial(MaterialFilePath, OutObjInfo))
-			{
-				UE_LOG_ERROR("머티리얼을 불러오는데 실패했습니다: %s", MaterialFilePath.string().c_str());
-				return false;
-			}
+			AddCommand(EParseCommand::MaterialLibrary, NextToken(Line));
 		}
 
 		else if (Prefix == "usemtl")
 		{
-			FString MaterialName;
-			Tokenizer >> MaterialName;
-
-			if (!OptObjectInfo)
-			{
-				OptObjectInfo.emplace();
-				OptObjectInfo->Name = Config.DefaultName;
-			}
-
-			OptObjectInfo->MaterialNameList.emplace_back(std::move(MaterialName));
-			OptObjectInfo->MaterialIndexList.emplace_back(FaceCount);
+			AddCommand(EParseCommand::Material, NextToken(Line));
+			bObjectKnown = true;
 		}
 	}
-
-	if (OptObjectInfo)
-	{
-		OutObjInfo->ObjectInfoList.emplace_back(std::move(*OptObjectInfo));
-	}
-
-	if (Config.bIsBinaryEnabled)
-	{
-		FWindowsBinWriter WindowsBinWriter(BinFilePath);
-		WindowsBinWriter << *OutObjInfo;
-	}
-
-	return true;
 }
 
 bool FObjImporter::LoadMaterial(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo)
@@ -629,105 +813,78 @@ bool FObjImporter::LoadMaterial(const std::filesystem::path& FilePath, FObjInfo*
 	return true;
 }
 
-bool FObjImporter::ParseFaceBuffer(const FString& FaceBuffer, FObjectInfo* OutObjectInfo)
+bool FObjImporter::ParseFaceVertex(std::string_view InToken, FParseChunk& OutChunk, const char*& OutError)
 {
-	/** Ignore data when ObjInfo is nullptr */
-	if (!OutObjectInfo)
-	{
-		return false;
-	}
-
-	TArray<FString> IndexBuffers;
-	std::istringstream Tokenizer(FaceBuffer);
-	FString IndexBuffer;
-	while (std::getline(Tokenizer, IndexBuffer, '/'))
+	// '/'로 나눈다. 끝의 '/' 뒤 빈 조각은 세지 않는다 (std::getline(…, '/')으로 나누던 때와 같은 규칙)
+	std::string_view IndexBuffers[3];
+	size_t IndexBufferCount = 0;
+	size_t Start = 0;
+	while (Start < InToken.size())
 	{
-		IndexBuffers.emplace_back(IndexBuffer);
-	}
+		const size_t Slash = InToken.find('/', Start);
+		const std::string_view IndexBuffer = InToken.substr(Start, Slash == std::string_view::npos ? std::string_view::npos : Slash - Start);
+		if (IndexBufferCount < 3)
+		{
+			IndexBuffers[IndexBufferCount] = IndexBuffer;
+		}
+		++IndexBufferCount;
 
-	if (IndexBuffers.empty())
-	{
-		UE_LOG_ERROR("면 형식이 잘못되었습니다");
-		return false;
+		if (Slash == std::string_view::npos)
+		{
+			break;
+		}
+		Start = Slash + 1;
 	}
 
-	if (IndexBuffers[0].empty())
+	if (IndexBufferCount == 0 || IndexBuffers[0].empty())
 	{
-		UE_LOG_ERROR("정점 위치 형식이 잘못되었습니다");
+		OutError = "정점 위치 형식이 잘못되었습니다";
 		return false;
 	}
 
-	try
-	{
-		OutObjectInfo->VertexIndexList.push_back(std::stoull(IndexBuffers[0]) - 1);
-	}
-	catch ([[maybe_unused]] const std::invalid_argument& Exception)
+	size_t Index;
+	if (!ParseIndex(IndexBuffers[0], Index))
 	{
-		UE_LOG_ERROR("정점 위치 인덱스 형식이 잘못되었습니다");
+		OutError = "정점 위치 인덱스 형식이 잘못되었습니다";
 		return false;
 	}
+	OutChunk.VertexIndexList.push_back(Index);
 
-	switch (IndexBuffers.size())
+	switch (IndexBufferCount)
 	{
 	case 1:
 		/** @brief: Only position data (e.g., 'f 1 2 3') */
 		break;
 	case 2:
 		/** @brief: Position and texture coordinate data (e.g., 'f 1/1 2/1') */
-		if (IndexBuffers[1].empty())
-		{
-			UE_LOG_ERROR("정점 텍스쳐 좌표 인덱스 형식이 잘못되었습니다");
-			return false;
-		}
-
-		try
+		if (!ParseIndex(IndexBuffers[1], Index))
 		{
-			OutObjectInfo->TexCoordIndexList.push_back(std::stoull(IndexBuffers[1]) - 1);
-		}
-		catch ([[maybe_unused]] const std::invalid_argument& Exception)
-		{
-			UE_LOG_ERROR("정점 텍스쳐 좌표 인덱스 형식이 잘못되었습니다");
+			OutError = "정점 텍스쳐 좌표 인덱스 형식이 잘못되었습니다";
 			return false;
 		}
+		OutChunk.TexCoordIndexList.push_back(Index);
 		break;
 	case 3:
 		/** @brief: Position, texture coordinate and vertex normal data (e.g., 'f 1/1/1 2/2/1' or 'f 1//1 2//1') */
 		if (IndexBuffers[1].empty()) /** Position and vertex normal */
 		{
-			if (IndexBuffers[2].empty())
-			{
-				UE_LOG_ERROR("정점 법선 인덱스 형식이 잘못되었습니다");
-				return false;
-			}
-
-			try
-			{
-				OutObjectInfo->NormalIndexList.push_back(std::stoull(IndexBuffers[2]) - 1);
-			}
-			catch ([[maybe_unused]] const std::invalid_argument& Exception)
+			if (!ParseIndex(IndexBuffers[2], Index))
 			{
-				UE_LOG_ERROR("정점 법선 인덱스 형식이 잘못되었습니다");
+				OutError = "정점 법선 인덱스 형식이 잘못되었습니다";
 				return false;
 			}
+			OutChunk.NormalIndexList.push_back(Index);
 		}
 		else /** Position, texture coordinate, and vertex normal */
 		{
-			if (IndexBuffers[1].empty() || IndexBuffers[2].empty())
-			{
-				UE_LOG_ERROR("정점 텍스쳐 좌표 또는 법선 인덱스 형식이 잘못되었습니다");
-				return false;
-			}
-
-			try
-			{
-				OutObjectInfo->TexCoordIndexList.push_back(std::stoull(IndexBuffers[1]) - 1);
-				OutObjectInfo->NormalIndexList.push_back(std::stoull(IndexBuffers[2]) - 1);
-			}
-			catch ([[maybe_unused]] const std::invalid_argument& Exception)
+			size_t NormalIndex;
+			if (!ParseIndex(IndexBuffers[1], Index) || !ParseIndex(IndexBuffers[2], NormalIndex))
 			{
-				UE_LOG_ERROR("정점 텍스쳐 좌표 또는 법선 인덱스 형식이 잘못되었습니다");
+				OutError = "정점 텍스쳐 좌표 또는 법선 인덱스 형식이 잘못되었습니다";
 				return false;
 			}
+			OutChunk.TexCoordIndexList.push_back(Index);
+			OutChunk.NormalIndexList.push_back(NormalIndex);
 		}
 		break;
 	}
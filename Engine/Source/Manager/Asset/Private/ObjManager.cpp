@@ -6,6 +6,9 @@
 #include "Manager/Asset/Public/AssetManager.h"
 #include "Texture/Public/Material.h"
 #include "Texture/Public/Texture.h"
+#include "Optimization/Public/OccluderProxy.h"
+#include "Core/Public/WindowsBinReader.h"
+#include "Core/Public/WindowsBinWriter.h"
 #include <filesystem>
 
 // N과 직교하는 안전한 탄젠트 생성 (폴백용)
@@ -101,6 +104,149 @@ static void ComputeTangents(TArray<FNormalVertex>& Vertices, const TArray<uint32
 
 }
 
+/**
+ * @brief 쿠킹된 메시 캐시(.meshbin) 머리말.
+ * 원본 해시, 결과에 영향을 주는 임포트 설정, 포맷 버전 중 하나라도 다르면 캐시를 버리고 다시 만든다.
+ */
+struct FCookedMeshHeader
+{
+	static constexpr uint32 MAGIC = 0x48534D46; // "FMSH"
+	static constexpr uint32 VERSION = 2;
+
+	uint32 Magic = MAGIC;
+	uint32 Version = VERSION;
+	uint64 SourceHash = 0;
+	uint32 ConfigFlags = 0;
+	uint32 Reserved = 0;
+};
+
+static uint32 GetCookedConfigFlags(const FObjImporter::Configuration& Config)
+{
+	return (Config.bIsObjectEnabled ? 1u << 0 : 0u) |
+		(Config.bFlipWindingOrder ? 1u << 1 : 0u) |
+		(Config.bPositionToUEBasis ? 1u << 2 : 0u) |
+		(Config.bNormalToUEBasis ? 1u << 3 : 0u) |
+		(Config.bUVToUEBasis ? 1u << 4 : 0u) |
+		(Config.bGenerateOccluderProxy ? 1u << 5 : 0u);
+}
+
+/** @brief FNV-1a 64비트 해시를 InOutHash에 이어서 누적한다 */
+static void HashBytes(std::string_view InBytes, uint64& InOutHash)
+{
+	for (const char Byte : InBytes)
+	{
+		InOutHash ^= static_cast<uint8>(Byte);
+		InOutHash *= 0x100000001B3ULL;
+	}
+}
+
+static bool ReadFileBytes(const std::filesystem::path& FilePath, FString& OutBytes)
+{
+	std::ifstream File(FilePath, std::ios::binary);
+	if (!File)
+	{
+		return false;
+	}
+	OutBytes.assign(std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>());
+	return true;
+}
+
+/** @brief istringstream의 >>와 같은 줄 안의 공백 문자 */
+static bool IsLineSpace(char InChar)
+{
+	return InChar == ' ' || InChar == '\t' || InChar == '\r' || InChar == '\v' || InChar == '\f';
+}
+
+/**
+ * @brief 이미 읽은 .obj 내용(InSource)과 그 파일이 mtllib로 참조하는 .mtl 파일 내용의 해시.
+ * 재질 정보도 캐시에 들어가므로 .mtl만 고쳐도 캐시가 무효가 된다. (경로 해석은 FObjImporter::LoadObj와 같다)
+ * 줄마다 토큰을 나누지 않고 버퍼에서 "mtllib"만 찾아, 줄의 첫 토큰인 경우에만 파일 이름을 읽는다.
+ */
+static uint64 ComputeSourceHash(const std::filesystem::path& FilePath, std::string_view InSource)
+{
+	constexpr std::string_view MaterialLibraryPrefix = "mtllib";
+
+	uint64 Hash = 0xCBF29CE484222325ULL;
+	HashBytes(InSource, Hash);
+
+	for (size_t Found = InSource.find(MaterialLibraryPrefix); Found != std::string_view::npos;
+		Found = InSource.find(MaterialLibraryPrefix, Found + MaterialLibraryPrefix.size()))
+	{
+		// 줄의 첫 토큰이어야 한다
+		size_t LineBegin = Found;
+		while (LineBegin > 0 && IsLineSpace(InSource[LineBegin - 1])) { --LineBegin; }
+		if (LineBegin > 0 && InSource[LineBegin - 1] != '\n')
+		{
+			continue;
+		}
+
+		size_t NameBegin = Found + MaterialLibraryPrefix.size();
+		if (NameBegin >= InSource.size() || !IsLineSpace(InSource[NameBegin]))
+		{
+			continue;
+		}
+		while (NameBegin < InSource.size() && IsLineSpace(InSource[NameBegin])) { ++NameBegin; }
+		size_t NameEnd = NameBegin;
+		while (NameEnd < InSource.size() && InSource[NameEnd] != '\n' && !IsLineSpace(InSource[NameEnd])) { ++NameEnd; }
+		if (NameEnd == NameBegin)
+		{
+			continue;
+		}
+
+		// 없는 .mtl은 이름만 섞어, 나중에 파일이 생기면 해시가 달라지게 한다
+		const std::string_view MaterialFileName = InSource.substr(NameBegin, NameEnd - NameBegin);
+		FString MaterialBytes;
+		ReadFileBytes(FilePath.parent_path() / FString(MaterialFileName), MaterialBytes);
+		HashBytes(MaterialFileName, Hash);
+		HashBytes(MaterialBytes, Hash);
+	}
+	return Hash;
+}
+
+static bool LoadCookedStaticMesh(const std::filesystem::path& CookedFilePath, uint64 SourceHash, uint32 ConfigFlags, FStaticMesh& OutStaticMesh)
+{
+	if (!std::filesystem::exists(CookedFilePath))
+	{
+		return false;
+	}
+
+	FWindowsBinReader WindowsBinReader(CookedFilePath);
+	FCookedMeshHeader Header;
+	WindowsBinReader << Header;
+	if (!WindowsBinReader.IsValid() || Header.Magic != FCookedMeshHeader::MAGIC || Header.Version != FCookedMeshHeader::VERSION ||
+		Header.SourceHash != SourceHash || Header.ConfigFlags != ConfigFlags)
+	{
+		UE_LOG("ObjManager: 메시 캐시가 원본과 다릅니다. 다시 만듭니다: %s", CookedFilePath.string().c_str());
+		return false;
+	}
+
+	WindowsBinReader << OutStaticMesh;
+	return WindowsBinReader.IsValid();
+}
+
+/** @brief 임시 파일에 다 쓴 뒤 이름을 바꿔, 쓰다 중단된 캐시가 유효한 머리말을 갖고 남지 않게 한다 */
+static void SaveCookedStaticMesh(const std::filesystem::path& CookedFilePath, uint64 SourceHash, uint32 ConfigFlags, FStaticMesh& StaticMesh)
+{
+	std::filesystem::path TempFilePath = CookedFilePath;
+	TempFilePath += ".tmp";
+	{
+		FWindowsBinWriter WindowsBinWriter(TempFilePath);
+		FCookedMeshHeader Header;
+		Header.SourceHash = SourceHash;
+		Header.ConfigFlags = ConfigFlags;
+		WindowsBinWriter << Header;
+		WindowsBinWriter << StaticMesh;
+	}
+
+	std::error_code ErrorCode;
+	std::filesystem::rename(TempFilePath, CookedFilePath, ErrorCode);
+	if (ErrorCode)
+	{
+		UE_LOG_ERROR("ObjManager: 메시 캐시를 저장하지 못했습니다: %s", CookedFilePath.string().c_str());
+		std::filesystem::remove(TempFilePath, ErrorCode);
+	}
+}
+
 // static 멤버 변수의 실체를 정의(메모리 할당)합니다.
 TMap<FName, std::unique_ptr<FStaticMesh>> FObjManager::ObjFStaticMeshMap;
 UMaterial* FObjManager::CachedDefaultMaterial = nullptr;
@@ -133,9 +279,35 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FName& PathFileName, cons
 		return Iter->second.get();
 	}
 
-	/** #1. '.obj' 파일로부터 오브젝트 정보를 로드 */
+	/** #0. 원본 해시가 같은 쿠킹된 메시 캐시(.meshbin)가 있으면 파싱/정점 병합/탄젠트/BVH 구축을 모두 건너뛴다 */
+	const std::filesystem::path SourceFilePath = PathFileName.ToString();
+	std::filesystem::path CookedFilePath = SourceFilePath;
+	CookedFilePath.replace_extension(".meshbin");
+
+	const uint32 ConfigFlags = GetCookedConfigFlags(Config);
+	FString SourceBytes;
+	uint64 SourceHash = 0;
+	const bool bUseCookedCache = Config.bIsBinaryEnabled && ReadFileBytes(SourceFilePath, SourceBytes);
+	if (bUseCookedCache)
+	{
+		SourceHash = ComputeSourceHash(SourceFilePath, SourceBytes);
+		auto CookedMesh = std::make_unique<FStaticMesh>();
+		if (LoadCookedStaticMesh(CookedFilePath, SourceHash, ConfigFlags, *CookedMesh))
+		{
+			CookedMesh->PathFileName = PathFileName;
+			FStaticMesh* CookedMeshPtr = CookedMesh.get();
+			ObjFStaticMeshMap.emplace(PathFileName, std::move(CookedMesh));
+			return CookedMeshPtr;
+		}
+	}
+
+	/** #1. '.obj' 파일로부터 오브젝트 정보를 로드. 해시를 구하려고 이미 읽은 원본이 있으면 파일을 다시 읽지 않고 그대로 파싱한다 */
 	FObjInfo ObjInfo;
-	if (!FObjImporter::LoadObj(PathFileName.ToString(), &ObjInfo, Config))
+	const bool bIsLoaded = bUseCookedCache
+		? FObjImporter::ParseObj(SourceBytes, SourceFilePath, &ObjInfo, Config)
+		: FObjImporter::LoadObj(PathFileName.ToString(), &ObjInfo, Config);
+	FString().swap(SourceBytes);
+	if (!bIsLoaded)
 	{
 		UE_LOG_ERROR("파일 정보를 읽어오는데 실패했습니다: %s", PathFileName.ToString());
 		return nullptr;
@@ -288,7 +460,23 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FName& PathFileName, cons
 		}
 	}
 
-	//StaticMesh->BVH.Build(StaticMesh.get()); // 빠른 피킹용 BVH 구축
+	/** #5. 소프트웨어 오클루전 컬링용 오클루더 프록시 생성 */
+	if (Config.bGenerateOccluderProxy)
+	{
+		if (FOccluderProxyBuilder::Build(StaticMesh->Vertices, StaticMesh->Indices, StaticMesh->OccluderProxy))
+		{
+			UE_LOG("ObjManager: 오클루더 프록시 생성: %s (%s, 삼각형 %zu개)", PathFileName.ToString().c_str(),
+				StaticMesh->OccluderProxy.Type == EOccluderProxyType::Box ? "Box" : "Voxel", StaticMesh->OccluderProxy.Indices.size() / 3);
+		}
+	}
+
+	StaticMesh->BVH.Build(StaticMesh.get()); // 빠른 피킹용 BVH 구축
+
+	/** #6. 다음 로드부터는 캐시를 읽는다 */
+	if (bUseCookedCache)
+	{
+		SaveCookedStaticMesh(CookedFilePath, SourceHash, ConfigFlags, *StaticMesh);
+	}
 	ObjFStaticMeshMap.emplace(PathFileName, std::move(StaticMesh));
 
 	return ObjFStaticMeshMap[PathFileName].get();
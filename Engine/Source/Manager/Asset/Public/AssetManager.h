@@ -37,6 +37,7 @@ public:
 	// StaticMesh Cache Accessors
 	UStaticMesh* GetStaticMeshFromCache(const FName& InObjPath);
 	void AddStaticMeshToCache(const FName& InObjPath, UStaticMesh* InStaticMesh);
+	const TMap<FName, std::unique_ptr<UStaticMesh>>& GetStaticMeshCache() const;
 
 	// Bounding Box
 	FAABB& GetAABB(EPrimitiveType InType);
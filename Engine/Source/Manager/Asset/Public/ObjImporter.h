@@ -4,6 +4,7 @@
 #include <filesystem>
 #include <fstream>
 #include <sstream>
+#include <string_view>
 
 // Engine Headers
 #include "Core/Public/Archive.h"
@@ -158,11 +159,15 @@ struct FObjImporter
 		bool bPositionToUEBasis = true;
 		bool bNormalToUEBasis = true;
 		bool bUVToUEBasis = true;
+		bool bGenerateOccluderProxy = true;
 		// ...
 	};
 
 	/**
 	 * @brief Loads and parses a .obj file from the given path.
+	 * The whole file is read into memory and tokenized in place; numbers are parsed with std::from_chars.
+	 * Files larger than a few MB are split into line-aligned chunks that are parsed in parallel and merged in file order,
+	 * so the result is identical to a single sequential pass.
 	 * @param FilePath The absolute or relative path to the .obj file.
 	 * @param OutObjInfo A pointer to an FObjInfo struct that will be populated with the file's data.
 	 * @param Config Configuration options for the import process.
@@ -170,6 +175,18 @@ struct FObjImporter
 	 */
 	static bool LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo, Configuration Config = {});
 
+	/**
+	 * @brief Parses .obj source that is already in memory. LoadObj calls this after reading the file; it does not read or write .objbin.
+	 * @param InSource The whole contents of the .obj file. Must stay alive until this returns.
+	 * @param FilePath The path the source came from. mtllib paths are resolved relative to its directory.
+	 * @param OutObjInfo A pointer to an FObjInfo struct that will be populated with the file's data.
+	 * @param Config Configuration options for the import process.
+	 * @param InChunkCount Number of line-aligned chunks to parse in parallel. 0 picks it from the source size and worker count.
+	 * @return True if the source was parsed successfully, false otherwise.
+	 */
+	static bool ParseObj(std::string_view InSource, const std::filesystem::path& FilePath, FObjInfo* OutObjInfo, const Configuration& Config,
+		uint32 InChunkCount = 0);
+
 	/**
 	 * @brief Loads and parses a .mtl material library file.
 	 * @param FilePath The path to the .mtl file.
@@ -179,15 +196,24 @@ struct FObjImporter
 	static bool LoadMaterial(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo);
 
 private:
+	/** @brief Parse result of one line-aligned chunk of an .obj file (defined in ObjImporter.cpp). */
+	struct FParseChunk;
+
+	/**
+	 * @brief Parses the lines in [InBegin, InEnd) into OutChunk. Safe to call from worker threads; errors are stored in the chunk instead of logged.
+	 * Object/group/material lines are recorded as commands at their position in the chunk's face stream and applied when chunks are merged.
+	 */
+	static void ParseChunk(const char* InBegin, const char* InEnd, const Configuration& Config, FParseChunk& OutChunk);
+
 	/**
-	 * @brief Parses a single face component string (e.g., "v/vt/vn").
-	 * @param FaceBuffer The string chunk representing one vertex of a face.
-	 * @param OutObjectInfo The object info struct to populate with the parsed indices.
+	 * @brief Parses a single face component string (e.g., "v/vt/vn") and appends its indices to OutChunk.
+	 * @param InToken The token representing one vertex of a face.
+	 * @param OutError Set to the error message on failure.
 	 * @return True on success, false on failure.
 	 * @note This function assumes a consistent face format within a single object.
 	 *       Mixing formats (e.g., 'f 1/1' and 'f 1//1') may lead to incorrect parsing.
 	 */
-	static bool ParseFaceBuffer(const FString& FaceBuffer, FObjectInfo* OutObjectInfo);
+	static bool ParseFaceVertex(std::string_view InToken, FParseChunk& OutChunk, const char*& OutError);
 
 	static FVector PositionToUEBasis(const FVector& InVector)
 	{
@@ -0,0 +1,105 @@
+#include "pch.h"
+#include "Optimization/Public/ContributionCuller.h"
+#include "Component/Public/PrimitiveComponent.h"
+#include "Component/Public/BillBoardComponent.h"
+
+#include <limits>
+
+void FContributionCuller::InitializeCuller(const FCameraConstants& InViewProj, float InViewportWidth, float InViewportHeight)
+{
+	ViewLocation = InViewProj.ViewWorldLocation;
+
+	// 원근 투영 행렬은 W에 뷰 공간 Z를 복사하므로 [3][3]이 0이다.
+	const FMatrix& Projection = InViewProj.Projection;
+	bIsPerspective = Projection.Data[3][3] == 0.0f;
+
+	// NDC [-1, 1]이 뷰포트 폭/높이에 대응하므로 NDC 1은 (폭 / 2) 픽셀이다.
+	// 종횡비가 뷰포트와 다르면 더 크게 보이는 축을 기준으로 해 보수적으로 판정한다.
+	PixelScale = max(fabsf(Projection.Data[0][0]) * InViewportWidth, fabsf(Projection.Data[1][1]) * InViewportHeight) * 0.5f;
+}
+
+void FContributionCuller::PerformCulling(TArray<UPrimitiveComponent*>& InOutPrimitives)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	Stats = {};
+	Stats.TestedCount = static_cast<uint32>(InOutPrimitives.size());
+
+	size_t WriteIndex = 0;
+	for (size_t ReadIndex = 0; ReadIndex < InOutPrimitives.size(); ++ReadIndex)
+	{
+		UPrimitiveComponent* Primitive = InOutPrimitives[ReadIndex];
+
+		bool bIsCulled = false;
+		const UBillBoardComponent* BillBoard = Cast<UBillBoardComponent>(Primitive);
+		if (!BillBoard || !BillBoard->IsScreenSizeScaled())
+		{
+			FVector Min, Max;
+			Primitive->GetWorldAABB(Min, Max);
+			const FVector Center = (Min + Max) * 0.5f;
+			const float RadiusSquared = (Max - Min).LengthSquared() * 0.25f;
+
+			float MinScreenSize = Primitive->GetMinScreenSize();
+			if (MinScreenSize < 0.0f)
+			{
+				MinScreenSize = DEFAULT_MIN_SCREEN_SIZE;
+			}
+			const float MaxDrawDistance = Primitive->GetMaxDrawDistance();
+
+			if (bIsPerspective)
+			{
+				const float DistanceSquared = (Center - ViewLocation).LengthSquared();
+
+				// 카메라가 구 안에 있으면 거리/크기 모두 의미가 없으므로 그대로 그린다
+				if (DistanceSquared > RadiusSquared)
+				{
+					// 구 표면까지의 거리로 비교해 큰 프리미티브가 가까운 쪽이 보이는데도 사라지지 않게 한다
+					// D - R > MaxDrawDistance  <=>  D^2 > (MaxDrawDistance + R)^2
+					const float CullDistance = MaxDrawDistance > 0.0f ? MaxDrawDistance + sqrtf(RadiusSquared) : 0.0f;
+					if (MaxDrawDistance > 0.0f && DistanceSquared > CullDistance * CullDistance)
+					{
+						bIsCulled = true;
+						++Stats.DistanceCulledCount;
+					}
+					else if (MinScreenSize > 0.0f)
+					{
+						// 2 * PixelScale * R / sqrt(D^2 - R^2) < MinScreenSize  <=>  4 * PixelScale^2 * R^2 < MinScreenSize^2 * (D^2 - R^2)
+						if (4.0f * PixelScale * PixelScale * RadiusSquared < MinScreenSize * MinScreenSize * (DistanceSquared - RadiusSquared))
+						{
+							bIsCulled = true;
+							++Stats.SizeCulledCount;
+						}
+					}
+				}
+			}
+			else if (MinScreenSize > 0.0f && 4.0f * PixelScale * PixelScale * RadiusSquared < MinScreenSize * MinScreenSize)
+			{
+				bIsCulled = true;
+				++Stats.SizeCulledCount;
+			}
+		}
+
+		if (!bIsCulled)
+		{
+			InOutPrimitives[WriteIndex++] = Primitive;
+		}
+	}
+	InOutPrimitives.resize(WriteIndex);
+
+	Stats.TestMs = static_cast<float>(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+}
+
+float FContributionCuller::ComputeScreenSize(const FVector& InCenter, float InRadius) const
+{
+	if (!bIsPerspective)
+	{
+		return 2.0f * PixelScale * InRadius;
+	}
+
+	const float DistanceSquared = (InCenter - ViewLocation).LengthSquared();
+	const float RadiusSquared = InRadius * InRadius;
+	if (DistanceSquared <= RadiusSquared)
+	{
+		return std::numeric_limits<float>::infinity();
+	}
+	return 2.0f * PixelScale * InRadius / sqrtf(DistanceSquared - RadiusSquared);
+}
@@ -0,0 +1,191 @@
+#include "pch.h"
+#include "Optimization/Public/FrustumCullingKernel.h"
+#include "Optimization/Public/ViewVolumeCuller.h"
+#include "Component/Public/PrimitiveComponent.h"
+
+#include <immintrin.h>
+
+FFrustumCullingKernel::FFrustumCullingKernel(const FFrustum& InFrustum)
+{
+	for (int PlaneIndex = 0; PlaneIndex < 6; ++PlaneIndex)
+	{
+		const FVector4& Plane = InFrustum.Planes[PlaneIndex];
+		for (uint32 Lane = 0; Lane < LANE_COUNT; ++Lane)
+		{
+			PlaneX[PlaneIndex][Lane] = Plane.X;
+			PlaneY[PlaneIndex][Lane] = Plane.Y;
+			PlaneZ[PlaneIndex][Lane] = Plane.Z;
+			PlaneW[PlaneIndex][Lane] = Plane.W;
+		}
+	}
+}
+
+void FFrustumCullingKernel::CullBoxes(const float* InMinX, const float* InMinY, const float* InMinZ,
+	const float* InMaxX, const float* InMaxY, const float* InMaxZ, uint32 InCount, uint32* OutVisibleMask) const
+{
+#if defined(__AVX__)
+	CullBoxesAVX(InMinX, InMinY, InMinZ, InMaxX, InMaxY, InMaxZ, InCount, OutVisibleMask);
+#else
+	CullBoxesSSE(InMinX, InMinY, InMinZ, InMaxX, InMaxY, InMaxZ, InCount, OutVisibleMask);
+#endif
+}
+
+void FFrustumCullingKernel::CullBoxesSSE(const float* InMinX, const float* InMinY, const float* InMinZ,
+	const float* InMaxX, const float* InMaxY, const float* InMaxZ, uint32 InCount, uint32* OutVisibleMask) const
+{
+	std::fill(OutVisibleMask, OutVisibleMask + GetMaskWordCount(InCount), 0u);
+
+	const __m128 Zero = _mm_setzero_ps();
+
+	uint32 Index = 0;
+	for (; Index + 4 <= InCount; Index += 4)
+	{
+		const __m128 MinX = _mm_loadu_ps(InMinX + Index);
+		const __m128 MinY = _mm_loadu_ps(InMinY + Index);
+		const __m128 MinZ = _mm_loadu_ps(InMinZ + Index);
+		const __m128 MaxX = _mm_loadu_ps(InMaxX + Index);
+		const __m128 MaxY = _mm_loadu_ps(InMaxY + Index);
+		const __m128 MaxZ = _mm_loadu_ps(InMaxZ + Index);
+
+		__m128 Outside = _mm_setzero_ps();
+		for (int PlaneIndex = 0; PlaneIndex < 6; ++PlaneIndex)
+		{
+			const __m128 PX = _mm_load_ps(PlaneX[PlaneIndex]);
+			const __m128 PY = _mm_load_ps(PlaneY[PlaneIndex]);
+			const __m128 PZ = _mm_load_ps(PlaneZ[PlaneIndex]);
+			const __m128 PW = _mm_load_ps(PlaneW[PlaneIndex]);
+
+			// 축마다 평면 쪽으로 가장 덜 나간 성분(negative vertex)을 min으로 고른다
+			__m128 Distance = _mm_min_ps(_mm_mul_ps(PX, MinX), _mm_mul_ps(PX, MaxX));
+			Distance = _mm_add_ps(Distance, _mm_min_ps(_mm_mul_ps(PY, MinY), _mm_mul_ps(PY, MaxY)));
+			Distance = _mm_add_ps(Distance, _mm_min_ps(_mm_mul_ps(PZ, MinZ), _mm_mul_ps(PZ, MaxZ)));
+			Distance = _mm_add_ps(Distance, PW);
+
+			Outside = _mm_or_ps(Outside, _mm_cmpgt_ps(Distance, Zero));
+		}
+
+		const uint32 VisibleBits = static_cast<uint32>(~_mm_movemask_ps(Outside)) & 0xFu;
+		OutVisibleMask[Index / 32] |= VisibleBits << (Index % 32);
+	}
+
+	for (; Index < InCount; ++Index)
+	{
+		if (IsBoxVisible(InMinX[Index], InMinY[Index], InMinZ[Index], InMaxX[Index], InMaxY[Index], InMaxZ[Index]))
+		{
+			OutVisibleMask[Index / 32] |= 1u << (Index % 32);
+		}
+	}
+}
+
+void FFrustumCullingKernel::CullBoxesAVX(const float* InMinX, const float* InMinY, const float* InMinZ,
+	const float* InMaxX, const float* InMaxY, const float* InMaxZ, uint32 InCount, uint32* OutVisibleMask) const
+{
+	std::fill(OutVisibleMask, OutVisibleMask + GetMaskWordCount(InCount), 0u);
+
+	const __m256 Zero = _mm256_setzero_ps();
+
+	uint32 Index = 0;
+	for (; Index + 8 <= InCount; Index += 8)
+	{
+		const __m256 MinX = _mm256_loadu_ps(InMinX + Index);
+		const __m256 MinY = _mm256_loadu_ps(InMinY + Index);
+		const __m256 MinZ = _mm256_loadu_ps(InMinZ + Index);
+		const __m256 MaxX = _mm256_loadu_ps(InMaxX + Index);
+		const __m256 MaxY = _mm256_loadu_ps(InMaxY + Index);
+		const __m256 MaxZ = _mm256_loadu_ps(InMaxZ + Index);
+
+		__m256 Outside = _mm256_setzero_ps();
+		for (int PlaneIndex = 0; PlaneIndex < 6; ++PlaneIndex)
+		{
+			const __m256 PX = _mm256_load_ps(PlaneX[PlaneIndex]);
+			const __m256 PY = _mm256_load_ps(PlaneY[PlaneIndex]);
+			const __m256 PZ = _mm256_load_ps(PlaneZ[PlaneIndex]);
+			const __m256 PW = _mm256_load_ps(PlaneW[PlaneIndex]);
+
+			__m256 Distance = _mm256_min_ps(_mm256_mul_ps(PX, MinX), _mm256_mul_ps(PX, MaxX));
+			Distance = _mm256_add_ps(Distance, _mm256_min_ps(_mm256_mul_ps(PY, MinY), _mm256_mul_ps(PY, MaxY)));
+			Distance = _mm256_add_ps(Distance, _mm256_min_ps(_mm256_mul_ps(PZ, MinZ), _mm256_mul_ps(PZ, MaxZ)));
+			Distance = _mm256_add_ps(Distance, PW);
+
+			Outside = _mm256_or_ps(Outside, _mm256_cmp_ps(Distance, Zero, _CMP_GT_OQ));
+		}
+
+		const uint32 VisibleBits = static_cast<uint32>(~_mm256_movemask_ps(Outside)) & 0xFFu;
+		OutVisibleMask[Index / 32] |= VisibleBits << (Index % 32);
+	}
+
+	for (; Index < InCount; ++Index)
+	{
+		if (IsBoxVisible(InMinX[Index], InMinY[Index], InMinZ[Index], InMaxX[Index], InMaxY[Index], InMaxZ[Index]))
+		{
+			OutVisibleMask[Index / 32] |= 1u << (Index % 32);
+		}
+	}
+}
+
+bool FFrustumCullingKernel::IsBoxVisible(float InMinX, float InMinY, float InMinZ, float InMaxX, float InMaxY, float InMaxZ) const
+{
+	for (int PlaneIndex = 0; PlaneIndex < 6; ++PlaneIndex)
+	{
+		const float PX = PlaneX[PlaneIndex][0];
+		const float PY = PlaneY[PlaneIndex][0];
+		const float PZ = PlaneZ[PlaneIndex][0];
+
+		const float Distance = std::min(PX * InMinX, PX * InMaxX) + std::min(PY * InMinY, PY * InMaxY)
+			+ std::min(PZ * InMinZ, PZ * InMaxZ) + PlaneW[PlaneIndex][0];
+		if (Distance > 0.0f)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FPrimitiveBoundsSoA::Reset()
+{
+	MinX.clear(); MinY.clear(); MinZ.clear();
+	MaxX.clear(); MaxY.clear(); MaxZ.clear();
+	Primitives.clear();
+}
+
+void FPrimitiveBoundsSoA::Add(UPrimitiveComponent* InPrimitive, const FVector& InMin, const FVector& InMax)
+{
+	MinX.push_back(InMin.X); MinY.push_back(InMin.Y); MinZ.push_back(InMin.Z);
+	MaxX.push_back(InMax.X); MaxY.push_back(InMax.Y); MaxZ.push_back(InMax.Z);
+	Primitives.push_back(InPrimitive);
+}
+
+void FPrimitiveBoundsSoA::AddPrimitive(UPrimitiveComponent* InPrimitive)
+{
+	FVector Min, Max;
+	InPrimitive->GetWorldAABB(Min, Max);
+	Add(InPrimitive, Min, Max);
+}
+
+void FPrimitiveBoundsSoA::Cull(const FFrustumCullingKernel& InKernel)
+{
+	const uint32 Count = Num();
+	VisibleMask.resize(FFrustumCullingKernel::GetMaskWordCount(Count));
+	if (Count == 0) { return; }
+
+	InKernel.CullBoxes(MinX.data(), MinY.data(), MinZ.data(), MaxX.data(), MaxY.data(), MaxZ.data(), Count, VisibleMask.data());
+}
+
+void FPrimitiveBoundsSoA::AppendVisible(TArray<UPrimitiveComponent*>& OutPrimitives) const
+{
+	const uint32 Count = Num();
+	for (uint32 Index = 0; Index < Count; ++Index)
+	{
+		// 32개가 전부 잘린 워드는 한 번에 건너뛴다
+		if ((Index % 32) == 0 && VisibleMask[Index / 32] == 0)
+		{
+			Index += 31;
+			continue;
+		}
+
+		if (IsVisible(Index))
+		{
+			OutPrimitives.push_back(Primitives[Index]);
+		}
+	}
+}
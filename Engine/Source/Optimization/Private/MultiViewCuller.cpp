@@ -0,0 +1,344 @@
+#include "pch.h"
+#include "Optimization/Public/MultiViewCuller.h"
+#include "Global/Octree.h"
+#include "Global/DynamicAABBTree.h"
+#include "Optimization/Public/PotentiallyVisibleSet.h"
+
+void FMultiViewCuller::ResetViews()
+{
+	ViewCount = 0;
+}
+
+uint32 FMultiViewCuller::AddView(const FCameraConstants& InViewProj, const FPotentiallyVisibleSet* InPVS)
+{
+	if (ViewCount >= MAX_VIEWS)
+	{
+		return INVALID_VIEW;
+	}
+
+	FView& View = Views[ViewCount];
+	if (!View.Frustum.SetFromViewProjection(InViewProj))
+	{
+		// 퇴화한 투영은 아무것도 보이지 않게 한다 (모든 점이 바깥인 평면)
+		View.Frustum.Clear();
+		View.Frustum.Planes[0] = FVector4(0.0f, 0.0f, 0.0f, 1.0f);
+	}
+	View.Location = InViewProj.ViewWorldLocation;
+	View.PVS = InPVS;
+	return ViewCount++;
+}
+
+void FMultiViewCuller::Cull(const FOctree* StaticOctree, const FDynamicAABBTree* DynamicTree,
+	const TArray<UPrimitiveComponent*>& InUnboundedPrimitives)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	Primitives.clear();
+	ViewMasks.clear();
+	Stats = {};
+	Stats.ViewCount = ViewCount;
+	if (ViewCount == 0) { return; }
+
+	const uint8 AllViews = static_cast<uint8>((1u << ViewCount) - 1u);
+
+	// 1. 정적 프리미티브
+	//    PVS 셀 안에 있는 뷰는 PVS 집합을 후보로 쓰고, 나머지 뷰만 옥트리를 함께 순회한다.
+	if (StaticOctree)
+	{
+		uint8 OctreeViews = AllViews;
+		for (uint32 ViewIndex = 0; ViewIndex < ViewCount; ++ViewIndex)
+		{
+			if (Views[ViewIndex].PVS && GatherPVSCandidates(ViewIndex))
+			{
+				OctreeViews &= ~static_cast<uint8>(1u << ViewIndex);
+			}
+		}
+
+		if (OctreeViews != 0)
+		{
+			CullOctree(StaticOctree, OctreeViews);
+			ResolvePending();
+		}
+	}
+
+	// 2. 움직이는 프리미티브
+	if (DynamicTree && !DynamicTree->IsEmpty())
+	{
+		CullDynamicTree(*DynamicTree, AllViews);
+		ResolvePending();
+	}
+
+	// 3. 경계가 없는 프리미티브
+	for (UPrimitiveComponent* Primitive : InUnboundedPrimitives)
+	{
+		if (Primitive != nullptr && Primitive->IsVisible())
+		{
+			AddResult(Primitive, AllViews);
+		}
+	}
+
+	Stats.VisiblePrimitiveCount = static_cast<uint32>(Primitives.size());
+	Stats.CullMs = static_cast<float>(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+}
+
+void FMultiViewCuller::GetViewPrimitives(uint32 InViewIndex, TArray<UPrimitiveComponent*>& OutPrimitives) const
+{
+	OutPrimitives.clear();
+	if (InViewIndex >= ViewCount) { return; }
+
+	const uint8 ViewBit = static_cast<uint8>(1u << InViewIndex);
+	const size_t Count = Primitives.size();
+	for (size_t Index = 0; Index < Count; ++Index)
+	{
+		if (ViewMasks[Index] & ViewBit)
+		{
+			OutPrimitives.push_back(Primitives[Index]);
+		}
+	}
+}
+
+void FMultiViewCuller::CullOctree(const FOctree* InOctree, uint8 InViewMask)
+{
+	OctreeStack.clear();
+	OctreeStack.push_back({ InOctree, InViewMask, 0, GetAllPlanesMask(InViewMask) });
+
+	while (!OctreeStack.empty())
+	{
+		FOctreeEntry Entry = OctreeStack.back();
+		OctreeStack.pop_back();
+		++Stats.VisitedNodeCount;
+
+		// 아직 판정이 끝나지 않은 뷰만 노드 경계로 검사한다. 카메라 이동은 연속적이므로 뷰마다 지난 프레임에 노드를 잘라낸 평면부터 검사한다
+		if (Entry.PendingViews != 0)
+		{
+			uint32 RejectingPlanes = Entry.Node->GetLastRejectingPlanes();
+			ClassifyBox(Entry.Node->GetBoundingBox(), Entry.PendingViews, Entry.InsideViews, Entry.PlaneMasks, RejectingPlanes);
+			Entry.Node->SetLastRejectingPlanes(RejectingPlanes);
+		}
+
+		// Case 1. 모든 뷰에서 바깥
+		if ((Entry.PendingViews | Entry.InsideViews) == 0)
+		{
+			continue;
+		}
+
+		// Case 2. 남은 뷰가 모두 노드를 완전히 포함하므로 서브트리 전체를 검사 없이 추가한다
+		if (Entry.PendingViews == 0)
+		{
+			SubtreePrimitives.clear();
+			Entry.Node->GetAllPrimitives(SubtreePrimitives);
+			for (UPrimitiveComponent* Primitive : SubtreePrimitives)
+			{
+				if (Primitive != nullptr && Primitive->IsVisible())
+				{
+					AddResult(Primitive, Entry.InsideViews);
+				}
+			}
+			continue;
+		}
+
+		// Case 3. 걸친 뷰가 있으면 이 노드의 프리미티브를 개별 검사 대상으로 모으고 자식으로 내려간다
+		for (UPrimitiveComponent* Primitive : Entry.Node->GetPrimitives())
+		{
+			if (Primitive != nullptr && Primitive->IsVisible())
+			{
+				FVector Min, Max;
+				Primitive->GetWorldAABB(Min, Max);
+				AddPending(Primitive, Min, Max, Entry.PendingViews, Entry.InsideViews);
+			}
+		}
+
+		if (Entry.Node->IsLeafNode() == false)
+		{
+			for (const FOctree* Child : Entry.Node->GetChildren())
+			{
+				if (Child != nullptr)
+				{
+					OctreeStack.push_back({ Child, Entry.PendingViews, Entry.InsideViews, Entry.PlaneMasks });
+				}
+			}
+		}
+	}
+}
+
+void FMultiViewCuller::CullDynamicTree(const FDynamicAABBTree& InTree, uint8 InViewMask)
+{
+	DynamicStack.clear();
+	DynamicStack.push_back({ InTree.GetRootIndex(), InViewMask, 0, GetAllPlanesMask(InViewMask) });
+
+	while (!DynamicStack.empty())
+	{
+		FDynamicEntry Entry = DynamicStack.back();
+		DynamicStack.pop_back();
+		++Stats.VisitedNodeCount;
+
+		const FDynamicAABBTreeNode& Node = InTree.GetNode(Entry.NodeIndex);
+
+		// 리프는 검사하지 않고 모아 두었다가 SIMD 커널로 한 번에 검사한다
+		if (Node.IsLeaf())
+		{
+			if (!Node.Primitive->IsVisible()) { continue; }
+
+			if (Entry.PendingViews == 0)
+			{
+				AddResult(Node.Primitive, Entry.InsideViews);
+			}
+			else
+			{
+				AddPending(Node.Primitive, Node.Box.Min, Node.Box.Max, Entry.PendingViews, Entry.InsideViews);
+			}
+			continue;
+		}
+
+		if (Entry.PendingViews != 0)
+		{
+			ClassifyBox(Node.Box, Entry.PendingViews, Entry.InsideViews, Entry.PlaneMasks, Node.LastRejectingPlanes);
+		}
+
+		if ((Entry.PendingViews | Entry.InsideViews) == 0)
+		{
+			continue;
+		}
+
+		DynamicStack.push_back({ Node.Child1, Entry.PendingViews, Entry.InsideViews, Entry.PlaneMasks });
+		DynamicStack.push_back({ Node.Child2, Entry.PendingViews, Entry.InsideViews, Entry.PlaneMasks });
+	}
+}
+
+bool FMultiViewCuller::GatherPVSCandidates(uint32 InViewIndex)
+{
+	const FView& View = Views[InViewIndex];
+	const FPotentiallyVisibleSet& PVS = *View.PVS;
+
+	const uint32 SetIndex = PVS.FindSet(View.Location);
+	if (SetIndex == FPotentiallyVisibleSet::INVALID_SET)
+	{
+		return false;
+	}
+
+	FPVSCache& Cache = PVSCaches[InViewIndex];
+	if (Cache.PVS != &PVS || Cache.Revision != PVS.GetRevision() || Cache.SetIndex != SetIndex)
+	{
+		PVS.DecodeSet(SetIndex, Cache.Bits);
+		Cache.PVS = &PVS;
+		Cache.Revision = PVS.GetRevision();
+		Cache.SetIndex = SetIndex;
+	}
+
+	const uint8 ViewBit = static_cast<uint8>(1u << InViewIndex);
+	const uint32 WordCount = static_cast<uint32>(Cache.Bits.size());
+	for (uint32 Word = 0; Word < WordCount; ++Word)
+	{
+		for (uint32 Bits = Cache.Bits[Word]; Bits != 0; Bits &= Bits - 1)
+		{
+			unsigned long Bit;
+			_BitScanForward(&Bit, Bits);
+
+			UPrimitiveComponent* Primitive = PVS.GetPrimitive(Word * 32 + Bit);
+			if (Primitive->IsVisible())
+			{
+				FVector Min, Max;
+				Primitive->GetWorldAABB(Min, Max);
+				AddPending(Primitive, Min, Max, ViewBit, 0);
+			}
+		}
+	}
+
+	ResolvePending();
+	return true;
+}
+
+void FMultiViewCuller::ClassifyBox(const FAABB& InBox, uint8& InOutPendingViews, uint8& InOutInsideViews, uint64& InOutPlaneMasks,
+	uint32& InOutRejectingPlanes) const
+{
+	for (uint32 RemainingViews = InOutPendingViews; RemainingViews != 0; RemainingViews &= RemainingViews - 1)
+	{
+		unsigned long ViewIndex;
+		_BitScanForward(&ViewIndex, RemainingViews);
+
+		const uint32 Shift = ViewIndex * 8;
+		uint8 PlaneMask = static_cast<uint8>(InOutPlaneMasks >> Shift);
+		const uint32 HintShift = ViewIndex * 3;
+		uint8 RejectingPlane = static_cast<uint8>((InOutRejectingPlanes >> HintShift) & 0x7u);
+		const EBoundCheckResult Result = Views[ViewIndex].Frustum.CheckIntersection(InBox, PlaneMask, RejectingPlane);
+		InOutRejectingPlanes = (InOutRejectingPlanes & ~(0x7u << HintShift)) | (static_cast<uint32>(RejectingPlane) << HintShift);
+
+		const uint8 ViewBit = static_cast<uint8>(1u << ViewIndex);
+		if (Result == EBoundCheckResult::Outside)
+		{
+			InOutPendingViews &= ~ViewBit;
+		}
+		else if (Result == EBoundCheckResult::Inside)
+		{
+			InOutPendingViews &= ~ViewBit;
+			InOutInsideViews |= ViewBit;
+		}
+		else
+		{
+			InOutPlaneMasks = (InOutPlaneMasks & ~(0xFFull << Shift)) | (static_cast<uint64>(PlaneMask) << Shift);
+		}
+	}
+}
+
+void FMultiViewCuller::AddPending(UPrimitiveComponent* InPrimitive, const FVector& InMin, const FVector& InMax, uint8 InPendingViews,
+	uint8 InInsideViews)
+{
+	PendingBounds.Add(InPrimitive, InMin, InMax);
+	PendingViewMasks.push_back(InPendingViews);
+	PendingInsideMasks.push_back(InInsideViews);
+}
+
+void FMultiViewCuller::ResolvePending()
+{
+	const uint32 Count = PendingBounds.Num();
+	Stats.TestedPrimitiveCount += Count;
+	if (Count == 0) { return; }
+
+	uint8 UsedViews = 0;
+	for (uint8 Mask : PendingViewMasks)
+	{
+		UsedViews |= Mask;
+	}
+
+	// 뷰마다 후보 전체를 한 번씩 커널로 검사하고, 그 뷰를 검사해야 하는 후보에만 결과를 반영한다
+	for (uint32 RemainingViews = UsedViews; RemainingViews != 0; RemainingViews &= RemainingViews - 1)
+	{
+		unsigned long ViewIndex;
+		_BitScanForward(&ViewIndex, RemainingViews);
+		const uint8 ViewBit = static_cast<uint8>(1u << ViewIndex);
+
+		PendingBounds.Cull(FFrustumCullingKernel(Views[ViewIndex].Frustum));
+		for (uint32 Index = 0; Index < Count; ++Index)
+		{
+			if ((PendingViewMasks[Index] & ViewBit) && PendingBounds.IsVisible(Index))
+			{
+				PendingInsideMasks[Index] |= ViewBit;
+			}
+		}
+	}
+
+	for (uint32 Index = 0; Index < Count; ++Index)
+	{
+		if (PendingInsideMasks[Index] != 0)
+		{
+			AddResult(PendingBounds.Primitives[Index], PendingInsideMasks[Index]);
+		}
+	}
+
+	PendingBounds.Reset();
+	PendingViewMasks.clear();
+	PendingInsideMasks.clear();
+}
+
+uint64 FMultiViewCuller::GetAllPlanesMask(uint8 InViewMask)
+{
+	uint64 PlaneMasks = 0;
+	for (uint32 ViewIndex = 0; ViewIndex < MAX_VIEWS; ++ViewIndex)
+	{
+		if (InViewMask & (1u << ViewIndex))
+		{
+			PlaneMasks |= static_cast<uint64>(FFrustum::ALL_PLANES_MASK) << (ViewIndex * 8);
+		}
+	}
+	return PlaneMasks;
+}
@@ -0,0 +1,396 @@
+#include "pch.h"
+#include "Optimization/Public/OccluderProxy.h"
+
+namespace
+{
+	/** @brief 삼각형이 칸 경계에 정확히 걸칠 때도 표면 칸으로 잡히도록 칸을 살짝 부풀리는 비율 */
+	constexpr float SURFACE_CELL_INFLATION = 1.001f;
+	/** @brief 이보다 얇은 축을 가진 메시(평면 등)는 내부 부피가 없으므로 프록시를 만들지 않는다 */
+	constexpr float MIN_AXIS_EXTENT = 1e-4f;
+
+	struct FPositionKey
+	{
+		float X, Y, Z;
+		bool operator==(const FPositionKey& Other) const { return X == Other.X && Y == Other.Y && Z == Other.Z; }
+	};
+
+	struct FPositionKeyHash
+	{
+		size_t operator()(const FPositionKey& Key) const
+		{
+			const size_t H1 = std::hash<float>()(Key.X);
+			const size_t H2 = std::hash<float>()(Key.Y);
+			const size_t H3 = std::hash<float>()(Key.Z);
+			return H1 ^ (H2 << 1) ^ (H3 << 2);
+		}
+	};
+
+	/** @brief 세 값을 InAxis 위에 투영한 구간이 [-InRadius, InRadius]와 겹치지 않으면 true */
+	bool IsSeparated(float InP0, float InP1, float InP2, float InRadius)
+	{
+		return std::min({ InP0, InP1, InP2 }) > InRadius || std::max({ InP0, InP1, InP2 }) < -InRadius;
+	}
+
+	/**
+	 * @brief 삼각형과 AABB의 분리축 검사 (박스 축 3개, 삼각형 법선 1개, 변 x 박스 축 9개)
+	 * @param InCenter 박스 중심, InHalfSize 박스 반크기
+	 */
+	bool TriangleOverlapsBox(const FVector& InCenter, const FVector& InHalfSize, const FVector& InA, const FVector& InB, const FVector& InC)
+	{
+		const FVector V0 = InA - InCenter;
+		const FVector V1 = InB - InCenter;
+		const FVector V2 = InC - InCenter;
+
+		if (IsSeparated(V0.X, V1.X, V2.X, InHalfSize.X) ||
+			IsSeparated(V0.Y, V1.Y, V2.Y, InHalfSize.Y) ||
+			IsSeparated(V0.Z, V1.Z, V2.Z, InHalfSize.Z))
+		{
+			return false;
+		}
+
+		const FVector Edges[3] = { V1 - V0, V2 - V1, V0 - V2 };
+
+		const FVector Normal = Cross(Edges[0], Edges[1]);
+		const float NormalRadius = InHalfSize.X * std::abs(Normal.X) + InHalfSize.Y * std::abs(Normal.Y) + InHalfSize.Z * std::abs(Normal.Z);
+		if (std::abs(Dot(Normal, V0)) > NormalRadius) { return false; }
+
+		const FVector BoxAxes[3] = { FVector(1.0f, 0.0f, 0.0f), FVector(0.0f, 1.0f, 0.0f), FVector(0.0f, 0.0f, 1.0f) };
+		for (const FVector& Edge : Edges)
+		{
+			for (const FVector& BoxAxis : BoxAxes)
+			{
+				const FVector Axis = Cross(BoxAxis, Edge);
+				const float Radius = InHalfSize.X * std::abs(Axis.X) + InHalfSize.Y * std::abs(Axis.Y) + InHalfSize.Z * std::abs(Axis.Z);
+				if (IsSeparated(Dot(Axis, V0), Dot(Axis, V1), Dot(Axis, V2), Radius)) { return false; }
+			}
+		}
+
+		return true;
+	}
+
+	struct FVoxelBox
+	{
+		uint32 Begin[3];
+		uint32 End[3]; // 포함하지 않는 끝
+
+		uint32 GetCellCount() const { return (End[0] - Begin[0]) * (End[1] - Begin[1]) * (End[2] - Begin[2]); }
+	};
+}
+
+void FOccluderProxy::Reset()
+{
+	Type = EOccluderProxyType::None;
+	Vertices.clear();
+	Indices.clear();
+}
+
+void FOccluderProxy::AddBox(const FVector& InMin, const FVector& InMax)
+{
+	const uint32 BaseIndex = static_cast<uint32>(Vertices.size());
+	for (int32 Half = 0; Half < 2; ++Half)
+	{
+		const float Z = Half == 0 ? InMin.Z : InMax.Z;
+		Vertices.emplace_back(InMin.X, InMin.Y, Z);
+		Vertices.emplace_back(InMax.X, InMin.Y, Z);
+		Vertices.emplace_back(InMax.X, InMax.Y, Z);
+		Vertices.emplace_back(InMin.X, InMax.Y, Z);
+	}
+
+	for (uint8 CornerIndex : BOX_TRIANGLE_INDICES)
+	{
+		Indices.push_back(BaseIndex + CornerIndex);
+	}
+}
+
+bool FOccluderProxyBuilder::Build(const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, FOccluderProxy& OutProxy)
+{
+	OutProxy.Reset();
+	if (InVertices.empty() || InIndices.size() < 3) { return false; }
+
+	FVector Min = InVertices[0].Position;
+	FVector Max = InVertices[0].Position;
+	for (const FNormalVertex& Vertex : InVertices)
+	{
+		Min.X = std::min(Min.X, Vertex.Position.X); Max.X = std::max(Max.X, Vertex.Position.X);
+		Min.Y = std::min(Min.Y, Vertex.Position.Y); Max.Y = std::max(Max.Y, Vertex.Position.Y);
+		Min.Z = std::min(Min.Z, Vertex.Position.Z); Max.Z = std::max(Max.Z, Vertex.Position.Z);
+	}
+
+	const FVector Extent = Max - Min;
+	if (Extent.X < MIN_AXIS_EXTENT || Extent.Y < MIN_AXIS_EXTENT || Extent.Z < MIN_AXIS_EXTENT) { return false; }
+
+	// 1. 구멍 없는 메시가 AABB를 가득 채운다면 AABB가 곧 메시다
+	const bool bIsClosed = IsClosedMesh(InVertices, InIndices);
+	if (bIsClosed)
+	{
+		const float BoxVolume = Extent.X * Extent.Y * Extent.Z;
+		if (std::abs(ComputeSignedVolume(InVertices, InIndices)) >= BoxVolume * BOX_MESH_VOLUME_RATIO)
+		{
+			OutProxy.Type = EOccluderProxyType::Box;
+			OutProxy.AddBox(Min, Max);
+			return true;
+		}
+	}
+
+	// 2. 복셀화로 내부 영역을 찾아 박스로 근사한다
+	BuildVoxelBoxes(InVertices, InIndices, Min, Max, OutProxy);
+	return OutProxy.IsValid();
+}
+
+bool FOccluderProxyBuilder::IsClosedMesh(const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices)
+{
+	// 노멀/UV 때문에 분리된 정점을 위치 기준으로 다시 합친다
+	TMap<FPositionKey, uint32, FPositionKeyHash> PositionIds;
+	TArray<uint32> WeldedIds(InVertices.size());
+	for (size_t Index = 0; Index < InVertices.size(); ++Index)
+	{
+		const FVector& Position = InVertices[Index].Position;
+		auto Result = PositionIds.emplace(FPositionKey{ Position.X, Position.Y, Position.Z }, static_cast<uint32>(PositionIds.size()));
+		WeldedIds[Index] = Result.first->second;
+	}
+
+	TMap<uint64, uint32> EdgeUseCounts;
+	for (size_t Index = 0; Index + 2 < InIndices.size(); Index += 3)
+	{
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			const uint32 A = WeldedIds[InIndices[Index + Corner]];
+			const uint32 B = WeldedIds[InIndices[Index + (Corner + 1) % 3]];
+			if (A == B) { continue; }
+
+			const uint64 EdgeKey = (static_cast<uint64>(std::min(A, B)) << 32) | std::max(A, B);
+			++EdgeUseCounts[EdgeKey];
+		}
+	}
+
+	for (const auto& [EdgeKey, UseCount] : EdgeUseCounts)
+	{
+		if (UseCount != 2) { return false; }
+	}
+	return !EdgeUseCounts.empty();
+}
+
+float FOccluderProxyBuilder::ComputeSignedVolume(const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices)
+{
+	// 원점과 각 삼각형이 이루는 사면체 부피의 합
+	float Volume = 0.0f;
+	for (size_t Index = 0; Index + 2 < InIndices.size(); Index += 3)
+	{
+		const FVector& A = InVertices[InIndices[Index]].Position;
+		const FVector& B = InVertices[InIndices[Index + 1]].Position;
+		const FVector& C = InVertices[InIndices[Index + 2]].Position;
+		Volume += Dot(A, Cross(B, C));
+	}
+	return Volume / 6.0f;
+}
+
+void FOccluderProxyBuilder::BuildVoxelBoxes(const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices,
+	const FVector& InMin, const FVector& InMax, FOccluderProxy& OutProxy)
+{
+	constexpr uint32 N = VOXEL_RESOLUTION;
+	// 바깥 테두리 한 칸을 덧댄 격자. Flood Fill이 테두리에서 시작해 메시를 둘러싼다
+	constexpr uint32 PaddedN = N + 2;
+	auto PaddedIndex = [](uint32 X, uint32 Y, uint32 Z) { return (Z * PaddedN + Y) * PaddedN + X; };
+
+	enum ECellState : uint8 { Unknown, Surface, Exterior };
+	TArray<uint8> Cells(PaddedN * PaddedN * PaddedN, Unknown);
+
+	const FVector CellSize((InMax.X - InMin.X) / N, (InMax.Y - InMin.Y) / N, (InMax.Z - InMin.Z) / N);
+	const FVector HalfCellSize = CellSize * (0.5f * SURFACE_CELL_INFLATION);
+
+	auto ToCell = [](float InValue, float InMin, float InCellSize)
+	{
+		const int32 Cell = static_cast<int32>(std::floor((InValue - InMin) / InCellSize));
+		return static_cast<uint32>(std::clamp(Cell, 0, static_cast<int32>(N) - 1));
+	};
+
+	// 1. 삼각형이 지나는 칸을 표면으로 표시한다
+	for (size_t Index = 0; Index + 2 < InIndices.size(); Index += 3)
+	{
+		const FVector& A = InVertices[InIndices[Index]].Position;
+		const FVector& B = InVertices[InIndices[Index + 1]].Position;
+		const FVector& C = InVertices[InIndices[Index + 2]].Position;
+
+		// 경계에 걸친 삼각형을 놓치지 않도록 삼각형 AABB를 칸 하나만큼 넓혀서 후보 범위를 잡는다
+		const uint32 BeginX = ToCell(std::min({ A.X, B.X, C.X }) - CellSize.X, InMin.X, CellSize.X);
+		const uint32 EndX = ToCell(std::max({ A.X, B.X, C.X }) + CellSize.X, InMin.X, CellSize.X);
+		const uint32 BeginY = ToCell(std::min({ A.Y, B.Y, C.Y }) - CellSize.Y, InMin.Y, CellSize.Y);
+		const uint32 EndY = ToCell(std::max({ A.Y, B.Y, C.Y }) + CellSize.Y, InMin.Y, CellSize.Y);
+		const uint32 BeginZ = ToCell(std::min({ A.Z, B.Z, C.Z }) - CellSize.Z, InMin.Z, CellSize.Z);
+		const uint32 EndZ = ToCell(std::max({ A.Z, B.Z, C.Z }) + CellSize.Z, InMin.Z, CellSize.Z);
+
+		for (uint32 Z = BeginZ; Z <= EndZ; ++Z)
+		{
+			for (uint32 Y = BeginY; Y <= EndY; ++Y)
+			{
+				for (uint32 X = BeginX; X <= EndX; ++X)
+				{
+					uint8& Cell = Cells[PaddedIndex(X + 1, Y + 1, Z + 1)];
+					if (Cell == Surface) { continue; }
+
+					const FVector Center(InMin.X + (X + 0.5f) * CellSize.X, InMin.Y + (Y + 0.5f) * CellSize.Y, InMin.Z + (Z + 0.5f) * CellSize.Z);
+					if (TriangleOverlapsBox(Center, HalfCellSize, A, B, C))
+					{
+						Cell = Surface;
+					}
+				}
+			}
+		}
+	}
+
+	// 2. 테두리 칸에서 시작해 표면을 넘지 않고 닿는 칸을 바깥으로 표시한다
+	TArray<uint32> Stack;
+	Stack.push_back(PaddedIndex(0, 0, 0));
+	Cells[Stack.back()] = Exterior;
+	while (!Stack.empty())
+	{
+		const uint32 CellIndex = Stack.back();
+		Stack.pop_back();
+
+		const uint32 X = CellIndex % PaddedN;
+		const uint32 Y = (CellIndex / PaddedN) % PaddedN;
+		const uint32 Z = CellIndex / (PaddedN * PaddedN);
+
+		auto Visit = [&Cells, &Stack](uint32 InNeighborIndex)
+		{
+			if (Cells[InNeighborIndex] == Unknown)
+			{
+				Cells[InNeighborIndex] = Exterior;
+				Stack.push_back(InNeighborIndex);
+			}
+		};
+		if (X > 0) { Visit(PaddedIndex(X - 1, Y, Z)); }
+		if (X + 1 < PaddedN) { Visit(PaddedIndex(X + 1, Y, Z)); }
+		if (Y > 0) { Visit(PaddedIndex(X, Y - 1, Z)); }
+		if (Y + 1 < PaddedN) { Visit(PaddedIndex(X, Y + 1, Z)); }
+		if (Z > 0) { Visit(PaddedIndex(X, Y, Z - 1)); }
+		if (Z + 1 < PaddedN) { Visit(PaddedIndex(X, Y, Z + 1)); }
+	}
+
+	// 3. 남은(Unknown) 칸이 내부(밖에서 닿지 않는 닫힌 빈 공간 포함. 밖에서는 보이지 않으므로 가려도 결과가 같다).
+	//    표면까지 가장 먼 칸에서 시작해 여섯 방향으로 한 칸씩 번갈아 늘리는 식으로, 큰 박스부터 하나씩 떼어낸다
+	auto IsFree = [&Cells](uint32 InPaddedIndex) { return Cells[InPaddedIndex] == Unknown; };
+	auto IsFreeRange = [&IsFree, &PaddedIndex](const uint32 InBegin[3], const uint32 InEnd[3])
+	{
+		for (uint32 Z = InBegin[2]; Z < InEnd[2]; ++Z)
+		{
+			for (uint32 Y = InBegin[1]; Y < InEnd[1]; ++Y)
+			{
+				for (uint32 X = InBegin[0]; X < InEnd[0]; ++X)
+				{
+					if (!IsFree(PaddedIndex(X, Y, Z))) { return false; }
+				}
+			}
+		}
+		return true;
+	};
+
+	const uint32 MinCellCount = std::max(1u, static_cast<uint32>(std::ceil(MIN_BOX_VOLUME_RATIO * N * N * N)));
+	TArray<uint32> Distances(Cells.size());
+	TArray<uint32> Queue;
+	for (uint32 BoxCount = 0; BoxCount < MAX_PROXY_BOX_COUNT; ++BoxCount)
+	{
+		// 3-1. 비어 있지 않은 칸으로부터의 체비셰프 거리(26방향 BFS). 가장 먼 칸이 가장 큰 박스를 품을 수 있는 시작점이다
+		Queue.clear();
+		for (uint32 CellIndex = 0; CellIndex < Cells.size(); ++CellIndex)
+		{
+			Distances[CellIndex] = IsFree(CellIndex) ? UINT32_MAX : 0;
+			if (!IsFree(CellIndex)) { Queue.push_back(CellIndex); }
+		}
+
+		uint32 SeedIndex = 0;
+		uint32 SeedDistance = 0;
+		for (size_t Head = 0; Head < Queue.size(); ++Head)
+		{
+			const uint32 CellIndex = Queue[Head];
+			const int32 X = CellIndex % PaddedN;
+			const int32 Y = (CellIndex / PaddedN) % PaddedN;
+			const int32 Z = CellIndex / (PaddedN * PaddedN);
+			for (int32 OffsetZ = -1; OffsetZ <= 1; ++OffsetZ)
+			{
+				for (int32 OffsetY = -1; OffsetY <= 1; ++OffsetY)
+				{
+					for (int32 OffsetX = -1; OffsetX <= 1; ++OffsetX)
+					{
+						const int32 NeighborX = X + OffsetX;
+						const int32 NeighborY = Y + OffsetY;
+						const int32 NeighborZ = Z + OffsetZ;
+						if (NeighborX < 0 || NeighborY < 0 || NeighborZ < 0 ||
+							NeighborX >= static_cast<int32>(PaddedN) || NeighborY >= static_cast<int32>(PaddedN) || NeighborZ >= static_cast<int32>(PaddedN))
+						{
+							continue;
+						}
+
+						const uint32 NeighborIndex = PaddedIndex(NeighborX, NeighborY, NeighborZ);
+						if (Distances[NeighborIndex] != UINT32_MAX) { continue; }
+
+						Distances[NeighborIndex] = Distances[CellIndex] + 1;
+						Queue.push_back(NeighborIndex);
+						if (Distances[NeighborIndex] > SeedDistance)
+						{
+							SeedDistance = Distances[NeighborIndex];
+							SeedIndex = NeighborIndex;
+						}
+					}
+				}
+			}
+		}
+		if (SeedDistance == 0) { break; }
+
+		// 3-2. 시작 칸에서 막힐 때까지 -X, +X, -Y, +Y, -Z, +Z 순서로 한 칸씩 늘린다
+		FVoxelBox Box;
+		Box.Begin[0] = SeedIndex % PaddedN;
+		Box.Begin[1] = (SeedIndex / PaddedN) % PaddedN;
+		Box.Begin[2] = SeedIndex / (PaddedN * PaddedN);
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			Box.End[Axis] = Box.Begin[Axis] + 1;
+		}
+
+		bool bIsGrowing = true;
+		while (bIsGrowing)
+		{
+			bIsGrowing = false;
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				for (int32 Side = 0; Side < 2; ++Side)
+				{
+					uint32 SliceBegin[3] = { Box.Begin[0], Box.Begin[1], Box.Begin[2] };
+					uint32 SliceEnd[3] = { Box.End[0], Box.End[1], Box.End[2] };
+					// 패딩 칸은 항상 바깥이므로 격자 밖으로 나가지 않는다
+					SliceBegin[Axis] = Side == 0 ? Box.Begin[Axis] - 1 : Box.End[Axis];
+					SliceEnd[Axis] = SliceBegin[Axis] + 1;
+					if (!IsFreeRange(SliceBegin, SliceEnd)) { continue; }
+
+					if (Side == 0) { --Box.Begin[Axis]; }
+					else { ++Box.End[Axis]; }
+					bIsGrowing = true;
+				}
+			}
+		}
+
+		if (Box.GetCellCount() < MinCellCount) { break; }
+
+		// 3-3. 떼어낸 칸은 표면으로 표시해 다른 박스에 다시 들어가지 않게 한다
+		for (uint32 Z = Box.Begin[2]; Z < Box.End[2]; ++Z)
+		{
+			for (uint32 Y = Box.Begin[1]; Y < Box.End[1]; ++Y)
+			{
+				for (uint32 X = Box.Begin[0]; X < Box.End[0]; ++X)
+				{
+					Cells[PaddedIndex(X, Y, Z)] = Surface;
+				}
+			}
+		}
+
+		// 패딩 좌표(1부터 시작)를 로컬 좌표로 바꾼다
+		const FVector BoxMin(InMin.X + (Box.Begin[0] - 1) * CellSize.X, InMin.Y + (Box.Begin[1] - 1) * CellSize.Y, InMin.Z + (Box.Begin[2] - 1) * CellSize.Z);
+		const FVector BoxMax(InMin.X + (Box.End[0] - 1) * CellSize.X, InMin.Y + (Box.End[1] - 1) * CellSize.Y, InMin.Z + (Box.End[2] - 1) * CellSize.Z);
+		OutProxy.AddBox(BoxMin, BoxMax);
+	}
+
+	if (!OutProxy.Indices.empty())
+	{
+		OutProxy.Type = EOccluderProxyType::Voxel;
+	}
+}
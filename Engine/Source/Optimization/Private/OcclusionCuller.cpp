@@ -1,416 +1,724 @@
 ﻿#include "pch.h"
 #include "Optimization/Public/OcclusionCuller.h"
 #include "Component/Public/PrimitiveComponent.h"
+#include "Component/Mesh/Public/StaticMeshComponent.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Optimization/Public/OccluderProxy.h"
+#include "Utility/Public/ParallelFor.h"
 
-#include "Level/Public/Level.h"
-#include "Global/Octree.h"
+#include <emmintrin.h>
+#include <limits>
+
+namespace
+{
+    constexpr uint32 FULL_ROW_MASK = 0xFFFFFFFFu;
+    /** @brief 이 값 이하의 clip W는 카메라 뒤(또는 카메라와 너무 가까운) 정점으로 본다. 근평면 판정은 NDC Z < 0으로 한다. */
+    constexpr float MIN_CLIP_W = 1e-4f;
+    /** @brief 이보다 작은 화면 면적(픽셀^2 * 2)의 삼각형은 버린다 */
+    constexpr float MIN_TRIANGLE_AREA = 1e-4f;
+    constexpr float POSITIVE_INFINITY = std::numeric_limits<float>::infinity();
+
+    /** @brief [InBegin, InEnd] 비트가 켜진 32비트 마스크 (0 <= InBegin <= InEnd <= 31) */
+    uint32 MakeSpanMask(int32 InBegin, int32 InEnd)
+    {
+        const uint32 UpperBits = (InEnd >= 31) ? FULL_ROW_MASK : ((1u << (InEnd + 1)) - 1u);
+        return UpperBits & (FULL_ROW_MASK << InBegin);
+    }
+
+    bool IsMaskZero(__m128i InMask0, __m128i InMask1)
+    {
+        const __m128i Combined = _mm_or_si128(InMask0, InMask1);
+        return _mm_movemask_epi8(_mm_cmpeq_epi32(Combined, _mm_setzero_si128())) == 0xFFFF;
+    }
+
+    bool IsMaskFull(__m128i InMask0, __m128i InMask1)
+    {
+        const __m128i Combined = _mm_and_si128(InMask0, InMask1);
+        return _mm_movemask_epi8(_mm_cmpeq_epi32(Combined, _mm_set1_epi32(-1))) == 0xFFFF;
+    }
+}
 
 COcclusionCuller::COcclusionCuller()
-{ 
-    CPU_ZBuffer.resize(Z_BUFFER_SIZE);
+{
+    Tiles.resize(TILE_COUNT_X * TILE_COUNT_Y);
 }
 
 void COcclusionCuller::InitializeCuller(const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix)
 {
-    fill(CPU_ZBuffer.begin(), CPU_ZBuffer.end(), 1.0f);
+    for (FOcclusionTile& Tile : Tiles)
+    {
+        std::fill(std::begin(Tile.Mask), std::end(Tile.Mask), 0u);
+        Tile.Z0 = 1.0f;
+        Tile.Z1 = 0.0f;
+    }
+
+    ClearTriangles();
+
     CurrentViewProj = ViewMatrix * ProjectionMatrix;
 }
 
-TArray<UPrimitiveComponent*> COcclusionCuller::PerformCulling(const TArray<UPrimitiveComponent*>& AllPrimitives, const FVector& CameraPos)
-{    
-    Frame++;
-    // 0. Primitive AABB 데이터 채우기
+void COcclusionCuller::ClearTriangles()
+{
+    Triangles.clear();
+    for (TArray<uint32>& Bin : BandBins)
+    {
+        Bin.clear();
+    }
+}
+
+void COcclusionCuller::SetTemporalReprojectionEnabled(bool bInEnabled)
+{
+    if (bTemporalReprojectionEnabled == bInEnabled) { return; }
+
+    bTemporalReprojectionEnabled = bInEnabled;
+    ResetTemporalHistory();
+}
+
+void COcclusionCuller::ResetTemporalHistory()
+{
+    bHasHistory = false;
+    FramesSinceRefresh = 0;
+    HistoryTileZ0.clear();
+    PreviousOccludees.clear();
+    PreviousVisibility.clear();
+}
+
+const TArray<UPrimitiveComponent*>& COcclusionCuller::PerformCulling(const TArray<UPrimitiveComponent*>& AllPrimitives, const FVector& CameraPos)
+{
+    Stats = {};
+    VisibleMeshComponents.clear();
+    ++FrameIndex;
+
+    // 0. Primitive AABB 데이터 채우기. 스태틱 메시가 아닌 프리미티브는 검사하지 않고 통과시킨다.
     CachedAABBs.clear();
-    for (int32 i = 0; i < AllPrimitives.size(); ++i)
+    for (UPrimitiveComponent* PrimitiveComp : AllPrimitives)
     {
-        UPrimitiveComponent* PrimitiveComp = AllPrimitives[i];
-        if (!PrimitiveComp) continue;
+        if (!PrimitiveComp) { continue; }
+
+        UStaticMeshComponent* StaticMeshComp = Cast<UStaticMeshComponent>(PrimitiveComp);
+        if (!StaticMeshComp)
+        {
+            VisibleMeshComponents.push_back(PrimitiveComp);
+            continue;
+        }
 
         FWorldAABBData Data;
         Data.Prim = PrimitiveComp;
         PrimitiveComp->GetWorldAABB(Data.Min, Data.Max);
         Data.Center = (Data.Min + Data.Max) * 0.5f;
+        Data.OccluderProxy = nullptr;
+        if (UStaticMesh* StaticMesh = StaticMeshComp->GetStaticMesh())
+        {
+            const FStaticMesh* StaticMeshAsset = StaticMesh->GetStaticMeshAsset();
+            if (StaticMeshAsset && StaticMeshAsset->OccluderProxy.IsValid())
+            {
+                Data.OccluderProxy = &StaticMeshAsset->OccluderProxy;
+            }
+        }
         CachedAABBs.push_back(Data);
+    }
 
-        // 인덱스를 컴포넌트에 직접 캐시
-        PrimitiveComp->CachedAABBIndex = i;
-        PrimitiveComp->CachedFrame = Frame;
+    // 1. 오클루더 선택 및 CPU 깊이 버퍼 구성. 재투영을 쓰는 프레임에는 재투영 깊이를 먼저 채우고 구멍에 걸친 오클루더만 그린다
+    const uint64 RasterizeStartCycles = FPlatformTime::Cycles64();
+
+    const bool bUseHistory = bTemporalReprojectionEnabled && bHasHistory && FramesSinceRefresh < TEMPORAL_REFRESH_INTERVAL;
+    if (bUseHistory)
+    {
+        ReprojectPreviousDepth();
     }
 
+    SelectOccluders(CameraPos);
+    for (uint32 OccluderIndex : OccluderIndices)
+    {
+        const FWorldAABBData& Data = CachedAABBs[OccluderIndex];
+        if (bUseHistory && IsCoveredByReprojection(Data.Min, Data.Max))
+        {
+            ++Stats.SkippedOccluderCount;
+            continue;
+        }
+        AddOccluderMesh(*Data.OccluderProxy, Data.Prim->GetWorldTransformMatrix());
+    }
+    RasterizeOccluders();
 
-    // 1. 오클루더 동적 선택
-    ULevel* CurrentLevel = GWorld->GetLevel();
-    TArray<UPrimitiveComponent*> OccluderCandidates = CurrentLevel->GetStaticOctree()->FindNearestPrimitives(CameraPos, AllPrimitives.size() / 10);
-    TArray<UPrimitiveComponent*> SelectedOccluders = SelectOccluders(OccluderCandidates, CameraPos);
+    const uint64 TestStartCycles = FPlatformTime::Cycles64();
 
-    // 2. CPU Z-Buffer 구성
-    RasterizeOccluders(SelectedOccluders, CameraPos);
+    // 2. 가시성 테스트. 묶음 단위로 워커에 나누고 결과는 인덱스별로 기록한다.
+    constexpr uint8 PENDING_TEST = 0xFF;
+    const uint32 OccludeeCount = static_cast<uint32>(CachedAABBs.size());
+    OccludeeVisibility.assign(OccludeeCount, PENDING_TEST);
 
-    // 3. 가시성 테스트
-    VisibleMeshComponents.clear();
-    for (auto& AABBData : CachedAABBs)
+    // 지난 프레임에 보였던 오클루디는 재검사 차례가 아니면 보이는 것으로 둔다
+    if (bUseHistory)
     {
-        if (IsMeshVisible(AABBData))
+        for (uint32 Index = 0; Index < OccludeeCount; ++Index)
         {
-            VisibleMeshComponents.push_back(AABBData.Prim);
+            if (Index >= PreviousOccludees.size() || PreviousOccludees[Index] != CachedAABBs[Index].Prim || !PreviousVisibility[Index])
+            {
+                continue;
+            }
+
+            const uint32 RetestPhase = static_cast<uint32>(reinterpret_cast<uintptr_t>(CachedAABBs[Index].Prim) >> 4);
+            if ((RetestPhase + FrameIndex) % TEMPORAL_RETEST_INTERVAL != 0)
+            {
+                OccludeeVisibility[Index] = 1;
+                ++Stats.LikelyVisibleCount;
+            }
         }
     }
 
+    const uint32 BatchCount = (OccludeeCount + OCCLUDEE_BATCH_SIZE - 1) / OCCLUDEE_BATCH_SIZE;
+    ParallelFor(BatchCount, [this, OccludeeCount](uint32 InBatchIndex)
+    {
+        const uint32 Begin = InBatchIndex * OCCLUDEE_BATCH_SIZE;
+        const uint32 End = std::min(Begin + OCCLUDEE_BATCH_SIZE, OccludeeCount);
+        for (uint32 Index = Begin; Index < End; ++Index)
+        {
+            if (OccludeeVisibility[Index] != PENDING_TEST) { continue; }
+            OccludeeVisibility[Index] = IsBoxVisible(CachedAABBs[Index].Min, CachedAABBs[Index].Max) ? 1 : 0;
+        }
+    });
+
+    for (uint32 Index = 0; Index < OccludeeCount; ++Index)
+    {
+        if (OccludeeVisibility[Index])
+        {
+            VisibleMeshComponents.push_back(CachedAABBs[Index].Prim);
+        }
+    }
+
+    const uint64 EndCycles = FPlatformTime::Cycles64();
+    Stats.OccluderCount = static_cast<uint32>(OccluderIndices.size());
+    Stats.TestedCount = OccludeeCount;
+    Stats.OccludedCount = OccludeeCount - static_cast<uint32>(std::count(OccludeeVisibility.begin(), OccludeeVisibility.end(), 1));
+    Stats.RasterizeMs = static_cast<float>(FPlatformTime::ToMilliseconds(TestStartCycles - RasterizeStartCycles));
+    Stats.TestMs = static_cast<float>(FPlatformTime::ToMilliseconds(EndCycles - TestStartCycles));
+
+    if (bTemporalReprojectionEnabled)
+    {
+        FramesSinceRefresh = bUseHistory ? FramesSinceRefresh + 1 : 0;
+        SaveTemporalHistory();
+    }
+
     return VisibleMeshComponents;
 }
 
-TArray<UPrimitiveComponent*> COcclusionCuller::SelectOccluders(const TArray<UPrimitiveComponent*>& Candidates, const FVector& CameraPos)
+void COcclusionCuller::ReprojectPreviousDepth()
 {
-    FilteredOccluders.clear();
+    const FMatrix InvHistoryViewProj = HistoryViewProj.Inverse();
 
-    for (UPrimitiveComponent* Occluder : Candidates)
+    for (int32 TileY = 0; TileY < TILE_COUNT_Y; ++TileY)
     {
-        if (Occluder->CachedFrame != Frame) { continue; }
-        FWorldAABBData& Data = CachedAABBs[Occluder->CachedAABBIndex];
-
-        float AABB_Diagonal_LengthSq = FVector::DistSquared(Data.Min, Data.Max);
-        float DistanceToOccluderSq = FVector::DistSquared(CameraPos, Data.Center);
+        for (int32 TileX = 0; TileX < TILE_COUNT_X; ++TileX)
+        {
+            const float TileZ0 = HistoryTileZ0[TileY * TILE_COUNT_X + TileX];
+            if (TileZ0 >= 1.0f) { continue; }
+
+            // 이전 화면의 타일 꼭짓점(0=좌상, 1=우상, 2=우하, 3=좌하)을 Z0 깊이에서 월드로 되돌린 뒤 현재 화면으로 투영한다
+            const float CornerX[4] = { 0.0f, 1.0f, 1.0f, 0.0f };
+            const float CornerY[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+            float X[4], Y[4], Z[4];
+            bool bIsValid = true;
+            for (int32 Corner = 0; Corner < 4 && bIsValid; ++Corner)
+            {
+                const float PixelX = static_cast<float>((TileX + CornerX[Corner]) * TILE_WIDTH);
+                const float PixelY = static_cast<float>((TileY + CornerY[Corner]) * TILE_HEIGHT);
+                const FVector4 NDCPos(PixelX / (Z_BUFFER_WIDTH * 0.5f) - 1.0f, 1.0f - PixelY / (Z_BUFFER_HEIGHT * 0.5f), TileZ0, 1.0f);
+                const FVector4 WorldPos = NDCPos * InvHistoryViewProj;
+                if (std::abs(WorldPos.W) <= MIN_CLIP_W) { bIsValid = false; break; }
+
+                const float InvW = 1.0f / WorldPos.W;
+                bIsValid = ProjectToScreen(CurrentViewProj, FVector(WorldPos.X * InvW, WorldPos.Y * InvW, WorldPos.Z * InvW), X[Corner], Y[Corner], Z[Corner]);
+            }
+            if (!bIsValid) { continue; }
+
+            // 이전 화면에서 반시계였던 사각형이 현재 화면에서 뒤집혀 보이면 감기 방향을 바꾼다
+            const float Area = (X[1] - X[0]) * (Y[2] - Y[0]) - (X[2] - X[0]) * (Y[1] - Y[0]);
+            const int32 I1 = Area >= 0.0f ? 1 : 3;
+            const int32 I3 = Area >= 0.0f ? 3 : 1;
+            AddScreenTriangle(X[0], Y[0], Z[0], X[I1], Y[I1], Z[I1], X[2], Y[2], Z[2]);
+            AddScreenTriangle(X[0], Y[0], Z[0], X[2], Y[2], Z[2], X[I3], Y[I3], Z[I3]);
+            ++Stats.ReprojectedTileCount;
+        }
+    }
 
-        if (DistanceToOccluderSq < AABB_Diagonal_LengthSq) { continue; }
+    RasterizeOccluders();
+    ClearTriangles();
 
-        FilteredOccluders.push_back(Occluder);
+    ReprojectedTiles.resize(Tiles.size());
+    for (size_t TileIndex = 0; TileIndex < Tiles.size(); ++TileIndex)
+    {
+        ReprojectedTiles[TileIndex] = Tiles[TileIndex].Z0 < 1.0f ? 1 : 0;
     }
-    return FilteredOccluders;
 }
 
-void COcclusionCuller::RasterizeOccluders(const TArray<UPrimitiveComponent*>& SelectedOccluders, const FVector& CameraPos)
+bool COcclusionCuller::IsCoveredByReprojection(const FVector& InMin, const FVector& InMax) const
 {
-    for (UPrimitiveComponent* OccluderComp : SelectedOccluders)
+    alignas(16) float X[8];
+    alignas(16) float Y[8];
+    alignas(16) float Z[8];
+    if (!ProjectBoxCorners(InMin, InMax, X, Y, Z)) { return false; }
+
+    const float MinX = *std::min_element(X, X + 8);
+    const float MaxX = *std::max_element(X, X + 8);
+    const float MinY = *std::min_element(Y, Y + 8);
+    const float MaxY = *std::max_element(Y, Y + 8);
+    if (MaxX < 0.0f || MinX >= Z_BUFFER_WIDTH || MaxY < 0.0f || MinY >= Z_BUFFER_HEIGHT) { return true; }
+
+    const int32 TileXBegin = std::max(0, static_cast<int32>(std::floor(MinX))) / TILE_WIDTH;
+    const int32 TileXEnd = std::min(Z_BUFFER_WIDTH - 1, static_cast<int32>(std::floor(MaxX))) / TILE_WIDTH;
+    const int32 TileYBegin = std::max(0, static_cast<int32>(std::floor(MinY))) / TILE_HEIGHT;
+    const int32 TileYEnd = std::min(Z_BUFFER_HEIGHT - 1, static_cast<int32>(std::floor(MaxY))) / TILE_HEIGHT;
+    for (int32 TileY = TileYBegin; TileY <= TileYEnd; ++TileY)
     {
-        if (OccluderComp->CachedFrame != Frame) { continue; }
-        // 1. AABB를 12개 삼각형의 월드 정점 리스트로 변환
-        TArray<FVector> BoxTriangles = ConvertAABBToTriangles(OccluderComp);
-
-        // 2. CPU 래스터라이징
-        for (uint32 Idx = 0; Idx < BoxTriangles.size(); Idx += 3)
+        for (int32 TileX = TileXBegin; TileX <= TileXEnd; ++TileX)
         {
-            // 삼각형의 세 정점 (월드 좌표)
-            const FVector& P1_World = BoxTriangles[Idx];
-            const FVector& P2_World = BoxTriangles[Idx + 1];
-            const FVector& P3_World = BoxTriangles[Idx + 2];
-
-            // 정점을 화면 좌표로 투영
-            FVector P1_Screen = Project(P1_World);
-            FVector P2_Screen = Project(P2_World);
-            FVector P3_Screen = Project(P3_World);
-
-            // Backface Culling
-            FVector2 V1(P2_Screen.X - P1_Screen.X, P2_Screen.Y - P1_Screen.Y);
-            FVector2 V2(P3_Screen.X - P1_Screen.X, P3_Screen.Y - P1_Screen.Y);
-
-            // 2D 외적 (Z 성분만)
-            float CrossZ = V1.X * V2.Y - V1.Y * V2.X;
-            if (CrossZ < 0.0f) { continue; }
-
-            // Z-Buffer에 깊이 쓰기
-            RasterizeTriangle(P1_Screen, P2_Screen, P3_Screen, CPU_ZBuffer);
+            if (!ReprojectedTiles[TileY * TILE_COUNT_X + TileX]) { return false; }
         }
     }
+    return true;
 }
 
-FVector COcclusionCuller::Project(const FVector& WorldPos) const
+void COcclusionCuller::SaveTemporalHistory()
 {
-    FVector4 WorldPos4(WorldPos.X, WorldPos.Y, WorldPos.Z, 1.0f);
-    FVector4 ClipPos = WorldPos4 * CurrentViewProj;
-
-    if (ClipPos.W != 0.0f)
+    HistoryViewProj = CurrentViewProj;
+    HistoryTileZ0.resize(Tiles.size());
+    for (size_t TileIndex = 0; TileIndex < Tiles.size(); ++TileIndex)
     {
-        ClipPos.X /= ClipPos.W;
-        ClipPos.Y /= ClipPos.W;
-        ClipPos.Z /= ClipPos.W;
+        HistoryTileZ0[TileIndex] = Tiles[TileIndex].Z0;
     }
 
-    // NDC to Screen
-    float ScreenX = (ClipPos.X + 1.0f) * 0.5f * Z_BUFFER_WIDTH;
-    float ScreenY = (1.0f - ClipPos.Y) * 0.5f * Z_BUFFER_HEIGHT;
-    float ScreenZ = ClipPos.Z;
-
-    return FVector(ScreenX, ScreenY, ScreenZ);
+    PreviousOccludees.resize(CachedAABBs.size());
+    for (size_t Index = 0; Index < CachedAABBs.size(); ++Index)
+    {
+        PreviousOccludees[Index] = CachedAABBs[Index].Prim;
+    }
+    PreviousVisibility = OccludeeVisibility;
+    bHasHistory = true;
 }
 
-bool COcclusionCuller::IsMeshVisible(const FWorldAABBData& AABBData)
+void COcclusionCuller::SelectOccluders(const FVector& CameraPos)
 {
-    const FVector& WorldMin = AABBData.Min;
-    const FVector& WorldMax = AABBData.Max;
-    const FVector& WorldCenter = AABBData.Center;
-
-    constexpr int32 NumSamples = 19;
-    FVector OriginalSamplesArray[NumSamples];
-    int32 Index = 0; // 배열 인덱스 카운터
-
-    // 1개 중심점
-    OriginalSamplesArray[Index++] = WorldCenter;
-
-    // 6개 면 중심
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldMin.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldMax.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMin.X, WorldCenter.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMax.X, WorldCenter.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldCenter.Y, WorldMin.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldCenter.Y, WorldMax.Z);
-
-    // 12개 엣지 중심
-    // X 엣지 (4개)
-    OriginalSamplesArray[Index++] = FVector(WorldMin.X, WorldCenter.Y, WorldMin.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMax.X, WorldCenter.Y, WorldMin.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMin.X, WorldCenter.Y, WorldMax.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMax.X, WorldCenter.Y, WorldMax.Z);
-
-    // Y 엣지 (4개)
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldMin.Y, WorldMin.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldMax.Y, WorldMin.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldMin.Y, WorldMax.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldMax.Y, WorldMax.Z);
-
-    // Z 엣지 (4개)
-    OriginalSamplesArray[Index++] = FVector(WorldMin.X, WorldMin.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMax.X, WorldMin.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMin.X, WorldMax.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMax.X, WorldMax.Y, WorldCenter.Z);
-
-    // SIMD 배치 처리를 위해 20개로 패딩
-    const int32 BatchCount = (NumSamples + 3) / 4;
-
-    for (int32 i = 0; i < 19; ++i)
-    {
-        SampleCoords[0][i] = OriginalSamplesArray[i].X;  // X
-        SampleCoords[1][i] = OriginalSamplesArray[i].Y;  // Y
-        SampleCoords[2][i] = OriginalSamplesArray[i].Z;  // Z
+    OccluderIndices.clear();
+
+    TArray<TPair<float, uint32>> Candidates;
+    Candidates.reserve(CachedAABBs.size());
+    for (uint32 Index = 0; Index < CachedAABBs.size(); ++Index)
+    {
+        const FWorldAABBData& Data = CachedAABBs[Index];
+        if (!Data.OccluderProxy) { continue; }
+
+        const float DiagonalLengthSq = FVector::DistSquared(Data.Min, Data.Max);
+        const float DistanceToOccluderSq = FVector::DistSquared(CameraPos, Data.Center);
+
+        if (DistanceToOccluderSq < DiagonalLengthSq) { continue; }
+
+        Candidates.emplace_back(DiagonalLengthSq / DistanceToOccluderSq, Index);
     }
 
-    // 패딩
-    for (int32 i = 19; i < 20; ++i)
+    if (Candidates.size() > MAX_OCCLUDER_COUNT)
     {
-        SampleCoords[0][i] = 1e30f;
-        SampleCoords[1][i] = 1e30f;
-        SampleCoords[2][i] = 1e30f;
+        std::nth_element(Candidates.begin(), Candidates.begin() + MAX_OCCLUDER_COUNT, Candidates.end(),
+            [](const TPair<float, uint32>& A, const TPair<float, uint32>& B) { return A.first > B.first; });
+        Candidates.resize(MAX_OCCLUDER_COUNT);
     }
 
-    constexpr float Z_TOLERANCE = 0.001f;
-    for (int32 BatchIdx = 0; BatchIdx < BatchCount; ++BatchIdx)
+    for (const TPair<float, uint32>& Candidate : Candidates)
     {
-        BatchProjectionInput Input;
-        Input.WorldX = _mm_load_ps(&SampleCoords[0][BatchIdx * 4]);
-        Input.WorldY = _mm_load_ps(&SampleCoords[1][BatchIdx * 4]);
-        Input.WorldZ = _mm_load_ps(&SampleCoords[2][BatchIdx * 4]);
+        OccluderIndices.push_back(Candidate.second);
+    }
+}
 
-        BatchProjectionResult ProjectionResult = BatchProject4(Input);
+void COcclusionCuller::AddOccluderTriangles(const FVector* InVertices, uint32 InVertexCount)
+{
+    for (uint32 Index = 0; Index + 2 < InVertexCount; Index += 3)
+    {
+        float X[3], Y[3], Z[3];
+        if (!Project(InVertices[Index], X[0], Y[0], Z[0]) ||
+            !Project(InVertices[Index + 1], X[1], Y[1], Z[1]) ||
+            !Project(InVertices[Index + 2], X[2], Y[2], Z[2]))
+        {
+            continue;
+        }
 
-        // 멤버 배열에 저장
-        _mm_store_si128((__m128i*)TempPixelCoords[0], ProjectionResult.PixelX);
-        _mm_store_si128((__m128i*)TempPixelCoords[1], ProjectionResult.PixelY);
-        _mm_store_ps(TempScreenZ, ProjectionResult.ScreenZ);
+        AddScreenTriangle(X[0], Y[0], Z[0], X[1], Y[1], Z[1], X[2], Y[2], Z[2]);
+    }
+}
 
-        for (int32 i = 0; i < 4; ++i)
-        {
-            int32 SampleIdx = BatchIdx * 4 + i;
-            if (SampleIdx >= 19) break;
+void COcclusionCuller::AddOccluderBox(const FVector& InMin, const FVector& InMax)
+{
+    alignas(16) float X[8];
+    alignas(16) float Y[8];
+    alignas(16) float Z[8];
+    if (!ProjectBoxCorners(InMin, InMax, X, Y, Z)) { return; }
 
-            int32 X = TempPixelCoords[0][i];  // PixelX
-            int32 Y = TempPixelCoords[1][i];  // PixelY
+    for (uint32 Index = 0; Index < 36; Index += 3)
+    {
+        const uint8 I0 = FOccluderProxy::BOX_TRIANGLE_INDICES[Index];
+        const uint8 I1 = FOccluderProxy::BOX_TRIANGLE_INDICES[Index + 1];
+        const uint8 I2 = FOccluderProxy::BOX_TRIANGLE_INDICES[Index + 2];
+        AddScreenTriangle(X[I0], Y[I0], Z[I0], X[I1], Y[I1], Z[I1], X[I2], Y[I2], Z[I2]);
+    }
+}
 
-            if (X >= 0 && X < Z_BUFFER_WIDTH && Y >= 0 && Y < Z_BUFFER_HEIGHT)
-            {
-                int32 Index = Y * Z_BUFFER_WIDTH + X;
-                if (TempScreenZ[i] < CPU_ZBuffer[Index] + Z_TOLERANCE)
-                {
-                    return true;
-                }
-            }
-        }
+void COcclusionCuller::AddOccluderMesh(const FOccluderProxy& InProxy, const FMatrix& InLocalToWorld)
+{
+    const FMatrix LocalToClip = InLocalToWorld * CurrentViewProj;
+
+    // 프록시 정점은 여러 삼각형이 공유하므로 한 번씩만 투영한다
+    const size_t VertexCount = InProxy.Vertices.size();
+    ProjectedX.resize(VertexCount);
+    ProjectedY.resize(VertexCount);
+    ProjectedZ.resize(VertexCount);
+    ProjectedValid.resize(VertexCount);
+    for (size_t Index = 0; Index < VertexCount; ++Index)
+    {
+        ProjectedValid[Index] = ProjectToScreen(LocalToClip, InProxy.Vertices[Index], ProjectedX[Index], ProjectedY[Index], ProjectedZ[Index]) ? 1 : 0;
+    }
+
+    // 변환의 3x3 행렬식이 음수(홀수 개 축의 음수 스케일)라면 화면에서 감기 방향이 뒤집힌다
+    const FMatrix& M = InLocalToWorld;
+    const float Determinant =
+        M.Data[0][0] * (M.Data[1][1] * M.Data[2][2] - M.Data[1][2] * M.Data[2][1]) -
+        M.Data[0][1] * (M.Data[1][0] * M.Data[2][2] - M.Data[1][2] * M.Data[2][0]) +
+        M.Data[0][2] * (M.Data[1][0] * M.Data[2][1] - M.Data[1][1] * M.Data[2][0]);
+    const bool bFlipWinding = Determinant < 0.0f;
+
+    const TArray<uint32>& Indices = InProxy.Indices;
+    for (size_t Index = 0; Index + 2 < Indices.size(); Index += 3)
+    {
+        const uint32 I0 = Indices[Index];
+        const uint32 I1 = bFlipWinding ? Indices[Index + 2] : Indices[Index + 1];
+        const uint32 I2 = bFlipWinding ? Indices[Index + 1] : Indices[Index + 2];
+        if (!ProjectedValid[I0] || !ProjectedValid[I1] || !ProjectedValid[I2]) { continue; }
+
+        AddScreenTriangle(ProjectedX[I0], ProjectedY[I0], ProjectedZ[I0],
+            ProjectedX[I1], ProjectedY[I1], ProjectedZ[I1],
+            ProjectedX[I2], ProjectedY[I2], ProjectedZ[I2]);
     }
-    return false;
 }
 
-BatchProjectionResult COcclusionCuller::BatchProject4(const BatchProjectionInput& Input) const
-{    
-    // 1. 4개 월드 좌표를 동질 좌표로 변환 (W = 1.0f)
-    __m128 Ones = _mm_set1_ps(1.0f);
-
-    // 2. ViewProjection 행렬 접근
-    const float* MatrixData = (const float*)&CurrentViewProj;
-
-    __m128 Row0 = _mm_load_ps(&MatrixData[0]);
-    __m128 Row1 = _mm_load_ps(&MatrixData[4]);
-    __m128 Row2 = _mm_load_ps(&MatrixData[8]);
-    __m128 Row3 = _mm_load_ps(&MatrixData[12]);
-
-    __m128 ClipX = _mm_add_ps(_mm_add_ps(_mm_add_ps(
-        _mm_mul_ps(Input.WorldX, _mm_shuffle_ps(Row0, Row0, 0x00)),
-        _mm_mul_ps(Input.WorldY, _mm_shuffle_ps(Row1, Row1, 0x00))),
-        _mm_mul_ps(Input.WorldZ, _mm_shuffle_ps(Row2, Row2, 0x00))),
-        _mm_mul_ps(Ones, _mm_shuffle_ps(Row3, Row3, 0x00)));
-
-    __m128 ClipY = _mm_add_ps(_mm_add_ps(_mm_add_ps(
-        _mm_mul_ps(Input.WorldX, _mm_shuffle_ps(Row0, Row0, 0x55)),
-        _mm_mul_ps(Input.WorldY, _mm_shuffle_ps(Row1, Row1, 0x55))),
-        _mm_mul_ps(Input.WorldZ, _mm_shuffle_ps(Row2, Row2, 0x55))),
-        _mm_mul_ps(Ones, _mm_shuffle_ps(Row3, Row3, 0x55)));
-
-    __m128 ClipZ = _mm_add_ps(_mm_add_ps(_mm_add_ps(
-        _mm_mul_ps(Input.WorldX, _mm_shuffle_ps(Row0, Row0, 0xAA)),
-        _mm_mul_ps(Input.WorldY, _mm_shuffle_ps(Row1, Row1, 0xAA))),
-        _mm_mul_ps(Input.WorldZ, _mm_shuffle_ps(Row2, Row2, 0xAA))),
-        _mm_mul_ps(Ones, _mm_shuffle_ps(Row3, Row3, 0xAA)));
-
-    __m128 ClipW = _mm_add_ps(_mm_add_ps(_mm_add_ps(
-        _mm_mul_ps(Input.WorldX, _mm_shuffle_ps(Row0, Row0, 0xFF)),
-        _mm_mul_ps(Input.WorldY, _mm_shuffle_ps(Row1, Row1, 0xFF))),
-        _mm_mul_ps(Input.WorldZ, _mm_shuffle_ps(Row2, Row2, 0xFF))),
-        _mm_mul_ps(Ones, _mm_shuffle_ps(Row3, Row3, 0xFF)));
-
-    // -----------------------------------------------------------
-    // 3. Perspective divide 안전성 체크 및 수행
-    // -----------------------------------------------------------
-
-    // 3-1. W > 0 (프러스텀 앞)인 항목만 유효하게 만듦
-    __m128 W_is_positive = _mm_cmpgt_ps(ClipW, _mm_set1_ps(1e-6f)); // W > 0.000001f
-
-    // 3-2. 역수 (InvW) 계산
-    __m128 SafeW = _mm_or_ps(ClipW, _mm_andnot_ps(W_is_positive, Ones));
-    // W > 0이면 ClipW, 아니면 1.0f (0으로 나누는 것을 방지)
-
-    __m128 InvW = _mm_div_ps(Ones, SafeW);
-
-    // 3-3. W <= 0 (Near Plane 뒤)인 항목은 InvW를 0으로 마스킹
-    InvW = _mm_and_ps(InvW, W_is_positive);
-
-    // 역투영
-    ClipX = _mm_mul_ps(ClipX, InvW);
-    ClipY = _mm_mul_ps(ClipY, InvW);
-    ClipZ = _mm_mul_ps(ClipZ, InvW);
-    // W <= 0인 좌표는 ClipX/Y/Z = 0이 되므로, NDC 밖(-1 또는 1)으로 튀어나가지 않음
-
-    // -----------------------------------------------------------
-    // 4. NDC to Screen coordinates (4개 동시)
-    // -----------------------------------------------------------
-    __m128 HalfWidth = _mm_set1_ps(Z_BUFFER_WIDTH * 0.5f);
-    __m128 HalfHeight = _mm_set1_ps(Z_BUFFER_HEIGHT * 0.5f);
-
-    BatchProjectionResult Result;
-    // X: (ClipX + 1.0) * 0.5 * Width
-    Result.ScreenX = _mm_mul_ps(_mm_add_ps(ClipX, Ones), HalfWidth);
-    // Y: (1.0 - ClipY) * 0.5 * Height
-    Result.ScreenY = _mm_mul_ps(_mm_sub_ps(Ones, ClipY), HalfHeight);
-    Result.ScreenZ = ClipZ; // ScreenZ (NDC Z)
-
-    // 5. 정수형 픽셀 좌표로 변환
-    // _mm_cvtps_epi32는 기본적으로 TRUNCATE (버림)을 수행
-    Result.PixelX = _mm_cvtps_epi32(Result.ScreenX);
-    Result.PixelY = _mm_cvtps_epi32(Result.ScreenY);
-
-    return Result;
+void COcclusionCuller::AddScreenTriangle(float X0, float Y0, float Z0, float X1, float Y1, float Z1, float X2, float Y2, float Z2)
+{
+    // Backface Culling: 화면 기준(Y 아래 방향) 부호 있는 면적이 양수인 면이 앞면
+    const float Area = (X1 - X0) * (Y2 - Y0) - (X2 - X0) * (Y1 - Y0);
+    if (Area < MIN_TRIANGLE_AREA) { return; }
+
+    const float MinY = std::min({ Y0, Y1, Y2 });
+    const float MaxY = std::max({ Y0, Y1, Y2 });
+    const float MinX = std::min({ X0, X1, X2 });
+    const float MaxX = std::max({ X0, X1, X2 });
+    if (MaxX < 0.0f || MinX > Z_BUFFER_WIDTH || MaxY < 0.0f || MinY > Z_BUFFER_HEIGHT) { return; }
+
+    // 중심이 삼각형 범위에 들어올 수 있는 픽셀 행으로 밴드 범위를 구한다
+    constexpr int32 BandPixelHeight = TILE_ROWS_PER_BAND * TILE_HEIGHT;
+    const int32 RowBegin = std::max(0, static_cast<int32>(std::ceil(MinY - 0.5f)));
+    const int32 RowEnd = std::min(Z_BUFFER_HEIGHT - 1, static_cast<int32>(std::floor(MaxY - 0.5f)));
+    if (RowBegin > RowEnd) { return; }
+
+    const uint32 TriangleIndex = static_cast<uint32>(Triangles.size());
+    Triangles.push_back({ { X0, X1, X2 }, { Y0, Y1, Y2 }, { Z0, Z1, Z2 } });
+
+    for (int32 Band = RowBegin / BandPixelHeight; Band <= RowEnd / BandPixelHeight; ++Band)
+    {
+        BandBins[Band].push_back(TriangleIndex);
+    }
 }
 
-void COcclusionCuller::RasterizeTriangle(const FVector& P1, const FVector& P2, const FVector& P3, TArray<float>& ZBuffer)
-{        
-    // 1. 바운딩 박스 계산
-    int32 MinX = max(0, (int32)min({ P1.X, P2.X, P3.X }));
-    int32 MaxX = min(Z_BUFFER_WIDTH - 1, (int32)max({ P1.X, P2.X, P3.X }));
-    int32 MinY = max(0, (int32)min({ P1.Y, P2.Y, P3.Y }));
-    int32 MaxY = min(Z_BUFFER_HEIGHT - 1, (int32)max({ P1.Y, P2.Y, P3.Y }));
+void COcclusionCuller::RasterizeOccluders()
+{
+    // 밴드는 서로 다른 타일 행을 담당하므로 잠금 없이 병렬로 기록할 수 있다
+    ParallelFor(BAND_COUNT, [this](uint32 InBand)
+    {
+        for (uint32 TriangleIndex : BandBins[InBand])
+        {
+            RasterizeTriangleInBand(Triangles[TriangleIndex], static_cast<int32>(InBand));
+        }
+    });
 
-    // 3. 삼각형 면적 계산 (degenerate triangle 체크용)
-    float Area = 0.5f * abs((P2.X - P1.X) * (P3.Y - P1.Y) - (P3.X - P1.X) * (P2.Y - P1.Y));
-    if (Area < 0.001f) { return; }
+    Stats.RasterizedTriangleCount += static_cast<uint32>(Triangles.size());
+}
+
+void COcclusionCuller::RasterizeTriangleInBand(const FOcclusionTriangle& InTriangle, int32 InBand)
+{
+    const float* X = InTriangle.X;
+    const float* Y = InTriangle.Y;
+    const float* Z = InTriangle.Z;
+
+    const float MinX = std::min({ X[0], X[1], X[2] });
+    const float MaxX = std::max({ X[0], X[1], X[2] });
+    const float MinY = std::min({ Y[0], Y[1], Y[2] });
+    const float MaxY = std::max({ Y[0], Y[1], Y[2] });
+    const float MaxZ = std::max({ Z[0], Z[1], Z[2] });
+
+    constexpr int32 BandPixelHeight = TILE_ROWS_PER_BAND * TILE_HEIGHT;
+    const int32 RowBegin = std::max(InBand * BandPixelHeight, static_cast<int32>(std::ceil(MinY - 0.5f)));
+    const int32 RowEnd = std::min((InBand + 1) * BandPixelHeight - 1, static_cast<int32>(std::floor(MaxY - 0.5f)));
+    if (RowBegin > RowEnd) { return; }
+
+    // 1. 변 방정식 E(x, y) = A * x + B * y + C >= 0 이 삼각형 안쪽 (반시계 정렬 기준)
+    float EdgeA[3], EdgeB[3], EdgeC[3];
+    for (int32 Edge = 0; Edge < 3; ++Edge)
+    {
+        const int32 Next = (Edge + 1) % 3;
+        const float DeltaX = X[Next] - X[Edge];
+        const float DeltaY = Y[Next] - Y[Edge];
+        EdgeA[Edge] = -DeltaY;
+        EdgeB[Edge] = DeltaX;
+        EdgeC[Edge] = DeltaY * X[Edge] - DeltaX * Y[Edge];
+    }
 
-    // 4. Barycentric 좌표 계산을 위한 분모 미리 계산 (최적화)
-    float Denom1 = (P2.X - P3.X) * (P1.Y - P3.Y) - (P2.Y - P3.Y) * (P1.X - P3.X);
-    float Denom2 = (P3.X - P1.X) * (P2.Y - P1.Y) - (P3.Y - P1.Y) * (P2.X - P1.X);
+    // 2. 깊이 평면 z = Z[0] + DzDx * (x - X[0]) + DzDy * (y - Y[0]) (NDC Z는 화면 공간에서 선형)
+    const float Area = (X[1] - X[0]) * (Y[2] - Y[0]) - (X[2] - X[0]) * (Y[1] - Y[0]);
+    const float InvArea = 1.0f / Area;
+    const float DzDx = ((Z[1] - Z[0]) * (Y[2] - Y[0]) - (Z[2] - Z[0]) * (Y[1] - Y[0])) * InvArea;
+    const float DzDy = ((Z[2] - Z[0]) * (X[1] - X[0]) - (Z[1] - Z[0]) * (X[2] - X[0])) * InvArea;
 
-    // 5. 분모가 0에 가까우면 degenerate triangle
-    if (abs(Denom1) < 0.0001f || abs(Denom2) < 0.0001f) { return; }
+    const __m128 MinXVector = _mm_set1_ps(MinX);
+    const __m128 MaxXVector = _mm_set1_ps(MaxX);
+    const __m128 RowOffsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
 
-    // 6. 역수 미리 계산
-    float InvDenom1 = 1.0f / Denom1;
-    float InvDenom2 = 1.0f / Denom2;
+    alignas(16) float LowerBounds[TILE_HEIGHT];
+    alignas(16) float UpperBounds[TILE_HEIGHT];
+    int32 ColumnBegins[TILE_HEIGHT];
+    int32 ColumnEnds[TILE_HEIGHT];
 
-    // 7. 바운딩 박스 내의 모든 픽셀에 대해 검사
-    for (int32 Y = MinY; Y <= MaxY; ++Y)
+    for (int32 TileY = RowBegin / TILE_HEIGHT; TileY <= RowEnd / TILE_HEIGHT; ++TileY)
     {
-        for (int32 X = MinX; X <= MaxX; ++X)
-        {
-            // 픽셀 중심점
-            float PixelX = X + 0.5f;
-            float PixelY = Y + 0.5f;
+        const int32 TilePixelY = TileY * TILE_HEIGHT;
 
-            // Barycentric coordinates 계산 (최적화된 버전)
-            float W1 = ((P2.X - P3.X) * (PixelY - P3.Y) - (P2.Y - P3.Y) * (PixelX - P3.X)) * InvDenom1;
-            float W2 = ((P3.X - P1.X) * (PixelY - P1.Y) - (P3.Y - P1.Y) * (PixelX - P1.X)) * InvDenom2;
-            float W3 = 1.0f - W1 - W2;
+        // 3. 타일의 8개 행에 대해 각 변이 허용하는 픽셀 중심 x 범위를 SSE로 4행씩 계산한다
+        for (int32 Group = 0; Group < TILE_HEIGHT; Group += 4)
+        {
+            const __m128 PixelY = _mm_add_ps(_mm_set1_ps(static_cast<float>(TilePixelY + Group)), RowOffsets);
+            __m128 Lower = MinXVector;
+            __m128 Upper = MaxXVector;
 
-            const float EPSILON = -0.0001f; // 경계 케이스 처리
-            if (W1 >= EPSILON && W2 >= EPSILON && W3 >= EPSILON)
+            for (int32 Edge = 0; Edge < 3; ++Edge)
             {
-                // 깊이값 보간
-                float InterpolatedZ = W1 * P1.Z + W2 * P2.Z + W3 * P3.Z;
-
-                int32 Index = Y * Z_BUFFER_WIDTH + X;
-
-                // 깊이 테스트 및 업데이트
-                if (InterpolatedZ < ZBuffer[Index])
+                // A * x + (B * y + C) >= 0
+                const __m128 RowTerm = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(EdgeB[Edge]), PixelY), _mm_set1_ps(EdgeC[Edge]));
+                if (EdgeA[Edge] > 0.0f)
                 {
-                    ZBuffer[Index] = InterpolatedZ;
+                    Lower = _mm_max_ps(Lower, _mm_div_ps(_mm_sub_ps(_mm_setzero_ps(), RowTerm), _mm_set1_ps(EdgeA[Edge])));
+                }
+                else if (EdgeA[Edge] < 0.0f)
+                {
+                    Upper = _mm_min_ps(Upper, _mm_div_ps(_mm_sub_ps(_mm_setzero_ps(), RowTerm), _mm_set1_ps(EdgeA[Edge])));
+                }
+                else
+                {
+                    // 수평 변: 행 전체가 안쪽이거나 바깥쪽이다
+                    const __m128 Outside = _mm_cmplt_ps(RowTerm, _mm_setzero_ps());
+                    Lower = _mm_or_ps(_mm_andnot_ps(Outside, Lower), _mm_and_ps(Outside, _mm_set1_ps(POSITIVE_INFINITY)));
                 }
             }
+
+            _mm_store_ps(LowerBounds + Group, Lower);
+            _mm_store_ps(UpperBounds + Group, Upper);
+        }
+
+        // 4. 픽셀 열 범위로 변환 (픽셀 중심 c + 0.5가 [Lower, Upper] 안에 있어야 한다)
+        int32 TileColumnBegin = TILE_COUNT_X;
+        int32 TileColumnEnd = -1;
+        for (int32 Row = 0; Row < TILE_HEIGHT; ++Row)
+        {
+            const int32 PixelY = TilePixelY + Row;
+            ColumnBegins[Row] = 0;
+            ColumnEnds[Row] = -1;
+            if (PixelY < RowBegin || PixelY > RowEnd || !(LowerBounds[Row] <= UpperBounds[Row])) { continue; }
+
+            const int32 Begin = std::max(0, static_cast<int32>(std::ceil(std::max(LowerBounds[Row], -1.0f) - 0.5f)));
+            const int32 End = std::min(Z_BUFFER_WIDTH - 1, static_cast<int32>(std::floor(std::min(UpperBounds[Row], Z_BUFFER_WIDTH + 1.0f) - 0.5f)));
+            if (Begin > End) { continue; }
+
+            ColumnBegins[Row] = Begin;
+            ColumnEnds[Row] = End;
+            TileColumnBegin = std::min(TileColumnBegin, Begin / TILE_WIDTH);
+            TileColumnEnd = std::max(TileColumnEnd, End / TILE_WIDTH);
+        }
+
+        // 5. 타일마다 커버리지 마스크와 보수적 최대 깊이를 만들어 병합한다
+        for (int32 TileX = TileColumnBegin; TileX <= TileColumnEnd; ++TileX)
+        {
+            const int32 TilePixelX = TileX * TILE_WIDTH;
+
+            alignas(16) uint32 Coverage[TILE_HEIGHT];
+            uint32 AnyCoverage = 0;
+            for (int32 Row = 0; Row < TILE_HEIGHT; ++Row)
+            {
+                const int32 Begin = std::max(ColumnBegins[Row], TilePixelX) - TilePixelX;
+                const int32 End = std::min(ColumnEnds[Row], TilePixelX + TILE_WIDTH - 1) - TilePixelX;
+                Coverage[Row] = Begin <= End ? MakeSpanMask(Begin, End) : 0u;
+                AnyCoverage |= Coverage[Row];
+            }
+            if (AnyCoverage == 0) { continue; }
+
+            // 타일 안 픽셀 중심 범위와 삼각형 경계의 교집합에서 깊이 평면의 최댓값
+            const float SampleMinX = std::max(TilePixelX + 0.5f, MinX);
+            const float SampleMaxX = std::min(TilePixelX + TILE_WIDTH - 0.5f, MaxX);
+            const float SampleMinY = std::max(TilePixelY + 0.5f, MinY);
+            const float SampleMaxY = std::min(TilePixelY + TILE_HEIGHT - 0.5f, MaxY);
+            const float PlaneMaxZ = Z[0]
+                + DzDx * ((DzDx > 0.0f ? SampleMaxX : SampleMinX) - X[0])
+                + DzDy * ((DzDy > 0.0f ? SampleMaxY : SampleMinY) - Y[0]);
+
+            UpdateTile(Tiles[TileY * TILE_COUNT_X + TileX], Coverage, std::min(PlaneMaxZ, MaxZ));
         }
     }
 }
 
-TArray<FVector> COcclusionCuller::ConvertAABBToTriangles(UPrimitiveComponent* Prim)
+void COcclusionCuller::UpdateTile(FOcclusionTile& InOutTile, const uint32 InCoverage[TILE_HEIGHT], float InMaxZ)
 {
-    Triangles.clear();
+    // 이미 타일 전체가 더 가까운 오클루더로 덮여 있다면 얻을 것이 없다
+    if (InMaxZ >= InOutTile.Z0) { return; }
 
-    if (!Prim) { return Triangles; }
+    const __m128i Coverage0 = _mm_load_si128(reinterpret_cast<const __m128i*>(InCoverage));
+    const __m128i Coverage1 = _mm_load_si128(reinterpret_cast<const __m128i*>(InCoverage + 4));
+    __m128i Mask0 = _mm_load_si128(reinterpret_cast<const __m128i*>(InOutTile.Mask));
+    __m128i Mask1 = _mm_load_si128(reinterpret_cast<const __m128i*>(InOutTile.Mask + 4));
 
-    FWorldAABBData& Data = CachedAABBs[Prim->CachedAABBIndex];
-    const FVector& WorldCenter = Data.Center;
-    FVector Extent = (Data.Min - Data.Max) * 0.5f;
+    // 작업 레이어가 비었거나, 새 삼각형이 작업 레이어보다 훨씬 가깝다면 작업 레이어를 새 삼각형으로 교체한다
+    if (IsMaskZero(Mask0, Mask1) || (InOutTile.Z1 - InMaxZ) > (InOutTile.Z0 - InOutTile.Z1))
+    {
+        Mask0 = Coverage0;
+        Mask1 = Coverage1;
+        InOutTile.Z1 = InMaxZ;
+    }
+    else
+    {
+        Mask0 = _mm_or_si128(Mask0, Coverage0);
+        Mask1 = _mm_or_si128(Mask1, Coverage1);
+        InOutTile.Z1 = std::max(InOutTile.Z1, InMaxZ);
+    }
 
-    constexpr float OccluderScale = 0.5f;
+    // 작업 레이어가 타일을 가득 채우면 타일 전체의 상한(Z0)으로 병합하고 비운다
+    if (IsMaskFull(Mask0, Mask1))
+    {
+        InOutTile.Z0 = InOutTile.Z1;
+        InOutTile.Z1 = 0.0f;
+        Mask0 = _mm_setzero_si128();
+        Mask1 = _mm_setzero_si128();
+    }
 
-    FVector WorldMin = WorldCenter - Extent * OccluderScale;
-    FVector WorldMax = WorldCenter + Extent * OccluderScale;
+    _mm_store_si128(reinterpret_cast<__m128i*>(InOutTile.Mask), Mask0);
+    _mm_store_si128(reinterpret_cast<__m128i*>(InOutTile.Mask + 4), Mask1);
+}
 
-    // AABB의 8개 정점 계산
-    FVector Vertices[8];
-    Vertices[0] = FVector(WorldMin.X, WorldMin.Y, WorldMin.Z); // 000
-    Vertices[1] = FVector(WorldMax.X, WorldMin.Y, WorldMin.Z); // 100
-    Vertices[2] = FVector(WorldMax.X, WorldMax.Y, WorldMin.Z); // 110
-    Vertices[3] = FVector(WorldMin.X, WorldMax.Y, WorldMin.Z); // 010
-    Vertices[4] = FVector(WorldMin.X, WorldMin.Y, WorldMax.Z); // 001
-    Vertices[5] = FVector(WorldMax.X, WorldMin.Y, WorldMax.Z); // 101
-    Vertices[6] = FVector(WorldMax.X, WorldMax.Y, WorldMax.Z); // 111
-    Vertices[7] = FVector(WorldMin.X, WorldMax.Y, WorldMax.Z); // 011
+bool COcclusionCuller::IsBoxVisible(const FVector& InMin, const FVector& InMax) const
+{
+    alignas(16) float X[8];
+    alignas(16) float Y[8];
+    alignas(16) float Z[8];
+    if (!ProjectBoxCorners(InMin, InMax, X, Y, Z)) { return true; }
+
+    const float MinX = *std::min_element(X, X + 8);
+    const float MaxX = *std::max_element(X, X + 8);
+    const float MinY = *std::min_element(Y, Y + 8);
+    const float MaxY = *std::max_element(Y, Y + 8);
+    const float MinZ = *std::min_element(Z, Z + 8);
+
+    if (MaxX < 0.0f || MinX >= Z_BUFFER_WIDTH || MaxY < 0.0f || MinY >= Z_BUFFER_HEIGHT) { return false; }
+
+    // 박스가 조금이라도 걸치는 모든 픽셀
+    const int32 ColumnBegin = std::max(0, static_cast<int32>(std::floor(MinX)));
+    const int32 ColumnEnd = std::min(Z_BUFFER_WIDTH - 1, static_cast<int32>(std::floor(MaxX)));
+    const int32 RowBegin = std::max(0, static_cast<int32>(std::floor(MinY)));
+    const int32 RowEnd = std::min(Z_BUFFER_HEIGHT - 1, static_cast<int32>(std::floor(MaxY)));
+
+    const __m128i RowIndices0 = _mm_setr_epi32(0, 1, 2, 3);
+    const __m128i RowIndices1 = _mm_setr_epi32(4, 5, 6, 7);
 
-    // Front face (Z = Min)
-    Triangles.push_back(Vertices[0]); Triangles.push_back(Vertices[1]); Triangles.push_back(Vertices[2]);
-    Triangles.push_back(Vertices[0]); Triangles.push_back(Vertices[2]); Triangles.push_back(Vertices[3]);
+    for (int32 TileY = RowBegin / TILE_HEIGHT; TileY <= RowEnd / TILE_HEIGHT; ++TileY)
+    {
+        // 타일 안에서 박스가 걸치는 행 [LocalRowBegin, LocalRowEnd]
+        const int32 LocalRowBegin = std::max(RowBegin - TileY * TILE_HEIGHT, 0);
+        const int32 LocalRowEnd = std::min(RowEnd - TileY * TILE_HEIGHT, TILE_HEIGHT - 1);
+        const __m128i RowBeginVector = _mm_set1_epi32(LocalRowBegin - 1);
+        const __m128i RowEndVector = _mm_set1_epi32(LocalRowEnd + 1);
+        const __m128i RowSelect0 = _mm_and_si128(_mm_cmpgt_epi32(RowIndices0, RowBeginVector), _mm_cmplt_epi32(RowIndices0, RowEndVector));
+        const __m128i RowSelect1 = _mm_and_si128(_mm_cmpgt_epi32(RowIndices1, RowBeginVector), _mm_cmplt_epi32(RowIndices1, RowEndVector));
+
+        for (int32 TileX = ColumnBegin / TILE_WIDTH; TileX <= ColumnEnd / TILE_WIDTH; ++TileX)
+        {
+            const FOcclusionTile& Tile = Tiles[TileY * TILE_COUNT_X + TileX];
+
+            // 계층 Z: 타일 전체의 오클루더 깊이 상한보다 멀다면 이 타일에서는 가려진다
+            if (MinZ >= Tile.Z0) { continue; }
+            // 작업 레이어보다도 가깝다면 타일의 어느 픽셀에서든 보인다
+            if (MinZ < Tile.Z1) { return true; }
+
+            // 작업 레이어 깊이보다는 멀다: 박스가 걸친 픽셀이 모두 작업 레이어 마스크 안에 있어야 가려진다
+            const int32 TilePixelX = TileX * TILE_WIDTH;
+            const uint32 RowBits = MakeSpanMask(std::max(ColumnBegin, TilePixelX) - TilePixelX,
+                std::min(ColumnEnd, TilePixelX + TILE_WIDTH - 1) - TilePixelX);
+            const __m128i RowBitsVector = _mm_set1_epi32(static_cast<int32>(RowBits));
+
+            const __m128i Mask0 = _mm_load_si128(reinterpret_cast<const __m128i*>(Tile.Mask));
+            const __m128i Mask1 = _mm_load_si128(reinterpret_cast<const __m128i*>(Tile.Mask + 4));
+            const __m128i Uncovered0 = _mm_andnot_si128(Mask0, _mm_and_si128(RowBitsVector, RowSelect0));
+            const __m128i Uncovered1 = _mm_andnot_si128(Mask1, _mm_and_si128(RowBitsVector, RowSelect1));
+            if (!IsMaskZero(Uncovered0, Uncovered1)) { return true; }
+        }
+    }
 
-    // Back face (Z = Max)
-    Triangles.push_back(Vertices[5]); Triangles.push_back(Vertices[4]); Triangles.push_back(Vertices[7]);
-    Triangles.push_back(Vertices[5]); Triangles.push_back(Vertices[7]); Triangles.push_back(Vertices[6]);
+    return false;
+}
 
-    // Left face (X = Min)
-    Triangles.push_back(Vertices[4]); Triangles.push_back(Vertices[0]); Triangles.push_back(Vertices[3]);
-    Triangles.push_back(Vertices[4]); Triangles.push_back(Vertices[3]); Triangles.push_back(Vertices[7]);
+bool COcclusionCuller::ProjectBoxCorners(const FVector& InMin, const FVector& InMax, float OutX[8], float OutY[8], float OutZ[8]) const
+{
+    const FMatrix& M = CurrentViewProj;
+    const __m128 CornerX = _mm_setr_ps(InMin.X, InMax.X, InMax.X, InMin.X);
+    const __m128 CornerY = _mm_setr_ps(InMin.Y, InMin.Y, InMax.Y, InMax.Y);
+    const __m128 Ones = _mm_set1_ps(1.0f);
+    const __m128 HalfWidth = _mm_set1_ps(Z_BUFFER_WIDTH * 0.5f);
+    const __m128 HalfHeight = _mm_set1_ps(Z_BUFFER_HEIGHT * 0.5f);
+
+    // Row-vector 변환: Clip[c] = X * M[0][c] + Y * M[1][c] + Z * M[2][c] + M[3][c]
+    auto TransformColumn = [&M, &CornerX, &CornerY](const __m128& InCornerZ, int InColumn)
+    {
+        __m128 Result = _mm_mul_ps(CornerX, _mm_set1_ps(M.Data[0][InColumn]));
+        Result = _mm_add_ps(Result, _mm_mul_ps(CornerY, _mm_set1_ps(M.Data[1][InColumn])));
+        Result = _mm_add_ps(Result, _mm_mul_ps(InCornerZ, _mm_set1_ps(M.Data[2][InColumn])));
+        return _mm_add_ps(Result, _mm_set1_ps(M.Data[3][InColumn]));
+    };
+
+    __m128 BehindNearPlane = _mm_setzero_ps();
+    for (int32 Half = 0; Half < 2; ++Half)
+    {
+        // 앞 4개는 Min.Z, 뒤 4개는 Max.Z 꼭짓점
+        const __m128 CornerZ = _mm_set1_ps(Half == 0 ? InMin.Z : InMax.Z);
+        const __m128 ClipX = TransformColumn(CornerZ, 0);
+        const __m128 ClipY = TransformColumn(CornerZ, 1);
+        const __m128 ClipZ = TransformColumn(CornerZ, 2);
+        const __m128 ClipW = TransformColumn(CornerZ, 3);
+
+        BehindNearPlane = _mm_or_ps(BehindNearPlane, _mm_cmple_ps(ClipW, _mm_set1_ps(MIN_CLIP_W)));
+        BehindNearPlane = _mm_or_ps(BehindNearPlane, _mm_cmplt_ps(ClipZ, _mm_setzero_ps()));
+
+        const __m128 InvW = _mm_div_ps(Ones, ClipW);
+        _mm_store_ps(OutX + Half * 4, _mm_mul_ps(_mm_add_ps(_mm_mul_ps(ClipX, InvW), Ones), HalfWidth));
+        _mm_store_ps(OutY + Half * 4, _mm_mul_ps(_mm_sub_ps(Ones, _mm_mul_ps(ClipY, InvW)), HalfHeight));
+        _mm_store_ps(OutZ + Half * 4, _mm_mul_ps(ClipZ, InvW));
+    }
 
-    // Right face (X = Max)
-    Triangles.push_back(Vertices[1]); Triangles.push_back(Vertices[5]); Triangles.push_back(Vertices[6]);
-    Triangles.push_back(Vertices[1]); Triangles.push_back(Vertices[6]); Triangles.push_back(Vertices[2]);
+    return _mm_movemask_ps(BehindNearPlane) == 0;
+}
 
-    // Bottom face (Y = Min)
-    Triangles.push_back(Vertices[4]); Triangles.push_back(Vertices[5]); Triangles.push_back(Vertices[1]);
-    Triangles.push_back(Vertices[4]); Triangles.push_back(Vertices[1]); Triangles.push_back(Vertices[0]);
+bool COcclusionCuller::Project(const FVector& WorldPos, float& OutX, float& OutY, float& OutZ) const
+{
+    return ProjectToScreen(CurrentViewProj, WorldPos, OutX, OutY, OutZ);
+}
 
-    // Top face (Y = Max)
-    Triangles.push_back(Vertices[3]); Triangles.push_back(Vertices[2]); Triangles.push_back(Vertices[6]);
-    Triangles.push_back(Vertices[3]); Triangles.push_back(Vertices[6]); Triangles.push_back(Vertices[7]);
+bool COcclusionCuller::ProjectToScreen(const FMatrix& InToClip, const FVector& InPosition, float& OutX, float& OutY, float& OutZ)
+{
+    FVector4 Position4(InPosition.X, InPosition.Y, InPosition.Z, 1.0f);
+    FVector4 ClipPos = Position4 * InToClip;
+    if (ClipPos.W <= MIN_CLIP_W || ClipPos.Z < 0.0f) { return false; }
 
-    return Triangles;
+    // NDC to Screen
+    const float InvW = 1.0f / ClipPos.W;
+    OutX = (ClipPos.X * InvW + 1.0f) * 0.5f * Z_BUFFER_WIDTH;
+    OutY = (1.0f - ClipPos.Y * InvW) * 0.5f * Z_BUFFER_HEIGHT;
+    OutZ = ClipPos.Z * InvW;
+    return true;
 }
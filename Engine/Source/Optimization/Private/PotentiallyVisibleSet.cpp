@@ -0,0 +1,903 @@
+#include "pch.h"
+#include "Optimization/Public/PotentiallyVisibleSet.h"
+#include "Actor/Public/Actor.h"
+#include "Component/Public/PrimitiveComponent.h"
+#include "Component/Mesh/Public/StaticMeshComponent.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Core/Public/WindowsBinReader.h"
+#include "Core/Public/WindowsBinWriter.h"
+#include "Global/BVH.h"
+#include "Global/Octree.h"
+#include "Level/Public/Level.h"
+#include "Utility/Public/ParallelFor.h"
+
+#include <atomic>
+
+namespace
+{
+	/** @brief 이보다 가까운 교차는 레이 시작점의 자기 교차로 보고 무시한다 */
+	constexpr float MIN_HIT_DISTANCE = 1e-4f;
+	constexpr float GOLDEN_ANGLE = 2.39996323f;
+	/** @brief 헤더 한 개에 담는 0 워드/리터럴 워드 수의 최대값 */
+	constexpr uint32 MAX_RUN_LENGTH = 0xFFFF;
+	/** @brief 탑 레벨 BVH 리프에 두는 최대 프리미티브 수 */
+	constexpr uint32 MAX_LEAF_PRIMITIVE_COUNT = 4;
+
+	/** @brief 모든 PVS 인스턴스가 공유한다. 레벨이 바뀌어 같은 주소에 새 PVS가 생겨도 리비전이 겹치지 않는다 */
+	std::atomic<uint32> RevisionCounter{ 0 };
+
+	/** @brief 베이크 중 레이 판정에 쓰는 오클루더 정보 (월드 → 모델 변환과 메시 데이터) */
+	struct FBakeOccluder
+	{
+		uint32 PrimitiveIndex = 0;
+		FVector BoundsMin;
+		FVector BoundsMax;
+		FMatrix WorldToModel;
+		const TArray<FNormalVertex>* Vertices = nullptr;
+		const TArray<uint32>* Indices = nullptr;
+		const FBVH* BVH = nullptr;
+	};
+
+	/** @brief Count > 0이면 리프(Occluders[First, First + Count)), 아니면 자식이 Nodes[First], Nodes[First + 1] */
+	struct FBakeNode
+	{
+		FVector Min;
+		FVector Max;
+		uint32 First = 0;
+		uint32 Count = 0;
+	};
+
+	float SafeInverse(float InValue)
+	{
+		return 1.0f / (fabsf(InValue) > 1e-12f ? InValue : (InValue < 0.0f ? -1e-12f : 1e-12f));
+	}
+
+	/** @brief 슬랩 검사. 박스에 들어가는 거리가 InMaxDistance보다 가까우면 true */
+	bool IntersectRayBox(const FVector& InMin, const FVector& InMax, const FVector& InOrigin, const FVector& InInvDirection,
+		float InMaxDistance, float& OutEntry)
+	{
+		const float TX1 = (InMin.X - InOrigin.X) * InInvDirection.X;
+		const float TX2 = (InMax.X - InOrigin.X) * InInvDirection.X;
+		const float TY1 = (InMin.Y - InOrigin.Y) * InInvDirection.Y;
+		const float TY2 = (InMax.Y - InOrigin.Y) * InInvDirection.Y;
+		const float TZ1 = (InMin.Z - InOrigin.Z) * InInvDirection.Z;
+		const float TZ2 = (InMax.Z - InOrigin.Z) * InInvDirection.Z;
+
+		const float Entry = std::max({ std::min(TX1, TX2), std::min(TY1, TY2), std::min(TZ1, TZ2), 0.0f });
+		const float Exit = std::min({ std::max(TX1, TX2), std::max(TY1, TY2), std::max(TZ1, TZ2), InMaxDistance });
+		OutEntry = Entry;
+		return Entry <= Exit;
+	}
+
+	/** @brief 양면 Moller-Trumbore 교차. 방향이 정규화되지 않아도 T는 같은 매개변수로 나온다. */
+	bool IntersectRayTriangle(const FVector& InOrigin, const FVector& InDirection,
+		const FVector& V0, const FVector& V1, const FVector& V2, float& InOutClosest)
+	{
+		const FVector E1 = V1 - V0;
+		const FVector E2 = V2 - V0;
+		const FVector P = InDirection.Cross(E2);
+		const float Determinant = E1.Dot(P);
+		if (Determinant == 0.0f)
+		{
+			return false;
+		}
+
+		const float InvDeterminant = 1.0f / Determinant;
+		const FVector S = InOrigin - V0;
+		const float U = S.Dot(P) * InvDeterminant;
+		if (U < 0.0f || U > 1.0f)
+		{
+			return false;
+		}
+
+		const FVector Q = S.Cross(E1);
+		const float V = InDirection.Dot(Q) * InvDeterminant;
+		if (V < 0.0f || U + V > 1.0f)
+		{
+			return false;
+		}
+
+		const float T = E2.Dot(Q) * InvDeterminant;
+		if (T <= MIN_HIT_DISTANCE || T >= InOutClosest)
+		{
+			return false;
+		}
+
+		InOutClosest = T;
+		return true;
+	}
+
+	/**
+	 * @brief 베이크 전용 레이 캐스터
+	 * 오클루더의 월드 AABB로 만든 탑 레벨 BVH를 가까운 자식부터 순회하고, 후보 메시는 모델 공간 레이로 바꿔 메시 BVH로 검사한다.
+	 */
+	class FBakeScene
+	{
+	public:
+		explicit FBakeScene(TArray<FBakeOccluder>&& InOccluders)
+			: Occluders(std::move(InOccluders))
+		{
+			if (Occluders.empty())
+			{
+				return;
+			}
+
+			Nodes.reserve(Occluders.size() * 2);
+			Nodes.emplace_back();
+			BuildNode(0, 0, static_cast<uint32>(Occluders.size()));
+		}
+
+		/** @return 레이가 가장 먼저 맞는 프리미티브의 인덱스. 맞지 않으면 -1 */
+		int32 CastRay(const FVector& InOrigin, const FVector& InDirection) const
+		{
+			if (Nodes.empty())
+			{
+				return -1;
+			}
+
+			const FVector InvDirection(SafeInverse(InDirection.X), SafeInverse(InDirection.Y), SafeInverse(InDirection.Z));
+			float Closest = FLT_MAX;
+			int32 HitPrimitive = -1;
+
+			uint32 Stack[64];
+			uint32 StackSize = 0;
+			Stack[StackSize++] = 0;
+
+			while (StackSize > 0)
+			{
+				const FBakeNode& Node = Nodes[Stack[--StackSize]];
+				float Entry;
+				if (!IntersectRayBox(Node.Min, Node.Max, InOrigin, InvDirection, Closest, Entry))
+				{
+					continue;
+				}
+
+				if (Node.Count > 0)
+				{
+					for (uint32 Index = Node.First; Index < Node.First + Node.Count; ++Index)
+					{
+						const FBakeOccluder& Occluder = Occluders[Index];
+						if (!IntersectRayBox(Occluder.BoundsMin, Occluder.BoundsMax, InOrigin, InvDirection, Closest, Entry))
+						{
+							continue;
+						}
+						if (IntersectOccluder(Occluder, InOrigin, InDirection, Closest))
+						{
+							HitPrimitive = static_cast<int32>(Occluder.PrimitiveIndex);
+						}
+					}
+					continue;
+				}
+
+				// 가까운 자식을 나중에 넣어 먼저 꺼낸다
+				float LeftEntry, RightEntry;
+				const bool bHitLeft = IntersectRayBox(Nodes[Node.First].Min, Nodes[Node.First].Max, InOrigin, InvDirection, Closest, LeftEntry);
+				const bool bHitRight = IntersectRayBox(Nodes[Node.First + 1].Min, Nodes[Node.First + 1].Max, InOrigin, InvDirection, Closest, RightEntry);
+				if (bHitLeft && bHitRight)
+				{
+					const bool bLeftFirst = LeftEntry <= RightEntry;
+					Stack[StackSize++] = bLeftFirst ? Node.First + 1 : Node.First;
+					Stack[StackSize++] = bLeftFirst ? Node.First : Node.First + 1;
+				}
+				else if (bHitLeft)
+				{
+					Stack[StackSize++] = Node.First;
+				}
+				else if (bHitRight)
+				{
+					Stack[StackSize++] = Node.First + 1;
+				}
+			}
+
+			return HitPrimitive;
+		}
+
+	private:
+		/** @brief 중심점이 가장 넓게 퍼진 축의 중앙값으로 나눈다. 깊이는 log2(오클루더 수) 정도로 유지된다. */
+		void BuildNode(uint32 InNodeIndex, uint32 InBegin, uint32 InEnd)
+		{
+			FVector Min(FLT_MAX, FLT_MAX, FLT_MAX);
+			FVector Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+			FVector CenterMin = Min;
+			FVector CenterMax = Max;
+			for (uint32 Index = InBegin; Index < InEnd; ++Index)
+			{
+				const FBakeOccluder& Occluder = Occluders[Index];
+				const FVector Center = (Occluder.BoundsMin + Occluder.BoundsMax) * 0.5f;
+				Min = FVector(std::min(Min.X, Occluder.BoundsMin.X), std::min(Min.Y, Occluder.BoundsMin.Y), std::min(Min.Z, Occluder.BoundsMin.Z));
+				Max = FVector(std::max(Max.X, Occluder.BoundsMax.X), std::max(Max.Y, Occluder.BoundsMax.Y), std::max(Max.Z, Occluder.BoundsMax.Z));
+				CenterMin = FVector(std::min(CenterMin.X, Center.X), std::min(CenterMin.Y, Center.Y), std::min(CenterMin.Z, Center.Z));
+				CenterMax = FVector(std::max(CenterMax.X, Center.X), std::max(CenterMax.Y, Center.Y), std::max(CenterMax.Z, Center.Z));
+			}
+
+			Nodes[InNodeIndex].Min = Min;
+			Nodes[InNodeIndex].Max = Max;
+
+			if (InEnd - InBegin <= MAX_LEAF_PRIMITIVE_COUNT)
+			{
+				Nodes[InNodeIndex].First = InBegin;
+				Nodes[InNodeIndex].Count = InEnd - InBegin;
+				return;
+			}
+
+			const FVector Spread = CenterMax - CenterMin;
+			const int Axis = (Spread.X >= Spread.Y && Spread.X >= Spread.Z) ? 0 : (Spread.Y >= Spread.Z ? 1 : 2);
+			auto GetCenter = [Axis](const FBakeOccluder& InOccluder)
+			{
+				const FVector Center = InOccluder.BoundsMin + InOccluder.BoundsMax;
+				return Axis == 0 ? Center.X : (Axis == 1 ? Center.Y : Center.Z);
+			};
+
+			const uint32 Middle = InBegin + (InEnd - InBegin) / 2;
+			std::nth_element(Occluders.begin() + InBegin, Occluders.begin() + Middle, Occluders.begin() + InEnd,
+				[&GetCenter](const FBakeOccluder& A, const FBakeOccluder& B) { return GetCenter(A) < GetCenter(B); });
+
+			const uint32 ChildIndex = static_cast<uint32>(Nodes.size());
+			Nodes[InNodeIndex].First = ChildIndex;
+			Nodes[InNodeIndex].Count = 0;
+			Nodes.emplace_back();
+			Nodes.emplace_back();
+			BuildNode(ChildIndex, InBegin, Middle);
+			BuildNode(ChildIndex + 1, Middle, InEnd);
+		}
+
+		bool IntersectOccluder(const FBakeOccluder& InOccluder, const FVector& InOrigin, const FVector& InDirection,
+			float& InOutClosest) const
+		{
+			// 방향을 정규화하지 않으므로 모델 공간의 T가 월드 공간의 T와 같다
+			const FVector4 ModelOrigin4 = FVector4(InOrigin, 1.0f) * InOccluder.WorldToModel;
+			const FVector4 ModelDirection4 = FVector4(InDirection, 0.0f) * InOccluder.WorldToModel;
+			const FVector ModelOrigin(ModelOrigin4.X, ModelOrigin4.Y, ModelOrigin4.Z);
+			const FVector ModelDirection(ModelDirection4.X, ModelDirection4.Y, ModelDirection4.Z);
+
+			const TArray<FNormalVertex>& Vertices = *InOccluder.Vertices;
+			const TArray<uint32>* Indices = InOccluder.Indices;
+			const uint32 TriangleCount = static_cast<uint32>((Indices ? Indices->size() : Vertices.size()) / 3);
+
+			auto TestTriangle = [&](uint32 InTriangle)
+			{
+				const uint32 I0 = Indices ? (*Indices)[InTriangle * 3 + 0] : InTriangle * 3 + 0;
+				const uint32 I1 = Indices ? (*Indices)[InTriangle * 3 + 1] : InTriangle * 3 + 1;
+				const uint32 I2 = Indices ? (*Indices)[InTriangle * 3 + 2] : InTriangle * 3 + 2;
+				return IntersectRayTriangle(ModelOrigin, ModelDirection,
+					Vertices[I0].Position, Vertices[I1].Position, Vertices[I2].Position, InOutClosest);
+			};
+
+			bool bHit = false;
+			if (InOccluder.BVH)
+			{
+				FRay ModelRay;
+				ModelRay.Origin = ModelOrigin4;
+				ModelRay.Direction = ModelDirection4;
+				FBVHRayHit Hit;
+				if (InOccluder.BVH->ClosestHit(ModelRay, Hit, MIN_HIT_DISTANCE, InOutClosest))
+				{
+					InOutClosest = Hit.Distance;
+					bHit = true;
+				}
+			}
+			else
+			{
+				for (uint32 Triangle = 0; Triangle < TriangleCount; ++Triangle)
+				{
+					bHit |= TestTriangle(Triangle);
+				}
+			}
+			return bHit;
+		}
+
+		TArray<FBakeOccluder> Occluders;
+		TArray<FBakeNode> Nodes;
+	};
+
+	/** @brief 밑이 InBase인 Halton 수열의 InIndex번째 값 ([0, 1)) */
+	float Halton(uint32 InIndex, uint32 InBase)
+	{
+		float Result = 0.0f;
+		float Fraction = 1.0f / static_cast<float>(InBase);
+		while (InIndex > 0)
+		{
+			Result += Fraction * static_cast<float>(InIndex % InBase);
+			InIndex /= InBase;
+			Fraction /= static_cast<float>(InBase);
+		}
+		return Result;
+	}
+
+	uint64 HashWords(const TArray<uint32>& InWords)
+	{
+		uint64 Hash = 14695981039346656037ull;
+		for (uint32 Word : InWords)
+		{
+			Hash = (Hash ^ Word) * 1099511628211ull;
+		}
+		return Hash;
+	}
+}
+
+bool FPotentiallyVisibleSet::Bake(ULevel* InLevel, const FPVSBakeSettings& InSettings)
+{
+	Reset();
+	if (!InLevel || !InLevel->GetStaticOctree())
+	{
+		return false;
+	}
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	TArray<UPrimitiveComponent*> BakePrimitives;
+	GatherStaticPrimitives(InLevel, BakePrimitives, PrimitiveKeys);
+	if (PrimitiveKeys.empty())
+	{
+		UE_LOG_WARNING("PVS: StaticOctree에 프리미티브가 없어 베이크하지 않습니다");
+		return false;
+	}
+
+	const uint32 PrimitiveCount = GetPrimitiveCount();
+	const uint32 WordCount = GetWordCount();
+
+	// 1. 격자: 레벨 경계를 셀 하나만큼 넓혀 가장자리 바로 바깥의 카메라도 셀을 찾게 한다
+	TArray<FVector> PrimitiveMins(PrimitiveCount);
+	TArray<FVector> PrimitiveMaxs(PrimitiveCount);
+	FVector BoundsMin(FLT_MAX, FLT_MAX, FLT_MAX);
+	FVector BoundsMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	for (uint32 Index = 0; Index < PrimitiveCount; ++Index)
+	{
+		FVector& Min = PrimitiveMins[Index];
+		FVector& Max = PrimitiveMaxs[Index];
+		BakePrimitives[Index]->GetWorldAABB(Min, Max);
+		BoundsMin = FVector(std::min(BoundsMin.X, Min.X), std::min(BoundsMin.Y, Min.Y), std::min(BoundsMin.Z, Min.Z));
+		BoundsMax = FVector(std::max(BoundsMax.X, Max.X), std::max(BoundsMax.Y, Max.Y), std::max(BoundsMax.Z, Max.Z));
+	}
+
+	const float CellSize = std::max(InSettings.CellSize, 0.01f);
+	const uint32 MaxCellsPerAxis = std::max(InSettings.MaxCellsPerAxis, 1u);
+	const FVector Padding(CellSize, CellSize, CellSize);
+	GridMin = BoundsMin - Padding;
+	const FVector GridSize = (BoundsMax + Padding) - GridMin;
+
+	auto GetAxisCellCount = [CellSize, MaxCellsPerAxis](float InSize)
+	{
+		return std::clamp(static_cast<uint32>(std::ceil(InSize / CellSize)), 1u, MaxCellsPerAxis);
+	};
+	CellCountX = GetAxisCellCount(GridSize.X);
+	CellCountY = GetAxisCellCount(GridSize.Y);
+	CellCountZ = GetAxisCellCount(GridSize.Z);
+	CellExtent = FVector(GridSize.X / CellCountX, GridSize.Y / CellCountY, GridSize.Z / CellCountZ);
+	const uint32 CellCount = CellCountX * CellCountY * CellCountZ;
+
+	// 2. 오클루더 수집. 스태틱 메시만 시야를 가리며, 나머지(빌보드, 텍스트, 데칼 등)는 모든 셀에서 보이는 것으로 둔다
+	TArray<uint32> AlwaysVisibleBits(WordCount, 0u);
+	TArray<FBakeOccluder> Occluders;
+	TSet<FStaticMesh*> MeshesWithoutBVH;
+	for (uint32 Index = 0; Index < PrimitiveCount; ++Index)
+	{
+		UPrimitiveComponent* Primitive = BakePrimitives[Index];
+		UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Primitive);
+		FStaticMesh* StaticMeshAsset = (StaticMeshComponent && StaticMeshComponent->GetStaticMesh())
+			? StaticMeshComponent->GetStaticMesh()->GetStaticMeshAsset() : nullptr;
+
+		if (!StaticMeshAsset || !Primitive->GetVerticesData() || Primitive->GetTopology() != D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST)
+		{
+			AlwaysVisibleBits[Index / 32] |= 1u << (Index % 32);
+			continue;
+		}
+
+		FBakeOccluder Occluder;
+		Occluder.PrimitiveIndex = Index;
+		Occluder.BoundsMin = PrimitiveMins[Index];
+		Occluder.BoundsMax = PrimitiveMaxs[Index];
+		Occluder.WorldToModel = Primitive->GetWorldTransformMatrixInverse();
+		Occluder.Vertices = Primitive->GetVerticesData();
+		Occluder.Indices = Primitive->GetIndicesData();
+		Occluder.BVH = &StaticMeshAsset->BVH;
+		Occluders.push_back(Occluder);
+
+		if (StaticMeshAsset->BVH.GetNodeCount() == 0 && !StaticMeshAsset->Indices.empty())
+		{
+			MeshesWithoutBVH.insert(StaticMeshAsset);
+		}
+	}
+
+	// 임포트 때 BVH를 만들지 못한 메시가 있으면 베이크에 쓰는 메시만 여기서 만든다. (이후 피킹도 이 BVH를 쓴다)
+	for (FStaticMesh* StaticMeshAsset : MeshesWithoutBVH)
+	{
+		StaticMeshAsset->BVH.Build(StaticMeshAsset);
+	}
+	for (FBakeOccluder& Occluder : Occluders)
+	{
+		if (Occluder.BVH->GetNodeCount() == 0)
+		{
+			Occluder.BVH = nullptr;
+		}
+	}
+
+	const uint32 OccluderCount = static_cast<uint32>(Occluders.size());
+	const FBakeScene Scene(std::move(Occluders));
+
+	// 3. 셀과 겹치는 프리미티브는 카메라 바로 옆에 있으므로 샘플링 결과와 관계없이 보이는 것으로 둔다
+	TArray<uint32> CellBits(static_cast<size_t>(CellCount) * WordCount, 0u);
+	for (uint32 Cell = 0; Cell < CellCount; ++Cell)
+	{
+		std::copy(AlwaysVisibleBits.begin(), AlwaysVisibleBits.end(), CellBits.begin() + static_cast<size_t>(Cell) * WordCount);
+	}
+
+	auto ToCellCoordinate = [](float InValue, float InGridMin, float InExtent, uint32 InCount)
+	{
+		const int32 Coordinate = static_cast<int32>(std::floor((InValue - InGridMin) / InExtent));
+		return static_cast<uint32>(std::clamp(Coordinate, 0, static_cast<int32>(InCount) - 1));
+	};
+
+	for (uint32 Index = 0; Index < PrimitiveCount; ++Index)
+	{
+		const FVector& Min = PrimitiveMins[Index];
+		const FVector& Max = PrimitiveMaxs[Index];
+		const uint32 MinX = ToCellCoordinate(Min.X, GridMin.X, CellExtent.X, CellCountX);
+		const uint32 MinY = ToCellCoordinate(Min.Y, GridMin.Y, CellExtent.Y, CellCountY);
+		const uint32 MinZ = ToCellCoordinate(Min.Z, GridMin.Z, CellExtent.Z, CellCountZ);
+		const uint32 MaxX = ToCellCoordinate(Max.X, GridMin.X, CellExtent.X, CellCountX);
+		const uint32 MaxY = ToCellCoordinate(Max.Y, GridMin.Y, CellExtent.Y, CellCountY);
+		const uint32 MaxZ = ToCellCoordinate(Max.Z, GridMin.Z, CellExtent.Z, CellCountZ);
+
+		for (uint32 Z = MinZ; Z <= MaxZ; ++Z)
+		{
+			for (uint32 Y = MinY; Y <= MaxY; ++Y)
+			{
+				for (uint32 X = MinX; X <= MaxX; ++X)
+				{
+					const size_t Cell = (static_cast<size_t>(Z) * CellCountY + Y) * CellCountX + X;
+					CellBits[Cell * WordCount + Index / 32] |= 1u << (Index % 32);
+				}
+			}
+		}
+	}
+
+	// 4. 샘플 지점과 레이 방향. 방향은 피보나치 구이며, 지점마다 방위각을 돌려 같은 방향만 반복해서 쏘지 않게 한다
+	const uint32 SampleCount = std::max(InSettings.SamplesPerCell, 1u);
+	const uint32 RayCount = std::max(InSettings.RaysPerSample, 1u);
+
+	TArray<FVector> SampleOffsets(SampleCount);
+	TArray<FVector> Directions(static_cast<size_t>(SampleCount) * RayCount);
+	for (uint32 Sample = 0; Sample < SampleCount; ++Sample)
+	{
+		SampleOffsets[Sample] = (Sample == 0)
+			? FVector(0.5f, 0.5f, 0.5f)
+			: FVector(0.05f + 0.9f * Halton(Sample, 2), 0.05f + 0.9f * Halton(Sample, 3), 0.05f + 0.9f * Halton(Sample, 5));
+
+		const float AzimuthOffset = 2.0f * PI * Halton(Sample + 1, 7);
+		for (uint32 Ray = 0; Ray < RayCount; ++Ray)
+		{
+			const float Z = 1.0f - (2.0f * Ray + 1.0f) / static_cast<float>(RayCount);
+			const float Radius = sqrtf(std::max(0.0f, 1.0f - Z * Z));
+			const float Azimuth = GOLDEN_ANGLE * Ray + AzimuthOffset;
+			Directions[static_cast<size_t>(Sample) * RayCount + Ray] = FVector(Radius * cosf(Azimuth), Radius * sinf(Azimuth), Z);
+		}
+	}
+
+	// 5. 셀마다 레이를 쏘아 가장 먼저 맞은 프리미티브를 보이는 것으로 표시한다. 셀마다 자기 워드만 쓰므로 병렬로 처리한다
+	ParallelFor(CellCount, [&](uint32 InCell)
+	{
+		const uint32 X = InCell % CellCountX;
+		const uint32 Y = (InCell / CellCountX) % CellCountY;
+		const uint32 Z = InCell / (CellCountX * CellCountY);
+		const FVector CellMin(GridMin.X + CellExtent.X * X, GridMin.Y + CellExtent.Y * Y, GridMin.Z + CellExtent.Z * Z);
+		uint32* Bits = CellBits.data() + static_cast<size_t>(InCell) * WordCount;
+
+		for (uint32 Sample = 0; Sample < SampleCount; ++Sample)
+		{
+			const FVector& Offset = SampleOffsets[Sample];
+			const FVector Origin(CellMin.X + CellExtent.X * Offset.X, CellMin.Y + CellExtent.Y * Offset.Y, CellMin.Z + CellExtent.Z * Offset.Z);
+			for (uint32 Ray = 0; Ray < RayCount; ++Ray)
+			{
+				const int32 Hit = Scene.CastRay(Origin, Directions[static_cast<size_t>(Sample) * RayCount + Ray]);
+				if (Hit >= 0)
+				{
+					Bits[Hit / 32] |= 1u << (Hit % 32);
+				}
+			}
+		}
+	});
+
+	// 6. 이웃 셀 합치기
+	if (InSettings.bMergeNeighbourCells)
+	{
+		const TArray<uint32> SourceBits = CellBits;
+		ParallelFor(CellCount, [&](uint32 InCell)
+		{
+			const int32 X = static_cast<int32>(InCell % CellCountX);
+			const int32 Y = static_cast<int32>((InCell / CellCountX) % CellCountY);
+			const int32 Z = static_cast<int32>(InCell / (CellCountX * CellCountY));
+			const int32 Neighbours[6][3] = { {-1, 0, 0}, {1, 0, 0}, {0, -1, 0}, {0, 1, 0}, {0, 0, -1}, {0, 0, 1} };
+
+			uint32* Bits = CellBits.data() + static_cast<size_t>(InCell) * WordCount;
+			for (const int32* Step : Neighbours)
+			{
+				const int32 NX = X + Step[0];
+				const int32 NY = Y + Step[1];
+				const int32 NZ = Z + Step[2];
+				if (NX < 0 || NY < 0 || NZ < 0 || NX >= static_cast<int32>(CellCountX) || NY >= static_cast<int32>(CellCountY) || NZ >= static_cast<int32>(CellCountZ))
+				{
+					continue;
+				}
+
+				const size_t Neighbour = (static_cast<size_t>(NZ) * CellCountY + NY) * CellCountX + NX;
+				const uint32* NeighbourBits = SourceBits.data() + Neighbour * WordCount;
+				for (uint32 Word = 0; Word < WordCount; ++Word)
+				{
+					Bits[Word] |= NeighbourBits[Word];
+				}
+			}
+		});
+	}
+
+	// 7. 압축 후 내용이 같은 셀끼리 집합을 공유한다
+	TArray<TArray<uint32>> CompressedCells(CellCount);
+	ParallelFor(CellCount, [&](uint32 InCell)
+	{
+		CompressBits(CellBits.data() + static_cast<size_t>(InCell) * WordCount, WordCount, CompressedCells[InCell]);
+	});
+
+	TMap<uint64, TArray<uint32>> SetsByHash;
+	TArray<uint32> SetCells;
+	CellSets.resize(CellCount);
+	SetOffsets.push_back(0);
+	for (uint32 Cell = 0; Cell < CellCount; ++Cell)
+	{
+		const TArray<uint32>& Compressed = CompressedCells[Cell];
+		TArray<uint32>& Candidates = SetsByHash[HashWords(Compressed)];
+
+		uint32 SetIndex = INVALID_SET;
+		for (uint32 Candidate : Candidates)
+		{
+			if (CompressedCells[SetCells[Candidate]] == Compressed)
+			{
+				SetIndex = Candidate;
+				break;
+			}
+		}
+
+		if (SetIndex == INVALID_SET)
+		{
+			SetIndex = static_cast<uint32>(SetCells.size());
+			SetCells.push_back(Cell);
+			Candidates.push_back(SetIndex);
+			SetWords.insert(SetWords.end(), Compressed.begin(), Compressed.end());
+			SetOffsets.push_back(static_cast<uint32>(SetWords.size()));
+		}
+		CellSets[Cell] = SetIndex;
+	}
+
+	Primitives = std::move(BakePrimitives);
+	for (uint32 Index = 0; Index < PrimitiveCount; ++Index)
+	{
+		PrimitiveIndices[Primitives[Index]] = Index;
+	}
+	bIsBound = true;
+	Revision = ++RevisionCounter;
+
+	const double ElapsedMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+	UE_LOG("PVS: 베이크 완료 (프리미티브 %u개, 오클루더 %u개, 셀 %ux%ux%u, 고유 집합 %u개, %zu bytes (원본 %zu bytes), %.1f ms)",
+		PrimitiveCount, OccluderCount, CellCountX, CellCountY, CellCountZ, GetSetCount(),
+		GetCompressedSize(), static_cast<size_t>(CellCount) * WordCount * sizeof(uint32), ElapsedMs);
+	return true;
+}
+
+bool FPotentiallyVisibleSet::Save(const std::filesystem::path& InFilePath)
+{
+	if (!bIsBound)
+	{
+		return false;
+	}
+
+	FWindowsBinWriter Writer(InFilePath);
+	uint32 Magic = FILE_MAGIC;
+	uint32 Version = FILE_VERSION;
+	Writer << Magic << Version;
+	Writer << GridMin << CellExtent << CellCountX << CellCountY << CellCountZ;
+	Writer << PrimitiveKeys << CellSets << SetOffsets << SetWords;
+
+	UE_LOG("PVS: 저장 완료: %s", InFilePath.string().c_str());
+	return true;
+}
+
+bool FPotentiallyVisibleSet::Load(const std::filesystem::path& InFilePath, ULevel* InLevel)
+{
+	Reset();
+	if (!std::filesystem::exists(InFilePath))
+	{
+		return false;
+	}
+
+	try
+	{
+		FWindowsBinReader Reader(InFilePath);
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		Reader << Magic << Version;
+		if (Magic != FILE_MAGIC || Version != FILE_VERSION)
+		{
+			UE_LOG_WARNING("PVS: 지원하지 않는 파일입니다: %s", InFilePath.string().c_str());
+			return false;
+		}
+
+		Reader << GridMin << CellExtent << CellCountX << CellCountY << CellCountZ;
+		Reader << PrimitiveKeys << CellSets << SetOffsets << SetWords;
+	}
+	catch (const exception& Exception)
+	{
+		UE_LOG_ERROR("PVS: 파일 로드 중 예외 발생: %s", Exception.what());
+		Reset();
+		return false;
+	}
+
+	if (!ValidateSets())
+	{
+		UE_LOG_WARNING("PVS: 손상된 파일입니다: %s", InFilePath.string().c_str());
+		Reset();
+		return false;
+	}
+
+	return Bind(InLevel);
+}
+
+bool FPotentiallyVisibleSet::Bind(ULevel* InLevel)
+{
+	Primitives.clear();
+	PrimitiveIndices.clear();
+	bIsBound = false;
+	Revision = ++RevisionCounter;
+
+	if (!InLevel || PrimitiveKeys.empty())
+	{
+		return false;
+	}
+
+	TArray<UPrimitiveComponent*> LevelPrimitives;
+	TArray<FPrimitiveKey> LevelKeys;
+	GatherStaticPrimitives(InLevel, LevelPrimitives, LevelKeys);
+
+	if (LevelKeys != PrimitiveKeys)
+	{
+		UE_LOG_WARNING("PVS: 레벨의 정적 프리미티브가 베이크 당시와 다릅니다. 다시 베이크해야 합니다");
+		return false;
+	}
+
+	Primitives = std::move(LevelPrimitives);
+	for (uint32 Index = 0; Index < static_cast<uint32>(Primitives.size()); ++Index)
+	{
+		PrimitiveIndices[Primitives[Index]] = Index;
+	}
+	bIsBound = true;
+
+	UE_LOG("PVS: 바인딩 완료 (프리미티브 %u개, 셀 %u개, 고유 집합 %u개)", GetPrimitiveCount(), GetCellCount(), GetSetCount());
+	return true;
+}
+
+void FPotentiallyVisibleSet::Reset()
+{
+	GridMin = FVector::ZeroVector();
+	CellExtent = FVector::ZeroVector();
+	CellCountX = CellCountY = CellCountZ = 0;
+	PrimitiveKeys.clear();
+	CellSets.clear();
+	SetOffsets.clear();
+	SetWords.clear();
+	Primitives.clear();
+	PrimitiveIndices.clear();
+	bIsBound = false;
+	Revision = ++RevisionCounter;
+}
+
+bool FPotentiallyVisibleSet::Contains(const UPrimitiveComponent* InPrimitive) const
+{
+	return bIsBound && PrimitiveIndices.find(InPrimitive) != PrimitiveIndices.end();
+}
+
+uint32 FPotentiallyVisibleSet::FindSet(const FVector& InLocation) const
+{
+	if (!bIsBound)
+	{
+		return INVALID_SET;
+	}
+
+	const float LocalX = (InLocation.X - GridMin.X) / CellExtent.X;
+	const float LocalY = (InLocation.Y - GridMin.Y) / CellExtent.Y;
+	const float LocalZ = (InLocation.Z - GridMin.Z) / CellExtent.Z;
+	if (!(LocalX >= 0.0f && LocalY >= 0.0f && LocalZ >= 0.0f))
+	{
+		return INVALID_SET;
+	}
+
+	const uint32 X = static_cast<uint32>(LocalX);
+	const uint32 Y = static_cast<uint32>(LocalY);
+	const uint32 Z = static_cast<uint32>(LocalZ);
+	if (X >= CellCountX || Y >= CellCountY || Z >= CellCountZ)
+	{
+		return INVALID_SET;
+	}
+
+	return CellSets[(static_cast<size_t>(Z) * CellCountY + Y) * CellCountX + X];
+}
+
+void FPotentiallyVisibleSet::DecodeSet(uint32 InSetIndex, TArray<uint32>& OutBits) const
+{
+	OutBits.assign(GetWordCount(), 0u);
+
+	uint32 Position = 0;
+	for (uint32 Offset = SetOffsets[InSetIndex]; Offset < SetOffsets[InSetIndex + 1];)
+	{
+		const uint32 Header = SetWords[Offset++];
+		Position += Header >> 16;
+		const uint32 LiteralCount = Header & MAX_RUN_LENGTH;
+		std::copy(SetWords.begin() + Offset, SetWords.begin() + Offset + LiteralCount, OutBits.begin() + Position);
+		Offset += LiteralCount;
+		Position += LiteralCount;
+	}
+}
+
+std::filesystem::path FPotentiallyVisibleSet::GetFilePath(const std::filesystem::path& InScenePath)
+{
+	std::filesystem::path FilePath = InScenePath;
+	FilePath.replace_extension(".pvs");
+	return FilePath;
+}
+
+void FPotentiallyVisibleSet::GatherStaticPrimitives(ULevel* InLevel, TArray<UPrimitiveComponent*>& OutPrimitives, TArray<FPrimitiveKey>& OutKeys)
+{
+	OutPrimitives.clear();
+	OutKeys.clear();
+
+	FOctree* StaticOctree = InLevel->GetStaticOctree();
+	if (!StaticOctree)
+	{
+		return;
+	}
+
+	auto Quantize = [](float InValue)
+	{
+		const float Scaled = std::round(InValue / KEY_PRECISION);
+		return static_cast<int32>(std::clamp(Scaled, -2.0e9f, 2.0e9f));
+	};
+
+	TArray<TPair<FPrimitiveKey, UPrimitiveComponent*>> Entries;
+	for (AActor* Actor : InLevel->GetLevelActors())
+	{
+		if (!Actor)
+		{
+			continue;
+		}
+
+		const TArray<UActorComponent*>& Components = Actor->GetOwnedComponents();
+		for (uint32 ComponentIndex = 0; ComponentIndex < static_cast<uint32>(Components.size()); ++ComponentIndex)
+		{
+			UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Components[ComponentIndex]);
+			if (!Primitive || !StaticOctree->Contains(Primitive))
+			{
+				continue;
+			}
+
+			FVector Min, Max;
+			Primitive->GetWorldAABB(Min, Max);
+
+			FPrimitiveKey Key;
+			Key.Bounds[0] = Quantize(Min.X);
+			Key.Bounds[1] = Quantize(Min.Y);
+			Key.Bounds[2] = Quantize(Min.Z);
+			Key.Bounds[3] = Quantize(Max.X);
+			Key.Bounds[4] = Quantize(Max.Y);
+			Key.Bounds[5] = Quantize(Max.Z);
+			Key.ComponentIndex = ComponentIndex;
+			Entries.emplace_back(Key, Primitive);
+		}
+	}
+
+	std::stable_sort(Entries.begin(), Entries.end(),
+		[](const TPair<FPrimitiveKey, UPrimitiveComponent*>& A, const TPair<FPrimitiveKey, UPrimitiveComponent*>& B) { return A.first < B.first; });
+
+	OutPrimitives.reserve(Entries.size());
+	OutKeys.reserve(Entries.size());
+	for (const auto& Entry : Entries)
+	{
+		OutKeys.push_back(Entry.first);
+		OutPrimitives.push_back(Entry.second);
+	}
+}
+
+bool FPotentiallyVisibleSet::FPrimitiveKey::operator<(const FPrimitiveKey& InOther) const
+{
+	for (int32 Index = 0; Index < 6; ++Index)
+	{
+		if (Bounds[Index] != InOther.Bounds[Index])
+		{
+			return Bounds[Index] < InOther.Bounds[Index];
+		}
+	}
+	return ComponentIndex < InOther.ComponentIndex;
+}
+
+bool FPotentiallyVisibleSet::FPrimitiveKey::operator==(const FPrimitiveKey& InOther) const
+{
+	return std::equal(Bounds, Bounds + 6, InOther.Bounds) && ComponentIndex == InOther.ComponentIndex;
+}
+
+void FPotentiallyVisibleSet::CompressBits(const uint32* InBits, uint32 InWordCount, TArray<uint32>& OutWords)
+{
+	OutWords.clear();
+
+	uint32 Position = 0;
+	while (Position < InWordCount)
+	{
+		uint32 ZeroCount = 0;
+		while (Position < InWordCount && InBits[Position] == 0 && ZeroCount < MAX_RUN_LENGTH)
+		{
+			++Position;
+			++ZeroCount;
+		}
+
+		// 끝까지 0이면 헤더를 남기지 않는다. (풀 때 0으로 채운다)
+		if (Position == InWordCount)
+		{
+			break;
+		}
+
+		// 0 워드 하나는 새 헤더보다 리터럴로 두는 편이 작으므로, 0이 두 개 이상 이어질 때만 리터럴을 끊는다
+		const uint32 LiteralBegin = Position;
+		while (Position < InWordCount && Position - LiteralBegin < MAX_RUN_LENGTH)
+		{
+			if (InBits[Position] == 0 && (Position + 1 == InWordCount || InBits[Position + 1] == 0))
+			{
+				break;
+			}
+			++Position;
+		}
+
+		const uint32 LiteralCount = Position - LiteralBegin;
+		OutWords.push_back((ZeroCount << 16) | LiteralCount);
+		OutWords.insert(OutWords.end(), InBits + LiteralBegin, InBits + Position);
+	}
+}
+
+bool FPotentiallyVisibleSet::ValidateSets() const
+{
+	if (PrimitiveKeys.empty() || SetOffsets.empty() || SetOffsets.front() != 0 || SetOffsets.back() != SetWords.size())
+	{
+		return false;
+	}
+	if (CellSets.size() != static_cast<size_t>(CellCountX) * CellCountY * CellCountZ
+		|| !(CellExtent.X > 0.0f && CellExtent.Y > 0.0f && CellExtent.Z > 0.0f))
+	{
+		return false;
+	}
+
+	const uint32 SetCount = GetSetCount();
+	for (uint32 SetIndex : CellSets)
+	{
+		if (SetIndex >= SetCount)
+		{
+			return false;
+		}
+	}
+
+	const uint32 WordCount = GetWordCount();
+	for (uint32 SetIndex = 0; SetIndex < SetCount; ++SetIndex)
+	{
+		if (SetOffsets[SetIndex] > SetOffsets[SetIndex + 1])
+		{
+			return false;
+		}
+
+		uint64 Position = 0;
+		for (uint32 Offset = SetOffsets[SetIndex]; Offset < SetOffsets[SetIndex + 1];)
+		{
+			const uint32 Header = SetWords[Offset++];
+			const uint32 LiteralCount = Header & MAX_RUN_LENGTH;
+			Position += (Header >> 16) + LiteralCount;
+			Offset += LiteralCount;
+			if (Position > WordCount || Offset > SetOffsets[SetIndex + 1])
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+class UPrimitiveComponent;
+struct FCameraConstants;
+
+/** @brief 한 번의 PerformCulling 결과 통계 (UStatOverlay 표시용) */
+struct FContributionStats
+{
+	uint32 TestedCount = 0;
+	uint32 SizeCulledCount = 0;
+	uint32 DistanceCulledCount = 0;
+	float TestMs = 0.0f;
+};
+
+/**
+ * @brief 화면 기여도 컬링 (Screen Size / Draw Distance Culling)
+ * 프리미티브의 월드 AABB를 감싸는 구(중심 = AABB 중심, 반지름 = 대각선의 절반)를 현재 투영으로 화면에 투영해,
+ * 투영된 지름(픽셀)이 최소 화면 크기보다 작거나 카메라로부터 최대 그리기 거리보다 먼 프리미티브를 걸러낸다.
+ * 원근 투영에서 구의 투영 반지름은 PixelScale * R / sqrt(D^2 - R^2)이며 (D = 카메라와 구 중심 사이 거리),
+ * 양변을 제곱해 비교하므로 프리미티브마다 제곱근을 구하지 않는다. 카메라가 구 안에 있으면 항상 보이는 것으로 둔다.
+ * 직교 투영에서는 거리와 무관하게 지름 * PixelScale로 판정하며, 최대 그리기 거리는 적용하지 않는다.
+ * 프리미티브별 값(UPrimitiveComponent::GetMinScreenSize / GetMaxDrawDistance)이 없으면 DEFAULT_MIN_SCREEN_SIZE를 쓴다.
+ * 화면 크기에 맞춰 스케일되는 빌보드(에디터 아이콘)는 월드 AABB가 화면 크기를 나타내지 않으므로 검사하지 않는다.
+ */
+class FContributionCuller
+{
+public:
+	/** @brief 프리미티브가 최소 화면 크기를 지정하지 않았을 때 쓰는 값 (투영된 지름, 픽셀) */
+	static constexpr float DEFAULT_MIN_SCREEN_SIZE = 1.0f;
+
+	/**
+	 * @brief 현재 뷰의 카메라 위치와 투영, 뷰포트 크기(픽셀)를 설정한다.
+	 * 매 프레임 컬링을 시작하기 전에 호출되어야 함
+	 */
+	void InitializeCuller(const FCameraConstants& InViewProj, float InViewportWidth, float InViewportHeight);
+
+	/**
+	 * @brief InOutPrimitives에서 화면 기여도가 낮은 프리미티브를 제거한다. 남은 프리미티브의 순서는 유지된다.
+	 * @param InOutPrimitives 프러스텀 컬링을 통과한 프리미티브 목록
+	 */
+	void PerformCulling(TArray<UPrimitiveComponent*>& InOutPrimitives);
+
+	/** @brief 월드 공간 구의 투영된 지름(픽셀). 원근 투영에서 카메라가 구 안에 있으면 무한대 */
+	float ComputeScreenSize(const FVector& InCenter, float InRadius) const;
+
+	const FContributionStats& GetStats() const { return Stats; }
+
+private:
+	FVector ViewLocation;
+	/** @brief 원근 투영: 거리 1에서 월드 단위 1이 차지하는 픽셀 수, 직교 투영: 월드 단위 1이 차지하는 픽셀 수 */
+	float PixelScale = 0.0f;
+	bool bIsPerspective = true;
+
+	FContributionStats Stats;
+};
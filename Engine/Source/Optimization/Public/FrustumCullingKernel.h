@@ -0,0 +1,65 @@
+#pragma once
+
+class UPrimitiveComponent;
+struct FFrustum;
+
+/**
+ * @brief SIMD 절두체 컬링 커널
+ * 평면 6개의 X/Y/Z/W 성분을 8레인으로 미리 복제해 두고, 축별로 나뉜(SoA) AABB를 SSE 4개 / AVX 8개 단위로 검사한다.
+ * 박스에서 평면까지의 최소 거리는 축마다 min(P * Min, P * Max)의 합 + W이며, 이 값이 0보다 크면 박스는 평면 바깥이다.
+ * (FFrustum::CheckIntersection의 negative vertex 판정과 같은 결과를 분기 없이 계산한다)
+ * 결과는 보이는(Outside가 아닌) 박스의 비트가 1인 32비트 마스크 배열로 기록된다.
+ */
+struct alignas(32) FFrustumCullingKernel
+{
+	static constexpr uint32 LANE_COUNT = 8;
+
+	explicit FFrustumCullingKernel(const FFrustum& InFrustum);
+
+	/**
+	 * @brief InCount개의 박스를 검사해 OutVisibleMask[i / 32]의 (i % 32)번째 비트에 가시 여부를 쓴다.
+	 * OutVisibleMask는 GetMaskWordCount(InCount)개 이상의 워드를 가져야 한다. 빌드 옵션에 따라 SSE/AVX 중 넓은 쪽을 사용한다.
+	 */
+	void CullBoxes(const float* InMinX, const float* InMinY, const float* InMinZ,
+		const float* InMaxX, const float* InMaxY, const float* InMaxZ, uint32 InCount, uint32* OutVisibleMask) const;
+
+	void CullBoxesSSE(const float* InMinX, const float* InMinY, const float* InMinZ,
+		const float* InMaxX, const float* InMaxY, const float* InMaxZ, uint32 InCount, uint32* OutVisibleMask) const;
+	void CullBoxesAVX(const float* InMinX, const float* InMinY, const float* InMinZ,
+		const float* InMaxX, const float* InMaxY, const float* InMaxZ, uint32 InCount, uint32* OutVisibleMask) const;
+
+	/** @brief 박스 하나를 같은 방식으로 스칼라 검사한다. (SIMD 폭에 못 미치는 나머지 처리용) */
+	bool IsBoxVisible(float InMinX, float InMinY, float InMinZ, float InMaxX, float InMaxY, float InMaxZ) const;
+
+	static uint32 GetMaskWordCount(uint32 InCount) { return (InCount + 31) / 32; }
+
+	float PlaneX[6][LANE_COUNT];
+	float PlaneY[6][LANE_COUNT];
+	float PlaneZ[6][LANE_COUNT];
+	float PlaneW[6][LANE_COUNT];
+};
+
+/**
+ * @brief FFrustumCullingKernel 입력용 SoA 경계 버퍼
+ * 프리미티브의 월드 AABB를 축별 배열로 모아 두고 한 번에 컬링한다. 배열은 Reset 후에도 용량을 유지하므로 매 프레임 재사용한다.
+ */
+struct FPrimitiveBoundsSoA
+{
+	TArray<float> MinX, MinY, MinZ;
+	TArray<float> MaxX, MaxY, MaxZ;
+	TArray<UPrimitiveComponent*> Primitives;
+	TArray<uint32> VisibleMask;
+
+	void Reset();
+	void Add(UPrimitiveComponent* InPrimitive, const FVector& InMin, const FVector& InMax);
+	/** @brief 프리미티브의 GetWorldAABB를 중간 FAABB 없이 바로 배열에 기록한다. */
+	void AddPrimitive(UPrimitiveComponent* InPrimitive);
+	uint32 Num() const { return static_cast<uint32>(Primitives.size()); }
+
+	/** @brief 모은 박스 전체를 컬링해 VisibleMask를 채운다. */
+	void Cull(const FFrustumCullingKernel& InKernel);
+	bool IsVisible(uint32 InIndex) const { return (VisibleMask[InIndex / 32] >> (InIndex % 32)) & 1u; }
+
+	/** @brief Cull 결과 절두체와 겹치는 프리미티브를 OutPrimitives에 추가한다. (IsVisible 검사는 모을 때 한다) */
+	void AppendVisible(TArray<UPrimitiveComponent*>& OutPrimitives) const;
+};
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "Optimization/Public/ViewVolumeCuller.h"
+
+class FOctree;
+class FDynamicAABBTree;
+class FPotentiallyVisibleSet;
+
+/** @brief 한 번의 Cull 결과 통계 */
+struct FMultiViewCullStats
+{
+	uint32 ViewCount = 0;
+	uint32 VisitedNodeCount = 0;
+	/** @brief 노드가 걸쳐 있어 프리미티브별로 검사한 후보 수 (뷰 수와 무관하게 한 번씩 센다) */
+	uint32 TestedPrimitiveCount = 0;
+	uint32 VisiblePrimitiveCount = 0;
+	float CullMs = 0.0f;
+};
+
+/**
+ * @brief 여러 뷰(쿼드 뷰포트)의 절두체 컬링을 한 번의 트리 순회로 처리한다.
+ * 노드마다 아직 판정이 끝나지 않은 뷰의 비트 마스크와 뷰별 평면 마스크를 함께 들고 내려가며,
+ * 모든 뷰에서 바깥인 노드는 버리고, 완전히 안쪽인 뷰는 비트만 남겨 하위 노드에서 다시 검사하지 않는다.
+ * 노드가 걸친 프리미티브는 한 번만 SoA 버퍼에 모은 뒤 뷰마다 SIMD 커널을 돌려 보이는 뷰의 비트를 켠다.
+ * 결과는 프리미티브 배열과 같은 길이의 뷰 마스크 배열이며, 각 뷰포트의 목록은 GetViewPrimitives로 비트를 골라 만든다.
+ *
+ * PVS 셀 안에 있는 원근 뷰는 정적 프리미티브를 옥트리 대신 PVS 집합으로 따로 모으므로,
+ * 같은 정적 프리미티브가 (서로 겹치지 않는 뷰 비트로) 두 번 나올 수 있다. 한 뷰의 목록에는 항상 한 번만 들어간다.
+ */
+class FMultiViewCuller
+{
+public:
+	/** @brief 뷰 마스크가 uint8이므로 최대 8개. 노드의 평면 힌트도 뷰마다 3비트씩 uint32 하나에 담는다 */
+	static constexpr uint32 MAX_VIEWS = 8;
+	static constexpr uint32 INVALID_VIEW = 0xFFFFFFFFu;
+
+	/** @brief 등록한 뷰를 모두 지운다. 매 프레임 뷰를 다시 등록하기 전에 호출한다. */
+	void ResetViews();
+
+	/**
+	 * @brief 컬링할 뷰를 추가한다.
+	 * @param InPVS 주어지고 시점이 그 격자 안에 있으면 이 뷰의 정적 후보를 PVS 집합으로 제한한다
+	 * @return 뷰 인덱스(결과 마스크의 비트 번호). 뷰가 가득 찼으면 INVALID_VIEW
+	 */
+	uint32 AddView(const FCameraConstants& InViewProj, const FPotentiallyVisibleSet* InPVS = nullptr);
+	uint32 GetViewCount() const { return ViewCount; }
+
+	/**
+	 * @brief 등록한 모든 뷰를 한 번의 순회로 컬링한다.
+	 * @param InUnboundedPrimitives 경계가 없어 트리에 들어가지 못한 프리미티브. 검사 없이 모든 뷰에 보이는 것으로 추가한다
+	 */
+	void Cull(const FOctree* StaticOctree, const FDynamicAABBTree* DynamicTree, const TArray<UPrimitiveComponent*>& InUnboundedPrimitives);
+
+	const TArray<UPrimitiveComponent*>& GetPrimitives() const { return Primitives; }
+	/** @brief GetPrimitives()[i]가 보이는 뷰의 비트 마스크 */
+	const TArray<uint8>& GetViewMasks() const { return ViewMasks; }
+
+	/** @brief InViewIndex 뷰에 보이는 프리미티브를 결과 순서대로 OutPrimitives에 담는다. */
+	void GetViewPrimitives(uint32 InViewIndex, TArray<UPrimitiveComponent*>& OutPrimitives) const;
+
+	const FMultiViewCullStats& GetStats() const { return Stats; }
+
+private:
+	void CullOctree(const FOctree* InOctree, uint8 InViewMask);
+	void CullDynamicTree(const FDynamicAABBTree& InTree, uint8 InViewMask);
+	/** @brief InViewIndex 뷰 카메라 셀의 PVS 집합을 PendingBounds에 모은다. 카메라가 격자 밖이면 false */
+	bool GatherPVSCandidates(uint32 InViewIndex);
+
+	/**
+	 * @brief InOutPendingViews의 뷰마다 박스를 검사한다.
+	 * 바깥인 뷰는 비트를 끄고, 완전히 안쪽인 뷰는 InOutPendingViews에서 InOutInsideViews로 옮긴다.
+	 * 평면 마스크는 뷰마다 8비트씩 InOutPlaneMasks에, 지난 프레임에 박스를 잘라낸 평면은 뷰마다 3비트씩 InOutRejectingPlanes에 담겨 있다.
+	 */
+	void ClassifyBox(const FAABB& InBox, uint8& InOutPendingViews, uint8& InOutInsideViews, uint64& InOutPlaneMasks,
+		uint32& InOutRejectingPlanes) const;
+
+	/** @brief 박스 검사가 필요한 후보를 모은다. InPendingViews 뷰는 SIMD로 검사하고, InInsideViews 뷰는 검사 없이 보인다. */
+	void AddPending(UPrimitiveComponent* InPrimitive, const FVector& InMin, const FVector& InMax, uint8 InPendingViews, uint8 InInsideViews);
+	/** @brief 모은 후보를 뷰마다 한 번씩 컬링하고, 보이는 뷰가 하나라도 있는 후보를 결과에 추가한다. */
+	void ResolvePending();
+
+	void AddResult(UPrimitiveComponent* InPrimitive, uint8 InViewMask)
+	{
+		Primitives.push_back(InPrimitive);
+		ViewMasks.push_back(InViewMask);
+	}
+
+	static uint64 GetAllPlanesMask(uint8 InViewMask);
+
+	struct FView
+	{
+		FFrustum Frustum;
+		FVector Location;
+		const FPotentiallyVisibleSet* PVS = nullptr;
+	};
+
+	/** @brief 옥트리 순회 스택 항목 */
+	struct FOctreeEntry
+	{
+		const FOctree* Node;
+		uint8 PendingViews;
+		uint8 InsideViews;
+		uint64 PlaneMasks;
+	};
+
+	/** @brief 동적 AABB 트리 순회 스택 항목 */
+	struct FDynamicEntry
+	{
+		int32 NodeIndex;
+		uint8 PendingViews;
+		uint8 InsideViews;
+		uint64 PlaneMasks;
+	};
+
+	FView Views[MAX_VIEWS];
+	uint32 ViewCount = 0;
+
+	TArray<UPrimitiveComponent*> Primitives;
+	TArray<uint8> ViewMasks;
+
+	// 프레임 사이에 재사용하는 버퍼
+	FPrimitiveBoundsSoA PendingBounds;
+	TArray<uint8> PendingViewMasks;
+	TArray<uint8> PendingInsideMasks;
+	TArray<FOctreeEntry> OctreeStack;
+	TArray<FDynamicEntry> DynamicStack;
+	TArray<UPrimitiveComponent*> SubtreePrimitives;
+
+	/** @brief 뷰 슬롯마다 마지막으로 풀어 둔 PVS 집합. 카메라가 같은 집합의 셀에 머무는 동안 다시 풀지 않는다 */
+	struct FPVSCache
+	{
+		const FPotentiallyVisibleSet* PVS = nullptr;
+		uint32 Revision = 0;
+		uint32 SetIndex = 0xFFFFFFFFu;
+		TArray<uint32> Bits;
+	};
+	FPVSCache PVSCaches[MAX_VIEWS];
+
+	FMultiViewCullStats Stats;
+};
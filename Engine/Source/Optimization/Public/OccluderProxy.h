@@ -0,0 +1,74 @@
+#pragma once
+
+/** @brief 오클루더 프록시를 어떤 방식으로 만들었는지 (에셋별 플래그) */
+enum class EOccluderProxyType : uint8
+{
+	None,	// 프록시 없음. 이 메시는 오클루더로 사용하지 않는다
+	Box,	// 닫힌 박스형 메시. 로컬 AABB 자체가 프록시
+	Voxel,	// 복셀화한 내부 영역을 박스 몇 개로 합친 프록시
+};
+
+/**
+ * @brief 소프트웨어 오클루전 컬링용 저폴리 오클루더 메시 (로컬 공간)
+ * 원본 메시 안쪽에 완전히 들어가는 박스들로 구성되므로, 이 메시가 가리는 영역은 원본 메시도 반드시 가린다.
+ * 삼각형은 바깥에서 봤을 때 FOccluderProxy::BOX_TRIANGLE_INDICES와 같은 방향으로 감겨 있다.
+ */
+struct FOccluderProxy
+{
+	EOccluderProxyType Type = EOccluderProxyType::None;
+	TArray<FVector> Vertices;
+	TArray<uint32> Indices;
+
+	bool IsValid() const { return Type != EOccluderProxyType::None && !Indices.empty(); }
+	void Reset();
+	/** @brief 박스 하나(꼭짓점 8개, 삼각형 12개)를 추가한다. */
+	void AddBox(const FVector& InMin, const FVector& InMax);
+
+	/**
+	 * @brief 박스 꼭짓점 순서: 0=(m,m,m) 1=(M,m,m) 2=(M,M,m) 3=(m,M,m), 4~7은 같은 순서로 Z만 Max
+	 * 이 순서로 만든 12개 삼각형. 바깥에서 봤을 때 화면 기준 반시계가 되도록 감겨 있다.
+	 */
+	static constexpr uint8 BOX_TRIANGLE_INDICES[36] =
+	{
+		0, 2, 1,  0, 3, 2, // -Z
+		4, 5, 6,  4, 6, 7, // +Z
+		0, 4, 7,  0, 7, 3, // -X
+		1, 2, 6,  1, 6, 5, // +X
+		0, 1, 5,  0, 5, 4, // -Y
+		3, 7, 6,  3, 6, 2, // +Y
+	};
+};
+
+/**
+ * @brief 스태틱 메시로부터 보수적인(원본 안쪽의) 오클루더 프록시를 만드는 오프라인 빌더
+ * 1. 닫힌 메시의 부피가 로컬 AABB와 사실상 같으면 AABB 하나를 프록시로 쓴다.
+ * 2. 그 외에는 로컬 AABB를 축마다 VOXEL_RESOLUTION칸으로 나누고, 삼각형이 지나는 칸을 표면으로 표시한다.
+ *    바깥 테두리에서 표면이 아닌 칸을 따라 Flood Fill한 뒤 남은 칸이 메시 내부이며, 이를 Greedy하게 박스로 합친다.
+ *    축마다 칸 수가 같으므로 얇은 벽이나 판도 두께 방향으로 내부 칸이 생긴다.
+ * 구멍이 있어 내부가 바깥과 이어진 메시는 내부 칸이 없으므로 프록시를 만들지 않는다.
+ */
+class FOccluderProxyBuilder
+{
+public:
+	static constexpr uint32 VOXEL_RESOLUTION = 16;
+	/** @brief 프록시에 남길 최대 박스 수 (부피가 큰 순서) */
+	static constexpr uint32 MAX_PROXY_BOX_COUNT = 8;
+	/** @brief 로컬 AABB 부피 대비 이 비율보다 작은 박스는 오클루더로서 의미가 없으므로 버린다 */
+	static constexpr float MIN_BOX_VOLUME_RATIO = 0.02f;
+	/** @brief 닫힌 메시의 부피가 로컬 AABB 부피 대비 이 비율 이상이면 AABB를 그대로 프록시로 쓴다 */
+	static constexpr float BOX_MESH_VOLUME_RATIO = 0.999f;
+
+	/**
+	 * @brief 메시의 정점/인덱스로부터 프록시를 만든다.
+	 * @return 프록시가 만들어졌으면 true. false라면 OutProxy.Type은 None이다.
+	 */
+	static bool Build(const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, FOccluderProxy& OutProxy);
+
+private:
+	/** @brief 위치가 같은 정점을 합쳤을 때 모든 변이 정확히 두 삼각형에 공유되는지 검사한다. */
+	static bool IsClosedMesh(const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices);
+	/** @brief 삼각형들의 부호 있는 부피 합 (닫힌 메시에서만 의미가 있다) */
+	static float ComputeSignedVolume(const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices);
+	static void BuildVoxelBoxes(const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices,
+		const FVector& InMin, const FVector& InMax, FOccluderProxy& OutProxy);
+};
@@ -1,10 +1,42 @@
 ﻿#pragma once
 
-/**
- * @brief Occlusion Culling 을 담당하는 클래스
- */
 class UPrimitiveComponent;
+struct FOccluderProxy;
 
+/** @brief 한 번의 PerformCulling 결과 통계 (UStatOverlay 표시용) */
+struct FOcclusionStats
+{
+    uint32 OccluderCount = 0;
+    uint32 RasterizedTriangleCount = 0;
+    uint32 TestedCount = 0;
+    uint32 OccludedCount = 0;
+    float RasterizeMs = 0.0f;
+    float TestMs = 0.0f;
+
+    // 시간적 재투영 모드에서만 채워진다
+    uint32 ReprojectedTileCount = 0;
+    uint32 SkippedOccluderCount = 0;
+    uint32 LikelyVisibleCount = 0;
+};
+
+/**
+ * @brief 마스크 기반 소프트웨어 오클루전 컬링 (Masked Software Occlusion Culling)
+ * CPU 깊이 버퍼를 32x8 픽셀 타일로 나누고, 타일마다 픽셀별 깊이 대신 행 단위 커버리지 비트마스크와
+ * 보수적인 최대 깊이 두 개만 저장한다.
+ * - Z0: 타일의 모든 픽셀에 대한 오클루더 깊이 상한 (계층 Z)
+ * - Z1 / Mask: 작업 레이어. Mask에 켜진 픽셀의 오클루더 깊이 상한
+ * 작업 레이어가 타일을 가득 채우면 Z0로 병합한다. 깊이는 NDC Z(0 = Near, 1 = Far)를 사용한다.
+ * 오클루더로는 임포트 시 만든 에셋별 오클루더 프록시(FOccluderProxy)를 사용하며, 프록시가 없는 메시는 오클루디로만 검사한다.
+ * 오클루더 삼각형은 화면을 가로 밴드로 나누어 비닝한 뒤 밴드마다 워커 스레드에서 래스터라이즈하며(밴드끼리 타일을 공유하지 않는다),
+ * 오클루디 검사도 묶음 단위로 나누어 병렬로 수행한다.
+ *
+ * 시간적 재투영 모드에서는 이전 프레임의 타일별 깊이 상한(Z0)을 타일 크기의 사각형으로 현재 뷰에 재투영해 깊이 버퍼를 먼저 채운다.
+ * 재투영으로 덮이지 않은 구멍 타일에 걸친 오클루더만 래스터라이즈하고, 지난 프레임에 보였던 오클루디는
+ * TEMPORAL_RETEST_INTERVAL 프레임에 한 번만 다시 검사한다(나머지 프레임은 검사 없이 보이는 것으로 둔다).
+ * 재투영 깊이는 카메라가 움직이면 근사가 되고 움직이는 오클루더를 반영하지 못하므로,
+ * TEMPORAL_REFRESH_INTERVAL 프레임마다 기록 없이 깊이 버퍼를 새로 만든다.
+ * 뷰마다 기록이 따로 필요하므로 뷰(뷰포트)마다 인스턴스를 하나씩 사용한다.
+ */
 class COcclusionCuller
 {
 public:
@@ -18,83 +50,143 @@ public:
 
      /**
      * @brief 오클루전 컬링의 전체 프로세스를 실행하고 최종 가시 오브젝트 목록을 반환
-     * @param AllStaticMeshes 프러스텀 컬링을 통과한 모든 스태틱 메시 목록
+     * 스태틱 메시만 오클루더/오클루디로 사용하며, 나머지 프리미티브(빌보드, 텍스트 등)는 검사 없이 그대로 통과시킨다.
+     * @param AllPrimitives 프러스텀 컬링을 통과한 프리미티브 목록
      * @param CameraPos 현재 카메라 위치
-     * @return 렌더링되어야 할 UPrimitiveComponent 목록
+     * @return 렌더링되어야 할 UPrimitiveComponent 목록 (다음 호출 전까지 유효)
      */
-    TArray<UPrimitiveComponent*> PerformCulling(const TArray<UPrimitiveComponent*>& AllStaticMeshes, const FVector& CameraPos);
+    const TArray<UPrimitiveComponent*>& PerformCulling(const TArray<UPrimitiveComponent*>& AllPrimitives, const FVector& CameraPos);
+
+    /** @brief 월드 공간 삼각형 목록(정점 3개씩)을 오클루더로 추가한다. 화면 기준 뒷면과 근평면에 걸친 삼각형은 버린다. */
+    void AddOccluderTriangles(const FVector* InVertices, uint32 InVertexCount);
+    /** @brief AABB의 12개 삼각형을 오클루더로 추가한다. */
+    void AddOccluderBox(const FVector& InMin, const FVector& InMax);
+    /** @brief 로컬 공간 오클루더 프록시를 InLocalToWorld로 배치해 추가한다. 음수 스케일로 뒤집힌 변환은 감기 방향을 바로잡는다. */
+    void AddOccluderMesh(const FOccluderProxy& InProxy, const FMatrix& InLocalToWorld);
+    /** @brief 추가된 오클루더 삼각형을 밴드별로 병렬 래스터라이즈한다. */
+    void RasterizeOccluders();
+    /** @brief AABB가 깊이 버퍼에 가려지지 않는지 검사한다. 근평면에 걸친 박스는 항상 보이는 것으로 본다. */
+    bool IsBoxVisible(const FVector& InMin, const FVector& InMax) const;
+
+    const FOcclusionStats& GetStats() const { return Stats; }
+
+    /** @brief 시간적 재투영 모드를 켜거나 끈다. 모드가 바뀌면 이전 프레임 기록을 버린다. */
+    void SetTemporalReprojectionEnabled(bool bInEnabled);
+    bool IsTemporalReprojectionEnabled() const { return bTemporalReprojectionEnabled; }
+    /** @brief 이전 프레임의 깊이/가시성 기록을 버린다. 레벨 전환처럼 장면이 통째로 바뀔 때 호출한다. */
+    void ResetTemporalHistory();
 
     // Constants
     static constexpr int Z_BUFFER_WIDTH = 256;
     static constexpr int Z_BUFFER_HEIGHT = 256;
-    static constexpr int Z_BUFFER_SIZE = Z_BUFFER_WIDTH * Z_BUFFER_HEIGHT;
+    static constexpr int TILE_WIDTH = 32;
+    static constexpr int TILE_HEIGHT = 8;
+    static constexpr int TILE_COUNT_X = Z_BUFFER_WIDTH / TILE_WIDTH;
+    static constexpr int TILE_COUNT_Y = Z_BUFFER_HEIGHT / TILE_HEIGHT;
+    static constexpr int TILE_ROWS_PER_BAND = 4;
+    static constexpr int BAND_COUNT = TILE_COUNT_Y / TILE_ROWS_PER_BAND;
+    /** @brief 화면 점유율이 큰 순서로 고르는 오클루더 최대 개수 */
+    static constexpr uint32 MAX_OCCLUDER_COUNT = 128;
+    /** @brief 오클루디 검사를 워커에 나눠줄 때의 묶음 크기 */
+    static constexpr uint32 OCCLUDEE_BATCH_SIZE = 64;
+    /** @brief 재투영 깊이를 이 프레임 수만큼 이어 쓴 뒤에는 깊이 버퍼를 처음부터 다시 만든다 */
+    static constexpr uint32 TEMPORAL_REFRESH_INTERVAL = 8;
+    /** @brief 지난 프레임에 보였던 오클루디를 다시 검사하는 주기 (프리미티브마다 프레임을 엇갈려 분산한다) */
+    static constexpr uint32 TEMPORAL_RETEST_INTERVAL = 4;
+
+    static_assert(TILE_WIDTH == 32, "타일 한 행은 uint32 비트마스크 하나로 표현한다");
+    static_assert(TILE_HEIGHT == 8, "타일 마스크는 SSE 레지스터 두 개(행 8개)로 처리한다");
 
 private:
-    /**
-    * @brief 카메라에서 과도하게 가까운 애들 제외
-    * @param AllCandidates 가까운 곳의 Occluders 후보
-    * @return 오클루더로 선정된 UPrimitiveComponent 목록
-    */
-    TArray<UPrimitiveComponent*> SelectOccluders(const TArray<UPrimitiveComponent*>& AllCandidates, const FVector& CameraPos);
-
-    void RasterizeOccluders(const TArray<UPrimitiveComponent*>& SelectedOccluders, const FVector& CameraPos);
+    struct alignas(16) FOcclusionTile
+    {
+        uint32 Mask[TILE_HEIGHT];
+        float Z0;
+        float Z1;
+    };
+
+    /** @brief 화면 좌표(픽셀)와 NDC 깊이로 변환된 삼각형. 화면 기준 반시계(부호 있는 면적 > 0)로 정렬되어 있다. */
+    struct FOcclusionTriangle
+    {
+        float X[3];
+        float Y[3];
+        float Z[3];
+    };
+
+    struct FWorldAABBData
+    {
+        UPrimitiveComponent* Prim;
+        FVector Min;
+        FVector Max;
+        FVector Center;
+        /** @brief 에셋의 오클루더 프록시. 없으면 오클루더 후보에서 제외한다 */
+        const FOccluderProxy* OccluderProxy;
+    };
 
     /**
-     * @brief World Pos > Clip Space > Screen Coordinate
-     * @return 스크린 좌표 (X, Y)와 NDC Depth (Z)를 담은 FVector
-     */
-    FVector Project(const FVector& WorldPos) const;
-
-    /**
-     * @brief 해당 메시 컴포넌트가 Z-Buffer에 의해 가려지는지 테스트합니다.
-     * @return 바운딩 박스의 코너 중 하나라도 보이면 true를 반환합니다.
-     */
-    bool IsMeshVisible(const struct FWorldAABBData& AABBData);
-
-    struct BatchProjectionResult BatchProject4(const struct BatchProjectionInput& Input) const;
-
+    * @brief 오클루더 프록시가 없거나 카메라에서 과도하게 가까운 애들을 제외하고, 화면 점유율(대각선 길이^2 / 거리^2)이 큰 순서로 오클루더를 고른다.
+    */
+    void SelectOccluders(const FVector& CameraPos);
 
     /**
-     * @brief CPU Z-Buffer에 삼각형을 래스터라이징, 깊이 테스트 수행
+     * @brief 박스의 8개 꼭짓점을 SSE로 4개씩 투영한다.
+     * @return 꼭짓점 중 하나라도 근평면 뒤에 있으면 false
      */
-    void RasterizeTriangle(const FVector& P1, const FVector& P2, const FVector& P3, TArray<float>& ZBuffer);
+    bool ProjectBoxCorners(const FVector& InMin, const FVector& InMax, float OutX[8], float OutY[8], float OutZ[8]) const;
+    /** @brief 정점 하나를 투영한다. 근평면 뒤에 있으면 false */
+    bool Project(const FVector& WorldPos, float& OutX, float& OutY, float& OutZ) const;
+    /** @brief InToClip으로 정점 하나를 투영한다. 근평면 뒤에 있으면 false */
+    static bool ProjectToScreen(const FMatrix& InToClip, const FVector& InPosition, float& OutX, float& OutY, float& OutZ);
+
+    /** @brief 화면 좌표 삼각형을 뒷면 제거, 정렬 후 밴드별 Bin에 등록한다. */
+    void AddScreenTriangle(float X0, float Y0, float Z0, float X1, float Y1, float Z1, float X2, float Y2, float Z2);
+    /** @brief 삼각형 중 InBand에 속하는 타일들만 래스터라이즈한다. */
+    void RasterizeTriangleInBand(const FOcclusionTriangle& InTriangle, int32 InBand);
+    /** @brief 타일 하나에 커버리지와 보수적 최대 깊이를 병합한다. */
+    static void UpdateTile(FOcclusionTile& InOutTile, const uint32 InCoverage[TILE_HEIGHT], float InMaxZ);
+    void ClearTriangles();
 
     /**
-     * @brief PrimitiveComponent의 AABB를 12개의 삼각형 정점으로 변환
+     * @brief 이전 프레임 타일의 Z0 깊이에 놓인 타일 사각형을 현재 뷰로 재투영해 래스터라이즈하고, 덮인 타일을 ReprojectedTiles에 기록한다.
      */
-    TArray<FVector> ConvertAABBToTriangles(class UPrimitiveComponent* PrimitiveComp);
+    void ReprojectPreviousDepth();
+    /** @brief AABB가 화면에서 걸치는 타일이 모두 재투영 깊이로 덮여 있으면 true (근평면에 걸치면 false) */
+    bool IsCoveredByReprojection(const FVector& InMin, const FVector& InMax) const;
+    /** @brief 현재 깊이 버퍼와 가시 목록을 다음 프레임의 재투영 기록으로 저장한다. */
+    void SaveTemporalHistory();
 
-    TArray<float> CPU_ZBuffer;
+    TArray<FOcclusionTile> Tiles;
     FMatrix CurrentViewProj;
 
-    TArray<struct FWorldAABBData> CachedAABBs;
-    TArray<FVector> Triangles;
-    TArray<UPrimitiveComponent*> FilteredOccluders;    
-    TArray<UPrimitiveComponent*> VisibleMeshComponents;
-    uint32 Frame = 0;
+    TArray<FOcclusionTriangle> Triangles;
+    TArray<uint32> BandBins[BAND_COUNT];
 
-    // For SIMD
-    alignas(16) float SampleCoords[3][20];     // [0]=X, [1]=Y, [2]=Z
-    alignas(16) int32 TempPixelCoords[2][4];   // [0]=X, [1]=Y  
-    alignas(16) float TempScreenZ[4];
-};
+    /** @brief AddOccluderMesh에서 프록시 정점을 한 번씩만 투영하기 위한 임시 버퍼 */
+    TArray<float> ProjectedX;
+    TArray<float> ProjectedY;
+    TArray<float> ProjectedZ;
+    TArray<uint8> ProjectedValid;
 
-struct FWorldAABBData
-{
-    UPrimitiveComponent* Prim;
-    FVector Min;
-    FVector Max;
-    FVector Center; // 자주 사용되는 Center 값도 저장하여 계산 오버헤드 제거
-};
+    TArray<FWorldAABBData> CachedAABBs;
+    TArray<uint32> OccluderIndices;
+    TArray<uint8> OccludeeVisibility;
+    TArray<UPrimitiveComponent*> VisibleMeshComponents;
 
-struct alignas(16) BatchProjectionInput
-{
-    __m128 WorldX, WorldY, WorldZ; // 4개 점의 X, Y, Z 좌표
-};
+    FOcclusionStats Stats;
 
-struct alignas(16) BatchProjectionResult
-{
-    __m128 ScreenX, ScreenY, ScreenZ; // 4개 점의 스크린 좌표
-    __m128i PixelX, PixelY;          // 정수형 픽셀 좌표
-    __m128 InBoundsMask;             // 화면 경계 내부 마스크
+    // 시간적 재투영 기록
+    bool bTemporalReprojectionEnabled = false;
+    bool bHasHistory = false;
+    uint32 FramesSinceRefresh = 0;
+    uint32 FrameIndex = 0;
+    FMatrix HistoryViewProj;
+    TArray<float> HistoryTileZ0;
+    TArray<uint8> ReprojectedTiles;
+    /**
+     * @brief 지난 프레임의 오클루디 목록과 가시 결과 (CachedAABBs 순서)
+     * 프러스텀 컬링 결과의 순서는 프레임 사이에 거의 유지되므로 같은 인덱스의 프리미티브가 같을 때만 기록을 쓴다.
+     * 순서가 어긋난 프리미티브는 기록이 없는 것으로 보고 검사한다.
+     */
+    TArray<UPrimitiveComponent*> PreviousOccludees;
+    TArray<uint8> PreviousVisibility;
 };
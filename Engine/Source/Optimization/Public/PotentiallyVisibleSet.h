@@ -0,0 +1,106 @@
+#pragma once
+#include <filesystem>
+
+class ULevel;
+class UPrimitiveComponent;
+
+/** @brief PVS 베이크 설정 */
+struct FPVSBakeSettings
+{
+	/** @brief 목표 셀 크기. 축마다 셀 수가 MaxCellsPerAxis를 넘으면 그 축의 셀이 커진다 */
+	float CellSize = 5.0f;
+	uint32 MaxCellsPerAxis = 32;
+	/** @brief 셀마다 레이를 쏘는 지점 수. 첫 지점은 셀 중심이고 나머지는 셀 안에 고르게 흩뿌린다 */
+	uint32 SamplesPerCell = 4;
+	/** @brief 지점마다 구 위에 고르게 퍼뜨리는 레이 수 */
+	uint32 RaysPerSample = 256;
+	/** @brief 셀 경계를 넘을 때의 팝핑을 줄이기 위해 이웃 6셀의 가시 집합을 합친다 */
+	bool bMergeNeighbourCells = true;
+};
+
+/**
+ * @brief 정적 레벨용 Potentially Visible Set
+ * 레벨 경계를 균일한 셀로 나누고, 셀마다 그 안에서 보일 수 있는 정적 프리미티브를 비트셋으로 저장한다.
+ * 비트 i는 베이크 당시 StaticOctree에 있던 프리미티브를 월드 AABB 순으로 정렬했을 때 i번째 프리미티브이다.
+ * 레벨 파일은 액터를 UUID 키로 저장하므로 다시 불러오면 액터 순서가 바뀐다. 그래서 순서 대신 위치로 프리미티브를 식별한다.
+ * 비트셋은 0 워드의 런 길이로 압축한 뒤 내용이 같은 셀끼리 공유하고, .Scene 옆의 .pvs 파일에 저장한다.
+ * 런타임에는 레벨에 바인딩한 뒤 카메라가 속한 셀의 집합을 절두체 컬링 후보로 쓴다.
+ * 가시성 판정은 샘플링이므로 근사이며, 셀과 겹치는 프리미티브와 스태틱 메시가 아닌 프리미티브는 항상 보이는 것으로 둔다.
+ */
+class FPotentiallyVisibleSet
+{
+public:
+	static constexpr uint32 FILE_MAGIC = 0x31535650; // "PVS1"
+	static constexpr uint32 FILE_VERSION = 1;
+	static constexpr uint32 INVALID_SET = 0xFFFFFFFFu;
+
+	/** @brief InLevel의 StaticOctree에 있는 프리미티브로 PVS를 굽고 바인딩한다. */
+	bool Bake(ULevel* InLevel, const FPVSBakeSettings& InSettings);
+	bool Save(const std::filesystem::path& InFilePath);
+	/** @brief 파일을 읽어 InLevel에 바인딩한다. 레벨의 프리미티브 구성이 베이크 당시와 다르면 false */
+	bool Load(const std::filesystem::path& InFilePath, ULevel* InLevel);
+	/** @brief 구운 데이터를 InLevel의 프리미티브에 연결한다. PIE 복제 레벨처럼 구성이 같은 레벨에 다시 쓸 때 사용한다. */
+	bool Bind(ULevel* InLevel);
+	void Reset();
+
+	bool IsValid() const { return bIsBound; }
+	bool Contains(const UPrimitiveComponent* InPrimitive) const;
+	/** @brief Bake/Load/Bind/Reset마다 모든 PVS에서 유일한 값으로 바뀐다. 풀어 둔 집합을 캐시하는 쪽에서 갱신 여부를 판단할 때 쓴다. */
+	uint32 GetRevision() const { return Revision; }
+
+	/** @return InLocation이 속한 셀의 집합 인덱스. 격자 밖이면 INVALID_SET */
+	uint32 FindSet(const FVector& InLocation) const;
+	/** @brief 압축된 집합을 풀어 OutBits에 GetWordCount()개 워드의 비트셋으로 쓴다. */
+	void DecodeSet(uint32 InSetIndex, TArray<uint32>& OutBits) const;
+
+	UPrimitiveComponent* GetPrimitive(uint32 InIndex) const { return Primitives[InIndex]; }
+	uint32 GetPrimitiveCount() const { return static_cast<uint32>(PrimitiveKeys.size()); }
+	uint32 GetWordCount() const { return (GetPrimitiveCount() + 31) / 32; }
+	uint32 GetCellCount() const { return static_cast<uint32>(CellSets.size()); }
+	uint32 GetSetCount() const { return SetOffsets.empty() ? 0 : static_cast<uint32>(SetOffsets.size() - 1); }
+	size_t GetCompressedSize() const { return SetWords.size() * sizeof(uint32); }
+
+	/** @brief .Scene 경로에 대응하는 .pvs 경로 */
+	static std::filesystem::path GetFilePath(const std::filesystem::path& InScenePath);
+
+private:
+	/** @brief 프리미티브 식별자. 월드 AABB를 KEY_PRECISION 단위로 양자화해 텍스트 저장의 반올림 오차를 흡수한다. */
+	struct FPrimitiveKey
+	{
+		int32 Bounds[6];
+		/** @brief 액터 안에서의 컴포넌트 순서. AABB가 같은 프리미티브끼리의 순서를 정한다 */
+		uint32 ComponentIndex;
+
+		bool operator<(const FPrimitiveKey& InOther) const;
+		bool operator==(const FPrimitiveKey& InOther) const;
+	};
+
+	static constexpr float KEY_PRECISION = 1e-3f;
+
+	/** @brief StaticOctree에 있는 프리미티브를 모아 키 순서로 정렬한다. */
+	static void GatherStaticPrimitives(ULevel* InLevel, TArray<UPrimitiveComponent*>& OutPrimitives, TArray<FPrimitiveKey>& OutKeys);
+
+	/** @brief 비트셋을 [0 워드 수(16비트) | 리터럴 워드 수(16비트)] 헤더와 리터럴 워드의 반복으로 압축한다. */
+	static void CompressBits(const uint32* InBits, uint32 InWordCount, TArray<uint32>& OutWords);
+	/** @brief 모든 집합이 비트셋 범위 안에서 풀리는지 검사한다. (손상된 파일 방어) */
+	bool ValidateSets() const;
+
+	FVector GridMin;
+	FVector CellExtent;
+	uint32 CellCountX = 0;
+	uint32 CellCountY = 0;
+	uint32 CellCountZ = 0;
+
+	TArray<FPrimitiveKey> PrimitiveKeys;
+	/** @brief 셀 → 집합 인덱스 (X가 가장 빠르게 변한다) */
+	TArray<uint32> CellSets;
+	/** @brief 집합 → SetWords 시작 위치. 집합 수 + 1개 */
+	TArray<uint32> SetOffsets;
+	TArray<uint32> SetWords;
+
+	/** @brief 바인딩된 레벨의 프리미티브. PrimitiveKeys와 같은 순서 */
+	TArray<UPrimitiveComponent*> Primitives;
+	TMap<const UPrimitiveComponent*, uint32> PrimitiveIndices;
+	bool bIsBound = false;
+	uint32 Revision = 0;
+};
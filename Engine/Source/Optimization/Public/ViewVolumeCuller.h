@@ -2,8 +2,7 @@
 
 #include "Component/Public/PrimitiveComponent.h"
 #include "Physics/Public/AABB.h"
-
-class FOctree;
+#include "Optimization/Public/FrustumCullingKernel.h"
 
 enum class EBoundCheckResult
 {
@@ -12,73 +11,190 @@ enum class EBoundCheckResult
 	Inside
 };
 
+/**
+ * @brief 절두체 평면 6개. 법선은 바깥을 향하며, P.Dot3(X) + P.W > 0 인 점이 평면 바깥(+측)이다.
+ */
 struct FFrustum
 {
     FVector4 Planes[6];
 
+    static constexpr uint8 ALL_PLANES_MASK = 0x3F;
+
+    /**
+     * @brief View * Projection 행렬에서 평면 6개를 뽑아 정규화한다.
+     * @return 퇴화한 행렬이라 정규화할 수 없는 평면이 있으면 false
+     */
+    bool SetFromViewProjection(const FCameraConstants& InViewProj)
+    {
+        FMatrix VP = InViewProj.View * InViewProj.Projection;
+        Planes[0] = VP[3] + VP[0]; // Left
+        Planes[1] = VP[3] - VP[0]; // Right
+        Planes[2] = VP[3] + VP[1]; // Bottom
+        Planes[3] = VP[3] - VP[1]; // Top
+        Planes[4] = VP[2]; // Near
+        Planes[5] = VP[3] - VP[2]; // Far
+
+        for (int i = 0; i < 6; i++)
+        {
+            const float Length = sqrt((Planes[i].X * Planes[i].X) + (Planes[i].Y * Planes[i].Y) + (Planes[i].Z * Planes[i].Z));
+
+            if (Length > -MATH_EPSILON && Length < MATH_EPSILON) { return false; }
+
+            Planes[i] /= -Length;
+        }
+        return true;
+    }
+
     EBoundCheckResult CheckIntersection(const FAABB& BBox) const
     {
         EBoundCheckResult Result = EBoundCheckResult::Inside;
 
         for (int i = 0; i < 6; ++i)
         {
-            const FVector4& P = Planes[i];
+            const EBoundCheckResult PlaneResult = CheckPlane(BBox, i);
+            if (PlaneResult == EBoundCheckResult::Outside)
+            {
+                return EBoundCheckResult::Outside;
+            }
+            if (PlaneResult == EBoundCheckResult::Intersect)
+            {
+                Result = EBoundCheckResult::Intersect;
+            }
+        }
+
+        return Result;
 
-            // positive vertex: 법선 방향으로 가장 먼 꼭짓점
-            FVector PositiveVertex(
-                (P.X >= 0) ? BBox.Max.X : BBox.Min.X,
-                (P.Y >= 0) ? BBox.Max.Y : BBox.Min.Y,
-                (P.Z >= 0) ? BBox.Max.Z : BBox.Min.Z
-            );
+    }
 
-            if (P.Dot3(PositiveVertex) + P.W > 0)
+    /**
+     * @brief 계층 탐색용 검사. InOutPlaneMask에 켜진 평면만 검사하고, 박스가 완전히 안쪽에 있는 평면은 비트를 꺼서
+     * 자식 노드가 같은 평면을 다시 검사하지 않게 한다. 마스크가 비면 모든 평면의 안쪽이므로 Inside이다.
+     * InOutLastRejectPlane(이전 프레임에 이 노드를 잘라낸 평면)을 가장 먼저 검사하고, Outside가 되면 잘라낸 평면으로 갱신한다.
+     */
+    EBoundCheckResult CheckIntersection(const FAABB& BBox, uint8& InOutPlaneMask, uint8& InOutLastRejectPlane) const
+    {
+        const uint8 HintPlane = InOutLastRejectPlane;
+        if (InOutPlaneMask & (1u << HintPlane))
+        {
+            const EBoundCheckResult HintResult = CheckPlane(BBox, HintPlane);
+            if (HintResult == EBoundCheckResult::Outside)
             {
-                // 박스가 평면 바깥(+측)으로 완전히 나감
                 return EBoundCheckResult::Outside;
             }
+            if (HintResult == EBoundCheckResult::Inside)
+            {
+                InOutPlaneMask &= ~(1u << HintPlane);
+            }
+        }
 
-            // negative vertex: 반대쪽 꼭짓점
-            FVector NegativeVertex(
-                (P.X >= 0) ? BBox.Min.X : BBox.Max.X,
-                (P.Y >= 0) ? BBox.Min.Y : BBox.Max.Y,
-                (P.Z >= 0) ? BBox.Min.Z : BBox.Max.Z
-            );
+        for (uint8 i = 0; i < 6; ++i)
+        {
+            if (i == HintPlane || (InOutPlaneMask & (1u << i)) == 0) { continue; }
 
-            if (P.Dot3(NegativeVertex) + P.W < 0)
+            const EBoundCheckResult PlaneResult = CheckPlane(BBox, i);
+            if (PlaneResult == EBoundCheckResult::Outside)
             {
-                // 박스가 평면 안쪽(-측)으로 완전히 들어옴 → 계속 검사
-                continue;
+                InOutLastRejectPlane = i;
+                return EBoundCheckResult::Outside;
             }
+            if (PlaneResult == EBoundCheckResult::Inside)
+            {
+                InOutPlaneMask &= ~(1u << i);
+            }
+        }
 
-            // 완전 안쪽도 아니고 완전 바깥도 아니면 교차
-            Result = EBoundCheckResult::Intersect;
+        return InOutPlaneMask == 0 ? EBoundCheckResult::Inside : EBoundCheckResult::Intersect;
+    }
+
+    /** @brief 평면 하나에 대한 박스의 위치를 판정한다. */
+    EBoundCheckResult CheckPlane(const FAABB& BBox, int PlaneIndex) const
+    {
+        const FVector4& P = Planes[PlaneIndex];
+
+        // negative vertex: 바깥 법선 방향으로 가장 덜 나간 꼭짓점
+        FVector NegativeVertex(
+            (P.X >= 0) ? BBox.Min.X : BBox.Max.X,
+            (P.Y >= 0) ? BBox.Min.Y : BBox.Max.Y,
+            (P.Z >= 0) ? BBox.Min.Z : BBox.Max.Z
+        );
+
+        if (P.Dot3(NegativeVertex) + P.W > 0)
+        {
+            // 가장 안쪽 꼭짓점마저 바깥(+측)이므로 박스가 평면 바깥으로 완전히 나감
+            return EBoundCheckResult::Outside;
         }
 
+        // positive vertex: 바깥 법선 방향으로 가장 멀리 나간 꼭짓점
+        FVector PositiveVertex(
+            (P.X >= 0) ? BBox.Max.X : BBox.Min.X,
+            (P.Y >= 0) ? BBox.Max.Y : BBox.Min.Y,
+            (P.Z >= 0) ? BBox.Max.Z : BBox.Min.Z
+        );
+
+        if (P.Dot3(PositiveVertex) + P.W <= 0)
+        {
+            // 박스가 평면 안쪽(-측)으로 완전히 들어옴
+            return EBoundCheckResult::Inside;
+        }
+
+        // 완전 안쪽도 아니고 완전 바깥도 아니면 교차
+        return EBoundCheckResult::Intersect;
+    }
+
+    /** @brief 점이 모든 평면의 안쪽(경계 포함)에 있는지 */
+    bool ContainsPoint(const FVector& InPoint) const
+    {
+        for (int i = 0; i < 6; ++i)
+        {
+            if (Planes[i].Dot3(InPoint) + Planes[i].W > 0) { return false; }
+        }
+        return true;
+    }
+
+    /**
+     * @brief InLocalToWorld로 월드에 옮겨지는 공간(모델 공간 등)에서 같은 영역을 나타내는 절두체.
+     * 평면을 다시 정규화하지 않으므로 결과는 안쪽/바깥 부호 판정(CheckIntersection, CheckPlane, ContainsPoint)에만 쓴다.
+     */
+    FFrustum TransformToLocal(const FMatrix& InLocalToWorld) const
+    {
+        // 월드 점 X = x * M 이면 P·X = x · (M * P) 이므로 로컬 평면은 행렬 각 행과 평면의 내적이다
+        FFrustum Result;
+        for (int i = 0; i < 6; ++i)
+        {
+            const FVector4& P = Planes[i];
+            const auto RowDot = [&P, &InLocalToWorld](int InRow)
+            {
+                const float* Row = InLocalToWorld.Data[InRow];
+                return Row[0] * P.X + Row[1] * P.Y + Row[2] * P.Z + Row[3] * P.W;
+            };
+            Result.Planes[i] = FVector4(RowDot(0), RowDot(1), RowDot(2), RowDot(3));
+        }
         return Result;
+    }
 
+    /**
+     * @brief 평면 세 개의 교점으로 꼭짓점 8개를 구한다. 인덱스 비트 0은 Left(0)/Right(1), 비트 1은 Bottom/Top, 비트 2는 Near/Far.
+     * @return 평행한 평면이 있어 교점을 구할 수 없으면 false
+     */
+    bool GetCorners(FVector OutCorners[8]) const
+    {
+        for (int Corner = 0; Corner < 8; ++Corner)
+        {
+            const FVector4& A = Planes[(Corner & 1) ? 1 : 0];
+            const FVector4& B = Planes[(Corner & 2) ? 3 : 2];
+            const FVector4& C = Planes[(Corner & 4) ? 5 : 4];
+            const FVector NA(A.X, A.Y, A.Z);
+            const FVector NB(B.X, B.Y, B.Z);
+            const FVector NC(C.X, C.Y, C.Z);
+
+            const FVector BC = NB.Cross(NC);
+            const float Determinant = NA.Dot(BC);
+            if (fabsf(Determinant) < 1e-12f) { return false; }
+
+            OutCorners[Corner] = (BC * A.W + NC.Cross(NA) * B.W + NA.Cross(NB) * C.W) * (-1.0f / Determinant);
+        }
+        return true;
     }
 
     void Clear() { for (int i = 0; i < 6; ++i) { Planes[i] = FVector4::Zero(); }; }
 };
-
-class ViewVolumeCuller
-{
-public:
-	ViewVolumeCuller() = default;
-	~ViewVolumeCuller() = default;
-	ViewVolumeCuller(const ViewVolumeCuller& Other) = default;
-	ViewVolumeCuller& operator=(const ViewVolumeCuller& Other) = default;
-
-	void Cull(
-        FOctree* StaticOctree,
-        TArray<UPrimitiveComponent*>& DynamicPrimitives,
-		const FCameraConstants& ViewProjConstants
-	);
-
-	const TArray<UPrimitiveComponent*>& GetRenderableObjects();
-private:
-    void CullOctree(FOctree* Octree);
-
-    FFrustum CurrentFrustum{};
-    TArray<UPrimitiveComponent*> RenderableObjects{};
-};
\ No newline at end of file
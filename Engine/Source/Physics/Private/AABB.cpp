@@ -35,6 +35,12 @@ bool FAABB::RaycastHit() const
 }
 
 bool CheckIntersectionRayBox(const FRay& Ray, const FAABB& Box)
+{
+	float EntryDistance;
+	return CheckIntersectionRayBox(Ray, Box, EntryDistance);
+}
+
+bool CheckIntersectionRayBox(const FRay& Ray, const FAABB& Box, float& OutEntryDistance)
 {
 	// AABB intersectin test by "Slab Method"
     float TMin = -FLT_MAX;
@@ -68,6 +74,7 @@ bool CheckIntersectionRayBox(const FRay& Ray, const FAABB& Box)
 
 	if (TMax < 0.0f) return false; // box is behind the ray
 
+	OutEntryDistance = std::max(TMin, 0.0f);
     return true;
 }
 
@@ -0,0 +1,499 @@
+#include "pch.h"
+#include "Physics/Public/SceneQuery.h"
+#include "Physics/Public/OBB.h"
+#include "Physics/Public/SceneTLAS.h"
+#include "Level/Public/Level.h"
+#include "Actor/Public/Actor.h"
+#include "Component/Public/PrimitiveComponent.h"
+#include "Component/Mesh/Public/StaticMeshComponent.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Global/Octree.h"
+#include "Global/DynamicAABBTree.h"
+#include "Global/BVH.h"
+#include "Optimization/Public/ViewVolumeCuller.h"
+
+namespace
+{
+	/** @brief 이보다 짧은 선분은 트레이스하지 않는다 */
+	constexpr float MIN_TRACE_LENGTH = 1e-6f;
+
+	float SafeInverse(float InValue)
+	{
+		return 1.0f / (fabsf(InValue) > 1e-12f ? InValue : (InValue < 0.0f ? -1e-12f : 1e-12f));
+	}
+
+	float GetAxis(const FVector& InVector, int32 InAxis)
+	{
+		return InAxis == 0 ? InVector.X : (InAxis == 1 ? InVector.Y : InVector.Z);
+	}
+
+	FAABB GetPrimitiveBoundingBox(UPrimitiveComponent* InPrimitive)
+	{
+		FVector Min, Max;
+		InPrimitive->GetWorldAABB(Min, Max);
+		return FAABB(Min, Max);
+	}
+
+	void ToHitResult(const FSceneRayHit& InRayHit, const FVector& InStart, const FVector& InDirection, FHitResult& OutHit)
+	{
+		OutHit.Component = InRayHit.Primitive;
+		OutHit.Actor = InRayHit.Primitive->GetOwner();
+		OutHit.Distance = InRayHit.Distance;
+		OutHit.Location = InStart + InDirection * InRayHit.Distance;
+		OutHit.Normal = InRayHit.Normal;
+		OutHit.TriangleIndex = InRayHit.TriangleIndex;
+	}
+}
+
+bool FSceneQuery::LineTraceSingle(ULevel* InLevel, const FVector& InStart, const FVector& InEnd, FHitResult& OutHit,
+	const FCollisionQueryParams& InParams)
+{
+	OutHit = FHitResult();
+
+	const FVector Segment = InEnd - InStart;
+	const float Length = Segment.Length();
+	if (!InLevel || Length < MIN_TRACE_LENGTH) { return false; }
+	const FVector Direction = Segment * (1.0f / Length);
+
+	FSceneRayHit RayHit;
+	if (!InLevel->GetSceneTLAS()->Trace(InStart, Direction, MakeRayParams(InParams, Length, false), RayHit))
+	{
+		return false;
+	}
+
+	ToHitResult(RayHit, InStart, Direction, OutHit);
+	return true;
+}
+
+bool FSceneQuery::LineTraceTest(ULevel* InLevel, const FVector& InStart, const FVector& InEnd, const FCollisionQueryParams& InParams)
+{
+	const FVector Segment = InEnd - InStart;
+	const float Length = Segment.Length();
+	if (!InLevel || Length < MIN_TRACE_LENGTH) { return false; }
+	const FVector Direction = Segment * (1.0f / Length);
+
+	FSceneRayHit RayHit;
+	return InLevel->GetSceneTLAS()->Trace(InStart, Direction, MakeRayParams(InParams, Length, true), RayHit);
+}
+
+bool FSceneQuery::LineTraceMulti(ULevel* InLevel, const FVector& InStart, const FVector& InEnd, TArray<FHitResult>& OutHits,
+	const FCollisionQueryParams& InParams)
+{
+	OutHits.clear();
+
+	const FVector Segment = InEnd - InStart;
+	const float Length = Segment.Length();
+	if (!InLevel || Length < MIN_TRACE_LENGTH) { return false; }
+	const FVector Direction = Segment * (1.0f / Length);
+
+	GatherRayCandidates(InLevel, InStart, Direction, Length, InParams);
+
+	FHitResult Hit;
+	for (const auto& [EntryDistance, Primitive] : RayCandidates)
+	{
+		if (TracePrimitive(Primitive, InStart, Direction, Length, InParams, Hit))
+		{
+			OutHits.push_back(Hit);
+		}
+	}
+
+	std::sort(OutHits.begin(), OutHits.end(), [](const FHitResult& InA, const FHitResult& InB)
+	{
+		return InA.Distance < InB.Distance;
+	});
+
+	return !OutHits.empty();
+}
+
+bool FSceneQuery::OverlapAABB(ULevel* InLevel, const FAABB& InBox, TArray<UPrimitiveComponent*>& OutPrimitives,
+	const FCollisionQueryParams& InParams)
+{
+	OutPrimitives.clear();
+	if (!InLevel) { return false; }
+
+	GatherBoxCandidates(InLevel, InBox, InParams);
+	for (UPrimitiveComponent* Primitive : Candidates)
+	{
+		if (GetPrimitiveBoundingBox(Primitive).IsIntersected(InBox))
+		{
+			OutPrimitives.push_back(Primitive);
+		}
+	}
+
+	return !OutPrimitives.empty();
+}
+
+bool FSceneQuery::OverlapSphere(ULevel* InLevel, const FVector& InCenter, float InRadius, TArray<UPrimitiveComponent*>& OutPrimitives,
+	const FCollisionQueryParams& InParams)
+{
+	OutPrimitives.clear();
+	if (!InLevel || !(InRadius >= 0.0f)) { return false; }
+
+	const FVector Extent(InRadius, InRadius, InRadius);
+	GatherBoxCandidates(InLevel, FAABB(InCenter - Extent, InCenter + Extent), InParams);
+
+	const float RadiusSquared = InRadius * InRadius;
+	for (UPrimitiveComponent* Primitive : Candidates)
+	{
+		if (GetPrimitiveBoundingBox(Primitive).GetDistanceSquaredToPoint(InCenter) <= RadiusSquared)
+		{
+			OutPrimitives.push_back(Primitive);
+		}
+	}
+
+	return !OutPrimitives.empty();
+}
+
+bool FSceneQuery::OverlapOBB(ULevel* InLevel, const FOBB& InBox, TArray<UPrimitiveComponent*>& OutPrimitives,
+	const FCollisionQueryParams& InParams)
+{
+	OutPrimitives.clear();
+	if (!InLevel) { return false; }
+
+	GatherBoxCandidates(InLevel, InBox.ToWorldAABB(), InParams);
+	for (UPrimitiveComponent* Primitive : Candidates)
+	{
+		if (InBox.Intersects(GetPrimitiveBoundingBox(Primitive)))
+		{
+			OutPrimitives.push_back(Primitive);
+		}
+	}
+
+	return !OutPrimitives.empty();
+}
+
+bool FSceneQuery::OverlapFrustum(ULevel* InLevel, const FFrustum& InFrustum, EFrustumOverlapMode InMode, TArray<UPrimitiveComponent*>& OutPrimitives,
+	const FCollisionQueryParams& InParams)
+{
+	if (!InLevel)
+	{
+		OutPrimitives.clear();
+		return false;
+	}
+	return OverlapFrustum(InLevel->GetStaticOctree(), InLevel->GetDynamicTree(), InFrustum, InMode, OutPrimitives, InParams);
+}
+
+bool FSceneQuery::OverlapFrustum(FOctree* InStaticOctree, const FDynamicAABBTree* InDynamicTree, const FFrustum& InFrustum,
+	EFrustumOverlapMode InMode, TArray<UPrimitiveComponent*>& OutPrimitives, const FCollisionQueryParams& InParams)
+{
+	OutPrimitives.clear();
+
+	// 평면 마스크가 빈 노드는 절두체 안쪽이므로 판정 없이 담고, 아니면 노드가 걸친 평면만으로 프리미티브를 판정한다
+	const auto AddPrimitive = [&](UPrimitiveComponent* InPrimitive, uint8 InPlaneMask)
+	{
+		if (PassesFilter(InPrimitive, InParams) && (InPlaneMask == 0 || OverlapPrimitiveFrustum(InPrimitive, InFrustum, InPlaneMask, InMode)))
+		{
+			OutPrimitives.push_back(InPrimitive);
+		}
+	};
+
+	if (InStaticOctree)
+	{
+		FrustumNodeStack.clear();
+		FrustumNodeStack.emplace_back(InStaticOctree, FFrustum::ALL_PLANES_MASK);
+		while (!FrustumNodeStack.empty())
+		{
+			const auto [Node, ParentPlaneMask] = FrustumNodeStack.back();
+			FrustumNodeStack.pop_back();
+
+			uint8 PlaneMask = ParentPlaneMask;
+			uint8 RejectingPlane = 0;
+			if (PlaneMask != 0 && InFrustum.CheckIntersection(Node->GetBoundingBox(), PlaneMask, RejectingPlane) == EBoundCheckResult::Outside)
+			{
+				continue;
+			}
+
+			for (UPrimitiveComponent* Primitive : Node->GetPrimitives()) { AddPrimitive(Primitive, PlaneMask); }
+			if (!Node->IsLeafNode())
+			{
+				for (const FOctree* Child : Node->GetChildren()) { FrustumNodeStack.emplace_back(Child, PlaneMask); }
+			}
+		}
+	}
+
+	// Fat AABB가 절두체 안쪽이면 실제 AABB도 안쪽이므로 동적 트리도 같은 방식으로 서브트리를 통째로 담는다
+	if (InDynamicTree && !InDynamicTree->IsEmpty())
+	{
+		FrustumDynamicNodeStack.clear();
+		FrustumDynamicNodeStack.emplace_back(InDynamicTree->GetRootIndex(), FFrustum::ALL_PLANES_MASK);
+		while (!FrustumDynamicNodeStack.empty())
+		{
+			const auto [NodeIndex, ParentPlaneMask] = FrustumDynamicNodeStack.back();
+			FrustumDynamicNodeStack.pop_back();
+
+			const FDynamicAABBTreeNode& Node = InDynamicTree->GetNode(NodeIndex);
+			uint8 PlaneMask = ParentPlaneMask;
+			uint8 RejectingPlane = 0;
+			if (PlaneMask != 0 && InFrustum.CheckIntersection(Node.Box, PlaneMask, RejectingPlane) == EBoundCheckResult::Outside)
+			{
+				continue;
+			}
+
+			if (Node.IsLeaf())
+			{
+				AddPrimitive(Node.Primitive, PlaneMask);
+				continue;
+			}
+			FrustumDynamicNodeStack.emplace_back(Node.Child1, PlaneMask);
+			FrustumDynamicNodeStack.emplace_back(Node.Child2, PlaneMask);
+		}
+	}
+
+	return !OutPrimitives.empty();
+}
+
+void FSceneQuery::GatherBoxCandidates(ULevel* InLevel, const FAABB& InBox, const FCollisionQueryParams& InParams)
+{
+	Candidates.clear();
+
+	FOctree* StaticOctree = InLevel->GetStaticOctree();
+	if (StaticOctree)
+	{
+		NodeStack.clear();
+		NodeStack.push_back(StaticOctree);
+		while (!NodeStack.empty())
+		{
+			const FOctree* Node = NodeStack.back();
+			NodeStack.pop_back();
+			if (!Node->GetBoundingBox().IsIntersected(InBox)) { continue; }
+
+			for (UPrimitiveComponent* Primitive : Node->GetPrimitives())
+			{
+				if (PassesFilter(Primitive, InParams)) { Candidates.push_back(Primitive); }
+			}
+			if (!Node->IsLeafNode())
+			{
+				for (const FOctree* Child : Node->GetChildren()) { NodeStack.push_back(Child); }
+			}
+		}
+	}
+
+	const FDynamicAABBTree* DynamicTree = InLevel->GetDynamicTree();
+	if (DynamicTree && !DynamicTree->IsEmpty())
+	{
+		DynamicNodeStack.clear();
+		DynamicNodeStack.push_back(DynamicTree->GetRootIndex());
+		while (!DynamicNodeStack.empty())
+		{
+			const FDynamicAABBTreeNode& Node = DynamicTree->GetNode(DynamicNodeStack.back());
+			DynamicNodeStack.pop_back();
+			if (!Node.Box.IsIntersected(InBox)) { continue; }
+
+			if (Node.IsLeaf())
+			{
+				if (PassesFilter(Node.Primitive, InParams)) { Candidates.push_back(Node.Primitive); }
+				continue;
+			}
+			DynamicNodeStack.push_back(Node.Child1);
+			DynamicNodeStack.push_back(Node.Child2);
+		}
+	}
+}
+
+void FSceneQuery::GatherRayCandidates(ULevel* InLevel, const FVector& InStart, const FVector& InDirection, float InLength,
+	const FCollisionQueryParams& InParams)
+{
+	RayCandidates.clear();
+
+	const FVector InvDirection(SafeInverse(InDirection.X), SafeInverse(InDirection.Y), SafeInverse(InDirection.Z));
+	float EntryDistance;
+	int32 EntryAxis;
+
+	auto AddCandidate = [&](UPrimitiveComponent* InPrimitive)
+	{
+		if (PassesFilter(InPrimitive, InParams) &&
+			IntersectSegmentBox(InStart, InvDirection, InLength, GetPrimitiveBoundingBox(InPrimitive), EntryDistance, EntryAxis))
+		{
+			RayCandidates.push_back({ EntryDistance, InPrimitive });
+		}
+	};
+
+	FOctree* StaticOctree = InLevel->GetStaticOctree();
+	if (StaticOctree)
+	{
+		NodeStack.clear();
+		NodeStack.push_back(StaticOctree);
+		while (!NodeStack.empty())
+		{
+			const FOctree* Node = NodeStack.back();
+			NodeStack.pop_back();
+			if (!IntersectSegmentBox(InStart, InvDirection, InLength, Node->GetBoundingBox(), EntryDistance, EntryAxis)) { continue; }
+
+			for (UPrimitiveComponent* Primitive : Node->GetPrimitives()) { AddCandidate(Primitive); }
+			if (!Node->IsLeafNode())
+			{
+				for (const FOctree* Child : Node->GetChildren()) { NodeStack.push_back(Child); }
+			}
+		}
+	}
+
+	const FDynamicAABBTree* DynamicTree = InLevel->GetDynamicTree();
+	if (DynamicTree && !DynamicTree->IsEmpty())
+	{
+		DynamicNodeStack.clear();
+		DynamicNodeStack.push_back(DynamicTree->GetRootIndex());
+		while (!DynamicNodeStack.empty())
+		{
+			const FDynamicAABBTreeNode& Node = DynamicTree->GetNode(DynamicNodeStack.back());
+			DynamicNodeStack.pop_back();
+			if (!IntersectSegmentBox(InStart, InvDirection, InLength, Node.Box, EntryDistance, EntryAxis)) { continue; }
+
+			if (Node.IsLeaf())
+			{
+				AddCandidate(Node.Primitive);
+				continue;
+			}
+			DynamicNodeStack.push_back(Node.Child1);
+			DynamicNodeStack.push_back(Node.Child2);
+		}
+	}
+
+	std::sort(RayCandidates.begin(), RayCandidates.end(), [](const auto& InA, const auto& InB)
+	{
+		return InA.first < InB.first;
+	});
+}
+
+bool FSceneQuery::PassesFilter(UPrimitiveComponent* InPrimitive, const FCollisionQueryParams& InParams)
+{
+	if (!InPrimitive) { return false; }
+
+	// 채널은 프리미티브가 지금 들어 있는 트리가 아니라 컴포넌트의 Mobility로 정한다
+	const EQueryObjectType ObjectType = InPrimitive->GetMobility() == EComponentMobility::Movable ? EQueryObjectType::Dynamic : EQueryObjectType::Static;
+	if ((InParams.ObjectTypes & static_cast<uint8>(ObjectType)) == 0) { return false; }
+	if (InParams.bVisibleOnly && !InPrimitive->IsVisible()) { return false; }
+	if (InParams.ComponentClass && !InPrimitive->IsA(InParams.ComponentClass)) { return false; }
+
+	const AActor* Owner = InPrimitive->GetOwner();
+	if (InParams.ActorClass && (!Owner || !Owner->IsA(InParams.ActorClass))) { return false; }
+
+	if (!InParams.IgnoredComponents.empty() &&
+		std::find(InParams.IgnoredComponents.begin(), InParams.IgnoredComponents.end(), InPrimitive) != InParams.IgnoredComponents.end())
+	{
+		return false;
+	}
+	if (Owner && !InParams.IgnoredActors.empty() &&
+		std::find(InParams.IgnoredActors.begin(), InParams.IgnoredActors.end(), Owner) != InParams.IgnoredActors.end())
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool FSceneQuery::OverlapPrimitiveFrustum(UPrimitiveComponent* InPrimitive, const FFrustum& InFrustum, uint8 InPlaneMask,
+	EFrustumOverlapMode InMode)
+{
+	// 1. 월드 AABB. 완전히 바깥/안쪽이면 어느 모드든 판정이 끝난다
+	uint8 PlaneMask = InPlaneMask;
+	uint8 RejectingPlane = 0;
+	const EBoundCheckResult BoundsResult = InFrustum.CheckIntersection(GetPrimitiveBoundingBox(InPrimitive), PlaneMask, RejectingPlane);
+	if (BoundsResult != EBoundCheckResult::Intersect)
+	{
+		return BoundsResult == EBoundCheckResult::Inside;
+	}
+
+	if (InMode == EFrustumOverlapMode::BoundsIntersect || InMode == EFrustumOverlapMode::BoundsContain)
+	{
+		return InMode == EFrustumOverlapMode::BoundsIntersect;
+	}
+
+	// 2. 삼각형이 없는 프리미티브(빌보드, 텍스트 등)는 경계에 걸친 AABB로 판정한다
+	const bool bRequireContainment = InMode == EFrustumOverlapMode::TriangleContain;
+	const TArray<FNormalVertex>* Vertices = InPrimitive->GetVerticesData();
+	const TArray<uint32>* Indices = InPrimitive->GetIndicesData();
+	if (!Vertices || Vertices->empty() || InPrimitive->GetTopology() != D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST)
+	{
+		return !bRequireContainment;
+	}
+
+	// 3. 절두체를 모델 공간으로 옮겨 메시 BVH로 판정한다. BVH가 없는 프리미티브(기본 도형 등)는 삼각형이 적으므로 모두 검사한다
+	const FFrustum LocalFrustum = InFrustum.TransformToLocal(InPrimitive->GetWorldTransformMatrix());
+	if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(InPrimitive))
+	{
+		UStaticMesh* StaticMesh = StaticMeshComponent->GetStaticMesh();
+		FStaticMesh* StaticMeshAsset = StaticMesh ? StaticMesh->GetStaticMeshAsset() : nullptr;
+		if (StaticMeshAsset && StaticMeshAsset->BVH.GetRootIndex() >= 0)
+		{
+			return StaticMeshAsset->BVH.OverlapFrustum(LocalFrustum, bRequireContainment);
+		}
+	}
+
+	FVector Corners[8];
+	const FVector* CornerPointer = LocalFrustum.GetCorners(Corners) ? Corners : nullptr;
+
+	const uint32 TriangleCount = static_cast<uint32>(Indices ? Indices->size() / 3 : Vertices->size() / 3);
+	for (uint32 Triangle = 0; Triangle < TriangleCount; ++Triangle)
+	{
+		const FVector& V0 = (*Vertices)[Indices ? (*Indices)[Triangle * 3 + 0] : Triangle * 3 + 0].Position;
+		const FVector& V1 = (*Vertices)[Indices ? (*Indices)[Triangle * 3 + 1] : Triangle * 3 + 1].Position;
+		const FVector& V2 = (*Vertices)[Indices ? (*Indices)[Triangle * 3 + 2] : Triangle * 3 + 2].Position;
+
+		if (bRequireContainment)
+		{
+			if (!LocalFrustum.ContainsPoint(V0) || !LocalFrustum.ContainsPoint(V1) || !LocalFrustum.ContainsPoint(V2))
+			{
+				return false;
+			}
+		}
+		else if (FBVH::IntersectTriangleFrustum(LocalFrustum, CornerPointer, V0, V1, V2))
+		{
+			return true;
+		}
+	}
+	return bRequireContainment;
+}
+
+bool FSceneQuery::TracePrimitive(UPrimitiveComponent* InPrimitive, const FVector& InStart, const FVector& InDirection, float InMaxDistance,
+	const FCollisionQueryParams& InParams, FHitResult& OutHit, bool bAnyHit)
+{
+	FSceneRayHit RayHit;
+	if (!FSceneTLAS::IntersectPrimitive(InPrimitive, InStart, InDirection, InMaxDistance, MakeRayParams(InParams, InMaxDistance, bAnyHit), RayHit))
+	{
+		return false;
+	}
+
+	ToHitResult(RayHit, InStart, InDirection, OutHit);
+	return true;
+}
+
+FSceneRayParams FSceneQuery::MakeRayParams(const FCollisionQueryParams& InParams, float InLength, bool bAnyHit)
+{
+	FSceneRayParams RayParams;
+	RayParams.MaxDistance = InLength;
+	RayParams.bAnyHit = bAnyHit;
+	RayParams.bTraceComplex = InParams.bTraceComplex;
+	RayParams.Filter = [&InParams](UPrimitiveComponent* InPrimitive)
+	{
+		return PassesFilter(InPrimitive, InParams);
+	};
+	return RayParams;
+}
+
+bool FSceneQuery::IntersectSegmentBox(const FVector& InStart, const FVector& InInvDirection, float InLength, const FAABB& InBox,
+	float& OutEntryDistance, int32& OutEntryAxis)
+{
+	float Entry = 0.0f;
+	float Exit = InLength;
+	OutEntryAxis = -1;
+
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		const float Origin = GetAxis(InStart, Axis);
+		const float InvDirection = GetAxis(InInvDirection, Axis);
+		float T1 = (GetAxis(InBox.Min, Axis) - Origin) * InvDirection;
+		float T2 = (GetAxis(InBox.Max, Axis) - Origin) * InvDirection;
+		if (T1 > T2) { std::swap(T1, T2); }
+
+		if (T1 > Entry)
+		{
+			Entry = T1;
+			OutEntryAxis = Axis;
+		}
+		Exit = min(Exit, T2);
+		if (Exit < Entry) { return false; }
+	}
+
+	OutEntryDistance = Entry;
+	return true;
+}
@@ -0,0 +1,561 @@
+#include "pch.h"
+#include "Physics/Public/SceneTLAS.h"
+#include "Level/Public/Level.h"
+#include "Component/Public/PrimitiveComponent.h"
+#include "Component/Mesh/Public/StaticMeshComponent.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Global/Octree.h"
+#include "Global/DynamicAABBTree.h"
+#include "Global/BVH.h"
+
+namespace
+{
+	constexpr uint32 TLAS_BIN_COUNT = 16;
+	/** @brief Refit한 노드의 반면적 합이 구축 때의 이 배수를 넘으면 형제 박스가 많이 겹친 것으로 보고 다시 구축한다 */
+	constexpr float TLAS_REFIT_REBUILD_AREA_RATIO = 1.5f;
+
+	/** @brief Trace 순회 스택 (노드 인덱스, 노드 진입 거리). 스레드마다 하나씩 두고 재사용한다 */
+	thread_local TArray<std::pair<uint32, float>> TLASTraversalStack;
+
+	/** @brief 레이와 박스의 [InMinDistance, InMaxDistance] 구간 교차. 교차하면 진입 거리를 OutEntry에 담는다 */
+	bool IntersectRayBox(const float InMin[3], const float InMax[3], const FVector& InOrigin, const FVector& InInvDirection,
+		float InMinDistance, float InMaxDistance, float& OutEntry)
+	{
+		const float TX1 = (InMin[0] - InOrigin.X) * InInvDirection.X;
+		const float TX2 = (InMax[0] - InOrigin.X) * InInvDirection.X;
+		const float TY1 = (InMin[1] - InOrigin.Y) * InInvDirection.Y;
+		const float TY2 = (InMax[1] - InOrigin.Y) * InInvDirection.Y;
+		const float TZ1 = (InMin[2] - InOrigin.Z) * InInvDirection.Z;
+		const float TZ2 = (InMax[2] - InOrigin.Z) * InInvDirection.Z;
+
+		OutEntry = std::max({ std::min(TX1, TX2), std::min(TY1, TY2), std::min(TZ1, TZ2), InMinDistance });
+		const float Exit = std::min({ std::max(TX1, TX2), std::max(TY1, TY2), std::max(TZ1, TZ2), InMaxDistance });
+		return OutEntry <= Exit;
+	}
+
+	float GetAxis(const FVector& InVector, int32 InAxis)
+	{
+		return InAxis == 0 ? InVector.X : (InAxis == 1 ? InVector.Y : InVector.Z);
+	}
+
+	/** @brief 모델 공간 법선을 월드 공간으로 옮긴다. 비균등 스케일을 위해 역행렬의 전치를 곱한다 */
+	FVector TransformNormal(const FVector& InNormal, const FMatrix& InWorldToModel)
+	{
+		const auto& M = InWorldToModel.Data;
+		return FVector(
+			InNormal.X * M[0][0] + InNormal.Y * M[0][1] + InNormal.Z * M[0][2],
+			InNormal.X * M[1][0] + InNormal.Y * M[1][1] + InNormal.Z * M[1][2],
+			InNormal.X * M[2][0] + InNormal.Y * M[2][1] + InNormal.Z * M[2][2]);
+	}
+
+	/** @brief 구축 중인 박스. 비어 있으면 Min > Max */
+	struct FBuildBounds
+	{
+		float Min[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+		float Max[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+		void Grow(const float InMin[3], const float InMax[3])
+		{
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				Min[Axis] = std::min(Min[Axis], InMin[Axis]);
+				Max[Axis] = std::max(Max[Axis], InMax[Axis]);
+			}
+		}
+
+		void GrowPoint(float InX, float InY, float InZ)
+		{
+			const float Point[3] = { InX, InY, InZ };
+			Grow(Point, Point);
+		}
+
+		float GetHalfArea() const
+		{
+			if (Min[0] > Max[0]) { return 0.0f; }
+			const float X = Max[0] - Min[0];
+			const float Y = Max[1] - Min[1];
+			const float Z = Max[2] - Min[2];
+			return X * Y + Y * Z + Z * X;
+		}
+	};
+
+	/** @brief 아직 나누지 않은 노드와 그 노드가 담을 인스턴스 구간 */
+	struct FBuildRange
+	{
+		uint32 NodeIndex;
+		uint32 Begin;
+		uint32 End;
+	};
+}
+
+void FSceneTLAS::Update(ULevel* InLevel)
+{
+	if (!InLevel)
+	{
+		Clear();
+		return;
+	}
+	if (InLevel->GetSceneRevision() == BuiltSceneRevision)
+	{
+		return;
+	}
+
+	// 트랜스폼/가시성만 바뀌었다면 같은 프리미티브 집합이므로 트리 모양은 두고 박스만 다시 맞춘다
+	if (InLevel->GetSceneStructureRevision() == BuiltStructureRevision && Refit())
+	{
+		BuiltSceneRevision = InLevel->GetSceneRevision();
+		return;
+	}
+
+	// 레벨 로드/등록 경로와 같이 StaticOctree와 DynamicTree에 들어간 프리미티브만 담는다 (AABB가 유효하지 않은 대기 프리미티브 제외)
+	GatheredPrimitives.clear();
+	if (const FOctree* StaticOctree = InLevel->GetStaticOctree())
+	{
+		StaticOctree->GetAllPrimitives(GatheredPrimitives);
+	}
+
+	if (const FDynamicAABBTree* DynamicTree = InLevel->GetDynamicTree())
+	{
+		DynamicTree->GetAllPrimitives(GatheredPrimitives);
+	}
+
+	Build(GatheredPrimitives);
+	BuiltSceneRevision = InLevel->GetSceneRevision();
+	BuiltStructureRevision = InLevel->GetSceneStructureRevision();
+}
+
+void FSceneTLAS::Build(const TArray<UPrimitiveComponent*>& InPrimitives)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	Nodes.clear();
+	Instances.clear();
+	Instances.reserve(InPrimitives.size());
+	BuiltNodeAreaSum = 0.0f;
+	bSkippedInvalidPrimitives = false;
+
+	for (UPrimitiveComponent* Primitive : InPrimitives)
+	{
+		if (!Primitive) { continue; }
+
+		FVector Min, Max;
+		Primitive->GetWorldAABB(Min, Max);
+		if (!(Min.X <= Max.X && Min.Y <= Max.Y && Min.Z <= Max.Z))
+		{
+			bSkippedInvalidPrimitives = true;
+			continue;
+		}
+
+		Instances.push_back({ { Min.X, Min.Y, Min.Z }, { Max.X, Max.Y, Max.Z }, Primitive });
+	}
+
+	if (!Instances.empty())
+	{
+		Nodes.reserve(Instances.size() * 2);
+		Nodes.push_back(FNode());
+
+		TArray<FBuildRange> RangeStack;
+		RangeStack.push_back({ 0, 0, static_cast<uint32>(Instances.size()) });
+
+		while (!RangeStack.empty())
+		{
+			const FBuildRange Range = RangeStack.back();
+			RangeStack.pop_back();
+
+			// 1. 노드 박스와 인스턴스 중심의 박스
+			FBuildBounds NodeBounds;
+			FBuildBounds CentroidBounds;
+			for (uint32 Index = Range.Begin; Index < Range.End; ++Index)
+			{
+				const FInstance& Instance = Instances[Index];
+				NodeBounds.Grow(Instance.Min, Instance.Max);
+				CentroidBounds.GrowPoint((Instance.Min[0] + Instance.Max[0]) * 0.5f,
+					(Instance.Min[1] + Instance.Max[1]) * 0.5f, (Instance.Min[2] + Instance.Max[2]) * 0.5f);
+			}
+
+			FNode& Node = Nodes[Range.NodeIndex];
+			std::copy(NodeBounds.Min, NodeBounds.Min + 3, Node.Min);
+			std::copy(NodeBounds.Max, NodeBounds.Max + 3, Node.Max);
+			BuiltNodeAreaSum += NodeBounds.GetHalfArea();
+
+			const uint32 Count = Range.End - Range.Begin;
+			if (Count <= MAX_LEAF_INSTANCES)
+			{
+				Node.FirstIndex = Range.Begin;
+				Node.Count = Count;
+				continue;
+			}
+
+			// 2. 축마다 중심을 bin에 나눠 SAH 비용이 가장 낮은 경계를 찾는다
+			int32 BestAxis = -1;
+			uint32 BestSplit = 0;
+			float BestCost = FLT_MAX;
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				const float Extent = CentroidBounds.Max[Axis] - CentroidBounds.Min[Axis];
+				if (!(Extent > 0.0f)) { continue; }
+				const float BinScale = TLAS_BIN_COUNT / Extent;
+
+				FBuildBounds BinBounds[TLAS_BIN_COUNT];
+				uint32 BinCounts[TLAS_BIN_COUNT] = {};
+				for (uint32 Index = Range.Begin; Index < Range.End; ++Index)
+				{
+					const FInstance& Instance = Instances[Index];
+					const float Centroid = (Instance.Min[Axis] + Instance.Max[Axis]) * 0.5f;
+					const uint32 Bin = std::min(static_cast<uint32>((Centroid - CentroidBounds.Min[Axis]) * BinScale), TLAS_BIN_COUNT - 1);
+					BinBounds[Bin].Grow(Instance.Min, Instance.Max);
+					++BinCounts[Bin];
+				}
+
+				// 오른쪽에서 누적한 면적/개수를 먼저 구해 두고 왼쪽을 누적하며 경계마다 비용을 계산한다
+				float RightAreas[TLAS_BIN_COUNT];
+				uint32 RightCounts[TLAS_BIN_COUNT];
+				FBuildBounds Accumulated;
+				uint32 AccumulatedCount = 0;
+				for (uint32 Bin = TLAS_BIN_COUNT - 1; Bin > 0; --Bin)
+				{
+					Accumulated.Grow(BinBounds[Bin].Min, BinBounds[Bin].Max);
+					AccumulatedCount += BinCounts[Bin];
+					RightAreas[Bin] = Accumulated.GetHalfArea();
+					RightCounts[Bin] = AccumulatedCount;
+				}
+
+				Accumulated = FBuildBounds();
+				AccumulatedCount = 0;
+				for (uint32 Split = 1; Split < TLAS_BIN_COUNT; ++Split)
+				{
+					Accumulated.Grow(BinBounds[Split - 1].Min, BinBounds[Split - 1].Max);
+					AccumulatedCount += BinCounts[Split - 1];
+					if (AccumulatedCount == 0 || RightCounts[Split] == 0) { continue; }
+
+					const float Cost = Accumulated.GetHalfArea() * AccumulatedCount + RightAreas[Split] * RightCounts[Split];
+					if (Cost < BestCost)
+					{
+						BestCost = Cost;
+						BestAxis = Axis;
+						BestSplit = Split;
+					}
+				}
+			}
+
+			// 3. 중심이 모두 같은 위치라 나눌 경계가 없으면 구간을 반으로 나눈다 (같은 자리에 겹쳐 놓은 액터)
+			uint32 Middle = Range.Begin + Count / 2;
+			if (BestAxis >= 0)
+			{
+				const float BinScale = TLAS_BIN_COUNT / (CentroidBounds.Max[BestAxis] - CentroidBounds.Min[BestAxis]);
+				const float AxisMin = CentroidBounds.Min[BestAxis];
+				const auto SplitIt = std::partition(Instances.begin() + Range.Begin, Instances.begin() + Range.End, [&](const FInstance& InInstance)
+				{
+					const float Centroid = (InInstance.Min[BestAxis] + InInstance.Max[BestAxis]) * 0.5f;
+					return std::min(static_cast<uint32>((Centroid - AxisMin) * BinScale), TLAS_BIN_COUNT - 1) < BestSplit;
+				});
+				Middle = static_cast<uint32>(SplitIt - Instances.begin());
+			}
+
+			// 형제 노드는 항상 이웃한 두 칸에 둔다. push_back이 Node 참조를 무효화할 수 있으므로 인덱스로 다시 접근한다
+			const uint32 ChildIndex = static_cast<uint32>(Nodes.size());
+			Nodes[Range.NodeIndex].FirstIndex = ChildIndex;
+			Nodes[Range.NodeIndex].Count = 0;
+			Nodes.push_back(FNode());
+			Nodes.push_back(FNode());
+
+			RangeStack.push_back({ ChildIndex + 1, Middle, Range.End });
+			RangeStack.push_back({ ChildIndex, Range.Begin, Middle });
+		}
+	}
+
+	LastBuildMs = static_cast<float>(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+}
+
+bool FSceneTLAS::Refit()
+{
+	if (bSkippedInvalidPrimitives)
+	{
+		return false;
+	}
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	// 1. 인스턴스 박스를 컴포넌트의 현재 월드 AABB로 바꾼다
+	for (FInstance& Instance : Instances)
+	{
+		FVector Min, Max;
+		Instance.Primitive->GetWorldAABB(Min, Max);
+		if (!(Min.X <= Max.X && Min.Y <= Max.Y && Min.Z <= Max.Z)) { return false; }
+
+		Instance = { { Min.X, Min.Y, Min.Z }, { Max.X, Max.Y, Max.Z }, Instance.Primitive };
+	}
+
+	// 2. 자식은 항상 부모보다 뒤에 만들어지므로 뒤에서부터 훑으면 부모를 계산할 때 자식 박스가 이미 갱신되어 있다
+	float NodeAreaSum = 0.0f;
+	for (size_t NodeIndex = Nodes.size(); NodeIndex-- > 0;)
+	{
+		FNode& Node = Nodes[NodeIndex];
+		FBuildBounds NodeBounds;
+		if (Node.Count > 0)
+		{
+			for (uint32 Index = Node.FirstIndex; Index < Node.FirstIndex + Node.Count; ++Index)
+			{
+				NodeBounds.Grow(Instances[Index].Min, Instances[Index].Max);
+			}
+		}
+		else
+		{
+			NodeBounds.Grow(Nodes[Node.FirstIndex].Min, Nodes[Node.FirstIndex].Max);
+			NodeBounds.Grow(Nodes[Node.FirstIndex + 1].Min, Nodes[Node.FirstIndex + 1].Max);
+		}
+
+		std::copy(NodeBounds.Min, NodeBounds.Min + 3, Node.Min);
+		std::copy(NodeBounds.Max, NodeBounds.Max + 3, Node.Max);
+		NodeAreaSum += NodeBounds.GetHalfArea();
+	}
+
+	LastRefitMs = static_cast<float>(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+
+	// 멀리 움직인 인스턴스가 쌓이면 형제 박스가 겹쳐 순회가 느려지므로 다시 구축한다
+	return NodeAreaSum <= BuiltNodeAreaSum * TLAS_REFIT_REBUILD_AREA_RATIO;
+}
+
+void FSceneTLAS::Clear()
+{
+	Nodes.clear();
+	Instances.clear();
+	BuiltSceneRevision = 0;
+	BuiltStructureRevision = 0;
+	BuiltNodeAreaSum = 0.0f;
+	bSkippedInvalidPrimitives = false;
+}
+
+bool FSceneTLAS::Trace(const FVector& InOrigin, const FVector& InDirection, const FSceneRayParams& InParams, FSceneRayHit& OutHit) const
+{
+	OutHit = FSceneRayHit();
+	if (Nodes.empty())
+	{
+		return false;
+	}
+
+	const FVector InvDirection = FBVH::GetSafeInverseDirection(InDirection);
+
+	float RootEntry;
+	if (!IntersectRayBox(Nodes[0].Min, Nodes[0].Max, InOrigin, InvDirection, InParams.MinDistance, InParams.MaxDistance, RootEntry))
+	{
+		return false;
+	}
+
+	// 모든 인스턴스가 Closest 하나를 공유한다. 꺼낸 노드의 진입 거리가 그 사이 줄어든 Closest보다 멀면 건너뛴다
+	TArray<std::pair<uint32, float>>& NodeStack = TLASTraversalStack;
+	NodeStack.clear();
+	NodeStack.emplace_back(0, RootEntry);
+
+	float Closest = InParams.MaxDistance;
+	FSceneRayHit Hit;
+	while (!NodeStack.empty())
+	{
+		const auto [NodeIndex, Entry] = NodeStack.back();
+		NodeStack.pop_back();
+		if (Entry > Closest)
+		{
+			continue;
+		}
+
+		const FNode& Node = Nodes[NodeIndex];
+		if (Node.Count > 0)
+		{
+			for (uint32 Index = Node.FirstIndex; Index < Node.FirstIndex + Node.Count; ++Index)
+			{
+				const FInstance& Instance = Instances[Index];
+				float InstanceEntry;
+				if (!IntersectRayBox(Instance.Min, Instance.Max, InOrigin, InvDirection, InParams.MinDistance, Closest, InstanceEntry))
+				{
+					continue;
+				}
+				if (InParams.Filter && !InParams.Filter(Instance.Primitive))
+				{
+					continue;
+				}
+
+				// BLAS에는 지금까지의 Closest를 최대 거리로 넘기므로 그보다 먼 삼각형은 보지 않는다
+				if (IntersectPrimitive(Instance.Primitive, InOrigin, InDirection, Closest, InParams, Hit))
+				{
+					Closest = Hit.Distance;
+					OutHit = Hit;
+					if (InParams.bAnyHit)
+					{
+						return true;
+					}
+				}
+			}
+			continue;
+		}
+
+		// 가까운 자식이 먼저 꺼내지도록 먼 자식을 먼저 넣는다
+		float LeftEntry;
+		float RightEntry;
+		const FNode& Left = Nodes[Node.FirstIndex];
+		const FNode& Right = Nodes[Node.FirstIndex + 1];
+		const bool bLeftHit = IntersectRayBox(Left.Min, Left.Max, InOrigin, InvDirection, InParams.MinDistance, Closest, LeftEntry);
+		const bool bRightHit = IntersectRayBox(Right.Min, Right.Max, InOrigin, InvDirection, InParams.MinDistance, Closest, RightEntry);
+		if (bLeftHit && bRightHit)
+		{
+			if (LeftEntry <= RightEntry)
+			{
+				NodeStack.emplace_back(Node.FirstIndex + 1, RightEntry);
+				NodeStack.emplace_back(Node.FirstIndex, LeftEntry);
+			}
+			else
+			{
+				NodeStack.emplace_back(Node.FirstIndex, LeftEntry);
+				NodeStack.emplace_back(Node.FirstIndex + 1, RightEntry);
+			}
+		}
+		else if (bLeftHit)
+		{
+			NodeStack.emplace_back(Node.FirstIndex, LeftEntry);
+		}
+		else if (bRightHit)
+		{
+			NodeStack.emplace_back(Node.FirstIndex + 1, RightEntry);
+		}
+	}
+
+	return OutHit.Primitive != nullptr;
+}
+
+bool FSceneTLAS::IntersectPrimitive(UPrimitiveComponent* InPrimitive, const FVector& InOrigin, const FVector& InDirection, float InMaxDistance,
+	const FSceneRayParams& InParams, FSceneRayHit& OutHit)
+{
+	if (!InPrimitive)
+	{
+		return false;
+	}
+
+	// 1. 월드 AABB. 진입한 면의 축은 AABB로 판정할 때의 법선에 쓴다
+	FVector BoxMin, BoxMax;
+	InPrimitive->GetWorldAABB(BoxMin, BoxMax);
+
+	const FVector InvDirection = FBVH::GetSafeInverseDirection(InDirection);
+	float EntryDistance = InParams.MinDistance;
+	float ExitDistance = InMaxDistance;
+	int32 EntryAxis = -1;
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		const float Origin = GetAxis(InOrigin, Axis);
+		const float InvAxisDirection = GetAxis(InvDirection, Axis);
+		float T1 = (GetAxis(BoxMin, Axis) - Origin) * InvAxisDirection;
+		float T2 = (GetAxis(BoxMax, Axis) - Origin) * InvAxisDirection;
+		if (T1 > T2) { std::swap(T1, T2); }
+
+		if (T1 > EntryDistance)
+		{
+			EntryDistance = T1;
+			EntryAxis = Axis;
+		}
+		ExitDistance = std::min(ExitDistance, T2);
+		if (ExitDistance < EntryDistance) { return false; }
+	}
+
+	const TArray<FNormalVertex>* Vertices = InPrimitive->GetVerticesData();
+	const TArray<uint32>* Indices = InPrimitive->GetIndicesData();
+	const bool bHasTriangles = Vertices && !Vertices->empty() && InPrimitive->GetTopology() == D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+
+	// 2. 삼각형이 없는 프리미티브(빌보드, 텍스트 등)와 단순 트레이스는 월드 AABB로 판정한다
+	if (!InParams.bTraceComplex || !bHasTriangles)
+	{
+		if (InParams.bTraceComplex && !InParams.bHitBoundsWithoutTriangles)
+		{
+			return false;
+		}
+
+		OutHit.Primitive = InPrimitive;
+		OutHit.Distance = EntryDistance;
+		OutHit.TriangleIndex = -1;
+		if (EntryAxis < 0)
+		{
+			OutHit.Normal = -InDirection;
+		}
+		else
+		{
+			OutHit.Normal = FVector(0.0f, 0.0f, 0.0f);
+			const float Sign = GetAxis(InDirection, EntryAxis) > 0.0f ? -1.0f : 1.0f;
+			(EntryAxis == 0 ? OutHit.Normal.X : (EntryAxis == 1 ? OutHit.Normal.Y : OutHit.Normal.Z)) = Sign;
+		}
+		return true;
+	}
+
+	// 3. 방향을 정규화하지 않은 모델 공간 레이의 T는 월드 공간 거리와 같으므로 tMax를 그대로 BLAS에 넘긴다
+	const FMatrix& WorldToModel = InPrimitive->GetWorldTransformMatrixInverse();
+	const FVector4 ModelOrigin4 = FVector4(InOrigin, 1.0f) * WorldToModel;
+	const FVector4 ModelDirection4 = FVector4(InDirection, 0.0f) * WorldToModel;
+	const FVector ModelOrigin(ModelOrigin4.X, ModelOrigin4.Y, ModelOrigin4.Z);
+	const FVector ModelDirection(ModelDirection4.X, ModelDirection4.Y, ModelDirection4.Z);
+
+	const uint32 TriangleCount = static_cast<uint32>(Indices ? Indices->size() / 3 : Vertices->size() / 3);
+	auto GetPosition = [&](uint32 InTriangle, uint32 InCorner) -> const FVector&
+	{
+		return (*Vertices)[Indices ? (*Indices)[InTriangle * 3 + InCorner] : InTriangle * 3 + InCorner].Position;
+	};
+
+	float ClosestDistance = InMaxDistance;
+	int32 ClosestTriangle = -1;
+
+	const FBVH* BLAS = nullptr;
+	if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(InPrimitive))
+	{
+		UStaticMesh* StaticMesh = StaticMeshComponent->GetStaticMesh();
+		FStaticMesh* StaticMeshAsset = StaticMesh ? StaticMesh->GetStaticMeshAsset() : nullptr;
+		if (StaticMeshAsset && StaticMeshAsset->BVH.GetRootIndex() >= 0)
+		{
+			BLAS = &StaticMeshAsset->BVH;
+		}
+	}
+
+	if (BLAS)
+	{
+		FRay ModelRay;
+		ModelRay.Origin = ModelOrigin4;
+		ModelRay.Direction = ModelDirection4;
+
+		FBVHRayHit BVHHit;
+		const bool bBVHHit = InParams.bAnyHit
+			? BLAS->AnyHit(ModelRay, BVHHit, InParams.MinDistance, ClosestDistance)
+			: BLAS->ClosestHit(ModelRay, BVHHit, InParams.MinDistance, ClosestDistance);
+		if (bBVHHit && static_cast<uint32>(BVHHit.TriangleIndex) < TriangleCount)
+		{
+			ClosestDistance = BVHHit.Distance;
+			ClosestTriangle = BVHHit.TriangleIndex;
+		}
+	}
+	else
+	{
+		// BLAS가 없는 프리미티브(기본 도형 등)는 삼각형이 적으므로 모두 검사한다
+		for (uint32 Triangle = 0; Triangle < TriangleCount; ++Triangle)
+		{
+			float T, U, V;
+			if (FBVH::IntersectTriangle(ModelOrigin, ModelDirection, GetPosition(Triangle, 0), GetPosition(Triangle, 1), GetPosition(Triangle, 2),
+				InParams.MinDistance, ClosestDistance, T, U, V))
+			{
+				ClosestDistance = T;
+				ClosestTriangle = static_cast<int32>(Triangle);
+				if (InParams.bAnyHit) { break; }
+			}
+		}
+	}
+
+	if (ClosestTriangle < 0)
+	{
+		return false;
+	}
+
+	const uint32 Triangle = static_cast<uint32>(ClosestTriangle);
+	const FVector ModelNormal = (GetPosition(Triangle, 1) - GetPosition(Triangle, 0)).Cross(GetPosition(Triangle, 2) - GetPosition(Triangle, 0));
+
+	OutHit.Primitive = InPrimitive;
+	OutHit.Distance = ClosestDistance;
+	OutHit.TriangleIndex = ClosestTriangle;
+	OutHit.Normal = TransformNormal(ModelNormal, WorldToModel).GetNormalized();
+	if (OutHit.Normal.Dot(InDirection) > 0.0f)
+	{
+		OutHit.Normal = -OutHit.Normal;
+	}
+	return true;
+}
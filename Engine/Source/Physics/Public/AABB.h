@@ -28,5 +28,7 @@ struct FAABB : public IBoundingVolume
 };
 
 bool CheckIntersectionRayBox(const FRay& Ray, const FAABB& Box);
+/** @brief 교차하면 레이 원점에서 박스에 들어가는 거리(Ray.Direction 길이 단위)를 담는다. 원점이 박스 안이면 0 */
+bool CheckIntersectionRayBox(const FRay& Ray, const FAABB& Box, float& OutEntryDistance);
 
 FAABB Union(const FAABB& Box1, const FAABB& Box2);
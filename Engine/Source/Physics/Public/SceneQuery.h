@@ -0,0 +1,146 @@
+#pragma once
+#include "Physics/Public/AABB.h"
+
+class ULevel;
+class AActor;
+class UClass;
+class UPrimitiveComponent;
+class FOctree;
+class FDynamicAABBTree;
+struct FOBB;
+struct FFrustum;
+struct FSceneRayParams;
+
+/**
+ * @brief 쿼리가 검사할 프리미티브 종류. UPrimitiveComponent::GetMobility로 구분한다
+ * 레벨의 어느 트리에 들어 있는지와는 무관하므로, 옮기거나 BuildStaticOctree를 호출해도 결과가 바뀌지 않는다.
+ */
+enum class EQueryObjectType : uint8
+{
+	None = 0,
+	Static = 1 << 0,	// EComponentMobility::Static
+	Dynamic = 1 << 1,	// EComponentMobility::Movable
+	All = Static | Dynamic,
+};
+
+/** @brief FSceneQuery::OverlapFrustum의 판정 기준 */
+enum class EFrustumOverlapMode : uint8
+{
+	BoundsIntersect,	// 월드 AABB가 절두체와 겹치면 포함
+	BoundsContain,		// 월드 AABB가 절두체 안에 완전히 들어오면 포함
+	TriangleIntersect,	// 메시 삼각형이 하나라도 절두체와 겹치면 포함 (삼각형이 없는 프리미티브는 월드 AABB로 판정)
+	TriangleContain,	// 메시 삼각형이 모두 절두체 안에 있으면 포함 (삼각형이 없는 프리미티브는 월드 AABB로 판정)
+};
+
+/** @brief 월드 쿼리 필터 */
+struct FCollisionQueryParams
+{
+	/** @brief EQueryObjectType 비트 마스크 */
+	uint8 ObjectTypes = static_cast<uint8>(EQueryObjectType::All);
+	/** @brief 지정하면 이 클래스(또는 하위 클래스)의 컴포넌트만 검사한다 */
+	UClass* ComponentClass = nullptr;
+	/** @brief 지정하면 이 클래스(또는 하위 클래스)의 액터가 소유한 컴포넌트만 검사한다 */
+	UClass* ActorClass = nullptr;
+	bool bVisibleOnly = true;
+	/** @brief 라인 트레이스에서 true면 메시 삼각형까지, false면 월드 AABB까지만 검사한다 */
+	bool bTraceComplex = true;
+	TArray<const AActor*> IgnoredActors;
+	TArray<const UPrimitiveComponent*> IgnoredComponents;
+};
+
+/** @brief 라인 트레이스 결과 */
+struct FHitResult
+{
+	UPrimitiveComponent* Component = nullptr;
+	AActor* Actor = nullptr;
+	/** @brief 시작점에서 충돌 지점까지의 거리 */
+	float Distance = 0.0f;
+	FVector Location;
+	/** @brief 레이를 마주보는 방향의 월드 공간 면 법선 */
+	FVector Normal;
+	/** @brief 충돌한 삼각형 번호. AABB로 판정했다면 -1 */
+	int32 TriangleIndex = -1;
+
+	bool IsValidHit() const { return Component != nullptr; }
+};
+
+/**
+ * @brief 레벨의 StaticOctree와 DynamicTree를 함께 검사하는 공간 쿼리
+ * 트리에서 경계가 겹치는 후보를 모은 뒤 필터를 적용하고, 프리미티브의 월드 AABB(라인 트레이스는 메시 삼각형)로 정밀 판정한다.
+ * LineTraceSingle/LineTraceTest는 후보를 모으지 않고 레벨의 FSceneTLAS를 가까운 인스턴스부터 순회한다.
+ * 메시 삼각형은 스태틱 메시 에셋의 FBVH를 closest-hit(LineTraceTest는 any-hit)으로 순회하며, BVH가 없으면 모든 삼각형을 검사한다.
+ * 후보/노드 버퍼를 쿼리 사이에 재사용하므로 한 스레드(게임 스레드)에서만 호출해야 하며,
+ * 결과 배열도 호출하는 쪽에서 재사용하면 정상 상태에서는 메모리를 할당하지 않는다.
+ */
+class FSceneQuery
+{
+public:
+	/**
+	 * @brief InStart에서 InEnd까지의 선분과 가장 먼저 충돌하는 프리미티브를 찾는다.
+	 * TLAS를 가까운 노드부터 순회하므로, 지금까지 찾은 충돌보다 먼 인스턴스는 삼각형을 보지 않는다.
+	 */
+	bool LineTraceSingle(ULevel* InLevel, const FVector& InStart, const FVector& InEnd, FHitResult& OutHit,
+		const FCollisionQueryParams& InParams);
+	/**
+	 * @brief 선분을 가로막는 프리미티브가 하나라도 있는지 검사한다 (그림자/가시성 판정용).
+	 * 충돌을 하나 찾으면 바로 반환하며, 메시 BVH는 any-hit 순회로 가장 가까운 충돌을 찾지 않는다.
+	 */
+	bool LineTraceTest(ULevel* InLevel, const FVector& InStart, const FVector& InEnd, const FCollisionQueryParams& InParams);
+	/** @brief 선분과 충돌하는 모든 프리미티브를 가까운 순서로 찾는다. 프리미티브마다 가장 가까운 충돌 하나만 담는다. */
+	bool LineTraceMulti(ULevel* InLevel, const FVector& InStart, const FVector& InEnd, TArray<FHitResult>& OutHits,
+		const FCollisionQueryParams& InParams);
+
+	/** @brief 월드 AABB가 InBox와 겹치는 프리미티브 */
+	bool OverlapAABB(ULevel* InLevel, const FAABB& InBox, TArray<UPrimitiveComponent*>& OutPrimitives,
+		const FCollisionQueryParams& InParams);
+	/** @brief 월드 AABB가 구와 겹치는 프리미티브 (반경 쿼리) */
+	bool OverlapSphere(ULevel* InLevel, const FVector& InCenter, float InRadius, TArray<UPrimitiveComponent*>& OutPrimitives,
+		const FCollisionQueryParams& InParams);
+	/** @brief 월드 AABB가 OBB와 겹치는 프리미티브 (SAT) */
+	bool OverlapOBB(ULevel* InLevel, const FOBB& InBox, TArray<UPrimitiveComponent*>& OutPrimitives,
+		const FCollisionQueryParams& InParams);
+	/**
+	 * @brief 절두체(마퀴 선택의 부분 절두체 등)와 겹치거나 그 안에 들어오는 프리미티브.
+	 * 트리 노드를 절두체 평면 마스크와 함께 내려가며, 노드가 완전히 바깥이면 서브트리를 버리고 완전히 안쪽이면
+	 * 서브트리의 프리미티브를 개별 판정 없이 모두 담는다. 경계에 걸친 프리미티브만 AABB, 삼각형 모드면 메시 BVH로 판정한다.
+	 */
+	bool OverlapFrustum(ULevel* InLevel, const FFrustum& InFrustum, EFrustumOverlapMode InMode, TArray<UPrimitiveComponent*>& OutPrimitives,
+		const FCollisionQueryParams& InParams);
+	/** @brief 레벨 대신 트리를 직접 받는 OverlapFrustum (레벨에 등록하지 않은 트리를 쓰는 벤치마크용). 트리는 nullptr이어도 된다 */
+	bool OverlapFrustum(FOctree* InStaticOctree, const FDynamicAABBTree* InDynamicTree, const FFrustum& InFrustum, EFrustumOverlapMode InMode,
+		TArray<UPrimitiveComponent*>& OutPrimitives, const FCollisionQueryParams& InParams);
+
+private:
+	/** @brief 경계가 InBox와 겹치는 후보를 Candidates에 모으고 필터를 적용한다. */
+	void GatherBoxCandidates(ULevel* InLevel, const FAABB& InBox, const FCollisionQueryParams& InParams);
+	/** @brief 경계가 선분과 교차하는 후보를 RayCandidates에 진입 거리 순으로 모으고 필터를 적용한다. */
+	void GatherRayCandidates(ULevel* InLevel, const FVector& InStart, const FVector& InDirection, float InLength,
+		const FCollisionQueryParams& InParams);
+	static bool PassesFilter(UPrimitiveComponent* InPrimitive, const FCollisionQueryParams& InParams);
+	/** @brief 절두체 경계에 걸친 프리미티브 하나를 InMode로 판정한다. InPlaneMask는 소속 노드가 아직 걸쳐 있는 평면 */
+	static bool OverlapPrimitiveFrustum(UPrimitiveComponent* InPrimitive, const FFrustum& InFrustum, uint8 InPlaneMask, EFrustumOverlapMode InMode);
+	/** @brief InParams를 FSceneTLAS 필터로 옮긴다 */
+	static FSceneRayParams MakeRayParams(const FCollisionQueryParams& InParams, float InLength, bool bAnyHit);
+
+	/**
+	 * @brief 선분과 프리미티브의 가장 가까운 충돌을 찾는다.
+	 * @param InDirection 정규화된 월드 방향
+	 * @param InMaxDistance 이보다 먼 충돌은 무시한다
+	 * @param bAnyHit true면 메시 BVH에서 처음 찾은 충돌을 반환한다 (가장 가깝지 않을 수 있다)
+	 */
+	bool TracePrimitive(UPrimitiveComponent* InPrimitive, const FVector& InStart, const FVector& InDirection, float InMaxDistance,
+		const FCollisionQueryParams& InParams, FHitResult& OutHit, bool bAnyHit = false);
+
+	/** @brief 선분과 AABB의 진입 거리. 교차하지 않으면 false (시작점이 안에 있으면 0) */
+	static bool IntersectSegmentBox(const FVector& InStart, const FVector& InInvDirection, float InLength, const FAABB& InBox,
+		float& OutEntryDistance, int32& OutEntryAxis);
+
+	// 쿼리 사이에 재사용하는 버퍼
+	TArray<UPrimitiveComponent*> Candidates;
+	TArray<TPair<float, UPrimitiveComponent*>> RayCandidates;
+	TArray<const FOctree*> NodeStack;
+	TArray<int32> DynamicNodeStack;
+	/** @brief OverlapFrustum 순회 스택 (노드, 아직 검사해야 하는 평면 마스크). 마스크가 0이면 절두체 안쪽의 서브트리다 */
+	TArray<TPair<const FOctree*, uint8>> FrustumNodeStack;
+	TArray<TPair<int32, uint8>> FrustumDynamicNodeStack;
+};
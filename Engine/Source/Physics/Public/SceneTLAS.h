@@ -0,0 +1,119 @@
+#pragma once
+
+class ULevel;
+class UPrimitiveComponent;
+
+/** @brief FSceneTLAS 레이 쿼리 필터 */
+struct FSceneRayParams
+{
+	/** @brief 레이 원점에서 이 거리 구간 안의 충돌만 찾는다 (월드 단위) */
+	float MinDistance = 0.0f;
+	float MaxDistance = FLT_MAX;
+	/** @brief true면 가장 가까운 충돌 대신 처음 찾은 충돌에서 멈춘다 (그림자/가시성 판정용) */
+	bool bAnyHit = false;
+	/** @brief false면 삼각형을 보지 않고 프리미티브의 월드 AABB로 판정한다 */
+	bool bTraceComplex = true;
+	/** @brief 삼각형이 없는 프리미티브(빌보드, 텍스트 등)를 월드 AABB로 판정할지. false면 건너뛴다 */
+	bool bHitBoundsWithoutTriangles = true;
+	/** @brief 지정하면 false를 반환한 프리미티브는 검사하지 않는다 */
+	TFunction<bool(UPrimitiveComponent*)> Filter;
+};
+
+/** @brief FSceneTLAS 레이 쿼리 결과 */
+struct FSceneRayHit
+{
+	UPrimitiveComponent* Primitive = nullptr;
+	/** @brief 레이 원점에서 충돌 지점까지의 월드 거리 */
+	float Distance = FLT_MAX;
+	/** @brief 충돌한 삼각형 번호. 월드 AABB로 판정했다면 -1 */
+	int32 TriangleIndex = -1;
+	/** @brief 레이를 마주보는 방향의 월드 공간 면 법선 */
+	FVector Normal;
+};
+
+/**
+ * @brief 레벨 프리미티브의 월드 AABB로 만든 최상위 BVH (TLAS). 스태틱 메시의 FBVH를 하위 트리(BLAS)로 참조한다.
+ * 피킹과 라인 트레이스가 옥트리 후보를 하나씩 검사하는 대신, 인스턴스 트리를 가까운 노드부터 순회하며
+ * 모든 인스턴스가 하나의 최대 거리(tMax)를 공유하므로 이미 찾은 충돌보다 먼 인스턴스는 BLAS에 들어가지 않는다.
+ *
+ * 인스턴스는 프리미티브 포인터와 월드 AABB만 담고, 역행렬과 메시 BVH는 검사할 때 컴포넌트에서 읽는다.
+ * ULevel의 씬 리비전이 바뀐 뒤 처음 쿼리할 때 갱신한다 (ULevel::GetSceneTLAS). 프리미티브 구성(구조 리비전)이 그대로면
+ * 트랜스폼만 바뀐 것이므로 트리 모양은 두고 박스만 다시 맞추고(refit, O(N)), 등록/해제로 구성이 바뀌었을 때만 다시 구축한다(O(N log N)).
+ * 순회 스택은 스레드마다 하나씩 두므로 트리가 바뀌지 않는 동안에는 여러 스레드에서 동시에 쿼리할 수 있다.
+ */
+class FSceneTLAS
+{
+public:
+	/** @brief 리프 하나에 담는 최대 인스턴스 수 */
+	static constexpr uint32 MAX_LEAF_INSTANCES = 2;
+
+	/**
+	 * @brief InLevel의 씬 리비전이 마지막 갱신 이후 바뀌었으면 트리를 갱신한다.
+	 * 구조 리비전이 같으면 Refit하고, 다르거나 Refit할 수 없으면 StaticOctree와 DynamicTree의 프리미티브로 다시 구축한다.
+	 */
+	void Update(ULevel* InLevel);
+	/** @brief 월드 AABB가 유효한 프리미티브로 binned SAH 트리를 구축한다 */
+	void Build(const TArray<UPrimitiveComponent*>& InPrimitives);
+	void Clear();
+
+	/**
+	 * @brief 레이와 가장 가까운 충돌(bAnyHit면 처음 찾은 충돌)을 찾는다.
+	 * @param InDirection 정규화된 월드 방향. 충돌 거리는 이 방향 기준의 월드 거리다
+	 */
+	bool Trace(const FVector& InOrigin, const FVector& InDirection, const FSceneRayParams& InParams, FSceneRayHit& OutHit) const;
+
+	/**
+	 * @brief 레이와 프리미티브 하나의 충돌. 트리를 거치지 않고 FSceneQuery::LineTraceMulti 같은 후보별 검사에서도 쓴다.
+	 * 메시 BVH가 있는 스태틱 메시는 BVH로, 그 밖의 삼각형 프리미티브는 모든 삼각형을 검사한다.
+	 * @param InMaxDistance InParams.MaxDistance 대신 쓰는 최대 거리 (순회 중에 줄어든 tMax)
+	 */
+	static bool IntersectPrimitive(UPrimitiveComponent* InPrimitive, const FVector& InOrigin, const FVector& InDirection, float InMaxDistance,
+		const FSceneRayParams& InParams, FSceneRayHit& OutHit);
+
+	uint32 GetInstanceCount() const { return static_cast<uint32>(Instances.size()); }
+	uint32 GetNodeCount() const { return static_cast<uint32>(Nodes.size()); }
+	/** @brief 마지막 구축에 걸린 시간 */
+	float GetLastBuildMs() const { return LastBuildMs; }
+	/** @brief 마지막 Refit에 걸린 시간 */
+	float GetLastRefitMs() const { return LastRefitMs; }
+
+private:
+	/**
+	 * @brief 인스턴스의 월드 AABB를 다시 읽고, 노드 박스를 자식에서 부모 순으로 다시 계산한다.
+	 * 월드 AABB가 유효하지 않은 인스턴스가 있거나, 움직임이 쌓여 노드 면적 합이 구축 때보다 크게 늘었으면 false (다시 구축해야 한다)
+	 */
+	bool Refit();
+
+	/** @brief Count가 0이면 내부 노드이며 자식은 FirstIndex, FirstIndex + 1. 아니면 Instances[FirstIndex]부터 Count개 */
+	struct FNode
+	{
+		float Min[3];
+		uint32 FirstIndex;
+		float Max[3];
+		uint32 Count;
+	};
+
+	struct FInstance
+	{
+		float Min[3];
+		float Max[3];
+		UPrimitiveComponent* Primitive;
+	};
+
+	TArray<FNode> Nodes;
+	TArray<FInstance> Instances;
+
+	/** @brief 마지막으로 갱신한 씬 리비전. 모든 레벨이 같은 카운터를 쓰므로 레벨이 바뀌어도 겹치지 않는다 */
+	uint64 BuiltSceneRevision = 0;
+	/** @brief 마지막으로 구축한 구조 리비전 (ULevel::GetSceneStructureRevision) */
+	uint64 BuiltStructureRevision = 0;
+	/** @brief 구축 직후 모든 노드의 박스 반면적 합. Refit 뒤 이 값과 비교해 트리가 얼마나 나빠졌는지 본다 */
+	float BuiltNodeAreaSum = 0.0f;
+	/** @brief 구축할 때 월드 AABB가 유효하지 않아 뺀 프리미티브가 있으면 Refit으로는 되살릴 수 없으므로 다시 구축한다 */
+	bool bSkippedInvalidPrimitives = false;
+	float LastBuildMs = 0.0f;
+	float LastRefitMs = 0.0f;
+
+	// 구축 사이에 재사용하는 버퍼
+	TArray<UPrimitiveComponent*> GatheredPrimitives;
+};
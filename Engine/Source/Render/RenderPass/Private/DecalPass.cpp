@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "Component/Public/DecalComponent.h"
 #include "Global/Octree.h"
+#include "Global/DynamicAABBTree.h"
 #include "Level/Public/Level.h"
 #include "Manager/Asset/Public/AssetManager.h"
 #include "Physics/Public/OBB.h"
@@ -154,8 +155,6 @@ void FDecalPass::Execute(FRenderingContext& Context)
     uint32 RenderedDecal = 0;
     uint32 CollidedComps = 0;
     
-    TArray<UPrimitiveComponent*>& DynamicPrimitives = GWorld->GetLevel()->GetDynamicPrimitives();
-    
     // --- Render Decals ---
     for (UDecalComponent* Decal : Context.Decals)
     {
@@ -200,7 +199,7 @@ void FDecalPass::Execute(FRenderingContext& Context)
         ULevel* CurrentLevel = GWorld->GetLevel();
 
         Query(CurrentLevel->GetStaticOctree(), Decal, Primitives);
-        Primitives.insert(Primitives.end(), DynamicPrimitives.begin(), DynamicPrimitives.end());
+        CurrentLevel->GetDynamicTree()->QueryAABB(DecalOBB->ToWorldAABB(), Primitives);
 
         // --- Disable Octree Optimization --- 
         // Primitives = Context.DefaultPrimitives;
@@ -136,7 +136,7 @@ void FUpdateLightBufferPass::NewBakeShadowMap(FRenderingContext& Context)
         UpdateShadowCasterConstants(ProjectionType, LightData, Idx, Context);
 
         // Render all objects in the scene.
-        for (auto MeshComp : Context.StaticMeshes)
+        for (auto MeshComp : Context.ShadowCasters)
         {
             if (!MeshComp || !MeshComp->IsVisible()) continue;
             RenderPrimitive(MeshComp);
@@ -421,7 +421,7 @@ void FUpdateLightBufferPass::BakePointShadowMap(FRenderingContext& Context)
                 Pipeline->SetConstantBuffer(6, EShaderType::VS, PSMConstantBuffer);
 
                 // Render all meshes from this face's perspective
-                for (auto* MeshComp : Context.StaticMeshes)
+                for (auto* MeshComp : Context.ShadowCasters)
                 {
                     if (!MeshComp || !MeshComp->IsVisible()) continue;
                     RenderPrimitive(MeshComp);
@@ -735,7 +735,7 @@ void FUpdateLightBufferPass::BakeSpotShadowMap(FRenderingContext& Context)
                 DeviceContext->RSSetViewports(1, &vp);
 
                 // Render scene from this spot light POV into its tile
-                for (auto MeshComp : Context.StaticMeshes)
+                for (auto MeshComp : Context.ShadowCasters)
                 {
                     if (!MeshComp || !MeshComp->IsVisible()) continue;
                     RenderPrimitive(MeshComp);
@@ -910,7 +910,7 @@ void FUpdateLightBufferPass::BakeShadowMap(FRenderingContext& Context)
             LightCameraConsts.Projection = CascadeLightProj;
             FRenderResourceFactory::UpdateConstantBufferData(LightCameraConstantBuffer, LightCameraConsts);*/
 
-            for (auto MeshComp : Context.StaticMeshes)
+            for (auto MeshComp : Context.ShadowCasters)
             {
                 if (!MeshComp || !MeshComp->IsVisible())    continue;
                 RenderPrimitive(MeshComp);
@@ -1122,7 +1122,7 @@ void FUpdateLightBufferPass::BakeShadowMap(FRenderingContext& Context)
                     }
                 };
 
-                for (auto MeshComp : Context.StaticMeshes)
+                for (auto MeshComp : Context.ShadowCasters)
                 {
                     if (!MeshComp || !MeshComp->IsVisible()) continue;
                     FVector a,b; MeshComp->GetWorldAABB(a,b);
@@ -1373,7 +1373,7 @@ void FUpdateLightBufferPass::BakeShadowMap(FRenderingContext& Context)
       
         
             // 모든 Static Mesh를 Light 관점에서 렌더링
-            for (auto MeshComp : Context.StaticMeshes)
+            for (auto MeshComp : Context.ShadowCasters)
             {
                 if (!MeshComp || !MeshComp->IsVisible()) continue;
                 RenderPrimitive(MeshComp);
@@ -1450,7 +1450,7 @@ void FUpdateLightBufferPass::CalculateShadowMatrices(EShadowProjectionType ProjT
         // === LVP용: 월드 전체 AABB 집계 (카메라에 독립)
         FVector SceneMin(+FLT_MAX, +FLT_MAX, +FLT_MAX);
         FVector SceneMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
-        for (auto MeshComp : Context.StaticMeshes)
+        for (auto MeshComp : Context.ShadowCasters)
         {
             if (!MeshComp || !MeshComp->IsVisible()) continue;
             FVector aabbMin, aabbMax;
@@ -34,6 +34,8 @@ struct FRenderingContext
     TArray<class UTextComponent*> Texts;
     TArray<class UUUIDTextComponent*> UUIDs;
     TArray<class UDecalComponent*> Decals;
+    /** @brief 그림자를 드리우는 스태틱 메시. 화면 밖에서도 그림자는 보이므로 뷰 컬링을 거치지 않은 레벨 전체 목록이다 */
+    TArray<class UStaticMeshComponent*> ShadowCasters;
     TArray<class UPointLightComponent*> PointLights;
     TArray<class USpotLightComponent*> SpotLights;
     TArray<class UDirectionalLightComponent*> DirectionalLights;
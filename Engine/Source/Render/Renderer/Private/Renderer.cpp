@@ -16,6 +16,7 @@
 #include "Render/UI/Viewport/Public/ViewportClient.h"
 #include "Level/Public/Level.h"
 #include "Manager/UI/Public/UIManager.h"
+#include "Optimization/Public/ContributionCuller.h"
 #include "Optimization/Public/OcclusionCuller.h"
 #include "Render/RenderPass/Public/BillboardPass.h"
 #include "Render/RenderPass/Public/DecalPass.h"
@@ -109,7 +110,6 @@ void URenderer::Init(HWND InWindowHandle)
 	// ID3D11PixelShader* InPS, ID3D11InputLayout* InLayout, ID3D11SamplerState* InSampler
 	FXAAPass = new FFXAAPass(Pipeline, DeviceResources, FXAAVertexShader, FXAAPixelShader, FXAAInputLayout, FXAASamplerState);
 	//RenderPasses.push_back(FXAAPass);
-	
 }
 
 void URenderer::Release()
@@ -127,6 +127,11 @@ void URenderer::Release()
 	}
 	FXAAPass->Release();
 	SafeDelete(FXAAPass);
+	for (auto& [Viewport, OcclusionCuller] : OcclusionCullers)
+	{
+		SafeDelete(OcclusionCuller);
+	}
+	OcclusionCullers.clear();
 	
 	SafeDelete(ViewportClient);
 	SafeDelete(Pipeline);
@@ -726,6 +731,11 @@ void URenderer::Update()
 
     RenderBegin();
 
+    // 1. 모든 뷰포트의 카메라를 먼저 갱신해 뷰로 등록한다
+    FrameViewports.clear();
+    FrameViewIndices.clear();
+    MultiViewCuller.ResetViews();
+    ULevel* FrameLevel = GWorld->GetLevel();
     for (FViewport* Viewport : UViewportManager::GetInstance().GetViewports())
     {
         if (Viewport->GetRect().Width < 1.0f || Viewport->GetRect().Height < 1.0f) { continue; }
@@ -733,17 +743,47 @@ void URenderer::Update()
     	FRect SingleWindowRect = Viewport->GetRect();
     	const int32 ViewportToolBarHeight = 32;
     	D3D11_VIEWPORT LocalViewport = { (float)SingleWindowRect.Left,(float)SingleWindowRect.Top + ViewportToolBarHeight, (float)SingleWindowRect.Width, (float)SingleWindowRect.Height - ViewportToolBarHeight, 0.0f, 1.0f };
-    	GetDeviceContext()->RSSetViewports(1, &LocalViewport);
 		Viewport->SetRenderRect(LocalViewport);
         UCamera* CurrentCamera = Viewport->GetViewportClient()->GetCamera();
-    	
+
         CurrentCamera->Update(LocalViewport);
-    	
+
+        // 씬과 뷰가 지난 프레임과 같으면 컬링하지 않고 캐시된 목록을 쓴다
+        if (FrameLevel && IsViewRenderCacheValid(Viewport, FrameLevel))
+        {
+            FrameViewports.push_back(Viewport);
+            FrameViewIndices.push_back(FMultiViewCuller::INVALID_VIEW);
+            continue;
+        }
+
+        // PVS는 셀 안의 시점에서 구운 것이므로 멀리서 내려다보는 직교 카메라에는 쓰지 않는다
+        const FPotentiallyVisibleSet* PVS = FrameLevel && CurrentCamera->GetCameraType() == ECameraType::ECT_Perspective ? FrameLevel->GetPVS() : nullptr;
+        const uint32 ViewIndex = MultiViewCuller.AddView(CurrentCamera->GetFViewProjConstants(), PVS);
+        if (ViewIndex == FMultiViewCuller::INVALID_VIEW) { continue; }
+        FrameViewports.push_back(Viewport);
+        FrameViewIndices.push_back(ViewIndex);
+    }
+
+    // 2. 한 번의 순회로 다시 만들어야 하는 뷰를 모두 컬링한다
+    if (FrameLevel)
+    {
+        TIME_PROFILE(CullViews)
+        CullViews(FrameLevel);
+    }
+
+    // 3. 뷰포트마다 자기 뷰 비트로 목록을 꺼내 그린다
+    for (size_t ViewportIndex = 0; ViewportIndex < FrameViewports.size(); ++ViewportIndex)
+    {
+        FViewport* Viewport = FrameViewports[ViewportIndex];
+        const D3D11_VIEWPORT LocalViewport = Viewport->GetRenderRect();
+    	GetDeviceContext()->RSSetViewports(1, &LocalViewport);
+        UCamera* CurrentCamera = Viewport->GetViewportClient()->GetCamera();
+
         FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferViewProj, CurrentCamera->GetFViewProjConstants());
         Pipeline->SetConstantBuffer(1, EShaderType::VS, ConstantBufferViewProj);
         {
             TIME_PROFILE(RenderLevel)
-            RenderLevel(Viewport);
+            RenderLevel(Viewport, FrameViewIndices[ViewportIndex]);
         }
 		{
 			TIME_PROFILE(RenderEditor)
@@ -831,42 +871,100 @@ void URenderer::RenderBegin() const
     DeviceResources->UpdateViewport();
 }
 
-void URenderer::RenderLevel(FViewport* InViewport)
+void URenderer::CullViews(ULevel* InLevel)
 {
-	const ULevel* CurrentLevel = GWorld->GetLevel();
-	if (!CurrentLevel) { return; }
+	if (MultiViewCuller.GetViewCount() > 0)
+	{
+		MultiViewCuller.Cull(InLevel->GetStaticOctree(), InLevel->GetDynamicTree(), InLevel->GetPendingPrimitives());
+	}
 
-	const FCameraConstants& ViewProj = InViewport->GetViewportClient()->GetCamera()->GetFViewProjConstants();
-	static bool bCullingEnabled = false; // 임시 토글(초기값: 컬링 비활성)
-	TArray<UPrimitiveComponent*> FinalVisiblePrims;
-	if (!bCullingEnabled)
+	// 라이트와 포그는 뷰와 무관하므로 뷰포트마다 레벨을 다시 훑지 않고, 씬이 바뀌었을 때만 다시 모은다
+	if (FrameSceneLevel == InLevel && FrameSceneRevision == InLevel->GetSceneRevision())
+	{
+		return;
+	}
+	FrameSceneLevel = InLevel;
+	FrameSceneRevision = InLevel->GetSceneRevision();
+
+	FrameSceneContext.PointLights.clear();
+	FrameSceneContext.SpotLights.clear();
+	FrameSceneContext.DirectionalLights.clear();
+	FrameSceneContext.AmbientLights.clear();
+	FrameSceneContext.Fogs.clear();
+	FrameSceneContext.ShadowCasters.clear();
+	FrameSceneContext.CSMLambda = FRenderingContext().CSMLambda;
+
+	for (const auto& LightComponent : InLevel->GetLightComponents())
 	{
-		// 1) 옥트리(정적 프리미티브) 전부 수집
-		if (FOctree* StaticOctree = GWorld->GetLevel()->GetStaticOctree())
+		if (auto PointLightComponent = Cast<UPointLightComponent>(LightComponent))
 		{
-			TArray<UPrimitiveComponent*> AllStatics;
-			StaticOctree->GetAllPrimitives(AllStatics);
-			for (UPrimitiveComponent* Primitive : AllStatics)
+			if (auto SpotLightComponent = Cast<USpotLightComponent>(LightComponent))
 			{
-				if (Primitive && Primitive->IsVisible())
-				{
-					FinalVisiblePrims.push_back(Primitive);
-				}
+				FrameSceneContext.SpotLights.push_back(SpotLightComponent);
 			}
+			else
+			{
+				FrameSceneContext.PointLights.push_back(PointLightComponent);
+			}
+		}
+		if (auto DirectionalLightComponent = Cast<UDirectionalLightComponent>(LightComponent))
+		{
+			FrameSceneContext.DirectionalLights.push_back(DirectionalLightComponent);
+		}
+		
+		if (auto AmbientLightComponent = Cast<UAmbientLightComponent>(LightComponent))
+		{
+			FrameSceneContext.AmbientLights.push_back(AmbientLightComponent);
+		}
+
+		if (!FrameSceneContext.DirectionalLights.empty())
+		{
+			UDirectionalLightComponent* DirLight = FrameSceneContext.DirectionalLights[0];
+			FrameSceneContext.CSMLambda = DirLight->GetCSMLambda();
+		}
+	}
+
+	// 그림자 패스는 화면 밖의 메시도 그려야 하므로 뷰 컬링 결과와 별도로 레벨 전체의 스태틱 메시를 모은다
+	TArray<UPrimitiveComponent*> ScenePrimitives;
+	if (InLevel->GetStaticOctree())
+	{
+		InLevel->GetStaticOctree()->GetAllPrimitives(ScenePrimitives);
+	}
+	const TArray<UPrimitiveComponent*>& DynamicPrimitives = InLevel->GetDynamicPrimitives();
+	ScenePrimitives.insert(ScenePrimitives.end(), DynamicPrimitives.begin(), DynamicPrimitives.end());
+	for (UPrimitiveComponent* Primitive : ScenePrimitives)
+	{
+		if (auto StaticMesh = Cast<UStaticMeshComponent>(Primitive))
+		{
+			FrameSceneContext.ShadowCasters.push_back(StaticMesh);
 		}
-		// 2) 동적 프리미티브 전부 수집
-		TArray<UPrimitiveComponent*>& DynamicPrimitives = GWorld->GetLevel()->GetDynamicPrimitives();
-		for (UPrimitiveComponent* Primitive : DynamicPrimitives)
+	}
+
+	// Collect HeightFogComponents from all actors in the level
+	for (const auto& Actor : InLevel->GetLevelActors())
+	{
+		for (const auto& Component : Actor->GetOwnedComponents())
 		{
-			if (Primitive && Primitive->IsVisible())
+			if (auto Fog = Cast<UHeightFogComponent>(Component))
 			{
-				FinalVisiblePrims.push_back(Primitive);
+				FrameSceneContext.Fogs.push_back(Fog);
 			}
 		}
 	}
-	else
+}
+
+void URenderer::RenderLevel(FViewport* InViewport, uint32 InViewIndex)
+{
+	const ULevel* CurrentLevel = GWorld->GetLevel();
+	if (!CurrentLevel) { return; }
+
+	const FCameraConstants& ViewProj = InViewport->GetViewportClient()->GetCamera()->GetFViewProjConstants();
+
+	// InViewIndex가 INVALID_VIEW면 씬과 뷰가 지난 프레임과 같으므로 컬링과 분류를 건너뛰고 캐시된 목록을 쓴다
+	FViewRenderCache& ViewCache = ViewRenderCaches[InViewport];
+	if (InViewIndex != FMultiViewCuller::INVALID_VIEW)
 	{
-		FinalVisiblePrims = InViewport->GetViewportClient()->GetCamera()->GetViewVolumeCuller().GetRenderableObjects();
+		BuildViewRenderLists(InViewport, InViewIndex, CurrentLevel, ViewCache);
 	}
 
 	FRenderingContext RenderingContext(
@@ -880,75 +978,128 @@ void URenderer::RenderLevel(FViewport* InViewport)
 		CurrentLevel->GetShadowFilterType()
 	);
 
-	// 1. Sort visible primitive components
-	RenderingContext.AllPrimitives = FinalVisiblePrims;
-	for (auto& Prim : FinalVisiblePrims)
+	// 1. 컬링/분류가 끝난 프리미티브 목록
+	const FRenderingContext& Lists = ViewCache.Lists;
+	RenderingContext.AllPrimitives = Lists.AllPrimitives;
+	RenderingContext.StaticMeshes = Lists.StaticMeshes;
+	RenderingContext.BillBoards = Lists.BillBoards;
+	RenderingContext.Texts = Lists.Texts;
+	RenderingContext.UUIDs = Lists.UUIDs;
+	RenderingContext.Decals = Lists.Decals;
+
+	// 2. 프레임마다 한 번 모아 둔 라이트와 포그
+	RenderingContext.PointLights = FrameSceneContext.PointLights;
+	RenderingContext.SpotLights = FrameSceneContext.SpotLights;
+	RenderingContext.DirectionalLights = FrameSceneContext.DirectionalLights;
+	RenderingContext.AmbientLights = FrameSceneContext.AmbientLights;
+	RenderingContext.CSMLambda = FrameSceneContext.CSMLambda;
+	RenderingContext.Fogs = FrameSceneContext.Fogs;
+	RenderingContext.ShadowCasters = FrameSceneContext.ShadowCasters;
+
+	for (auto RenderPass: RenderPasses)
 	{
-		if (auto StaticMesh = Cast<UStaticMeshComponent>(Prim))
-		{
-			RenderingContext.StaticMeshes.push_back(StaticMesh);
-		}
-		else if (auto BillBoard = Cast<UBillBoardComponent>(Prim))
-		{
-			RenderingContext.BillBoards.push_back(BillBoard);
-		}
-		else if (auto Text = Cast<UTextComponent>(Prim))
-		{
-			if (!Text->IsExactly(UUUIDTextComponent::StaticClass())) { RenderingContext.Texts.push_back(Text); }
-			else { RenderingContext.UUIDs.push_back(Cast<UUUIDTextComponent>(Text)); }
-		}
-		else if (auto Decal = Cast<UDecalComponent>(Prim))
-		{
-			RenderingContext.Decals.push_back(Decal);
-		}
+		RenderPass->Execute(RenderingContext);
 	}
-	
-	for (const auto& LightComponent : CurrentLevel->GetLightComponents())
+}
+
+bool URenderer::IsViewRenderCacheValid(FViewport* InViewport, const ULevel* InLevel) const
+{
+	const auto It = ViewRenderCaches.find(InViewport);
+	if (It == ViewRenderCaches.end())
 	{
-		if (auto PointLightComponent = Cast<UPointLightComponent>(LightComponent))
+		return false;
+	}
+
+	const FViewRenderCache& Cache = It->second;
+	const FCameraConstants& ViewProj = InViewport->GetViewportClient()->GetCamera()->GetFViewProjConstants();
+	const D3D11_VIEWPORT RenderRect = InViewport->GetRenderRect();
+	return Cache.Level == InLevel
+		&& Cache.SceneRevision == InLevel->GetSceneRevision()
+		&& Cache.ShowFlags == InLevel->GetShowFlags()
+		&& Cache.Width == RenderRect.Width && Cache.Height == RenderRect.Height
+		&& memcmp(Cache.View.Data, ViewProj.View.Data, sizeof(Cache.View.Data)) == 0
+		&& memcmp(Cache.Projection.Data, ViewProj.Projection.Data, sizeof(Cache.Projection.Data)) == 0;
+}
+
+void URenderer::BuildViewRenderLists(FViewport* InViewport, uint32 InViewIndex, const ULevel* InLevel, FViewRenderCache& OutCache)
+{
+	const FCameraConstants& ViewProj = InViewport->GetViewportClient()->GetCamera()->GetFViewProjConstants();
+	TArray<UPrimitiveComponent*> FinalVisiblePrims;
+	MultiViewCuller.GetViewPrimitives(InViewIndex, FinalVisiblePrims);
+
+	// 화면에 너무 작게 투영되거나 그리기 거리보다 먼 프리미티브를 걸러낸다
+	if ((InLevel->GetShowFlags() & EEngineShowFlags::SF_ContributionCulling) != 0)
+	{
+		TIME_PROFILE(ContributionCulling)
+		const D3D11_VIEWPORT RenderRect = InViewport->GetRenderRect();
+		FContributionCuller ContributionCuller;
+		ContributionCuller.InitializeCuller(ViewProj, RenderRect.Width, RenderRect.Height);
+		ContributionCuller.PerformCulling(FinalVisiblePrims);
+		UStatOverlay::GetInstance().RecordContributionStats(ContributionCuller.GetStats());
+	}
+
+	// 가려진 스태틱 메시를 CPU 깊이 버퍼로 걸러낸다
+	if ((InLevel->GetShowFlags() & EEngineShowFlags::SF_OcclusionCulling) != 0)
+	{
+		TIME_PROFILE(OcclusionCulling)
+		COcclusionCuller*& OcclusionCuller = OcclusionCullers[InViewport];
+		if (!OcclusionCuller)
 		{
-			if (auto SpotLightComponent = Cast<USpotLightComponent>(LightComponent))
-			{
-				RenderingContext.SpotLights.push_back(SpotLightComponent);
-			}
-			else
+			OcclusionCuller = new COcclusionCuller();
+		}
+
+		if (OcclusionHistoryLevel != InLevel)
+		{
+			for (auto& [Viewport, Culler] : OcclusionCullers)
 			{
-				RenderingContext.PointLights.push_back(PointLightComponent);
+				if (Culler) { Culler->ResetTemporalHistory(); }
 			}
+			OcclusionHistoryLevel = InLevel;
 		}
-		if (auto DirectionalLightComponent = Cast<UDirectionalLightComponent>(LightComponent))
+
+		OcclusionCuller->SetTemporalReprojectionEnabled((InLevel->GetShowFlags() & EEngineShowFlags::SF_OcclusionTemporalReprojection) != 0);
+		OcclusionCuller->InitializeCuller(ViewProj.View, ViewProj.Projection);
+		FinalVisiblePrims = OcclusionCuller->PerformCulling(FinalVisiblePrims, ViewProj.ViewWorldLocation);
+		UStatOverlay::GetInstance().RecordOcclusionStats(OcclusionCuller->GetStats());
+	}
+
+	// Sort visible primitive components
+	FRenderingContext& Lists = OutCache.Lists;
+	Lists.AllPrimitives = FinalVisiblePrims;
+	Lists.StaticMeshes.clear();
+	Lists.BillBoards.clear();
+	Lists.Texts.clear();
+	Lists.UUIDs.clear();
+	Lists.Decals.clear();
+	for (auto& Prim : FinalVisiblePrims)
+	{
+		if (auto StaticMesh = Cast<UStaticMeshComponent>(Prim))
 		{
-			RenderingContext.DirectionalLights.push_back(DirectionalLightComponent);
+			Lists.StaticMeshes.push_back(StaticMesh);
 		}
-		
-		if (auto AmbientLightComponent = Cast<UAmbientLightComponent>(LightComponent))
+		else if (auto BillBoard = Cast<UBillBoardComponent>(Prim))
 		{
-			RenderingContext.AmbientLights.push_back(AmbientLightComponent);
+			Lists.BillBoards.push_back(BillBoard);
 		}
-
-		if (!RenderingContext.DirectionalLights.empty())
+		else if (auto Text = Cast<UTextComponent>(Prim))
 		{
-			UDirectionalLightComponent* DirLight = RenderingContext.DirectionalLights[0];
-			RenderingContext.CSMLambda = DirLight->GetCSMLambda();
+			if (!Text->IsExactly(UUUIDTextComponent::StaticClass())) { Lists.Texts.push_back(Text); }
+			else { Lists.UUIDs.push_back(Cast<UUUIDTextComponent>(Text)); }
 		}
-	}
-
-	// 2. Collect HeightFogComponents from all actors in the level
-	for (const auto& Actor : CurrentLevel->GetLevelActors())
-	{
-		for (const auto& Component : Actor->GetOwnedComponents())
+		else if (auto Decal = Cast<UDecalComponent>(Prim))
 		{
-			if (auto Fog = Cast<UHeightFogComponent>(Component))
-			{
-				RenderingContext.Fogs.push_back(Fog);
-			}
+			Lists.Decals.push_back(Decal);
 		}
 	}
 
-	for (auto RenderPass: RenderPasses)
-	{
-		RenderPass->Execute(RenderingContext);
-	}
+	const D3D11_VIEWPORT RenderRect = InViewport->GetRenderRect();
+	OutCache.Level = InLevel;
+	OutCache.SceneRevision = InLevel->GetSceneRevision();
+	OutCache.ShowFlags = InLevel->GetShowFlags();
+	OutCache.Width = RenderRect.Width;
+	OutCache.Height = RenderRect.Height;
+	OutCache.View = ViewProj.View;
+	OutCache.Projection = ViewProj.Projection;
 }
 
 void URenderer::RenderEditorPrimitive(const FEditorPrimitive& InPrimitive, const FRenderState& InRenderState, uint32 InStride, uint32 InIndexBufferStride)
@@ -7,6 +7,7 @@
 #include "Editor/Public/EditorPrimitive.h"
 #include "Render/Renderer/Public/Pipeline.h"
 #include "Render/RenderPass/Public/FXAAPass.h"
+#include "Optimization/Public/MultiViewCuller.h"
 
 class FViewport;
 class UCamera;
@@ -15,6 +16,7 @@ class FViewportClient;
 class FFXAAPass;
 class FLightPass;
 class FClusteredRenderingGridPass;
+class COcclusionCuller;
 
 // URenderer 내부에서 셰이더들은 용도에 따라 분류될 수 있음.
 // 용도별로 Create Shader 메소드가 존재함. (e.g. CreateStaticmeshShader)
@@ -76,7 +78,8 @@ public:
 	// Render
 	void Update();
 	void RenderBegin() const;
-	void RenderLevel(FViewport* InViewport);
+	/** @param InViewIndex CullViews에서 이 뷰포트를 등록한 MultiViewCuller 뷰 인덱스 */
+	void RenderLevel(FViewport* InViewport, uint32 InViewIndex);
 	void RenderEnd() const;
 	void RenderEditorPrimitive(const FEditorPrimitive& InPrimitive, const FRenderState& InRenderState, uint32 InStride = 0, uint32 InIndexBufferStride = 0);
 
@@ -224,6 +227,51 @@ private:
 	FLightPass* LightPass = nullptr;
 	FClusteredRenderingGridPass* ClusteredRenderingGridPass = nullptr;
 
+	/**
+	 * @brief 뷰포트별 가시 목록 캐시
+	 * 레벨의 씬 리비전, 카메라 뷰/투영 행렬, 뷰포트 크기, 쇼 플래그가 목록을 만들 때와 같으면
+	 * 컬링(절두체/화면 기여도/오클루전)과 분류를 건너뛰고 Lists를 그대로 쓴다.
+	 */
+	struct FViewRenderCache
+	{
+		const class ULevel* Level = nullptr;
+		uint64 SceneRevision = 0;
+		uint64 ShowFlags = 0;
+		float Width = 0.0f;
+		float Height = 0.0f;
+		FMatrix View;
+		FMatrix Projection;
+		/** @brief 프리미티브 목록(AllPrimitives ~ Decals)만 채운 컨텍스트 */
+		FRenderingContext Lists;
+	};
+
+	/** @brief 컬링이 필요한 뷰를 한 번에 컬링하고, 씬이 바뀌었다면 뷰와 무관한 라이트/포그/그림자 캐스터를 FrameSceneContext에 다시 모은다. */
+	void CullViews(class ULevel* InLevel);
+	bool IsViewRenderCacheValid(FViewport* InViewport, const class ULevel* InLevel) const;
+	/** @brief MultiViewCuller 결과에서 뷰의 목록을 꺼내 화면 기여도/오클루전 컬링과 분류를 거쳐 OutCache에 저장한다. */
+	void BuildViewRenderLists(FViewport* InViewport, uint32 InViewIndex, const class ULevel* InLevel, FViewRenderCache& OutCache);
+
+	/** @brief 모든 뷰포트의 절두체 컬링을 한 번의 트리 순회로 처리한다. RenderLevel은 뷰 인덱스로 자기 목록을 꺼낸다 */
+	FMultiViewCuller MultiViewCuller;
+	/** @brief 이번 프레임에 그리는 뷰포트 */
+	TArray<FViewport*> FrameViewports;
+	/** @brief FrameViewports와 같은 순서의 MultiViewCuller 뷰 인덱스. 캐시를 그대로 쓰는 뷰포트는 INVALID_VIEW */
+	TArray<uint32> FrameViewIndices;
+	TMap<FViewport*, FViewRenderCache> ViewRenderCaches;
+
+	/** @brief 라이트/포그/그림자 캐스터 목록만 채운 컨텍스트. 씬이 바뀐 프레임에만 다시 모아 모든 뷰포트의 컨텍스트에 복사한다 */
+	FRenderingContext FrameSceneContext;
+	const class ULevel* FrameSceneLevel = nullptr;
+	uint64 FrameSceneRevision = 0;
+
+	/**
+	 * @brief SF_OcclusionCulling이 켜진 레벨에서 RenderLevel의 가시 목록을 줄이는 CPU 소프트웨어 오클루전 컬러
+	 * 시간적 재투영은 뷰마다 이전 프레임 기록이 필요하므로 뷰포트마다 하나씩 처음 사용할 때 만든다.
+	 */
+	TMap<FViewport*, COcclusionCuller*> OcclusionCullers;
+	/** @brief 오클루전 기록을 만든 레벨. 레벨이 바뀌면 기록을 버린다 */
+	const class ULevel* OcclusionHistoryLevel = nullptr;
+
 	// For Hot Reloading Shaders
 	TMap<std::wstring, TSet<ShaderUsage>> ShaderFileUsageMap;
 	TMap<std::wstring, std::filesystem::file_time_type> ShaderFileLastWriteTimeMap;
@@ -96,6 +96,8 @@ void UStatOverlay::Render()
     if (IsStatEnabled(EStatType::Time))    RenderTimeInfo(D2DCtx);
     if (IsStatEnabled(EStatType::Decal))   RenderDecalInfo(D2DCtx);
 	if (IsStatEnabled(EStatType::Shadow))  RenderShadowInfo(D2DCtx);
+    if (IsStatEnabled(EStatType::Occlusion)) RenderOcclusionInfo(D2DCtx);
+    if (IsStatEnabled(EStatType::Contribution)) RenderContributionInfo(D2DCtx);
 
     D2DCtx->EndDraw();
     D2DCtx->SetTarget(nullptr);
@@ -311,6 +313,82 @@ void UStatOverlay::RenderShadowInfo(ID2D1DeviceContext* D2DCtx)
 	RenderText(D2DCtx, text, OverlayX, OverlayY + OffsetY, 0.8f, 0.8f, 0.8f);
 }
 
+void UStatOverlay::RenderOcclusionInfo(ID2D1DeviceContext* D2DCtx)
+{
+    float OffsetY = 0.0f;
+    if (IsStatEnabled(EStatType::FPS))    OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Memory)) OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Picking)) OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Decal))  OffsetY += 40.0f;
+    if (IsStatEnabled(EStatType::Time))
+    {
+        const TArray<FString> ProfileKeys = FScopeCycleCounter::GetTimeProfileKeys();
+        OffsetY += (ProfileKeys.size() * 20.0f);
+    }
+    if (IsStatEnabled(EStatType::Shadow)) OffsetY += 140.0f;
+
+    const bool bEnabled = GWorld && GWorld->GetLevel() &&
+        (GWorld->GetLevel()->GetShowFlags() & EEngineShowFlags::SF_OcclusionCulling) != 0;
+    if (!bEnabled)
+    {
+        RenderText(D2DCtx, "Occlusion Culling: Off", OverlayX, OverlayY + OffsetY, 0.8f, 0.8f, 0.8f);
+        return;
+    }
+
+    char Buf[128];
+    sprintf_s(Buf, sizeof(Buf), "Occlusion Culled: %u / %u (Occluders %u, Triangles %u)",
+        OcclusionStats.OccludedCount, OcclusionStats.TestedCount, OcclusionStats.OccluderCount, OcclusionStats.RasterizedTriangleCount);
+    RenderText(D2DCtx, Buf, OverlayX, OverlayY + OffsetY, 0.f, 1.f, 0.8f);
+    OffsetY += 20.0f;
+
+    sprintf_s(Buf, sizeof(Buf), "Occlusion Time: Rasterize %.3f ms, Test %.3f ms",
+        OcclusionStats.RasterizeMs, OcclusionStats.TestMs);
+    RenderText(D2DCtx, Buf, OverlayX, OverlayY + OffsetY, 0.f, 1.f, 0.8f);
+    OffsetY += 20.0f;
+
+    if ((GWorld->GetLevel()->GetShowFlags() & EEngineShowFlags::SF_OcclusionTemporalReprojection) != 0)
+    {
+        sprintf_s(Buf, sizeof(Buf), "Occlusion Temporal: Reprojected Tiles %u, Skipped Occluders %u, Likely Visible %u",
+            OcclusionStats.ReprojectedTileCount, OcclusionStats.SkippedOccluderCount, OcclusionStats.LikelyVisibleCount);
+        RenderText(D2DCtx, Buf, OverlayX, OverlayY + OffsetY, 0.f, 1.f, 0.8f);
+    }
+}
+
+void UStatOverlay::RenderContributionInfo(ID2D1DeviceContext* D2DCtx)
+{
+    float OffsetY = 0.0f;
+    if (IsStatEnabled(EStatType::FPS))    OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Memory)) OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Picking)) OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Decal))  OffsetY += 40.0f;
+    if (IsStatEnabled(EStatType::Time))
+    {
+        const TArray<FString> ProfileKeys = FScopeCycleCounter::GetTimeProfileKeys();
+        OffsetY += (ProfileKeys.size() * 20.0f);
+    }
+    if (IsStatEnabled(EStatType::Shadow)) OffsetY += 140.0f;
+    if (IsStatEnabled(EStatType::Occlusion))
+    {
+        const uint64 ShowFlags = (GWorld && GWorld->GetLevel()) ? GWorld->GetLevel()->GetShowFlags() : 0;
+        if ((ShowFlags & EEngineShowFlags::SF_OcclusionCulling) == 0)             OffsetY += 20.0f;
+        else if ((ShowFlags & EEngineShowFlags::SF_OcclusionTemporalReprojection) == 0) OffsetY += 40.0f;
+        else                                                                       OffsetY += 60.0f;
+    }
+
+    const bool bEnabled = GWorld && GWorld->GetLevel() &&
+        (GWorld->GetLevel()->GetShowFlags() & EEngineShowFlags::SF_ContributionCulling) != 0;
+    if (!bEnabled)
+    {
+        RenderText(D2DCtx, "Screen Size Culling: Off", OverlayX, OverlayY + OffsetY, 0.8f, 0.8f, 0.8f);
+        return;
+    }
+
+    char Buf[128];
+    sprintf_s(Buf, sizeof(Buf), "Screen Size Culled: %u / %u (Distance %u), %.3f ms",
+        ContributionStats.SizeCulledCount, ContributionStats.TestedCount, ContributionStats.DistanceCulledCount, ContributionStats.TestMs);
+    RenderText(D2DCtx, Buf, OverlayX, OverlayY + OffsetY, 0.f, 1.f, 0.8f);
+}
+
 void UStatOverlay::RenderText(ID2D1DeviceContext* D2DCtx, const FString& Text, float x, float y, float r, float g, float b)
 {
     if (!D2DCtx || Text.empty() || !TextFormat) return;
@@ -360,3 +438,13 @@ void UStatOverlay::RecordDecalStats(uint32 InRenderedDecal, uint32 InCollidedCom
     RenderedDecal = InRenderedDecal;
     CollidedCompCount = InCollidedCompCount;
 }
+
+void UStatOverlay::RecordOcclusionStats(const FOcclusionStats& InStats)
+{
+    OcclusionStats = InStats;
+}
+
+void UStatOverlay::RecordContributionStats(const FContributionStats& InStats)
+{
+    ContributionStats = InStats;
+}
@@ -1,5 +1,7 @@
 #pragma once
 #include "Core/Public/Object.h"
+#include "Optimization/Public/OcclusionCuller.h"
+#include "Optimization/Public/ContributionCuller.h"
 #include <d2d1.h>
 #include <dwrite.h>
 
@@ -12,7 +14,9 @@ enum class EStatType : uint8
 	Decal =		1 << 3,  // 8
 	Time =		1 << 4,	 // 16
 	Shadow =    1 << 5,  // 32
-	All = FPS | Memory | Picking | Time | Decal | Shadow
+	Occlusion = 1 << 6,  // 64
+	Contribution = 1 << 7, // 128
+	All = FPS | Memory | Picking | Time | Decal | Shadow | Occlusion | Contribution
 };
 
 UCLASS()
@@ -33,11 +37,15 @@ public:
 	void ShowTime() { IsStatEnabled(EStatType::Time) ? DisableStat(EStatType::Time) : EnableStat(EStatType::Time); }
 	void ShowDecal() { IsStatEnabled(EStatType::Decal) ? DisableStat(EStatType::Decal) : EnableStat(EStatType::Decal); }
 	void ShowShadow() { IsStatEnabled(EStatType::Shadow) ? DisableStat(EStatType::Shadow) : EnableStat(EStatType::Shadow); }
+	void ShowOcclusion() { IsStatEnabled(EStatType::Occlusion) ? DisableStat(EStatType::Occlusion) : EnableStat(EStatType::Occlusion); }
+	void ShowContribution() { IsStatEnabled(EStatType::Contribution) ? DisableStat(EStatType::Contribution) : EnableStat(EStatType::Contribution); }
 	void ShowAll() { IsStatEnabled(EStatType::All) ? DisableStat(EStatType::All) : EnableStat(EStatType::All); }
 
 	// API to update stats
 	void RecordPickingStats(float ElapsedMS);
 	void RecordDecalStats(uint32 InRenderedDecal, uint32 InCollidedCompCount);
+	void RecordOcclusionStats(const FOcclusionStats& InStats);
+	void RecordContributionStats(const FContributionStats& InStats);
 	
 private:
 	void RenderFPS(ID2D1DeviceContext* d2dCtx);
@@ -46,6 +54,8 @@ private:
 	void RenderDecalInfo(ID2D1DeviceContext* D2DCtx);
 	void RenderTimeInfo(ID2D1DeviceContext* d2dCtx);
 	void RenderShadowInfo(ID2D1DeviceContext* d2dCtx);
+	void RenderOcclusionInfo(ID2D1DeviceContext* D2DCtx);
+	void RenderContributionInfo(ID2D1DeviceContext* D2DCtx);
 	void RenderText(ID2D1DeviceContext* d2dCtx, const FString& Text, float X, float Y, float R, float G, float B);
 	template <typename T>
 	inline void SafeRelease(T*& ptr)
@@ -70,6 +80,12 @@ private:
 	uint32 RenderedDecal = 0;
 	uint32 CollidedCompCount = 0;
 
+	// Occlusion Stats (마지막으로 컬링한 뷰포트 기준)
+	FOcclusionStats OcclusionStats;
+
+	// Screen Size / Draw Distance Culling Stats (마지막으로 컬링한 뷰포트 기준)
+	FContributionStats ContributionStats;
+
 	// Rendering position
 	float OverlayX = 18.0f;
 	float OverlayY = 135.0f;
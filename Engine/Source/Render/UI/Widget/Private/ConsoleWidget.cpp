@@ -3,7 +3,10 @@
 #include "Render/UI/Overlay/Public/StatOverlay.h"
 #include "Utility/Public/UELogParser.h"
 #include "Utility/Public/ScopeCycleCounter.h"
+#include "Utility/Public/SpatialBenchmark.h"
+#include "Utility/Public/AssetBenchmark.h"
 #include "Level/Public/Level.h"
+#include "Optimization/Public/PotentiallyVisibleSet.h"
 
 IMPLEMENT_SINGLETON_CLASS(UConsoleWidget, UWidget)
 
@@ -467,7 +470,18 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 		AddLog(ELogType::Info, "  STAT MEMORY - Show memory overlay");
 		AddLog(ELogType::Info, "  STAT PICK - Show picking performance overlay");
 		AddLog(ELogType::Info, "  STAT SHADOW - Show shadow overlay");
+		AddLog(ELogType::Info, "  STAT OCCLUSION - Show software occlusion culling overlay");
+		AddLog(ELogType::Info, "  STAT SCREENSIZE - Show screen size / draw distance culling overlay");
 		AddLog(ELogType::Info, "  STAT NONE - Hide all overlays");
+		AddLog(ELogType::Info, "  BENCH OCTREE [COUNT] - Time FOctree insert, bulk build, queries and removal (default: 10000, 100000)");
+		AddLog(ELogType::Info, "  BENCH CULL [COUNT] - Compare scalar and SIMD frustum culling throughput (default: 100000)");
+		AddLog(ELogType::Info, "  BENCH BVH [COUNT] - Compare binned SAH and incremental mesh BVH builds (default: 5000 triangles)");
+		AddLog(ELogType::Info, "  BENCH BVHRAY [COUNT] - Compare binary, BVH4 and BVH8 closest hit rays/sec on loaded meshes (default: 100000 rays)");
+		AddLog(ELogType::Info, "  BENCH TLAS [COUNT] - Compare per-candidate picking and scene TLAS rays/sec on the current level (default: 10000 rays)");
+		AddLog(ELogType::Info, "  BENCH MARQUEE [COUNT] - Time marquee selection queries against a per-primitive loop (default: 50000 primitives)");
+		AddLog(ELogType::Info, "  BENCH OBJ [FACES] - Compare the previous and current OBJ parsers on Sphere.obj and a generated grid (default: 1000000 faces)");
+		AddLog(ELogType::Info, "  PVS BAKE [CELLSIZE] - Bake the potentially visible set of the editor level next to its .Scene (default: 5)");
+		AddLog(ELogType::Info, "  PVS INFO / PVS CLEAR - Show or discard the PVS of the current level");
 		AddLog(ELogType::Info, "  UE_LOG(\"String with format\", Args...) - Enhanced printf Formatting");
 		AddLog(ELogType::Debug, "    기본 예제: UE_LOG(\"Hello World %%d\", 2025)");
 		AddLog(ELogType::Debug, "    문자열: UE_LOG(\"User: %%s\", \"John\")");
@@ -483,6 +497,22 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 		AddLog(ELogType::System, "Terminal Commands:");
 		AddLog(ELogType::Info, "  Any Windows command will be executed directly");
 	}
+	// Bench 명령어 처리
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.length() > 6 && CommandLower.substr(0, 6) == "bench ")
+	{
+		FString BenchCommand = CommandLower.substr(6);
+		HandleBenchCommand(BenchCommand);
+	}
+	// PVS 명령어 처리
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.length() > 4 && CommandLower.substr(0, 4) == "pvs ")
+	{
+		FString PVSCommand = CommandLower.substr(4);
+		HandlePVSCommand(PVSCommand);
+	}
 	else if (FString CommandLower = InCommand;
 		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
 		CommandLower.length() > 14 && CommandLower.substr(0, 14) == "shadow_filter ")
@@ -535,6 +565,16 @@ void UConsoleWidget::HandleStatCommand(const FString& StatCommand)
 		StatOverlay.ShowShadow();
 		AddLog(ELogType::Success, "Shadow overlay");
 	}
+	else if (StatCommand == "occlusion")
+	{
+		StatOverlay.ShowOcclusion();
+		AddLog(ELogType::Success, "Occlusion overlay");
+	}
+	else if (StatCommand == "screensize" || StatCommand == "contribution")
+	{
+		StatOverlay.ShowContribution();
+		AddLog(ELogType::Success, "Screen size culling overlay");
+	}
 	else if (StatCommand == "all")
 	{
 		StatOverlay.ShowAll();
@@ -548,7 +588,135 @@ void UConsoleWidget::HandleStatCommand(const FString& StatCommand)
 	else
 	{
 		AddLog(ELogType::Error, "Unknown stat command: %s", StatCommand.c_str());
-		AddLog(ELogType::Info, "Available: fps, memory, pick, decal, shadow, none");
+		AddLog(ELogType::Info, "Available: fps, memory, pick, decal, shadow, occlusion, screensize, none");
+	}
+}
+
+void UConsoleWidget::HandleBenchCommand(const FString& BenchCommand)
+{
+	std::istringstream Stream(BenchCommand);
+	FString Target;
+	Stream >> Target;
+
+	if (Target == "octree")
+	{
+		uint32 PrimitiveCount = 0;
+		if (Stream >> PrimitiveCount && PrimitiveCount > 0)
+		{
+			FSpatialBenchmark::RunOctreeBenchmark(PrimitiveCount);
+		}
+		else
+		{
+			FSpatialBenchmark::RunOctreeBenchmark(10000);
+			FSpatialBenchmark::RunOctreeBenchmark(100000);
+		}
+	}
+	else if (Target == "cull")
+	{
+		uint32 BoxCount = 0;
+		if (!(Stream >> BoxCount) || BoxCount == 0)
+		{
+			BoxCount = 100000;
+		}
+		FSpatialBenchmark::RunFrustumCullBenchmark(BoxCount);
+	}
+	else if (Target == "bvh")
+	{
+		uint32 TriangleCount = 0;
+		if (!(Stream >> TriangleCount) || TriangleCount == 0)
+		{
+			TriangleCount = 5000;
+		}
+		FSpatialBenchmark::RunBVHBuildBenchmark(TriangleCount);
+	}
+	else if (Target == "bvhray")
+	{
+		uint32 RayCount = 0;
+		if (!(Stream >> RayCount) || RayCount == 0)
+		{
+			RayCount = 100000;
+		}
+		FSpatialBenchmark::RunBVHRayBenchmark(RayCount);
+	}
+	else if (Target == "tlas")
+	{
+		uint32 RayCount = 0;
+		if (!(Stream >> RayCount) || RayCount == 0)
+		{
+			RayCount = 10000;
+		}
+		FSpatialBenchmark::RunSceneRayBenchmark(RayCount);
+	}
+	else if (Target == "marquee")
+	{
+		uint32 PrimitiveCount = 0;
+		if (!(Stream >> PrimitiveCount) || PrimitiveCount == 0)
+		{
+			PrimitiveCount = 50000;
+		}
+		FSpatialBenchmark::RunMarqueeSelectionBenchmark(PrimitiveCount);
+	}
+	else if (Target == "obj")
+	{
+		uint32 FaceCount = 0;
+		if (!(Stream >> FaceCount) || FaceCount == 0)
+		{
+			FaceCount = 1000000;
+		}
+		FAssetBenchmark::RunObjImportBenchmark(FaceCount);
+	}
+	else
+	{
+		AddLog(ELogType::Error, "Unknown bench command: %s", BenchCommand.c_str());
+		AddLog(ELogType::Info, "Available: octree [count], cull [count], bvh [count], bvhray [count], tlas [count], marquee [count], obj [faces]");
+	}
+}
+
+void UConsoleWidget::HandlePVSCommand(const FString& PVSCommand)
+{
+	std::istringstream Stream(PVSCommand);
+	FString Target;
+	Stream >> Target;
+
+	if (Target == "bake")
+	{
+		FPVSBakeSettings Settings;
+		float CellSize = 0.0f;
+		if (Stream >> CellSize && CellSize > 0.0f)
+		{
+			Settings.CellSize = CellSize;
+		}
+		GEditor->BakeLevelPVS("", Settings);
+		return;
+	}
+
+	ULevel* CurrentLevel = (GWorld ? GWorld->GetLevel() : nullptr);
+	if (!CurrentLevel)
+	{
+		AddLog(ELogType::Error, "No level loaded.");
+		return;
+	}
+
+	if (Target == "info")
+	{
+		if (const FPotentiallyVisibleSet* PVS = CurrentLevel->GetPVS())
+		{
+			AddLog(ELogType::Info, "PVS: %u primitives, %u cells, %u unique sets, %zu bytes",
+				PVS->GetPrimitiveCount(), PVS->GetCellCount(), PVS->GetSetCount(), PVS->GetCompressedSize());
+		}
+		else
+		{
+			AddLog(ELogType::Info, "PVS: none (culling traverses the octree)");
+		}
+	}
+	else if (Target == "clear")
+	{
+		CurrentLevel->InvalidatePVS("pvs clear");
+	}
+	else
+	{
+		AddLog(ELogType::Error, "Unknown pvs command: %s", PVSCommand.c_str());
+		AddLog(ELogType::Info, "Available: bake [cellsize], info, clear");
 	}
 }
 
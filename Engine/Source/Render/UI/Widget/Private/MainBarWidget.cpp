@@ -480,6 +480,57 @@ void UMainBarWidget::RenderShowFlagsMenu()
 			CurrentLevel->SetShowFlags(ShowFlags);
 		}
 
+		// 오클루전 컬링 옵션
+		bool bEnableOcclusionCulling = (ShowFlags & EEngineShowFlags::SF_OcclusionCulling) != 0;
+		if (ImGui::MenuItem("오클루전 컬링 적용", nullptr, bEnableOcclusionCulling))
+		{
+			if (bEnableOcclusionCulling)
+			{
+				ShowFlags &= ~static_cast<uint64>(EEngineShowFlags::SF_OcclusionCulling);
+				UE_LOG("MainBarWidget: 오클루전 컬링 비활성화");
+			}
+			else
+			{
+				ShowFlags |= static_cast<uint64>(EEngineShowFlags::SF_OcclusionCulling);
+				UE_LOG("MainBarWidget: 오클루전 컬링 활성화");
+			}
+			CurrentLevel->SetShowFlags(ShowFlags);
+		}
+
+		// 오클루전 시간적 재투영 옵션 (오클루전 컬링이 켜져 있을 때만 의미가 있다)
+		bool bEnableOcclusionTemporal = (ShowFlags & EEngineShowFlags::SF_OcclusionTemporalReprojection) != 0;
+		if (ImGui::MenuItem("오클루전 시간적 재투영", nullptr, bEnableOcclusionTemporal, bEnableOcclusionCulling))
+		{
+			if (bEnableOcclusionTemporal)
+			{
+				ShowFlags &= ~static_cast<uint64>(EEngineShowFlags::SF_OcclusionTemporalReprojection);
+				UE_LOG("MainBarWidget: 오클루전 시간적 재투영 비활성화");
+			}
+			else
+			{
+				ShowFlags |= static_cast<uint64>(EEngineShowFlags::SF_OcclusionTemporalReprojection);
+				UE_LOG("MainBarWidget: 오클루전 시간적 재투영 활성화");
+			}
+			CurrentLevel->SetShowFlags(ShowFlags);
+		}
+
+		// 화면 크기/거리 기반 컬링 옵션
+		bool bEnableContributionCulling = (ShowFlags & EEngineShowFlags::SF_ContributionCulling) != 0;
+		if (ImGui::MenuItem("화면 크기 컬링 적용", nullptr, bEnableContributionCulling))
+		{
+			if (bEnableContributionCulling)
+			{
+				ShowFlags &= ~static_cast<uint64>(EEngineShowFlags::SF_ContributionCulling);
+				UE_LOG("MainBarWidget: 화면 크기 컬링 비활성화");
+			}
+			else
+			{
+				ShowFlags |= static_cast<uint64>(EEngineShowFlags::SF_ContributionCulling);
+				UE_LOG("MainBarWidget: 화면 크기 컬링 활성화");
+			}
+			CurrentLevel->SetShowFlags(ShowFlags);
+		}
+
 		// 그림자 표시 옵션
 		bool bEnableShadow = (ShowFlags & EEngineShowFlags::SF_Shadow) != 0;
 		if (ImGui::MenuItem("그림자 적용", nullptr, bEnableShadow))
@@ -166,6 +166,17 @@ void UViewportControlWidget::RenderWidget()
 			RenderViewportToolbar(i);
 		}
 	}
+
+	// 에디터가 마퀴 선택 중이면 드래그 사각형을 모든 창 위에 그린다
+	FVector2 MarqueeStart, MarqueeEnd;
+	if (GEditor->GetEditorModule()->GetMarqueeRect(MarqueeStart, MarqueeEnd))
+	{
+		const ImVec2 RectMin(std::min(MarqueeStart.X, MarqueeEnd.X), std::min(MarqueeStart.Y, MarqueeEnd.Y));
+		const ImVec2 RectMax(std::max(MarqueeStart.X, MarqueeEnd.X), std::max(MarqueeStart.Y, MarqueeEnd.Y));
+		ImDrawList* DrawList = ImGui::GetForegroundDrawList();
+		DrawList->AddRectFilled(RectMin, RectMax, IM_COL32(80, 140, 255, 40));
+		DrawList->AddRect(RectMin, RectMax, IM_COL32(80, 140, 255, 200), 0.0f, 0, 1.0f);
+	}
 }
 
 void UViewportControlWidget::RenderViewportToolbar(int32 ViewportIndex)
@@ -61,6 +61,8 @@ public:
 	void ProcessCommand(const char* InCommand);
 	void HandleStatCommand(const FString& StatCommand);
 	void HandleShadowFilterCommand(const FString& FilterType);
+	void HandleBenchCommand(const FString& BenchCommand);
+	void HandlePVSCommand(const FString& PVSCommand);
 	void ExecuteTerminalCommand(const char* InCommand);
 
 	// Use external terminal
@@ -0,0 +1,413 @@
+#include "pch.h"
+#include "Utility/Public/AssetBenchmark.h"
+#include "Utility/Public/ScopeCycleCounter.h"
+#include "Utility/Public/ParallelFor.h"
+#include "Manager/Asset/Public/ObjImporter.h"
+
+#include <random>
+
+namespace
+{
+	constexpr const char* BENCHMARK_SPHERE_OBJ_PATH = "Data/Shapes/Sphere.obj";
+	/** @brief 파일마다 두 파서를 번갈아 실행하는 횟수. 가장 빠른 시간을 쓴다 */
+	constexpr uint32 BENCHMARK_OBJ_REPEAT_COUNT = 3;
+	/** @brief 생성 메시의 오브젝트 수. 오브젝트마다 g/usemtl 줄을 넣어 명령 순서도 비교한다 */
+	constexpr uint32 BENCHMARK_OBJ_OBJECT_COUNT = 8;
+	constexpr uint32 BENCHMARK_RANDOM_SEED = 20251016;
+
+	double GetElapsedMilliseconds(uint64 InStartCycles)
+	{
+		return FWindowsPlatformTime::ToMilliseconds(FWindowsPlatformTime::Cycles64() - InStartCycles);
+	}
+
+	/** @brief 직렬화 결과를 메모리에 모으는 아카이브. 두 파서의 결과를 바이트 단위로 비교할 때 쓴다 */
+	struct FMemoryWriter : public FArchive
+	{
+		TArray<uint8> Bytes;
+
+		bool IsLoading() const override { return false; }
+
+		void Serialize(void* V, size_t Length) override
+		{
+			const uint8* Data = static_cast<const uint8*>(V);
+			Bytes.insert(Bytes.end(), Data, Data + Length);
+		}
+	};
+
+	/** @brief 이전 FObjImporter::ParseFaceBuffer. '/'로 나눈 인덱스를 std::stoull로 읽는다 */
+	bool ParseFaceBufferReference(const FString& FaceBuffer, FObjectInfo* OutObjectInfo)
+	{
+		TArray<FString> IndexBuffers;
+		std::istringstream Tokenizer(FaceBuffer);
+		FString IndexBuffer;
+		while (std::getline(Tokenizer, IndexBuffer, '/'))
+		{
+			IndexBuffers.emplace_back(IndexBuffer);
+		}
+
+		if (IndexBuffers.empty() || IndexBuffers[0].empty())
+		{
+			return false;
+		}
+
+		try
+		{
+			OutObjectInfo->VertexIndexList.push_back(std::stoull(IndexBuffers[0]) - 1);
+
+			switch (IndexBuffers.size())
+			{
+			case 1:
+				break;
+			case 2:
+				if (IndexBuffers[1].empty())
+				{
+					return false;
+				}
+				OutObjectInfo->TexCoordIndexList.push_back(std::stoull(IndexBuffers[1]) - 1);
+				break;
+			case 3:
+				if (IndexBuffers[1].empty())
+				{
+					if (IndexBuffers[2].empty())
+					{
+						return false;
+					}
+					OutObjectInfo->NormalIndexList.push_back(std::stoull(IndexBuffers[2]) - 1);
+				}
+				else
+				{
+					if (IndexBuffers[2].empty())
+					{
+						return false;
+					}
+					OutObjectInfo->TexCoordIndexList.push_back(std::stoull(IndexBuffers[1]) - 1);
+					OutObjectInfo->NormalIndexList.push_back(std::stoull(IndexBuffers[2]) - 1);
+				}
+				break;
+			}
+		}
+		catch ([[maybe_unused]] const std::invalid_argument& Exception)
+		{
+			return false;
+		}
+
+		return true;
+	}
+
+	/** @brief 두 파서로 InFilePath를 번갈아 읽어 가장 빠른 시간을 출력하고 결과를 비교한다 */
+	void CompareObjParsers(const char* InLabel, const std::filesystem::path& InFilePath, const FObjImporter::Configuration& InConfig)
+	{
+		const double FileMegabytes = static_cast<double>(std::filesystem::file_size(InFilePath)) / (1024.0 * 1024.0);
+
+		double ReferenceMs = DBL_MAX;
+		double ImporterMs = DBL_MAX;
+		FObjInfo ReferenceInfo;
+		FObjInfo ImporterInfo;
+		bool bReferenceLoaded = true;
+		bool bImporterLoaded = true;
+
+		for (uint32 Repeat = 0; Repeat < BENCHMARK_OBJ_REPEAT_COUNT; ++Repeat)
+		{
+			ReferenceInfo = FObjInfo();
+			uint64 StartCycles = FWindowsPlatformTime::Cycles64();
+			bReferenceLoaded &= FAssetBenchmark::LoadObjReference(InFilePath, &ReferenceInfo, InConfig);
+			ReferenceMs = std::min(ReferenceMs, GetElapsedMilliseconds(StartCycles));
+
+			ImporterInfo = FObjInfo();
+			StartCycles = FWindowsPlatformTime::Cycles64();
+			bImporterLoaded &= FObjImporter::LoadObj(InFilePath, &ImporterInfo, InConfig);
+			ImporterMs = std::min(ImporterMs, GetElapsedMilliseconds(StartCycles));
+		}
+
+		size_t FaceCount = 0;
+		for (const FObjectInfo& ObjectInfo : ImporterInfo.ObjectInfoList)
+		{
+			FaceCount += ObjectInfo.VertexIndexList.size() / 3;
+		}
+
+		UE_LOG("  %-10s : %.2f MB | %zu Vertices | %zu Faces | %zu Objects", InLabel, FileMegabytes,
+			ImporterInfo.VertexList.size(), FaceCount, ImporterInfo.ObjectInfoList.size());
+		UE_LOG("    getline + istringstream : %9.3f ms | %8.2f MB/s", ReferenceMs, ReferenceMs > 0.0 ? FileMegabytes * 1000.0 / ReferenceMs : 0.0);
+		UE_LOG("    in-place + from_chars   : %9.3f ms | %8.2f MB/s | x%.2f", ImporterMs, ImporterMs > 0.0 ? FileMegabytes * 1000.0 / ImporterMs : 0.0,
+			ImporterMs > 0.0 ? ReferenceMs / ImporterMs : 0.0);
+
+		if (bReferenceLoaded != bImporterLoaded || !FAssetBenchmark::IsSameObjInfo(ReferenceInfo, ImporterInfo))
+		{
+			UE_LOG_WARNING("OBJ Import Benchmark: %s 파싱 결과가 이전 파서와 일치하지 않습니다 (로드 %d / %d)", InLabel,
+				bReferenceLoaded ? 1 : 0, bImporterLoaded ? 1 : 0);
+		}
+	}
+}
+
+bool FAssetBenchmark::LoadObjReference(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo, const FObjImporter::Configuration& Config)
+{
+	std::ifstream File(FilePath);
+	if (!File)
+	{
+		return false;
+	}
+
+	size_t FaceCount = 0;
+	TOptional<FObjectInfo> OptObjectInfo;
+	const auto EnsureObject = [&OptObjectInfo, &Config]()
+	{
+		if (!OptObjectInfo)
+		{
+			OptObjectInfo.emplace();
+			OptObjectInfo->Name = Config.DefaultName;
+		}
+	};
+
+	FString Buffer;
+	while (std::getline(File, Buffer))
+	{
+		std::istringstream Tokenizer(Buffer);
+		FString Prefix;
+
+		Tokenizer >> Prefix;
+
+		if (Prefix == "v")
+		{
+			FVector Position;
+			if (!(Tokenizer >> Position.X >> Position.Y >> Position.Z))
+			{
+				return false;
+			}
+			OutObjInfo->VertexList.emplace_back(Config.bPositionToUEBasis ? FVector(Position.X, -Position.Y, Position.Z) : Position);
+		}
+		else if (Prefix == "vn")
+		{
+			FVector Normal;
+			if (!(Tokenizer >> Normal.X >> Normal.Y >> Normal.Z))
+			{
+				return false;
+			}
+			OutObjInfo->NormalList.emplace_back(Config.bNormalToUEBasis ? FVector(Normal.X, -Normal.Y, Normal.Z) : Normal);
+		}
+		else if (Prefix == "vt")
+		{
+			FVector2 TexCoord;
+			if (!(Tokenizer >> TexCoord.X >> TexCoord.Y))
+			{
+				return false;
+			}
+			OutObjInfo->TexCoordList.emplace_back(Config.bUVToUEBasis ? FVector2(TexCoord.X, 1.0f - TexCoord.Y) : TexCoord);
+		}
+		else if (Prefix == "o")
+		{
+			if (!Config.bIsObjectEnabled)
+			{
+				continue;
+			}
+
+			if (OptObjectInfo)
+			{
+				OutObjInfo->ObjectInfoList.emplace_back(std::move(*OptObjectInfo));
+			}
+
+			FString ObjectName;
+			if (!(Tokenizer >> ObjectName))
+			{
+				return false;
+			}
+			OptObjectInfo.emplace();
+			OptObjectInfo->Name = std::move(ObjectName);
+			FaceCount = 0;
+		}
+		else if (Prefix == "g")
+		{
+			EnsureObject();
+
+			FString GroupName;
+			if (!(Tokenizer >> GroupName))
+			{
+				return false;
+			}
+			OptObjectInfo->GroupNameList.emplace_back(std::move(GroupName));
+			OptObjectInfo->GroupIndexList.emplace_back(FaceCount);
+		}
+		else if (Prefix == "f")
+		{
+			EnsureObject();
+
+			TArray<FString> FaceBuffers;
+			FString FaceBuffer;
+			while (Tokenizer >> FaceBuffer)
+			{
+				FaceBuffers.emplace_back(FaceBuffer);
+			}
+
+			if (FaceBuffers.size() < 2)
+			{
+				return false;
+			}
+
+			for (size_t i = 1; i + 1 < FaceBuffers.size(); ++i)
+			{
+				const size_t Second = Config.bFlipWindingOrder ? i + 1 : i;
+				const size_t Third = Config.bFlipWindingOrder ? i : i + 1;
+				if (!ParseFaceBufferReference(FaceBuffers[0], &(*OptObjectInfo))
+					|| !ParseFaceBufferReference(FaceBuffers[Second], &(*OptObjectInfo))
+					|| !ParseFaceBufferReference(FaceBuffers[Third], &(*OptObjectInfo)))
+				{
+					return false;
+				}
+				++FaceCount;
+			}
+		}
+		else if (Prefix == "mtllib")
+		{
+			FString MaterialFileName;
+			Tokenizer >> MaterialFileName;
+
+			const std::filesystem::path MaterialFilePath = std::filesystem::weakly_canonical(FilePath.parent_path() / MaterialFileName);
+			if (!FObjImporter::LoadMaterial(MaterialFilePath, OutObjInfo))
+			{
+				return false;
+			}
+		}
+		else if (Prefix == "usemtl")
+		{
+			FString MaterialName;
+			Tokenizer >> MaterialName;
+
+			EnsureObject();
+			OptObjectInfo->MaterialNameList.emplace_back(std::move(MaterialName));
+			OptObjectInfo->MaterialIndexList.emplace_back(FaceCount);
+		}
+	}
+
+	if (OptObjectInfo)
+	{
+		OutObjInfo->ObjectInfoList.emplace_back(std::move(*OptObjectInfo));
+	}
+
+	return true;
+}
+
+bool FAssetBenchmark::WriteGridObj(const std::filesystem::path& InFilePath, uint32 InFaceCount)
+{
+	std::ofstream File(InFilePath, std::ios::binary);
+	if (!File)
+	{
+		return false;
+	}
+
+	const uint32 GridSize = std::max(1u, static_cast<uint32>(std::ceil(std::sqrt(InFaceCount * 0.5))));
+	const uint32 RowVertexCount = GridSize + 1;
+
+	std::mt19937 Random(BENCHMARK_RANDOM_SEED);
+	std::uniform_real_distribution<float> JitterDist(-0.25f, 0.25f);
+
+	// 한 줄씩 쓰면 스트림 호출이 병목이 되므로 버퍼에 모아 쓴다
+	FString Buffer;
+	Buffer.reserve(1 << 20);
+	char Line[160];
+	const auto Append = [&](int InLength)
+	{
+		Buffer.append(Line, static_cast<size_t>(InLength));
+		if (Buffer.size() >= (1 << 20) - sizeof(Line))
+		{
+			File.write(Buffer.data(), static_cast<std::streamsize>(Buffer.size()));
+			Buffer.clear();
+		}
+	};
+
+	Append(snprintf(Line, sizeof(Line), "# Generated by bench obj: %u faces\n", InFaceCount));
+	for (uint32 Y = 0; Y < RowVertexCount; ++Y)
+	{
+		for (uint32 X = 0; X < RowVertexCount; ++X)
+		{
+			const float PositionX = (static_cast<float>(X) + JitterDist(Random)) * 10.0f;
+			const float PositionY = (static_cast<float>(Y) + JitterDist(Random)) * 10.0f;
+			const float Height = std::sin(PositionX * 0.013f) * std::cos(PositionY * 0.017f) * 25.0f;
+			Append(snprintf(Line, sizeof(Line), "v %.6f %.6f %.6f\n", PositionX, Height, -PositionY));
+			Append(snprintf(Line, sizeof(Line), "vt %.6f %.6f\n",
+				static_cast<float>(X) / static_cast<float>(GridSize), static_cast<float>(Y) / static_cast<float>(GridSize)));
+
+			FVector Normal(-std::cos(PositionX * 0.013f) * 0.3f, 1.0f, std::sin(PositionY * 0.017f) * 0.3f);
+			Normal.Normalize();
+			Append(snprintf(Line, sizeof(Line), "vn %.4f %.4f %.4f\n", Normal.X, Normal.Y, Normal.Z));
+		}
+	}
+
+	const uint32 FacesPerObject = std::max(1u, (InFaceCount + BENCHMARK_OBJ_OBJECT_COUNT - 1) / BENCHMARK_OBJ_OBJECT_COUNT);
+	for (uint32 FaceIndex = 0; FaceIndex < InFaceCount; ++FaceIndex)
+	{
+		if (FaceIndex % FacesPerObject == 0)
+		{
+			const uint32 ObjectIndex = FaceIndex / FacesPerObject;
+			Append(snprintf(Line, sizeof(Line), "o Object_%u\ng Group_%u\nusemtl Material_%u\n", ObjectIndex, ObjectIndex, ObjectIndex % 3));
+		}
+
+		const uint32 Cell = FaceIndex / 2;
+		const uint32 CellX = Cell % GridSize;
+		const uint32 CellY = Cell / GridSize;
+		const uint32 V00 = CellY * RowVertexCount + CellX + 1;
+		const uint32 V10 = V00 + 1;
+		const uint32 V01 = V00 + RowVertexCount;
+		const uint32 V11 = V01 + 1;
+
+		const uint32 A = V00;
+		const uint32 B = (FaceIndex & 1) ? V11 : V10;
+		const uint32 C = (FaceIndex & 1) ? V01 : V11;
+		Append(snprintf(Line, sizeof(Line), "f %u/%u/%u %u/%u/%u %u/%u/%u\n", A, A, A, B, B, B, C, C, C));
+	}
+
+	File.write(Buffer.data(), static_cast<std::streamsize>(Buffer.size()));
+	return static_cast<bool>(File);
+}
+
+bool FAssetBenchmark::IsSameObjInfo(FObjInfo& InA, FObjInfo& InB)
+{
+	if (InA.ObjectMaterialInfoList.size() != InB.ObjectMaterialInfoList.size())
+	{
+		return false;
+	}
+	for (size_t Index = 0; Index < InA.ObjectMaterialInfoList.size(); ++Index)
+	{
+		if (InA.ObjectMaterialInfoList[Index].Name != InB.ObjectMaterialInfoList[Index].Name)
+		{
+			return false;
+		}
+	}
+
+	FMemoryWriter WriterA;
+	FMemoryWriter WriterB;
+	WriterA << InA.ObjectInfoList << InA.VertexList << InA.NormalList << InA.TexCoordList;
+	WriterB << InB.ObjectInfoList << InB.VertexList << InB.NormalList << InB.TexCoordList;
+	return WriterA.Bytes == WriterB.Bytes;
+}
+
+void FAssetBenchmark::RunObjImportBenchmark(uint32 InFaceCount)
+{
+	if (InFaceCount == 0) { return; }
+
+	UE_LOG("OBJ Import Benchmark: Best of %u Runs, %u Worker Threads", BENCHMARK_OBJ_REPEAT_COUNT, GetParallelWorkerCount());
+
+	// 1. 엔진 메시 (에셋 매니저와 같은 설정, 바이너리 캐시 제외)
+	FObjImporter::Configuration Config;
+	Config.bIsBinaryEnabled = false;
+	if (std::filesystem::exists(BENCHMARK_SPHERE_OBJ_PATH))
+	{
+		CompareObjParsers("Sphere.obj", BENCHMARK_SPHERE_OBJ_PATH, Config);
+	}
+	else
+	{
+		UE_LOG_WARNING("OBJ Import Benchmark: %s를 찾지 못했습니다", BENCHMARK_SPHERE_OBJ_PATH);
+	}
+
+	// 2. 생성한 격자 메시. 오브젝트 구분까지 비교하도록 'o'를 켠다
+	std::error_code ErrorCode;
+	const std::filesystem::path GridPath = std::filesystem::temp_directory_path(ErrorCode) / "FutureEngine_ObjBenchmark.obj";
+	if (ErrorCode || !WriteGridObj(GridPath, InFaceCount))
+	{
+		UE_LOG_WARNING("OBJ Import Benchmark: 임시 OBJ 파일을 만들지 못했습니다: %s", GridPath.string().c_str());
+		return;
+	}
+
+	Config.bIsObjectEnabled = true;
+	CompareObjParsers("Grid", GridPath, Config);
+
+	std::filesystem::remove(GridPath, ErrorCode);
+}
@@ -0,0 +1,158 @@
+#include "pch.h"
+#include "Utility/Public/ParallelFor.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+	/** @brief 하드웨어 스레드가 많아도 프레임 단위 작업에는 이 이상 나누지 않는다 */
+	constexpr uint32 MAX_WORKER_THREAD_COUNT = 7;
+
+	/** @brief 워커 스레드이거나 ParallelFor 실행 중인 호출 스레드면 true. 중첩 호출은 그 자리에서 순서대로 실행한다. */
+	thread_local bool bIsInsideParallelFor = false;
+
+	/**
+	 * @brief ParallelFor 전용 워커 스레드 풀
+	 * 작업을 하나씩 순서대로 처리한다. 모든 워커는 작업마다 한 번씩 깨어나 일을 나눠 가진 뒤 완료를 보고하며,
+	 * 호출 스레드는 모든 워커가 보고할 때까지 기다리므로 다음 작업이 이전 작업의 InBody를 참조하는 일은 없다.
+	 */
+	class FWorkerThreadPool
+	{
+	public:
+		static FWorkerThreadPool& Get()
+		{
+			static FWorkerThreadPool Pool;
+			return Pool;
+		}
+
+		uint32 GetNumWorkers() const { return static_cast<uint32>(Workers.size()); }
+
+		void Run(uint32 InCount, const TFunction<void(uint32)>& InBody)
+		{
+			std::lock_guard<std::mutex> DispatchLock(DispatchMutex);
+
+			{
+				std::lock_guard<std::mutex> Lock(Mutex);
+				CurrentBody = &InBody;
+				CurrentCount = InCount;
+				NextIndex.store(0, std::memory_order_relaxed);
+				FinishedWorkerCount = 0;
+				++Generation;
+			}
+			WakeCondition.notify_all();
+
+			bIsInsideParallelFor = true;
+			ExecuteItems(InBody, InCount);
+			bIsInsideParallelFor = false;
+
+			std::unique_lock<std::mutex> Lock(Mutex);
+			DoneCondition.wait(Lock, [this]() { return FinishedWorkerCount == Workers.size(); });
+			CurrentBody = nullptr;
+		}
+
+	private:
+		FWorkerThreadPool()
+		{
+			const uint32 HardwareThreadCount = std::thread::hardware_concurrency();
+			const uint32 WorkerCount = HardwareThreadCount > 1 ? std::min(HardwareThreadCount - 1, MAX_WORKER_THREAD_COUNT) : 0;
+
+			Workers.reserve(WorkerCount);
+			for (uint32 Index = 0; Index < WorkerCount; ++Index)
+			{
+				Workers.emplace_back([this]() { WorkerMain(); });
+			}
+		}
+
+		~FWorkerThreadPool()
+		{
+			{
+				std::lock_guard<std::mutex> Lock(Mutex);
+				bShutdown = true;
+			}
+			WakeCondition.notify_all();
+
+			for (std::thread& Worker : Workers)
+			{
+				Worker.join();
+			}
+		}
+
+		void WorkerMain()
+		{
+			bIsInsideParallelFor = true;
+			uint64 SeenGeneration = 0;
+
+			while (true)
+			{
+				const TFunction<void(uint32)>* Body = nullptr;
+				uint32 Count = 0;
+				{
+					std::unique_lock<std::mutex> Lock(Mutex);
+					WakeCondition.wait(Lock, [this, SeenGeneration]() { return bShutdown || Generation != SeenGeneration; });
+					if (bShutdown) { return; }
+
+					SeenGeneration = Generation;
+					Body = CurrentBody;
+					Count = CurrentCount;
+				}
+
+				ExecuteItems(*Body, Count);
+
+				{
+					std::lock_guard<std::mutex> Lock(Mutex);
+					++FinishedWorkerCount;
+				}
+				DoneCondition.notify_one();
+			}
+		}
+
+		void ExecuteItems(const TFunction<void(uint32)>& InBody, uint32 InCount)
+		{
+			for (uint32 Index = NextIndex.fetch_add(1, std::memory_order_relaxed); Index < InCount;
+				Index = NextIndex.fetch_add(1, std::memory_order_relaxed))
+			{
+				InBody(Index);
+			}
+		}
+
+		TArray<std::thread> Workers;
+
+		/** @brief 여러 스레드가 동시에 ParallelFor를 호출해도 작업이 하나씩 처리되도록 막는다 */
+		std::mutex DispatchMutex;
+		std::mutex Mutex;
+		std::condition_variable WakeCondition;
+		std::condition_variable DoneCondition;
+
+		const TFunction<void(uint32)>* CurrentBody = nullptr;
+		uint32 CurrentCount = 0;
+		std::atomic<uint32> NextIndex{ 0 };
+		size_t FinishedWorkerCount = 0;
+		uint64 Generation = 0;
+		bool bShutdown = false;
+	};
+}
+
+void ParallelFor(uint32 InCount, const TFunction<void(uint32)>& InBody)
+{
+	if (InCount == 0) { return; }
+
+	FWorkerThreadPool* Pool = bIsInsideParallelFor ? nullptr : &FWorkerThreadPool::Get();
+	if (InCount == 1 || Pool == nullptr || Pool->GetNumWorkers() == 0)
+	{
+		for (uint32 Index = 0; Index < InCount; ++Index)
+		{
+			InBody(Index);
+		}
+		return;
+	}
+
+	Pool->Run(InCount, InBody);
+}
+
+uint32 GetParallelWorkerCount()
+{
+	return FWorkerThreadPool::Get().GetNumWorkers();
+}
@@ -0,0 +1,937 @@
+#include "pch.h"
+#include "Utility/Public/SpatialBenchmark.h"
+#include "Utility/Public/ScopeCycleCounter.h"
+#include "Component/Public/PrimitiveComponent.h"
+#include "Optimization/Public/ViewVolumeCuller.h"
+#include "Optimization/Public/FrustumCullingKernel.h"
+#include "Global/Octree.h"
+#include "Global/BVH.h"
+#include "Global/WideBVH.h"
+#include "Manager/Asset/Public/AssetManager.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Utility/Public/ParallelFor.h"
+#include "Level/Public/World.h"
+#include "Level/Public/Level.h"
+#include "Global/DynamicAABBTree.h"
+#include "Physics/Public/SceneTLAS.h"
+#include "Physics/Public/SceneQuery.h"
+#include "Editor/Public/Camera.h"
+#include "Editor/Public/Editor.h"
+#include "Actor/Public/Actor.h"
+
+#include <random>
+
+namespace
+{
+	constexpr uint32 BENCHMARK_FRUSTUM_QUERY_COUNT = 64;
+	constexpr uint32 BENCHMARK_RAY_QUERY_COUNT = 256;
+	constexpr float BENCHMARK_WORLD_HALF_SIZE = 2000.0f;
+	constexpr float BENCHMARK_QUERY_HALF_SIZE = 400.0f;
+	constexpr uint32 BENCHMARK_RANDOM_SEED = 20251016;
+	/** @brief 마퀴 선택 쿼리 하나가 에디터 상호작용을 끊지 않고 끝나야 하는 시간 */
+	constexpr double BENCHMARK_MARQUEE_BUDGET_MS = 2.0;
+	/** @brief 마퀴 벤치마크에서 액터 하나가 소유하는 프리미티브 수 (액터 단위 중복 제거까지 재기 위해 1보다 크게 둔다) */
+	constexpr uint32 BENCHMARK_MARQUEE_PRIMITIVES_PER_ACTOR = 4;
+
+	/** @brief 레벨에 등록하지 않고 고정된 월드 AABB만 제공하는 벤치마크용 프리미티브 (Transform은 항등) */
+	class UBenchmarkPrimitiveComponent : public UPrimitiveComponent
+	{
+	public:
+		explicit UBenchmarkPrimitiveComponent(const FAABB& InWorldBox)
+			: WorldBox(InWorldBox)
+		{
+			BoundingBox = &WorldBox;
+		}
+
+	private:
+		FAABB WorldBox;
+	};
+
+	struct FOctreeBenchmarkResult
+	{
+		double BuildMs = 0.0;
+		double BulkBuildMs = 0.0;
+		double FrustumMs = 0.0;
+		double RayMs = 0.0;
+		double RemoveMs = 0.0;
+		uint64 FrustumHits = 0;
+		uint64 RayHits = 0;
+		uint64 BulkFrustumHits = 0;
+	};
+
+	/** @brief 중심이 InCenter인 축 정렬 쿼리 볼륨을 FFrustum 평면(바깥 법선)으로 표현한다. */
+	FFrustum MakeBoxFrustum(const FVector& InCenter, float InHalfSize)
+	{
+		FFrustum Frustum;
+		Frustum.Planes[0] = FVector4(-1.0f, 0.0f, 0.0f, InCenter.X - InHalfSize);
+		Frustum.Planes[1] = FVector4(1.0f, 0.0f, 0.0f, -(InCenter.X + InHalfSize));
+		Frustum.Planes[2] = FVector4(0.0f, -1.0f, 0.0f, InCenter.Y - InHalfSize);
+		Frustum.Planes[3] = FVector4(0.0f, 1.0f, 0.0f, -(InCenter.Y + InHalfSize));
+		Frustum.Planes[4] = FVector4(0.0f, 0.0f, -1.0f, InCenter.Z - InHalfSize);
+		Frustum.Planes[5] = FVector4(0.0f, 0.0f, 1.0f, -(InCenter.Z + InHalfSize));
+		return Frustum;
+	}
+
+	/** @brief 평면 마스크나 SIMD 없이 노드와 프리미티브를 하나씩 절두체와 검사하며 FOctree를 순회한다. */
+	void CullOctree(FOctree* InOctree, const FFrustum& InFrustum, TArray<UPrimitiveComponent*>& OutPrimitives)
+	{
+		TDeque<FOctree*> VisitingNodes;
+		VisitingNodes.push_back(InOctree);
+
+		while (!VisitingNodes.empty())
+		{
+			FOctree* CurrentNode = VisitingNodes.back();
+			VisitingNodes.pop_back();
+
+			const EBoundCheckResult Result = InFrustum.CheckIntersection(CurrentNode->GetBoundingBox());
+			if (Result == EBoundCheckResult::Outside) { continue; }
+
+			if (Result == EBoundCheckResult::Inside)
+			{
+				TArray<UPrimitiveComponent*> Primitives;
+				CurrentNode->GetAllPrimitives(Primitives);
+				for (UPrimitiveComponent* Primitive : Primitives)
+				{
+					if (Primitive->IsVisible()) { OutPrimitives.push_back(Primitive); }
+				}
+				continue;
+			}
+
+			for (UPrimitiveComponent* Primitive : CurrentNode->GetPrimitives())
+			{
+				FVector Min, Max;
+				Primitive->GetWorldAABB(Min, Max);
+				if (Primitive->IsVisible() && InFrustum.CheckIntersection(FAABB(Min, Max)) != EBoundCheckResult::Outside)
+				{
+					OutPrimitives.push_back(Primitive);
+				}
+			}
+
+			if (!CurrentNode->IsLeafNode())
+			{
+				for (FOctree* Child : CurrentNode->GetChildren()) { VisitingNodes.push_back(Child); }
+			}
+		}
+	}
+
+	/** @brief 레이가 지나는 옥트리 노드의 프리미티브를 모두 후보로 모은 뒤 AABB로 한 번 더 거른다 (TLAS 이전의 피킹 경로). */
+	void RaycastOctree(FOctree* InOctree, const FRay& InRay, TArray<UPrimitiveComponent*>& OutPrimitives)
+	{
+		TArray<UPrimitiveComponent*> Candidates;
+		TArray<FOctree*> NodeStack;
+		NodeStack.push_back(InOctree);
+
+		while (!NodeStack.empty())
+		{
+			FOctree* Node = NodeStack.back();
+			NodeStack.pop_back();
+
+			if (!CheckIntersectionRayBox(InRay, Node->GetBoundingBox())) { continue; }
+
+			Candidates.insert(Candidates.end(), Node->GetPrimitives().begin(), Node->GetPrimitives().end());
+			if (!Node->IsLeafNode())
+			{
+				for (FOctree* Child : Node->GetChildren()) { NodeStack.push_back(Child); }
+			}
+		}
+
+		for (UPrimitiveComponent* Primitive : Candidates)
+		{
+			FVector Min, Max;
+			Primitive->GetWorldAABB(Min, Max);
+			if (CheckIntersectionRayBox(InRay, FAABB(Min, Max))) { OutPrimitives.push_back(Primitive); }
+		}
+	}
+
+	double GetElapsedMilliseconds(uint64 InStartCycles)
+	{
+		return FWindowsPlatformTime::ToMilliseconds(FWindowsPlatformTime::Cycles64() - InStartCycles);
+	}
+
+	/** @brief 밀리초당 처리한 박스 수를 초당 백만 단위로 환산한다. */
+	double GetMegaBoxesPerSecond(uint64 InBoxTests, double InMilliseconds)
+	{
+		return InMilliseconds > 0.0 ? static_cast<double>(InBoxTests) / (InMilliseconds * 1000.0) : 0.0;
+	}
+
+	uint64 CountVisibleBits(const TArray<uint32>& InMask)
+	{
+		uint64 Count = 0;
+		for (uint32 Word : InMask)
+		{
+			for (; Word != 0; Word &= Word - 1) { ++Count; }
+		}
+		return Count;
+	}
+}
+
+void FSpatialBenchmark::RunOctreeBenchmark(uint32 InPrimitiveCount)
+{
+	if (InPrimitiveCount == 0) { return; }
+
+	// 1. 벤치마크 데이터 생성 (고정 시드)
+	std::mt19937 Random(BENCHMARK_RANDOM_SEED);
+	std::uniform_real_distribution<float> PositionDist(-BENCHMARK_WORLD_HALF_SIZE, BENCHMARK_WORLD_HALF_SIZE);
+	std::uniform_real_distribution<float> ExtentDist(0.5f, 8.0f);
+	std::uniform_real_distribution<float> DirectionDist(-1.0f, 1.0f);
+
+	TArray<UPrimitiveComponent*> Primitives;
+	Primitives.reserve(InPrimitiveCount);
+	for (uint32 Index = 0; Index < InPrimitiveCount; ++Index)
+	{
+		const FVector Center(PositionDist(Random), PositionDist(Random), PositionDist(Random));
+		const FVector Extent(ExtentDist(Random), ExtentDist(Random), ExtentDist(Random));
+		Primitives.push_back(new UBenchmarkPrimitiveComponent(FAABB(Center - Extent, Center + Extent)));
+	}
+
+	TArray<FFrustum> Frustums;
+	Frustums.reserve(BENCHMARK_FRUSTUM_QUERY_COUNT);
+	for (uint32 Index = 0; Index < BENCHMARK_FRUSTUM_QUERY_COUNT; ++Index)
+	{
+		Frustums.push_back(MakeBoxFrustum(FVector(PositionDist(Random), PositionDist(Random), PositionDist(Random)), BENCHMARK_QUERY_HALF_SIZE));
+	}
+
+	TArray<FRay> Rays;
+	Rays.reserve(BENCHMARK_RAY_QUERY_COUNT);
+	for (uint32 Index = 0; Index < BENCHMARK_RAY_QUERY_COUNT; ++Index)
+	{
+		FVector Direction(DirectionDist(Random), DirectionDist(Random), DirectionDist(Random));
+		Direction.Normalize();
+
+		FRay Ray;
+		Ray.Origin = FVector4(PositionDist(Random), PositionDist(Random), PositionDist(Random), 1.0f);
+		Ray.Direction = FVector4(Direction.X, Direction.Y, Direction.Z, 0.0f);
+		Rays.push_back(Ray);
+	}
+
+	TArray<UPrimitiveComponent*> RemoveOrder = Primitives;
+	std::shuffle(RemoveOrder.begin(), RemoveOrder.end(), Random);
+
+	TArray<UPrimitiveComponent*> QueryResult;
+	QueryResult.reserve(InPrimitiveCount);
+
+	// 2. FOctree (레벨과 같은 초기 크기에서 시작)
+	FOctreeBenchmarkResult OctreeResult;
+	{
+		uint64 StartCycles = FWindowsPlatformTime::Cycles64();
+		FOctree* Octree = new FOctree(FVector(0, 0, -5), 75, 0);
+		for (UPrimitiveComponent* Primitive : Primitives) { Octree->Insert(Primitive); }
+		OctreeResult.BuildMs = GetElapsedMilliseconds(StartCycles);
+
+		StartCycles = FWindowsPlatformTime::Cycles64();
+		for (const FFrustum& Frustum : Frustums)
+		{
+			QueryResult.clear();
+			CullOctree(Octree, Frustum, QueryResult);
+			OctreeResult.FrustumHits += QueryResult.size();
+		}
+		OctreeResult.FrustumMs = GetElapsedMilliseconds(StartCycles);
+
+		StartCycles = FWindowsPlatformTime::Cycles64();
+		for (const FRay& Ray : Rays)
+		{
+			QueryResult.clear();
+			RaycastOctree(Octree, Ray, QueryResult);
+			OctreeResult.RayHits += QueryResult.size();
+		}
+		OctreeResult.RayMs = GetElapsedMilliseconds(StartCycles);
+
+		StartCycles = FWindowsPlatformTime::Cycles64();
+		for (UPrimitiveComponent* Primitive : RemoveOrder) { Octree->Remove(Primitive); }
+		OctreeResult.RemoveMs = GetElapsedMilliseconds(StartCycles);
+
+		// 레벨 로드 경로와 같은 일괄 구축 (결과는 개별 삽입한 트리와 같은 쿼리 결과를 내야 한다)
+		TArray<UPrimitiveComponent*> Rejected;
+		StartCycles = FWindowsPlatformTime::Cycles64();
+		Octree->Build(Primitives, Rejected);
+		OctreeResult.BulkBuildMs = GetElapsedMilliseconds(StartCycles);
+
+		for (const FFrustum& Frustum : Frustums)
+		{
+			QueryResult.clear();
+			CullOctree(Octree, Frustum, QueryResult);
+			OctreeResult.BulkFrustumHits += QueryResult.size();
+		}
+
+		SafeDelete(Octree);
+	}
+
+	for (UPrimitiveComponent* Primitive : Primitives) { delete Primitive; }
+
+	// 3. 결과 출력
+	UE_LOG("Octree Benchmark: %u Primitives, %u Frustum Queries, %u Ray Queries", InPrimitiveCount,
+		BENCHMARK_FRUSTUM_QUERY_COUNT, BENCHMARK_RAY_QUERY_COUNT);
+	UE_LOG("  FOctree       : Build %8.3f ms | Frustum %8.3f ms | Ray %8.3f ms | Remove %8.3f ms | Bulk Build %8.3f ms",
+		OctreeResult.BuildMs, OctreeResult.FrustumMs, OctreeResult.RayMs, OctreeResult.RemoveMs, OctreeResult.BulkBuildMs);
+
+	if (OctreeResult.FrustumHits != OctreeResult.BulkFrustumHits)
+	{
+		UE_LOG_WARNING("Octree Benchmark: 일괄 구축한 FOctree의 쿼리 결과가 일치하지 않습니다 (Frustum %llu / %llu)",
+			OctreeResult.FrustumHits, OctreeResult.BulkFrustumHits);
+	}
+}
+
+void FSpatialBenchmark::RunFrustumCullBenchmark(uint32 InBoxCount)
+{
+	if (InBoxCount == 0) { return; }
+
+	// 1. 벤치마크 데이터 생성 (고정 시드). 같은 박스를 프리미티브/FAABB 배열/SoA 세 형태로 준비한다
+	std::mt19937 Random(BENCHMARK_RANDOM_SEED);
+	std::uniform_real_distribution<float> PositionDist(-BENCHMARK_WORLD_HALF_SIZE, BENCHMARK_WORLD_HALF_SIZE);
+	std::uniform_real_distribution<float> ExtentDist(0.5f, 8.0f);
+
+	TArray<UPrimitiveComponent*> Primitives;
+	TArray<FAABB> Boxes;
+	FPrimitiveBoundsSoA BoxesSoA;
+	Primitives.reserve(InBoxCount);
+	Boxes.reserve(InBoxCount);
+	for (uint32 Index = 0; Index < InBoxCount; ++Index)
+	{
+		const FVector Center(PositionDist(Random), PositionDist(Random), PositionDist(Random));
+		const FVector Extent(ExtentDist(Random), ExtentDist(Random), ExtentDist(Random));
+		const FAABB Box(Center - Extent, Center + Extent);
+
+		Primitives.push_back(new UBenchmarkPrimitiveComponent(Box));
+		Boxes.push_back(Box);
+		BoxesSoA.Add(Primitives.back(), Box.Min, Box.Max);
+	}
+
+	TArray<FFrustum> Frustums;
+	Frustums.reserve(BENCHMARK_FRUSTUM_QUERY_COUNT);
+	for (uint32 Index = 0; Index < BENCHMARK_FRUSTUM_QUERY_COUNT; ++Index)
+	{
+		// 절반 정도의 박스가 걸치도록 큰 쿼리 볼륨을 사용한다
+		Frustums.push_back(MakeBoxFrustum(FVector(PositionDist(Random), PositionDist(Random), PositionDist(Random)), BENCHMARK_WORLD_HALF_SIZE));
+	}
+
+	const uint64 BoxTests = static_cast<uint64>(InBoxCount) * BENCHMARK_FRUSTUM_QUERY_COUNT;
+	TArray<uint32> VisibleMask(FFrustumCullingKernel::GetMaskWordCount(InBoxCount));
+
+	// 2. 기존 경로: 프리미티브마다 GetWorldAABB → FAABB → CheckIntersection
+	uint64 PrimitiveVisible = 0;
+	uint64 StartCycles = FWindowsPlatformTime::Cycles64();
+	for (const FFrustum& Frustum : Frustums)
+	{
+		for (UPrimitiveComponent* Primitive : Primitives)
+		{
+			FVector Min, Max;
+			Primitive->GetWorldAABB(Min, Max);
+			PrimitiveVisible += Frustum.CheckIntersection(FAABB(Min, Max)) != EBoundCheckResult::Outside;
+		}
+	}
+	const double PrimitiveMs = GetElapsedMilliseconds(StartCycles);
+
+	// 3. 미리 계산된 FAABB 배열의 스칼라 판정
+	uint64 ScalarVisible = 0;
+	StartCycles = FWindowsPlatformTime::Cycles64();
+	for (const FFrustum& Frustum : Frustums)
+	{
+		for (const FAABB& Box : Boxes)
+		{
+			ScalarVisible += Frustum.CheckIntersection(Box) != EBoundCheckResult::Outside;
+		}
+	}
+	const double ScalarMs = GetElapsedMilliseconds(StartCycles);
+
+	// 4. SIMD 커널 (SoA)
+	TArray<FFrustumCullingKernel> Kernels;
+	Kernels.reserve(Frustums.size());
+	for (const FFrustum& Frustum : Frustums) { Kernels.emplace_back(Frustum); }
+
+	uint64 SSEVisible = 0;
+	StartCycles = FWindowsPlatformTime::Cycles64();
+	for (const FFrustumCullingKernel& Kernel : Kernels)
+	{
+		Kernel.CullBoxesSSE(BoxesSoA.MinX.data(), BoxesSoA.MinY.data(), BoxesSoA.MinZ.data(),
+			BoxesSoA.MaxX.data(), BoxesSoA.MaxY.data(), BoxesSoA.MaxZ.data(), InBoxCount, VisibleMask.data());
+		SSEVisible += CountVisibleBits(VisibleMask);
+	}
+	const double SSEMs = GetElapsedMilliseconds(StartCycles);
+
+	uint64 AVXVisible = 0;
+	StartCycles = FWindowsPlatformTime::Cycles64();
+	for (const FFrustumCullingKernel& Kernel : Kernels)
+	{
+		Kernel.CullBoxesAVX(BoxesSoA.MinX.data(), BoxesSoA.MinY.data(), BoxesSoA.MinZ.data(),
+			BoxesSoA.MaxX.data(), BoxesSoA.MaxY.data(), BoxesSoA.MaxZ.data(), InBoxCount, VisibleMask.data());
+		AVXVisible += CountVisibleBits(VisibleMask);
+	}
+	const double AVXMs = GetElapsedMilliseconds(StartCycles);
+
+	for (UPrimitiveComponent* Primitive : Primitives) { delete Primitive; }
+
+	// 5. 결과 출력
+	UE_LOG("Frustum Cull Benchmark: %u Boxes x %u Frustums", InBoxCount, BENCHMARK_FRUSTUM_QUERY_COUNT);
+	UE_LOG("  GetWorldAABB + CheckIntersection : %8.3f ms | %8.2f M boxes/s", PrimitiveMs, GetMegaBoxesPerSecond(BoxTests, PrimitiveMs));
+	UE_LOG("  FAABB + CheckIntersection        : %8.3f ms | %8.2f M boxes/s", ScalarMs, GetMegaBoxesPerSecond(BoxTests, ScalarMs));
+	UE_LOG("  SoA Kernel (SSE, 4 wide)         : %8.3f ms | %8.2f M boxes/s", SSEMs, GetMegaBoxesPerSecond(BoxTests, SSEMs));
+	UE_LOG("  SoA Kernel (AVX, 8 wide)         : %8.3f ms | %8.2f M boxes/s", AVXMs, GetMegaBoxesPerSecond(BoxTests, AVXMs));
+
+	if (PrimitiveVisible != ScalarVisible || ScalarVisible != SSEVisible || ScalarVisible != AVXVisible)
+	{
+		UE_LOG_WARNING("Frustum Cull Benchmark: 보이는 박스 수가 일치하지 않습니다 (%llu / %llu / %llu / %llu)",
+			PrimitiveVisible, ScalarVisible, SSEVisible, AVXVisible);
+	}
+}
+
+void FSpatialBenchmark::RunBVHBuildBenchmark(uint32 InTriangleCount)
+{
+	if (InTriangleCount == 0) { return; }
+
+	// 1. 벤치마크 메시 생성: 물결 모양 격자 지형 (사각형 하나에 삼각형 2개)
+	const uint32 GridSize = std::max(1u, static_cast<uint32>(std::ceil(std::sqrt(InTriangleCount * 0.5f))));
+	const float CellSize = BENCHMARK_WORLD_HALF_SIZE * 2.0f / GridSize;
+
+	FStaticMesh Mesh;
+	Mesh.Vertices.reserve(static_cast<size_t>(GridSize + 1) * (GridSize + 1));
+	for (uint32 Y = 0; Y <= GridSize; ++Y)
+	{
+		for (uint32 X = 0; X <= GridSize; ++X)
+		{
+			const float PositionX = X * CellSize - BENCHMARK_WORLD_HALF_SIZE;
+			const float PositionY = Y * CellSize - BENCHMARK_WORLD_HALF_SIZE;
+
+			FNormalVertex Vertex = {};
+			Vertex.Position = FVector(PositionX, PositionY, 100.0f * std::sin(PositionX * 0.01f) * std::cos(PositionY * 0.013f));
+			Mesh.Vertices.push_back(Vertex);
+		}
+	}
+
+	Mesh.Indices.reserve(static_cast<size_t>(InTriangleCount) * 3);
+	for (uint32 Triangle = 0; Triangle < InTriangleCount; ++Triangle)
+	{
+		const uint32 Quad = Triangle / 2;
+		const uint32 Corner = (Quad / GridSize) * (GridSize + 1) + Quad % GridSize;
+		if (Triangle % 2 == 0)
+		{
+			Mesh.Indices.insert(Mesh.Indices.end(), { Corner, Corner + 1, Corner + GridSize + 2 });
+		}
+		else
+		{
+			Mesh.Indices.insert(Mesh.Indices.end(), { Corner, Corner + GridSize + 2, Corner + GridSize + 1 });
+		}
+	}
+
+	// 지형 위에서 비스듬히 내려다보는 레이 (고정 시드)
+	std::mt19937 Random(BENCHMARK_RANDOM_SEED);
+	std::uniform_real_distribution<float> PositionDist(-BENCHMARK_WORLD_HALF_SIZE, BENCHMARK_WORLD_HALF_SIZE);
+	std::uniform_real_distribution<float> DirectionDist(-1.0f, 1.0f);
+
+	TArray<FRay> Rays;
+	Rays.reserve(BENCHMARK_RAY_QUERY_COUNT);
+	for (uint32 Index = 0; Index < BENCHMARK_RAY_QUERY_COUNT; ++Index)
+	{
+		FVector Direction(DirectionDist(Random), DirectionDist(Random), -1.0f);
+		Direction.Normalize();
+
+		FRay Ray;
+		Ray.Origin = FVector4(PositionDist(Random), PositionDist(Random), 500.0f, 1.0f);
+		Ray.Direction = FVector4(Direction.X, Direction.Y, Direction.Z, 0.0f);
+		Rays.push_back(Ray);
+	}
+
+	struct FBVHBenchmarkResult
+	{
+		double BuildMs = 0.0;
+		double RayMs = 0.0;
+		double ClosestHitMs = 0.0;
+		float SAHCost = 0.0f;
+		int32 NodeCount = 0;
+		uint64 RayCandidates = 0;
+	};
+
+	TArray<int32> Candidates;
+	auto MeasureQueries = [&](const FBVH& InBVH, FBVHBenchmarkResult& OutResult)
+	{
+		OutResult.SAHCost = InBVH.GetSAHCost();
+		OutResult.NodeCount = InBVH.GetNodeCount();
+
+		uint64 StartCycles = FWindowsPlatformTime::Cycles64();
+		for (const FRay& Ray : Rays)
+		{
+			InBVH.TraverseRay(Ray, Candidates);
+			OutResult.RayCandidates += Candidates.size();
+		}
+		OutResult.RayMs = GetElapsedMilliseconds(StartCycles);
+
+		FBVHRayHit Hit;
+		StartCycles = FWindowsPlatformTime::Cycles64();
+		for (const FRay& Ray : Rays)
+		{
+			InBVH.ClosestHit(Ray, Hit);
+		}
+		OutResult.ClosestHitMs = GetElapsedMilliseconds(StartCycles);
+	};
+
+	// 2. binned SAH 일괄 구축
+	FBVHBenchmarkResult SAHResult;
+	{
+		FBVH BVH;
+		const uint64 StartCycles = FWindowsPlatformTime::Cycles64();
+		BVH.Build(&Mesh);
+		SAHResult.BuildMs = GetElapsedMilliseconds(StartCycles);
+		MeasureQueries(BVH, SAHResult);
+	}
+
+	// 3. 삽입 구축
+	FBVHBenchmarkResult IncrementalResult;
+	{
+		FBVH BVH;
+		const uint64 StartCycles = FWindowsPlatformTime::Cycles64();
+		BVH.BuildIncremental(&Mesh);
+		IncrementalResult.BuildMs = GetElapsedMilliseconds(StartCycles);
+		MeasureQueries(BVH, IncrementalResult);
+	}
+
+	// 4. 결과 출력
+	UE_LOG("BVH Build Benchmark: %u Triangles, %u Ray Queries, %u Worker Threads", InTriangleCount,
+		BENCHMARK_RAY_QUERY_COUNT, GetParallelWorkerCount());
+	UE_LOG("  Binned SAH  : Build %10.3f ms | SAH Cost %8.2f | Ray %8.3f ms | Closest Hit %8.3f ms | %d Nodes",
+		SAHResult.BuildMs, SAHResult.SAHCost, SAHResult.RayMs, SAHResult.ClosestHitMs, SAHResult.NodeCount);
+	UE_LOG("  Incremental : Build %10.3f ms | SAH Cost %8.2f | Ray %8.3f ms | Closest Hit %8.3f ms | %d Nodes",
+		IncrementalResult.BuildMs, IncrementalResult.SAHCost, IncrementalResult.RayMs, IncrementalResult.ClosestHitMs, IncrementalResult.NodeCount);
+
+	if (SAHResult.RayCandidates != IncrementalResult.RayCandidates)
+	{
+		UE_LOG_WARNING("BVH Build Benchmark: 레이 후보 수가 일치하지 않습니다 (%llu / %llu)",
+			SAHResult.RayCandidates, IncrementalResult.RayCandidates);
+	}
+}
+
+void FSpatialBenchmark::RunBVHRayBenchmark(uint32 InRayCount)
+{
+	if (InRayCount == 0) { return; }
+
+	UE_LOG("BVH Ray Benchmark: %u Rays per Mesh, Default Wide BVH = BVH%u", InRayCount, FMeshWideBVH::WIDTH);
+
+	std::mt19937 Random(BENCHMARK_RANDOM_SEED);
+	std::uniform_real_distribution<float> UnitDist(-1.0f, 1.0f);
+	std::uniform_real_distribution<float> FractionDist(0.0f, 1.0f);
+
+	TArray<FRay> Rays(InRayCount);
+	TArray<FBVHRayHit> BinaryHits(InRayCount);
+	TArray<uint8> BinaryHitFlags(InRayCount);
+
+	for (const auto& [ObjPath, StaticMesh] : UAssetManager::GetInstance().GetStaticMeshCache())
+	{
+		const FStaticMesh* Mesh = StaticMesh ? StaticMesh->GetStaticMeshAsset() : nullptr;
+		if (!Mesh || Mesh->BVH.GetRootIndex() < 0)
+		{
+			continue;
+		}
+		const FBVH& BVH = Mesh->BVH;
+
+		// 1. 메시 AABB를 감싸는 구 위의 점에서 박스 안의 임의 지점을 향하는 레이 (메시마다 같은 시드)
+		Random.seed(BENCHMARK_RANDOM_SEED);
+		const FAABB& Bounds = BVH.GetNode(BVH.GetRootIndex()).Box;
+		const FVector Center = Bounds.GetCenter();
+		const float Radius = std::max((Bounds.Max - Bounds.Min).Length(), MATH_EPSILON);
+		for (FRay& Ray : Rays)
+		{
+			FVector Offset(UnitDist(Random), UnitDist(Random), UnitDist(Random));
+			if (Offset.Length() < MATH_EPSILON) { Offset = FVector(1.0f, 0.0f, 0.0f); }
+			Offset.Normalize();
+
+			const FVector Origin = Center + Offset * Radius;
+			const FVector Target(
+				Bounds.Min.X + (Bounds.Max.X - Bounds.Min.X) * FractionDist(Random),
+				Bounds.Min.Y + (Bounds.Max.Y - Bounds.Min.Y) * FractionDist(Random),
+				Bounds.Min.Z + (Bounds.Max.Z - Bounds.Min.Z) * FractionDist(Random));
+			FVector Direction = Target - Origin;
+			Direction.Normalize();
+
+			Ray.Origin = FVector4(Origin.X, Origin.Y, Origin.Z, 1.0f);
+			Ray.Direction = FVector4(Direction.X, Direction.Y, Direction.Z, 0.0f);
+		}
+
+		// 2. 이진 트리 기준 결과와 시간
+		uint32 HitCount = 0;
+		uint64 StartCycles = FWindowsPlatformTime::Cycles64();
+		for (uint32 Index = 0; Index < InRayCount; ++Index)
+		{
+			BinaryHitFlags[Index] = BVH.ClosestHitBinary(Rays[Index], BinaryHits[Index]) ? 1 : 0;
+			HitCount += BinaryHitFlags[Index];
+		}
+		const double BinaryMs = GetElapsedMilliseconds(StartCycles);
+
+		// 3. 같은 이진 트리를 접은 BVH4 / BVH8
+		auto MeasureWide = [&](const auto& InWideBVH, uint32& OutMismatchCount)
+		{
+			OutMismatchCount = 0;
+			FBVHRayHit Hit;
+			const uint64 WideStartCycles = FWindowsPlatformTime::Cycles64();
+			for (uint32 Index = 0; Index < InRayCount; ++Index)
+			{
+				const bool bHit = InWideBVH.ClosestHit(Rays[Index], Hit, 0.0f, FLT_MAX);
+				const FBVHRayHit& Expected = BinaryHits[Index];
+				if (bHit != (BinaryHitFlags[Index] != 0) ||
+					(bHit && fabsf(Hit.Distance - Expected.Distance) > 1e-4f * std::max(1.0f, Expected.Distance)))
+				{
+					++OutMismatchCount;
+				}
+			}
+			return GetElapsedMilliseconds(WideStartCycles);
+		};
+
+		FBVH4 BVH4;
+		FBVH8 BVH8;
+		StartCycles = FWindowsPlatformTime::Cycles64();
+		BVH4.Build(BVH);
+		const double Build4Ms = GetElapsedMilliseconds(StartCycles);
+		StartCycles = FWindowsPlatformTime::Cycles64();
+		BVH8.Build(BVH);
+		const double Build8Ms = GetElapsedMilliseconds(StartCycles);
+
+		uint32 Mismatch4 = 0;
+		uint32 Mismatch8 = 0;
+		const double Wide4Ms = MeasureWide(BVH4, Mismatch4);
+		const double Wide8Ms = MeasureWide(BVH8, Mismatch8);
+
+		// 4. 결과 출력 (초당 레이 수는 백만 단위)
+		auto GetMegaRaysPerSecond = [InRayCount](double InMs)
+		{
+			return InMs > 0.0 ? InRayCount / (InMs * 1000.0) : 0.0;
+		};
+
+		UE_LOG("  %s: %u Triangles, %u/%u Hits", ObjPath.ToString().c_str(), static_cast<uint32>(Mesh->Indices.size() / 3), HitCount, InRayCount);
+		UE_LOG("    Binary : %8.3f MRays/s | %7d Nodes", GetMegaRaysPerSecond(BinaryMs), BVH.GetNodeCount());
+		UE_LOG("    BVH4   : %8.3f MRays/s | %7u Nodes | %8.1f KB | Collapse %7.3f ms",
+			GetMegaRaysPerSecond(Wide4Ms), BVH4.GetNodeCount(), BVH4.GetMemorySize() / 1024.0, Build4Ms);
+		UE_LOG("    BVH8   : %8.3f MRays/s | %7u Nodes | %8.1f KB | Collapse %7.3f ms",
+			GetMegaRaysPerSecond(Wide8Ms), BVH8.GetNodeCount(), BVH8.GetMemorySize() / 1024.0, Build8Ms);
+
+		if (Mismatch4 != 0 || Mismatch8 != 0)
+		{
+			UE_LOG_WARNING("BVH Ray Benchmark: %s 결과가 이진 트리와 일치하지 않습니다 (BVH4 %u / BVH8 %u)",
+				ObjPath.ToString().c_str(), Mismatch4, Mismatch8);
+		}
+	}
+}
+
+void FSpatialBenchmark::RunSceneRayBenchmark(uint32 InRayCount)
+{
+	ULevel* Level = GWorld ? GWorld->GetLevel() : nullptr;
+	if (InRayCount == 0 || !Level) { return; }
+
+	// 1. TLAS (씬이 바뀐 뒤라면 여기서 다시 구축된다)
+	uint64 StartCycles = FWindowsPlatformTime::Cycles64();
+	const FSceneTLAS* TLAS = Level->GetSceneTLAS();
+	const double UpdateMs = GetElapsedMilliseconds(StartCycles);
+	if (TLAS->GetInstanceCount() == 0)
+	{
+		UE_LOG_WARNING("Scene Ray Benchmark: 레벨에 검사할 프리미티브가 없습니다");
+		return;
+	}
+
+	TArray<UPrimitiveComponent*> Primitives;
+	Level->GetStaticOctree()->GetAllPrimitives(Primitives);
+	Level->GetDynamicTree()->GetAllPrimitives(Primitives);
+
+	FVector SceneMin(FLT_MAX, FLT_MAX, FLT_MAX);
+	FVector SceneMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	for (UPrimitiveComponent* Primitive : Primitives)
+	{
+		FVector Min, Max;
+		Primitive->GetWorldAABB(Min, Max);
+		SceneMin = FVector(std::min(SceneMin.X, Min.X), std::min(SceneMin.Y, Min.Y), std::min(SceneMin.Z, Min.Z));
+		SceneMax = FVector(std::max(SceneMax.X, Max.X), std::max(SceneMax.Y, Max.Y), std::max(SceneMax.Z, Max.Z));
+	}
+
+	// 2. 씬 AABB를 감싸는 구 위의 점에서 박스 안의 임의 지점을 향하는 레이
+	std::mt19937 Random(BENCHMARK_RANDOM_SEED);
+	std::uniform_real_distribution<float> UnitDist(-1.0f, 1.0f);
+	std::uniform_real_distribution<float> FractionDist(0.0f, 1.0f);
+
+	const FVector Center = (SceneMin + SceneMax) * 0.5f;
+	const float Radius = std::max((SceneMax - SceneMin).Length(), MATH_EPSILON);
+	TArray<FRay> Rays(InRayCount);
+	for (FRay& Ray : Rays)
+	{
+		FVector Offset(UnitDist(Random), UnitDist(Random), UnitDist(Random));
+		if (Offset.Length() < MATH_EPSILON) { Offset = FVector(1.0f, 0.0f, 0.0f); }
+		Offset.Normalize();
+
+		const FVector Origin = Center + Offset * Radius;
+		const FVector Target(
+			SceneMin.X + (SceneMax.X - SceneMin.X) * FractionDist(Random),
+			SceneMin.Y + (SceneMax.Y - SceneMin.Y) * FractionDist(Random),
+			SceneMin.Z + (SceneMax.Z - SceneMin.Z) * FractionDist(Random));
+		FVector Direction = Target - Origin;
+		Direction.Normalize();
+
+		Ray.Origin = FVector4(Origin.X, Origin.Y, Origin.Z, 1.0f);
+		Ray.Direction = FVector4(Direction.X, Direction.Y, Direction.Z, 0.0f);
+	}
+
+	// 피킹과 같은 조건 (삼각형이 없는 프리미티브는 맞지 않는다)
+	FSceneRayParams Params;
+	Params.bHitBoundsWithoutTriangles = false;
+
+	auto GetOrigin = [](const FRay& InRay) { return FVector(InRay.Origin.X, InRay.Origin.Y, InRay.Origin.Z); };
+	auto GetDirection = [](const FRay& InRay) { return FVector(InRay.Direction.X, InRay.Direction.Y, InRay.Direction.Z); };
+
+	// 3. 기존 경로: 후보를 모두 모은 뒤 후보마다 가장 가까운 충돌을 찾는다 (후보 사이에 최대 거리를 공유하지 않는다)
+	TArray<float> CandidateDistances(InRayCount, FLT_MAX);
+	TArray<UPrimitiveComponent*> Candidates;
+	uint64 CandidateCount = 0;
+	FSceneRayHit Hit;
+	StartCycles = FWindowsPlatformTime::Cycles64();
+	for (uint32 Index = 0; Index < InRayCount; ++Index)
+	{
+		Candidates.clear();
+		RaycastOctree(Level->GetStaticOctree(), Rays[Index], Candidates);
+		Level->GetDynamicTree()->QueryRay(Rays[Index], Candidates);
+		CandidateCount += Candidates.size();
+
+		for (UPrimitiveComponent* Primitive : Candidates)
+		{
+			if (FSceneTLAS::IntersectPrimitive(Primitive, GetOrigin(Rays[Index]), GetDirection(Rays[Index]), FLT_MAX, Params, Hit))
+			{
+				CandidateDistances[Index] = std::min(CandidateDistances[Index], Hit.Distance);
+			}
+		}
+	}
+	const double CandidateMs = GetElapsedMilliseconds(StartCycles);
+
+	// 4. TLAS: 가까운 인스턴스부터 하나의 최대 거리를 공유하며 순회한다
+	uint32 HitCount = 0;
+	uint32 MismatchCount = 0;
+	StartCycles = FWindowsPlatformTime::Cycles64();
+	for (uint32 Index = 0; Index < InRayCount; ++Index)
+	{
+		const bool bHit = TLAS->Trace(GetOrigin(Rays[Index]), GetDirection(Rays[Index]), Params, Hit);
+		HitCount += bHit ? 1 : 0;
+
+		const float Expected = CandidateDistances[Index];
+		if (bHit != (Expected < FLT_MAX) || (bHit && fabsf(Hit.Distance - Expected) > 1e-4f * std::max(1.0f, Expected)))
+		{
+			++MismatchCount;
+		}
+	}
+	const double TLASMs = GetElapsedMilliseconds(StartCycles);
+
+	// 5. 트랜스폼만 바뀐 프레임과 같이 씬 리비전만 올려 Refit 경로를 잰다 (프리미티브 구성은 그대로)
+	Level->MarkSceneDirty();
+	StartCycles = FWindowsPlatformTime::Cycles64();
+	Level->GetSceneTLAS();
+	const double RefitUpdateMs = GetElapsedMilliseconds(StartCycles);
+
+	auto GetMegaRaysPerSecond = [InRayCount](double InMs)
+	{
+		return InMs > 0.0 ? InRayCount / (InMs * 1000.0) : 0.0;
+	};
+
+	UE_LOG("Scene Ray Benchmark: %u Rays, %u Instances, %u/%u Hits", InRayCount, TLAS->GetInstanceCount(), HitCount, InRayCount);
+	UE_LOG("  Candidates : %8.3f MRays/s | %.1f Candidates/Ray", GetMegaRaysPerSecond(CandidateMs),
+		static_cast<double>(CandidateCount) / InRayCount);
+	UE_LOG("  TLAS       : %8.3f MRays/s | %7u Nodes | Build %7.3f ms (Update %7.3f ms) | Refit %7.3f ms (Update %7.3f ms)",
+		GetMegaRaysPerSecond(TLASMs), TLAS->GetNodeCount(), TLAS->GetLastBuildMs(), UpdateMs, TLAS->GetLastRefitMs(), RefitUpdateMs);
+
+	if (MismatchCount != 0)
+	{
+		UE_LOG_WARNING("Scene Ray Benchmark: TLAS 결과가 후보별 검사와 일치하지 않는 레이가 %u개 있습니다", MismatchCount);
+	}
+}
+
+void FSpatialBenchmark::RunMarqueeSelectionBenchmark(uint32 InPrimitiveCount)
+{
+	if (InPrimitiveCount == 0) { return; }
+
+	// 1. 벤치마크 데이터 생성 (고정 시드). 열에 하나는 움직인 프리미티브처럼 동적 트리에 넣는다
+	std::mt19937 Random(BENCHMARK_RANDOM_SEED);
+	std::uniform_real_distribution<float> PositionDist(-BENCHMARK_WORLD_HALF_SIZE, BENCHMARK_WORLD_HALF_SIZE);
+	std::uniform_real_distribution<float> ExtentDist(0.5f, 8.0f);
+	std::uniform_real_distribution<float> FractionDist(0.0f, 1.0f);
+	std::uniform_real_distribution<float> RectSizeDist(0.05f, 0.6f);
+
+	// 액터는 레벨에 등록하지 않고 프리미티브를 OwnedComponents에 넣지 않으므로, 정리할 때 둘을 따로 지운다
+	TArray<UPrimitiveComponent*> Primitives;
+	TArray<UPrimitiveComponent*> StaticPrimitives;
+	TArray<AActor*> Actors;
+	Primitives.reserve(InPrimitiveCount);
+	FDynamicAABBTree* DynamicTree = new FDynamicAABBTree();
+	for (uint32 Index = 0; Index < InPrimitiveCount; ++Index)
+	{
+		const FVector Center(PositionDist(Random), PositionDist(Random), PositionDist(Random));
+		const FVector Extent(ExtentDist(Random), ExtentDist(Random), ExtentDist(Random));
+		UPrimitiveComponent* Primitive = new UBenchmarkPrimitiveComponent(FAABB(Center - Extent, Center + Extent));
+		Primitives.push_back(Primitive);
+
+		if (Index % BENCHMARK_MARQUEE_PRIMITIVES_PER_ACTOR == 0)
+		{
+			Actors.push_back(new AActor());
+			Actors.back()->SetRootComponent(Primitive);
+		}
+		Primitive->SetOwner(Actors.back());
+
+		if (Index % 10 == 0) { DynamicTree->Insert(Primitive); }
+		else { StaticPrimitives.push_back(Primitive); }
+	}
+
+	FOctree* Octree = new FOctree(FVector(0, 0, -5), 75, 0);
+	TArray<UPrimitiveComponent*> Rejected;
+	Octree->Build(StaticPrimitives, Rejected);
+
+	// 2. 월드 박스 밖에서 중심을 바라보는 원근 카메라로 에디터와 같은 부분 절두체를 만든다
+	UCamera* Camera = new UCamera();
+	Camera->SetInputEnabled(false);
+	Camera->SetLocation(FVector(-2.0f * BENCHMARK_WORLD_HALF_SIZE, 0.0f, 0.0f));
+	Camera->SetNearZ(1.0f);
+	Camera->SetFarZ(4.0f * BENCHMARK_WORLD_HALF_SIZE);
+	Camera->Update(D3D11_VIEWPORT{ 0.0f, 0.0f, 1920.0f, 1080.0f, 0.0f, 1.0f });
+
+	// 에디터 경로 측정에서 부분 절두체를 다시 만들도록 NDC 사각형도 남겨 둔다
+	TArray<FVector4> Rects;
+	TArray<FFrustum> Frustums;
+	Rects.reserve(BENCHMARK_FRUSTUM_QUERY_COUNT);
+	Frustums.reserve(BENCHMARK_FRUSTUM_QUERY_COUNT);
+	for (uint32 Index = 0; Index < BENCHMARK_FRUSTUM_QUERY_COUNT; ++Index)
+	{
+		const float Width = RectSizeDist(Random);
+		const float Height = RectSizeDist(Random);
+		const float MinX = -1.0f + (2.0f - Width) * FractionDist(Random);
+		const float MinY = -1.0f + (2.0f - Height) * FractionDist(Random);
+
+		FFrustum Frustum;
+		if (Camera->GetSubFrustum(MinX, MinY, MinX + Width, MinY + Height, Frustum))
+		{
+			Rects.emplace_back(MinX, MinY, MinX + Width, MinY + Height);
+			Frustums.push_back(Frustum);
+		}
+	}
+
+	const auto Cleanup = [&]()
+	{
+		SafeDelete(Camera);
+		SafeDelete(Octree);
+		SafeDelete(DynamicTree);
+		for (UPrimitiveComponent* Primitive : Primitives) { delete Primitive; }
+		for (AActor* Actor : Actors) { delete Actor; }
+	};
+
+	const uint32 QueryCount = static_cast<uint32>(Frustums.size());
+	if (QueryCount == 0)
+	{
+		Cleanup();
+		return;
+	}
+
+	// 3. 기존 방식: 모든 프리미티브의 월드 AABB를 하나씩 판정한다
+	TArray<uint64> ExpectedIntersectCounts(QueryCount, 0);
+	TArray<uint64> ExpectedContainCounts(QueryCount, 0);
+	double LoopTotalMs = 0.0;
+	double LoopWorstMs = 0.0;
+	for (uint32 Query = 0; Query < QueryCount; ++Query)
+	{
+		const uint64 StartCycles = FWindowsPlatformTime::Cycles64();
+		for (UPrimitiveComponent* Primitive : Primitives)
+		{
+			FVector Min, Max;
+			Primitive->GetWorldAABB(Min, Max);
+			const EBoundCheckResult Result = Frustums[Query].CheckIntersection(FAABB(Min, Max));
+			ExpectedIntersectCounts[Query] += Result != EBoundCheckResult::Outside ? 1 : 0;
+			ExpectedContainCounts[Query] += Result == EBoundCheckResult::Inside ? 1 : 0;
+		}
+		const double ElapsedMs = GetElapsedMilliseconds(StartCycles);
+		LoopTotalMs += ElapsedMs;
+		LoopWorstMs = std::max(LoopWorstMs, ElapsedMs);
+	}
+
+	// 4. FSceneQuery::OverlapFrustum: 노드 단위로 버리거나 통째로 담고 경계에 걸친 프리미티브만 판정한다
+	FSceneQuery SceneQuery;
+	FCollisionQueryParams Params;
+	TArray<UPrimitiveComponent*> Selected;
+	Selected.reserve(InPrimitiveCount);
+
+	struct FModeResult
+	{
+		const char* Name;
+		EFrustumOverlapMode Mode;
+		const TArray<uint64>* Expected;
+		double TotalMs = 0.0;
+		double WorstMs = 0.0;
+		uint64 SelectedCount = 0;
+		uint32 MismatchCount = 0;
+	};
+	FModeResult ModeResults[] =
+	{
+		{ "Intersect", EFrustumOverlapMode::BoundsIntersect, &ExpectedIntersectCounts },
+		{ "Contain  ", EFrustumOverlapMode::BoundsContain, &ExpectedContainCounts },
+	};
+
+	for (FModeResult& ModeResult : ModeResults)
+	{
+		for (uint32 Query = 0; Query < QueryCount; ++Query)
+		{
+			const uint64 StartCycles = FWindowsPlatformTime::Cycles64();
+			SceneQuery.OverlapFrustum(Octree, DynamicTree, Frustums[Query], ModeResult.Mode, Selected, Params);
+			const double ElapsedMs = GetElapsedMilliseconds(StartCycles);
+
+			ModeResult.TotalMs += ElapsedMs;
+			ModeResult.WorstMs = std::max(ModeResult.WorstMs, ElapsedMs);
+			ModeResult.SelectedCount += Selected.size();
+			ModeResult.MismatchCount += Selected.size() != (*ModeResult.Expected)[Query] ? 1 : 0;
+		}
+	}
+
+	// 5. UEditor::SelectActorsInMarquee와 같은 경로 전체: 부분 절두체 생성 → OverlapFrustum → 액터 묶기/정렬 → SelectActors
+	// 측정이 끝나면 사용자의 선택을 되돌린다
+	UEditor* Editor = GEditor ? GEditor->GetEditorModule() : nullptr;
+	double SelectionTotalMs = 0.0;
+	double SelectionWorstMs = 0.0;
+	uint64 SelectedActorCount = 0;
+	if (Editor)
+	{
+		const TArray<AActor*> PreviousActors = Editor->GetSelectedActors();
+		UActorComponent* PreviousComponent = Editor->GetSelectedComponent();
+		const FVector CameraLocation = Camera->GetLocation();
+
+		for (uint32 Query = 0; Query < QueryCount; ++Query)
+		{
+			const uint64 StartCycles = FWindowsPlatformTime::Cycles64();
+			FFrustum Frustum;
+			Camera->GetSubFrustum(Rects[Query].X, Rects[Query].Y, Rects[Query].Z, Rects[Query].W, Frustum);
+			SceneQuery.OverlapFrustum(Octree, DynamicTree, Frustum, EFrustumOverlapMode::BoundsIntersect, Selected, Params);
+			Editor->SelectPrimitiveOwners(Selected, CameraLocation);
+			const double ElapsedMs = GetElapsedMilliseconds(StartCycles);
+
+			SelectionTotalMs += ElapsedMs;
+			SelectionWorstMs = std::max(SelectionWorstMs, ElapsedMs);
+			SelectedActorCount += Editor->GetSelectedActors().size();
+		}
+
+		Editor->SelectActors(PreviousActors);
+		Editor->SelectComponent(PreviousComponent);
+	}
+
+	Cleanup();
+
+	// 6. 결과 출력
+	UE_LOG("Marquee Selection Benchmark: %u Primitives (%u Dynamic, %u Actors), %u Queries", InPrimitiveCount,
+		InPrimitiveCount - static_cast<uint32>(StaticPrimitives.size()), static_cast<uint32>(Actors.size()), QueryCount);
+	UE_LOG("  Per Primitive : avg %7.3f ms | worst %7.3f ms", LoopTotalMs / QueryCount, LoopWorstMs);
+
+	bool bOverBudget = false;
+	for (const FModeResult& ModeResult : ModeResults)
+	{
+		UE_LOG("  %s     : avg %7.3f ms | worst %7.3f ms | %.1f Selected/Query", ModeResult.Name, ModeResult.TotalMs / QueryCount,
+			ModeResult.WorstMs, static_cast<double>(ModeResult.SelectedCount) / QueryCount);
+		if (ModeResult.MismatchCount != 0)
+		{
+			UE_LOG_WARNING("Marquee Selection Benchmark: %s 결과 개수가 전체 검사와 다른 쿼리가 %u개 있습니다", ModeResult.Name, ModeResult.MismatchCount);
+		}
+		bOverBudget |= ModeResult.WorstMs > BENCHMARK_MARQUEE_BUDGET_MS;
+	}
+
+	if (Editor)
+	{
+		UE_LOG("  Selection     : avg %7.3f ms | worst %7.3f ms | %.1f Actors/Query", SelectionTotalMs / QueryCount,
+			SelectionWorstMs, static_cast<double>(SelectedActorCount) / QueryCount);
+		bOverBudget |= SelectionWorstMs > BENCHMARK_MARQUEE_BUDGET_MS;
+	}
+
+	if (bOverBudget)
+	{
+		UE_LOG_WARNING("Marquee Selection Benchmark: 가장 느린 쿼리가 %.1f ms 예산을 넘었습니다", BENCHMARK_MARQUEE_BUDGET_MS);
+	}
+}
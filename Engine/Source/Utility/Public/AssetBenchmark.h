@@ -0,0 +1,34 @@
+#pragma once
+#include "Manager/Asset/Public/ObjImporter.h"
+
+/**
+ * @brief 에셋 임포트 경로 성능 비교용 벤치마크
+ * 콘솔 명령 "bench obj [면 수]"로 실행하며, 결과는 UE_LOG로 출력된다.
+ * 생성한 임시 파일은 실행이 끝나면 지우고, 바이너리 캐시(.objbin)는 읽지도 쓰지도 않는다.
+ */
+class FAssetBenchmark
+{
+public:
+	/**
+	 * @brief FObjImporter::LoadObj를 줄마다 std::getline + std::istringstream으로 읽던 이전 파서와 비교한다.
+	 * Data/Shapes/Sphere.obj와, 임시 디렉터리에 만든 InFaceCount개 삼각형의 격자 메시(o/g/usemtl 포함)를 두 파서로 읽어
+	 * 가장 빠른 시간과 처리량을 출력한다.
+	 * 정점/법선/텍스처 좌표와 오브젝트 정보는 직렬화한 바이트를, 머티리얼은 개수와 이름을 비교해 다르면 경고를 출력한다.
+	 */
+	static void RunObjImportBenchmark(uint32 InFaceCount);
+
+	/**
+	 * @brief 이전 FObjImporter::LoadObj의 텍스트 파싱 경로. 줄마다 std::getline으로 읽고 std::istringstream으로 토큰을 뽑는다.
+	 * 바이너리 캐시는 다루지 않으며, .mtl은 현재 파서와 같이 FObjImporter::LoadMaterial로 읽는다. (EngineTest의 결과 비교 기준)
+	 */
+	static bool LoadObjReference(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo, const FObjImporter::Configuration& Config);
+
+	/**
+	 * @brief InFaceCount개 삼각형의 물결 격자를 v/vt/vn, "f v/vt/vn" 형식으로 쓴다.
+	 * 면을 8개 구간으로 나눠 구간마다 o/g/usemtl 줄을 넣는다.
+	 */
+	static bool WriteGridObj(const std::filesystem::path& InFilePath, uint32 InFaceCount);
+
+	/** @brief 머티리얼은 읽지 않은 필드가 초기화되지 않으므로 개수와 이름만, 나머지는 직렬화한 바이트를 비교한다 */
+	static bool IsSameObjInfo(FObjInfo& InA, FObjInfo& InB);
+};
@@ -0,0 +1,11 @@
+#pragma once
+
+/**
+ * @brief 공용 워커 스레드 풀에서 [0, InCount) 인덱스를 나누어 InBody를 실행하고, 전부 끝날 때까지 기다린다.
+ * 호출한 스레드도 작업에 참여한다. 인덱스는 원자적 카운터로 하나씩 가져가므로 InBody는 서로 다른 인덱스에 대해
+ * 동시에 호출될 수 있어야 한다. 워커 스레드 안에서 다시 호출되면(중첩) 호출한 스레드에서 순서대로 실행한다.
+ */
+void ParallelFor(uint32 InCount, const TFunction<void(uint32)>& InBody);
+
+/** @brief 풀의 워커 스레드 수 (호출 스레드 제외). 작업 분할 개수를 정할 때 사용한다. */
+uint32 GetParallelWorkerCount();
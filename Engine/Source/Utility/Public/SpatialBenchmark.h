@@ -0,0 +1,54 @@
+#pragma once
+
+/**
+ * @brief 공간 분할 자료구조 성능 비교용 벤치마크
+ * 콘솔 명령 "bench octree|cull|bvh|bvhray|tlas|marquee [개수]"로 실행하며, 결과는 UE_LOG로 출력된다.
+ * 레벨에 등록되지 않는 임시 프리미티브를 사용하거나(tlas는 현재 레벨을 읽기만 한다) 현재 씬에는 영향을 주지 않는다.
+ */
+class FSpatialBenchmark
+{
+public:
+	/**
+	 * @brief FOctree의 개별 삽입 구축/절두체 쿼리/레이 쿼리/삭제 시간과 레벨 로드 경로의 일괄 구축(Build) 시간을 측정한다.
+	 * 일괄 구축한 트리의 절두체 쿼리 결과 개수가 개별 삽입한 트리와 다르면 경고를 출력한다.
+	 */
+	static void RunOctreeBenchmark(uint32 InPrimitiveCount);
+
+	/**
+	 * @brief 박스 단위 절두체 판정 처리량(초당 박스 수)을 비교한다. 콘솔 명령 "bench cull [개수]"
+	 * 기존 경로(GetWorldAABB → FAABB → FFrustum::CheckIntersection), 미리 계산된 FAABB 배열의 스칼라 판정,
+	 * FFrustumCullingKernel의 SSE/AVX 경로를 같은 박스/절두체로 측정하며, 보이는 박스 수가 다르면 경고를 출력한다.
+	 */
+	static void RunFrustumCullBenchmark(uint32 InBoxCount);
+
+	/**
+	 * @brief 같은 메시로 FBVH의 binned SAH 일괄 구축(Build)과 삽입 구축(BuildIncremental)을 비교한다. 콘솔 명령 "bench bvh [삼각형 수]"
+	 * 구축 시간, SAH 비용(GetSAHCost), 레이 후보 수집(TraverseRay)과 ClosestHit 시간을 출력하며, 두 트리의 레이 후보 수가 다르면 경고를 출력한다.
+	 * 메시는 물결 모양의 격자 지형이며, 삽입 구축은 삼각형 수에 비해 매우 느리므로 수만 개 이상은 오래 걸린다.
+	 */
+	static void RunBVHBuildBenchmark(uint32 InTriangleCount);
+
+	/**
+	 * @brief 로드된 Data/ 메시마다 이진 BVH, BVH4(SSE), BVH8(AVX) ClosestHit의 초당 레이 수를 비교한다. 콘솔 명령 "bench bvhray [레이 수]"
+	 * 레이는 메시 AABB를 감싸는 구 위에서 박스 안의 임의 지점을 향하며, 넓은 트리의 충돌 여부/거리가 이진 트리와 다르면 경고를 출력한다.
+	 */
+	static void RunBVHRayBenchmark(uint32 InRayCount);
+
+	/**
+	 * @brief 현재 레벨에서 기존 피킹 경로(옥트리/동적 트리 후보를 모아 후보마다 메시를 검사)와 FSceneTLAS 순회의 초당 레이 수를 비교한다.
+	 * 콘솔 명령 "bench tlas [레이 수]". 레이는 씬 AABB를 감싸는 구 위에서 박스 안의 임의 지점을 향하며,
+	 * 가장 가까운 충돌 거리가 두 경로에서 다르면 경고를 출력한다.
+	 * 마지막으로 씬 리비전만 올려 트랜스폼 변경 프레임의 TLAS Refit 시간도 출력한다.
+	 */
+	static void RunSceneRayBenchmark(uint32 InRayCount);
+
+	/**
+	 * @brief 에디터 마퀴 선택 경로(UCamera::GetSubFrustum → FSceneQuery::OverlapFrustum)의 쿼리 시간을 모든 프리미티브를 하나씩 검사하는 경로와 비교한다.
+	 * 콘솔 명령 "bench marquee [프리미티브 수]". 프리미티브의 열에 하나는 동적 트리에, 나머지는 옥트리에 넣고,
+	 * 월드 밖의 원근 카메라에서 임의 크기의 사각형으로 만든 부분 절두체를 쓴다.
+	 * 에디터가 있으면 프리미티브 네 개씩을 임시 액터에 묶어 부분 절두체 생성부터 UEditor::SelectPrimitiveOwners(SelectActors 포함)까지
+	 * 마퀴 선택 경로 전체도 재고, 끝나면 원래 선택을 되돌린다.
+	 * 선택 개수가 두 경로에서 다르거나 가장 느린 쿼리가 상호작용 예산(2 ms)을 넘으면 경고를 출력한다.
+	 */
+	static void RunMarqueeSelectionBenchmark(uint32 InPrimitiveCount);
+};
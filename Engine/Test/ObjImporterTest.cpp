@@ -0,0 +1,218 @@
+#include "pch.h"
+#include "TestFramework.h"
+#include "Manager/Asset/Public/ObjImporter.h"
+#include "Utility/Public/AssetBenchmark.h"
+
+namespace
+{
+	constexpr const char* SPHERE_OBJ_PATH = "Data/Shapes/Sphere.obj";
+	constexpr uint32 GRID_FACE_COUNT = 1000000;
+	/** @brief 작은 파일은 이 수까지 청크 수를 바꿔 가며 읽어, 모든 줄 경계가 한 번씩 청크 시작이 되게 한다 */
+	constexpr uint32 MAX_FORCED_CHUNK_COUNT = 40;
+
+	/**
+	 * @brief 면 인덱스 형식과 명령 순서의 경계 사례를 모은 .obj
+	 * "f a//n", 끝이 '/'인 인덱스, 사각형 면, o/g/usemtl/mtllib이 섞인 순서를 담는다.
+	 */
+	constexpr std::string_view EDGE_CASE_OBJ =
+		"# FObjImporter edge cases\n"
+		"mtllib EdgeCases.mtl\n"
+		"v 0 0 0\n"
+		"v 1 0 0\n"
+		"v 1 1 0\n"
+		"v 0 1 0\n"
+		"vt 0 0\n"
+		"vt 1 0\n"
+		"vt 1 1\n"
+		"vt 0 1\n"
+		"vn 0 0 1\n"
+		"vn 0 0 -1\n"
+		"vn 0 1 0\n"
+		"vn 1 0 0\n"
+		"o First\n"
+		"g GroupA\n"
+		"usemtl MatA\n"
+		"f 1//1 2//2 3//3\n"
+		"f 1/1/ 2/2/ 3/3/\n"
+		"f 1/ 2/ 3/\n"
+		"usemtl MatB\n"
+		"f 1/1 2/2 3/3 4/4\n"
+		"g GroupB\n"
+		"f 1/1/1 2/2/2 3/3/3 4/4/4\n"
+		"\n"
+		"o Second\n"
+		"usemtl MatA\n"
+		"g GroupC\n"
+		"f 4 3 2 1\n";
+
+	constexpr std::string_view EDGE_CASE_MTL =
+		"newmtl MatA\n"
+		"Kd 1 0 0\n"
+		"newmtl MatB\n"
+		"Kd 0 1 0\n";
+
+	/** @brief 테스트마다 임시 디렉터리를 만들고, 끝나면 안의 파일과 함께 지운다 */
+	struct FTempDirectory
+	{
+		std::filesystem::path Path;
+
+		FTempDirectory()
+		{
+			std::error_code ErrorCode;
+			Path = std::filesystem::temp_directory_path(ErrorCode) / "FutureEngine_ObjImporterTest";
+			std::filesystem::create_directories(Path, ErrorCode);
+		}
+
+		~FTempDirectory()
+		{
+			std::error_code ErrorCode;
+			std::filesystem::remove_all(Path, ErrorCode);
+		}
+	};
+
+	bool WriteTextFile(const std::filesystem::path& InFilePath, std::string_view InText)
+	{
+		std::ofstream File(InFilePath, std::ios::binary);
+		File.write(InText.data(), static_cast<std::streamsize>(InText.size()));
+		return static_cast<bool>(File);
+	}
+
+	bool ReadTextFile(const std::filesystem::path& InFilePath, FString& OutText)
+	{
+		std::ifstream File(InFilePath, std::ios::binary);
+		if (!File)
+		{
+			return false;
+		}
+		OutText.assign(std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>());
+		return true;
+	}
+
+	FString ToCRLF(std::string_view InText)
+	{
+		FString Result;
+		Result.reserve(InText.size() * 2);
+		for (const char Character : InText)
+		{
+			if (Character == '\n') { Result += '\r'; }
+			Result += Character;
+		}
+		return Result;
+	}
+
+	/** @brief 이전 파서(FAssetBenchmark::LoadObjReference)로 읽은 결과와 ParseObj를 InChunkCount개 청크로 읽은 결과가 같은지 */
+	bool MatchesReference(const std::filesystem::path& InFilePath, const FObjInfo& InReferenceInfo, std::string_view InSource,
+		const FObjImporter::Configuration& InConfig, uint32 InChunkCount)
+	{
+		FObjInfo ReferenceInfo = InReferenceInfo;
+		FObjInfo ImporterInfo;
+		return FObjImporter::ParseObj(InSource, InFilePath, &ImporterInfo, InConfig, InChunkCount)
+			&& FAssetBenchmark::IsSameObjInfo(ReferenceInfo, ImporterInfo);
+	}
+
+	size_t CountFaces(const FObjInfo& InObjInfo)
+	{
+		size_t FaceCount = 0;
+		for (const FObjectInfo& ObjectInfo : InObjInfo.ObjectInfoList)
+		{
+			FaceCount += ObjectInfo.VertexIndexList.size() / 3;
+		}
+		return FaceCount;
+	}
+
+	/** @brief 이전 파서 결과를 기준으로 LoadObj, 자동 청크 수의 ParseObj, 지정한 청크 수의 ParseObj를 비교한다 */
+	void CheckMatchesReference(const std::filesystem::path& InFilePath, const FObjImporter::Configuration& InConfig,
+		std::initializer_list<uint32> InChunkCounts)
+	{
+		FObjInfo ReferenceInfo;
+		CHECK(FAssetBenchmark::LoadObjReference(InFilePath, &ReferenceInfo, InConfig));
+		CHECK(!ReferenceInfo.VertexList.empty());
+
+		FObjInfo LoadedInfo;
+		CHECK(FObjImporter::LoadObj(InFilePath, &LoadedInfo, InConfig));
+		FObjInfo ReferenceCopy = ReferenceInfo;
+		CHECK(FAssetBenchmark::IsSameObjInfo(ReferenceCopy, LoadedInfo));
+
+		FString Source;
+		CHECK(ReadTextFile(InFilePath, Source));
+		CHECK(MatchesReference(InFilePath, ReferenceInfo, Source, InConfig, 0));
+		for (const uint32 ChunkCount : InChunkCounts)
+		{
+			CHECK(MatchesReference(InFilePath, ReferenceInfo, Source, InConfig, ChunkCount));
+		}
+	}
+}
+
+TEST_CASE(ObjImporter_SphereMatchesReference)
+{
+	FObjImporter::Configuration Config;
+	Config.bIsBinaryEnabled = false;
+	CHECK(std::filesystem::exists(SPHERE_OBJ_PATH));
+	CheckMatchesReference(SPHERE_OBJ_PATH, Config, { 1, 2, 3, 7, 16 });
+
+	Config.bIsObjectEnabled = true;
+	CheckMatchesReference(SPHERE_OBJ_PATH, Config, { 1, 5 });
+}
+
+TEST_CASE(ObjImporter_GridMatchesReference)
+{
+	FTempDirectory TempDirectory;
+	const std::filesystem::path GridPath = TempDirectory.Path / "Grid.obj";
+	CHECK(FAssetBenchmark::WriteGridObj(GridPath, GRID_FACE_COUNT));
+
+	FObjImporter::Configuration Config;
+	Config.bIsBinaryEnabled = false;
+	Config.bIsObjectEnabled = true;
+	CheckMatchesReference(GridPath, Config, { 1, 3, 8 });
+
+	FObjInfo ObjInfo;
+	CHECK(FObjImporter::LoadObj(GridPath, &ObjInfo, Config));
+	CHECK(CountFaces(ObjInfo) == GRID_FACE_COUNT);
+	CHECK(ObjInfo.ObjectInfoList.size() == 8);
+}
+
+TEST_CASE(ObjImporter_EdgeCasesMatchReference)
+{
+	FTempDirectory TempDirectory;
+	CHECK(WriteTextFile(TempDirectory.Path / "EdgeCases.mtl", EDGE_CASE_MTL));
+
+	const FString LFSource(EDGE_CASE_OBJ);
+	const FString CRLFSource = ToCRLF(EDGE_CASE_OBJ);
+
+	for (const FString* Source : { &LFSource, &CRLFSource })
+	{
+		const std::filesystem::path ObjPath = TempDirectory.Path / (Source == &LFSource ? "EdgeCases.obj" : "EdgeCasesCRLF.obj");
+		CHECK(WriteTextFile(ObjPath, *Source));
+
+		for (const bool bIsObjectEnabled : { false, true })
+		{
+			for (const bool bFlipWindingOrder : { false, true })
+			{
+				FObjImporter::Configuration Config;
+				Config.bIsBinaryEnabled = false;
+				Config.bIsObjectEnabled = bIsObjectEnabled;
+				Config.bFlipWindingOrder = bFlipWindingOrder;
+
+				FObjInfo ReferenceInfo;
+				CHECK(FAssetBenchmark::LoadObjReference(ObjPath, &ReferenceInfo, Config));
+
+				// 청크 수를 늘려 가며 o/g/usemtl 줄과 면 줄이 청크 시작과 끝에 오도록 한다
+				for (uint32 ChunkCount = 1; ChunkCount <= MAX_FORCED_CHUNK_COUNT; ++ChunkCount)
+				{
+					CHECK(MatchesReference(ObjPath, ReferenceInfo, *Source, Config, ChunkCount));
+				}
+
+				// 비교 기준 자체가 비어 있지 않은지 확인한다 (삼각형 3 + 사각형 2 + 2 + 2)
+				FObjInfo ObjInfo;
+				CHECK(FObjImporter::LoadObj(ObjPath, &ObjInfo, Config));
+				CHECK(CountFaces(ObjInfo) == 9);
+				CHECK(ObjInfo.ObjectInfoList.size() == (bIsObjectEnabled ? 2u : 1u));
+				CHECK(ObjInfo.ObjectMaterialInfoList.size() == 2);
+				if (!ObjInfo.ObjectInfoList.empty())
+				{
+					CHECK(ObjInfo.ObjectInfoList[0].Name == (bIsObjectEnabled ? "First" : Config.DefaultName));
+				}
+			}
+		}
+	}
+}
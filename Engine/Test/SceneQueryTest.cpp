@@ -0,0 +1,510 @@
+#include "pch.h"
+#include "TestFramework.h"
+#include "Actor/Public/Actor.h"
+#include "Component/Public/PrimitiveComponent.h"
+#include "Core/Public/NewObject.h"
+#include "Level/Public/Level.h"
+#include "Optimization/Public/ViewVolumeCuller.h"
+#include "Physics/Public/OBB.h"
+#include "Physics/Public/SceneQuery.h"
+
+/** @brief 원점 중심, 한 변이 1인 큐브 메시를 가진 테스트용 프리미티브. 에셋 매니저와 렌더러 없이 삼각형과 AABB를 제공한다 */
+UCLASS()
+class UTestBoxComponent : public UPrimitiveComponent
+{
+	GENERATED_BODY()
+	DECLARE_CLASS(UTestBoxComponent, UPrimitiveComponent)
+
+public:
+	UTestBoxComponent();
+	~UTestBoxComponent() override;
+};
+
+/** @brief ComponentClass 필터 검사용 하위 클래스 */
+UCLASS()
+class UTestMarkerBoxComponent : public UTestBoxComponent
+{
+	GENERATED_BODY()
+	DECLARE_CLASS(UTestMarkerBoxComponent, UTestBoxComponent)
+};
+
+/** @brief ActorClass 필터 검사용 액터 */
+UCLASS()
+class ATestQueryActor : public AActor
+{
+	GENERATED_BODY()
+	DECLARE_CLASS(ATestQueryActor, AActor)
+};
+
+IMPLEMENT_CLASS(UTestBoxComponent, UPrimitiveComponent)
+IMPLEMENT_CLASS(UTestMarkerBoxComponent, UTestBoxComponent)
+IMPLEMENT_CLASS(ATestQueryActor, AActor)
+
+namespace
+{
+	const TArray<FNormalVertex>& GetUnitCubeVertices()
+	{
+		static const TArray<FNormalVertex> CubeVertices = []()
+		{
+			TArray<FNormalVertex> Result(8);
+			for (uint32 Corner = 0; Corner < 8; ++Corner)
+			{
+				Result[Corner].Position = FVector((Corner & 1) ? 0.5f : -0.5f, (Corner & 2) ? 0.5f : -0.5f, (Corner & 4) ? 0.5f : -0.5f);
+			}
+			return Result;
+		}();
+		return CubeVertices;
+	}
+
+	const TArray<uint32>& GetUnitCubeIndices()
+	{
+		static const TArray<uint32> CubeIndices =
+		{
+			0, 4, 6, 0, 6, 2,	// -X
+			1, 3, 7, 1, 7, 5,	// +X
+			0, 1, 5, 0, 5, 4,	// -Y
+			2, 6, 7, 2, 7, 3,	// +Y
+			0, 2, 3, 0, 3, 1,	// -Z
+			4, 5, 7, 4, 7, 6,	// +Z
+		};
+		return CubeIndices;
+	}
+
+	/** @brief InMin~InMax 박스 모양의 절두체. 평면은 FFrustum과 같이 바깥을 향하는 법선을 쓴다 */
+	FFrustum MakeBoxFrustum(const FVector& InMin, const FVector& InMax)
+	{
+		FFrustum Frustum;
+		Frustum.Planes[0] = FVector4(-1.0f, 0.0f, 0.0f, InMin.X);
+		Frustum.Planes[1] = FVector4(1.0f, 0.0f, 0.0f, -InMax.X);
+		Frustum.Planes[2] = FVector4(0.0f, -1.0f, 0.0f, InMin.Y);
+		Frustum.Planes[3] = FVector4(0.0f, 1.0f, 0.0f, -InMax.Y);
+		Frustum.Planes[4] = FVector4(0.0f, 0.0f, -1.0f, InMin.Z);
+		Frustum.Planes[5] = FVector4(0.0f, 0.0f, 1.0f, -InMax.Z);
+		return Frustum;
+	}
+
+	bool ContainsExactly(const TArray<UPrimitiveComponent*>& InPrimitives, std::initializer_list<const UPrimitiveComponent*> InExpected)
+	{
+		if (InPrimitives.size() != InExpected.size())
+		{
+			return false;
+		}
+		for (const UPrimitiveComponent* Expected : InExpected)
+		{
+			if (std::find(InPrimitives.begin(), InPrimitives.end(), Expected) == InPrimitives.end())
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * @brief X축을 따라 놓인 프리미티브로 만든 레벨
+	 * - WallA: x=10, YZ로 4배 늘린 벽 (Static)
+	 * - Hidden: x=12, 숨긴 큐브 (Static)
+	 * - Mover: x=15, 한 번 멀리 옮겼다가 되돌린 큐브 (Movable, UTestMarkerBoxComponent)
+	 * - WallB: x=20, YZ로 4배 늘린 벽 (Static, ATestQueryActor 소유)
+	 * - Far: y=50, 어떤 쿼리에도 걸리지 않는 큐브 (Static)
+	 * 괄호 안은 쿼리 채널을 정하는 Mobility이고, 트리 위치는 Mover만 DynamicTree다.
+	 * 액터는 레벨의 LevelActors에 넣지 않고 컴포넌트만 등록하므로, 레벨을 지울 때 에디터를 거치지 않는다.
+	 */
+	struct FSceneQueryTestLevel
+	{
+		ULevel* Level = nullptr;
+		TArray<AActor*> Actors;
+
+		AActor* ActorA = nullptr;
+		AActor* ActorMover = nullptr;
+		AActor* ActorB = nullptr;
+
+		UTestBoxComponent* WallA = nullptr;
+		UTestBoxComponent* Hidden = nullptr;
+		UTestBoxComponent* Mover = nullptr;
+		UTestBoxComponent* WallB = nullptr;
+		UTestBoxComponent* Far = nullptr;
+
+		FSceneQueryTestLevel()
+		{
+			Level = NewObject<ULevel>();
+
+			WallA = AddBox<AActor, UTestBoxComponent>(FVector(10.0f, 0.0f, 0.0f), FVector(1.0f, 4.0f, 4.0f), ActorA);
+			AActor* HiddenOwner = nullptr;
+			Hidden = AddBox<AActor, UTestBoxComponent>(FVector(12.0f, 0.0f, 0.0f), FVector(1.0f, 1.0f, 1.0f), HiddenOwner);
+			Hidden->SetVisibility(false);
+			Mover = AddBox<AActor, UTestMarkerBoxComponent>(FVector(15.0f, 0.0f, 0.0f), FVector(1.0f, 1.0f, 1.0f), ActorMover);
+			Mover->SetMobility(EComponentMobility::Movable);
+			WallB = AddBox<ATestQueryActor, UTestBoxComponent>(FVector(20.0f, 0.0f, 0.0f), FVector(1.0f, 4.0f, 4.0f), ActorB);
+			AActor* FarOwner = nullptr;
+			Far = AddBox<AActor, UTestBoxComponent>(FVector(0.0f, 50.0f, 0.0f), FVector(1.0f, 1.0f, 1.0f), FarOwner);
+
+			// 루트의 Loose 경계 밖으로 옮기면 DynamicTree로 넘어가고, 되돌려도 DynamicTree에 남는다 (USceneComponent::OnTransformChanged와 같은 경로)
+			Mover->SetRelativeLocation(FVector(1000.0f, 0.0f, 0.0f));
+			Level->UpdatePrimitiveInOctree(Mover);
+			Mover->SetRelativeLocation(FVector(15.0f, 0.0f, 0.0f));
+			Level->UpdatePrimitiveInOctree(Mover);
+		}
+
+		~FSceneQueryTestLevel()
+		{
+			for (AActor* Actor : Actors)
+			{
+				for (UActorComponent* Component : Actor->GetOwnedComponents())
+				{
+					Level->UnregisterComponent(Component);
+				}
+				SafeDelete(Actor);
+			}
+			SafeDelete(Level);
+		}
+
+		template<typename TActor, typename TComponent>
+		TComponent* AddBox(const FVector& InLocation, const FVector& InScale, AActor*& OutActor)
+		{
+			OutActor = NewObject<TActor>();
+			TComponent* Box = OutActor->CreateDefaultSubobject<TComponent>();
+			OutActor->SetRootComponent(Box);
+			Box->SetRelativeLocation(InLocation);
+			Box->SetRelativeScale3D(InScale);
+
+			Level->AddLevelComponent(OutActor);
+			Actors.push_back(OutActor);
+			return Box;
+		}
+	};
+
+	const FVector TRACE_START(0.0f, 0.2f, 0.3f);
+	const FVector TRACE_END(30.0f, 0.2f, 0.3f);
+	constexpr float TOLERANCE = 1.0e-3f;
+}
+
+UTestBoxComponent::UTestBoxComponent()
+{
+	Vertices = &GetUnitCubeVertices();
+	Indices = &GetUnitCubeIndices();
+	NumVertices = static_cast<uint32>(Vertices->size());
+	NumIndices = static_cast<uint32>(Indices->size());
+
+	bOwnsBoundingBox = true;
+	BoundingBox = new FAABB(FVector(-0.5f, -0.5f, -0.5f), FVector(0.5f, 0.5f, 0.5f));
+}
+
+UTestBoxComponent::~UTestBoxComponent()
+{
+	SafeDelete(BoundingBox);
+}
+
+TEST_CASE(SceneQuery_LevelSetup)
+{
+	FSceneQueryTestLevel Scene;
+
+	CHECK(Scene.WallA->GetOctreeNode() != nullptr);
+	CHECK(Scene.WallB->GetOctreeNode() != nullptr);
+	CHECK(Scene.Mover->GetOctreeNode() == nullptr);
+	CHECK(Scene.Mover->GetDynamicTreeProxy() >= 0);
+}
+
+TEST_CASE(SceneQuery_LineTraceSingle)
+{
+	FSceneQueryTestLevel Scene;
+	FSceneQuery SceneQuery;
+	FCollisionQueryParams Params;
+	FHitResult Hit;
+
+	CHECK(SceneQuery.LineTraceSingle(Scene.Level, TRACE_START, TRACE_END, Hit, Params));
+	CHECK(Hit.Component == Scene.WallA);
+	CHECK(Hit.Actor == Scene.ActorA);
+	CHECK_NEAR(Hit.Distance, 9.5f, TOLERANCE);
+	CHECK_NEAR(Hit.Location.X, 9.5f, TOLERANCE);
+	CHECK_NEAR(Hit.Location.Y, 0.2f, TOLERANCE);
+	CHECK_NEAR(Hit.Location.Z, 0.3f, TOLERANCE);
+	CHECK_NEAR(Hit.Normal.X, -1.0f, TOLERANCE);
+	CHECK(Hit.TriangleIndex >= 0);
+
+	// 반대 방향에서는 WallB의 +X 면에 먼저 닿는다
+	CHECK(SceneQuery.LineTraceSingle(Scene.Level, TRACE_END, TRACE_START, Hit, Params));
+	CHECK(Hit.Component == Scene.WallB);
+	CHECK_NEAR(Hit.Distance, 9.5f, TOLERANCE);
+	CHECK_NEAR(Hit.Normal.X, 1.0f, TOLERANCE);
+
+	// 단순 트레이스는 월드 AABB로 판정한다
+	Params.bTraceComplex = false;
+	CHECK(SceneQuery.LineTraceSingle(Scene.Level, TRACE_START, TRACE_END, Hit, Params));
+	CHECK(Hit.Component == Scene.WallA);
+	CHECK_NEAR(Hit.Distance, 9.5f, TOLERANCE);
+	CHECK(Hit.TriangleIndex == -1);
+
+	// 선분이 벽까지 닿지 않거나 모든 프리미티브를 비껴간다
+	Params = FCollisionQueryParams();
+	CHECK(!SceneQuery.LineTraceSingle(Scene.Level, TRACE_START, FVector(5.0f, 0.2f, 0.3f), Hit, Params));
+	CHECK(!SceneQuery.LineTraceSingle(Scene.Level, FVector(0.0f, 5.0f, 0.0f), FVector(30.0f, 5.0f, 0.0f), Hit, Params));
+}
+
+TEST_CASE(SceneQuery_LineTraceTest)
+{
+	FSceneQueryTestLevel Scene;
+	FSceneQuery SceneQuery;
+	FCollisionQueryParams Params;
+
+	CHECK(SceneQuery.LineTraceTest(Scene.Level, TRACE_START, TRACE_END, Params));
+	CHECK(!SceneQuery.LineTraceTest(Scene.Level, TRACE_START, FVector(5.0f, 0.2f, 0.3f), Params));
+	CHECK(!SceneQuery.LineTraceTest(Scene.Level, FVector(0.0f, 5.0f, 0.0f), FVector(30.0f, 5.0f, 0.0f), Params));
+
+	Params.IgnoredComponents = { Scene.WallA, Scene.Mover, Scene.WallB };
+	CHECK(!SceneQuery.LineTraceTest(Scene.Level, TRACE_START, TRACE_END, Params));
+}
+
+TEST_CASE(SceneQuery_LineTraceAfterMove)
+{
+	FSceneQueryTestLevel Scene;
+	FSceneQuery SceneQuery;
+	FCollisionQueryParams Params;
+	FHitResult Hit;
+
+	CHECK(SceneQuery.LineTraceSingle(Scene.Level, TRACE_START, TRACE_END, Hit, Params));
+	CHECK(Hit.Component == Scene.WallA);
+
+	// 트랜스폼만 바뀌면 TLAS는 다시 빌드하지 않고 바운딩 박스만 갱신한다
+	Scene.WallA->SetRelativeLocation(FVector(5.0f, 0.0f, 0.0f));
+	Scene.Level->UpdatePrimitiveInOctree(Scene.WallA);
+	CHECK(SceneQuery.LineTraceSingle(Scene.Level, TRACE_START, TRACE_END, Hit, Params));
+	CHECK(Hit.Component == Scene.WallA);
+	CHECK_NEAR(Hit.Distance, 4.5f, TOLERANCE);
+
+	// 벽을 선분 밖으로 치우면 다음 프리미티브가 맞는다
+	Scene.WallA->SetRelativeLocation(FVector(10.0f, 30.0f, 0.0f));
+	Scene.Level->UpdatePrimitiveInOctree(Scene.WallA);
+	CHECK(SceneQuery.LineTraceSingle(Scene.Level, TRACE_START, TRACE_END, Hit, Params));
+	CHECK(Hit.Component == Scene.Mover);
+	CHECK_NEAR(Hit.Distance, 14.5f, TOLERANCE);
+}
+
+TEST_CASE(SceneQuery_LineTraceMulti)
+{
+	FSceneQueryTestLevel Scene;
+	FSceneQuery SceneQuery;
+	FCollisionQueryParams Params;
+	TArray<FHitResult> Hits;
+
+	CHECK(SceneQuery.LineTraceMulti(Scene.Level, TRACE_START, TRACE_END, Hits, Params));
+	CHECK(Hits.size() == 3);
+	if (Hits.size() == 3)
+	{
+		CHECK(Hits[0].Component == Scene.WallA);
+		CHECK(Hits[1].Component == Scene.Mover);
+		CHECK(Hits[2].Component == Scene.WallB);
+		CHECK_NEAR(Hits[0].Distance, 9.5f, TOLERANCE);
+		CHECK_NEAR(Hits[1].Distance, 14.5f, TOLERANCE);
+		CHECK_NEAR(Hits[2].Distance, 19.5f, TOLERANCE);
+	}
+
+	// 숨긴 프리미티브도 검사하면 거리 순서 사이에 끼어든다
+	Params.bVisibleOnly = false;
+	CHECK(SceneQuery.LineTraceMulti(Scene.Level, TRACE_START, TRACE_END, Hits, Params));
+	CHECK(Hits.size() == 4);
+	if (Hits.size() == 4)
+	{
+		CHECK(Hits[1].Component == Scene.Hidden);
+		CHECK_NEAR(Hits[1].Distance, 11.5f, TOLERANCE);
+	}
+
+	Params = FCollisionQueryParams();
+	CHECK(!SceneQuery.LineTraceMulti(Scene.Level, FVector(0.0f, 5.0f, 0.0f), FVector(30.0f, 5.0f, 0.0f), Hits, Params));
+	CHECK(Hits.empty());
+}
+
+TEST_CASE(SceneQuery_Filters)
+{
+	FSceneQueryTestLevel Scene;
+	FSceneQuery SceneQuery;
+	FHitResult Hit;
+	TArray<FHitResult> Hits;
+
+	{
+		FCollisionQueryParams Params;
+		Params.ObjectTypes = static_cast<uint8>(EQueryObjectType::Static);
+		CHECK(SceneQuery.LineTraceMulti(Scene.Level, TRACE_START, TRACE_END, Hits, Params));
+		CHECK(Hits.size() == 2);
+		if (Hits.size() == 2)
+		{
+			CHECK(Hits[0].Component == Scene.WallA);
+			CHECK(Hits[1].Component == Scene.WallB);
+		}
+	}
+	{
+		FCollisionQueryParams Params;
+		Params.ObjectTypes = static_cast<uint8>(EQueryObjectType::Dynamic);
+		CHECK(SceneQuery.LineTraceSingle(Scene.Level, TRACE_START, TRACE_END, Hit, Params));
+		CHECK(Hit.Component == Scene.Mover);
+		CHECK_NEAR(Hit.Distance, 14.5f, TOLERANCE);
+	}
+	{
+		FCollisionQueryParams Params;
+		Params.ObjectTypes = static_cast<uint8>(EQueryObjectType::None);
+		CHECK(!SceneQuery.LineTraceSingle(Scene.Level, TRACE_START, TRACE_END, Hit, Params));
+	}
+	{
+		FCollisionQueryParams Params;
+		Params.IgnoredComponents.push_back(Scene.WallA);
+		CHECK(SceneQuery.LineTraceSingle(Scene.Level, TRACE_START, TRACE_END, Hit, Params));
+		CHECK(Hit.Component == Scene.Mover);
+	}
+	{
+		FCollisionQueryParams Params;
+		Params.IgnoredActors = { Scene.ActorA, Scene.ActorMover };
+		CHECK(SceneQuery.LineTraceSingle(Scene.Level, TRACE_START, TRACE_END, Hit, Params));
+		CHECK(Hit.Component == Scene.WallB);
+	}
+	{
+		FCollisionQueryParams Params;
+		Params.ComponentClass = UTestMarkerBoxComponent::StaticClass();
+		CHECK(SceneQuery.LineTraceSingle(Scene.Level, TRACE_START, TRACE_END, Hit, Params));
+		CHECK(Hit.Component == Scene.Mover);
+	}
+	{
+		FCollisionQueryParams Params;
+		Params.ActorClass = ATestQueryActor::StaticClass();
+		CHECK(SceneQuery.LineTraceSingle(Scene.Level, TRACE_START, TRACE_END, Hit, Params));
+		CHECK(Hit.Component == Scene.WallB);
+		CHECK(Hit.Actor == Scene.ActorB);
+	}
+}
+
+TEST_CASE(SceneQuery_ObjectTypesFollowMobility)
+{
+	FSceneQueryTestLevel Scene;
+	FSceneQuery SceneQuery;
+	FCollisionQueryParams Params;
+	FHitResult Hit;
+	TArray<UPrimitiveComponent*> Overlaps;
+	const FAABB QueryBox(FVector(9.0f, -1.0f, -1.0f), FVector(16.0f, 1.0f, 1.0f));
+
+	// Static 벽을 옮기면 DynamicTree로 넘어가지만 채널은 그대로 Static이다
+	Scene.WallA->SetRelativeLocation(FVector(1000.0f, 0.0f, 0.0f));
+	Scene.Level->UpdatePrimitiveInOctree(Scene.WallA);
+	Scene.WallA->SetRelativeLocation(FVector(10.0f, 0.0f, 0.0f));
+	Scene.Level->UpdatePrimitiveInOctree(Scene.WallA);
+	CHECK(Scene.WallA->GetOctreeNode() == nullptr);
+
+	Params.ObjectTypes = static_cast<uint8>(EQueryObjectType::Static);
+	CHECK(SceneQuery.OverlapAABB(Scene.Level, QueryBox, Overlaps, Params));
+	CHECK(ContainsExactly(Overlaps, { Scene.WallA }));
+	CHECK(SceneQuery.LineTraceSingle(Scene.Level, TRACE_START, TRACE_END, Hit, Params));
+	CHECK(Hit.Component == Scene.WallA);
+
+	// 새로 등록한 Movable 프리미티브는 StaticOctree에 들어가도 Dynamic이다
+	AActor* SpawnedOwner = nullptr;
+	UTestBoxComponent* Spawned = Scene.AddBox<AActor, UTestBoxComponent>(FVector(13.0f, 0.0f, 0.0f), FVector(1.0f, 1.0f, 1.0f), SpawnedOwner);
+	Spawned->SetMobility(EComponentMobility::Movable);
+	CHECK(Spawned->GetOctreeNode() != nullptr);
+
+	Params.ObjectTypes = static_cast<uint8>(EQueryObjectType::Dynamic);
+	CHECK(SceneQuery.OverlapAABB(Scene.Level, QueryBox, Overlaps, Params));
+	CHECK(ContainsExactly(Overlaps, { Spawned, Scene.Mover }));
+	CHECK(SceneQuery.LineTraceSingle(Scene.Level, TRACE_START, TRACE_END, Hit, Params));
+	CHECK(Hit.Component == Spawned);
+	CHECK_NEAR(Hit.Distance, 12.5f, TOLERANCE);
+
+	Params.ObjectTypes = static_cast<uint8>(EQueryObjectType::Static);
+	CHECK(SceneQuery.OverlapAABB(Scene.Level, QueryBox, Overlaps, Params));
+	CHECK(ContainsExactly(Overlaps, { Scene.WallA }));
+}
+
+TEST_CASE(SceneQuery_OverlapAABB)
+{
+	FSceneQueryTestLevel Scene;
+	FSceneQuery SceneQuery;
+	FCollisionQueryParams Params;
+	TArray<UPrimitiveComponent*> Overlaps;
+	const FAABB QueryBox(FVector(9.0f, -1.0f, -1.0f), FVector(16.0f, 1.0f, 1.0f));
+
+	CHECK(SceneQuery.OverlapAABB(Scene.Level, QueryBox, Overlaps, Params));
+	CHECK(ContainsExactly(Overlaps, { Scene.WallA, Scene.Mover }));
+
+	Params.bVisibleOnly = false;
+	CHECK(SceneQuery.OverlapAABB(Scene.Level, QueryBox, Overlaps, Params));
+	CHECK(ContainsExactly(Overlaps, { Scene.WallA, Scene.Hidden, Scene.Mover }));
+
+	Params = FCollisionQueryParams();
+	Params.ObjectTypes = static_cast<uint8>(EQueryObjectType::Static);
+	CHECK(SceneQuery.OverlapAABB(Scene.Level, QueryBox, Overlaps, Params));
+	CHECK(ContainsExactly(Overlaps, { Scene.WallA }));
+
+	Params.ObjectTypes = static_cast<uint8>(EQueryObjectType::Dynamic);
+	CHECK(SceneQuery.OverlapAABB(Scene.Level, QueryBox, Overlaps, Params));
+	CHECK(ContainsExactly(Overlaps, { Scene.Mover }));
+
+	Params = FCollisionQueryParams();
+	CHECK(!SceneQuery.OverlapAABB(Scene.Level, FAABB(FVector(-5.0f, -5.0f, -5.0f), FVector(-1.0f, -1.0f, -1.0f)), Overlaps, Params));
+	CHECK(Overlaps.empty());
+}
+
+TEST_CASE(SceneQuery_OverlapSphere)
+{
+	FSceneQueryTestLevel Scene;
+	FSceneQuery SceneQuery;
+	FCollisionQueryParams Params;
+	TArray<UPrimitiveComponent*> Overlaps;
+	const FVector Center(15.0f, 0.0f, 0.0f);
+
+	// 두 벽의 가까운 면은 중심에서 4.5 떨어져 있다
+	CHECK(SceneQuery.OverlapSphere(Scene.Level, Center, 4.6f, Overlaps, Params));
+	CHECK(ContainsExactly(Overlaps, { Scene.WallA, Scene.Mover, Scene.WallB }));
+
+	CHECK(SceneQuery.OverlapSphere(Scene.Level, Center, 4.4f, Overlaps, Params));
+	CHECK(ContainsExactly(Overlaps, { Scene.Mover }));
+
+	Params.IgnoredComponents.push_back(Scene.Mover);
+	CHECK(!SceneQuery.OverlapSphere(Scene.Level, Center, 4.4f, Overlaps, Params));
+	CHECK(Overlaps.empty());
+}
+
+TEST_CASE(SceneQuery_OverlapOBB)
+{
+	FSceneQueryTestLevel Scene;
+	FSceneQuery SceneQuery;
+	FCollisionQueryParams Params;
+	TArray<UPrimitiveComponent*> Overlaps;
+	const FVector Center(15.0f, 0.0f, 0.0f);
+	const FVector Extents(6.0f, 0.25f, 0.25f);
+
+	// X축으로 긴 막대는 세 프리미티브를 모두 지난다
+	CHECK(SceneQuery.OverlapOBB(Scene.Level, FOBB(Center, Extents, FMatrix::Identity()), Overlaps, Params));
+	CHECK(ContainsExactly(Overlaps, { Scene.WallA, Scene.Mover, Scene.WallB }));
+
+	// Z축으로 90도 돌리면 Y축으로 누워 가운데 큐브만 지난다
+	CHECK(SceneQuery.OverlapOBB(Scene.Level, FOBB(Center, Extents, FMatrix::RotationZ(PI * 0.5f)), Overlaps, Params));
+	CHECK(ContainsExactly(Overlaps, { Scene.Mover }));
+}
+
+TEST_CASE(SceneQuery_OverlapFrustum)
+{
+	FSceneQueryTestLevel Scene;
+	FSceneQuery SceneQuery;
+	FCollisionQueryParams Params;
+	TArray<UPrimitiveComponent*> Overlaps;
+
+	// WallA는 절두체 경계에 걸치고, Mover는 완전히 안에 들어온다
+	const FFrustum Frustum = MakeBoxFrustum(FVector(9.0f, -1.0f, -1.0f), FVector(16.0f, 1.0f, 1.0f));
+
+	CHECK(SceneQuery.OverlapFrustum(Scene.Level, Frustum, EFrustumOverlapMode::BoundsIntersect, Overlaps, Params));
+	CHECK(ContainsExactly(Overlaps, { Scene.WallA, Scene.Mover }));
+
+	CHECK(SceneQuery.OverlapFrustum(Scene.Level, Frustum, EFrustumOverlapMode::BoundsContain, Overlaps, Params));
+	CHECK(ContainsExactly(Overlaps, { Scene.Mover }));
+
+	CHECK(SceneQuery.OverlapFrustum(Scene.Level, Frustum, EFrustumOverlapMode::TriangleIntersect, Overlaps, Params));
+	CHECK(ContainsExactly(Overlaps, { Scene.WallA, Scene.Mover }));
+
+	CHECK(SceneQuery.OverlapFrustum(Scene.Level, Frustum, EFrustumOverlapMode::TriangleContain, Overlaps, Params));
+	CHECK(ContainsExactly(Overlaps, { Scene.Mover }));
+
+	Params.bVisibleOnly = false;
+	CHECK(SceneQuery.OverlapFrustum(Scene.Level, Frustum, EFrustumOverlapMode::BoundsContain, Overlaps, Params));
+	CHECK(ContainsExactly(Overlaps, { Scene.Hidden, Scene.Mover }));
+
+	Params = FCollisionQueryParams();
+	Params.ObjectTypes = static_cast<uint8>(EQueryObjectType::Static);
+	CHECK(SceneQuery.OverlapFrustum(Scene.Level, Frustum, EFrustumOverlapMode::BoundsIntersect, Overlaps, Params));
+	CHECK(ContainsExactly(Overlaps, { Scene.WallA }));
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+/**
+ * @brief 렌더러 없이 엔진 코드를 검사하는 최소 테스트 하네스 (EngineTest 프로젝트)
+ * TEST_CASE로 정의한 함수는 정적 초기화 때 등록되고, TestMain이 이름 순서대로 실행한다.
+ * CHECK는 실패해도 테스트를 멈추지 않고 위치와 식을 출력한 뒤 실패 수만 늘린다.
+ */
+class FTestRegistry
+{
+public:
+	using FTestFunction = void(*)();
+
+	struct FTestCase
+	{
+		const char* Name;
+		FTestFunction Function;
+	};
+
+	static TArray<FTestCase>& GetTestCases()
+	{
+		static TArray<FTestCase> TestCases;
+		return TestCases;
+	}
+
+	static uint32& GetFailureCount()
+	{
+		static uint32 FailureCount = 0;
+		return FailureCount;
+	}
+
+	static void ReportFailure(const char* InFile, int32 InLine, const char* InExpression)
+	{
+		printf("  FAILED %s(%d): %s\n", InFile, InLine, InExpression);
+		++GetFailureCount();
+	}
+};
+
+struct FTestRegistrar
+{
+	FTestRegistrar(const char* InName, FTestRegistry::FTestFunction InFunction)
+	{
+		FTestRegistry::GetTestCases().push_back({ InName, InFunction });
+	}
+};
+
+#define TEST_CASE(TestName) \
+	static void TestName(); \
+	static FTestRegistrar TestName##Registrar(#TestName, &TestName); \
+	static void TestName()
+
+#define CHECK(Expression) \
+	do { \
+		if (!(Expression)) { FTestRegistry::ReportFailure(__FILE__, __LINE__, #Expression); } \
+	} while (0)
+
+#define CHECK_NEAR(Value, Expected, Tolerance) \
+	CHECK(std::abs((Value) - (Expected)) <= (Tolerance))
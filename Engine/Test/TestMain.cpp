@@ -0,0 +1,42 @@
+#include "pch.h"
+#include "TestFramework.h"
+
+/**
+ * @brief 등록된 테스트를 모두 실행한다. 인자를 주면 이름에 그 문자열이 들어간 테스트만 실행한다.
+ * @return 실패한 CHECK가 하나라도 있으면 1
+ */
+int main(int argc, char* argv[])
+{
+	const char* Filter = argc > 1 ? argv[1] : nullptr;
+
+	TArray<FTestRegistry::FTestCase> TestCases = FTestRegistry::GetTestCases();
+	std::sort(TestCases.begin(), TestCases.end(), [](const FTestRegistry::FTestCase& A, const FTestRegistry::FTestCase& B)
+	{
+		return strcmp(A.Name, B.Name) < 0;
+	});
+
+	uint32 RunCount = 0;
+	uint32 FailedTestCount = 0;
+	for (const FTestRegistry::FTestCase& TestCase : TestCases)
+	{
+		if (Filter && !strstr(TestCase.Name, Filter))
+		{
+			continue;
+		}
+
+		printf("[ RUN  ] %s\n", TestCase.Name);
+		const uint32 FailuresBefore = FTestRegistry::GetFailureCount();
+		TestCase.Function();
+		const bool bPassed = FTestRegistry::GetFailureCount() == FailuresBefore;
+		printf("[ %s ] %s\n", bPassed ? " OK " : "FAIL", TestCase.Name);
+
+		++RunCount;
+		if (!bPassed)
+		{
+			++FailedTestCount;
+		}
+	}
+
+	printf("%u tests, %u failed\n", RunCount, FailedTestCount);
+	return FailedTestCount == 0 && RunCount > 0 ? 0 : 1;
+}
@@ -4,8 +4,7 @@
 int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int nShowCmd)
 {
     UNREFERENCED_PARAMETER(hPrevInstance);
-    UNREFERENCED_PARAMETER(lpCmdLine);
 
     FClientApp Client;
-    return Client.Run(hInstance, nShowCmd);
+    return Client.Run(hInstance, nShowCmd, lpCmdLine);
 }